@@ -102,7 +102,10 @@ class PyFunctionCost : public Cost {
                  const std::string& description)
       : Cost(num_vars, description),
         double_func_(py::cast<DoubleFunc>(func)),
-        autodiff_func_(py::cast<AutoDiffFunc>(func)) {}
+        autodiff_func_(py::cast<AutoDiffFunc>(func)) {
+    // Calling back into Python requires the GIL.
+    set_is_thread_safe(false);
+  }
 
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
@@ -131,7 +134,10 @@ class PyFunctionConstraint : public Constraint {
                        const std::string& description)
       : Constraint(lb.size(), num_vars, lb, ub, description),
         double_func_(py::cast<DoubleFunc>(func)),
-        autodiff_func_(py::cast<AutoDiffFunc>(func)) {}
+        autodiff_func_(py::cast<AutoDiffFunc>(func)) {
+    // Calling back into Python requires the GIL.
+    set_is_thread_safe(false);
+  }
 
  protected:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
@@ -186,7 +192,8 @@ PYBIND11_MODULE(_mathematicalprogram_py, m) {
       .value("kMobyLCP", SolverType::kMobyLCP)
       .value("kMosek", SolverType::kMosek)
       .value("kNlopt", SolverType::kNlopt)
-      .value("kSnopt", SolverType::kSnopt);
+      .value("kSnopt", SolverType::kSnopt)
+      .value("kActiveSetQP", SolverType::kActiveSetQP);
 
   py::class_<MathematicalProgram> prog_cls(m, "MathematicalProgram");
   prog_cls.def(py::init<>())
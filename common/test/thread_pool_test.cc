@@ -0,0 +1,94 @@
+#include "drake/common/thread_pool.h"
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ThreadPoolTest, RunsEachTaskOnItsOwnThread) {
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4);
+  const std::thread::id calling_thread = std::this_thread::get_id();
+  std::set<std::thread::id> first_workers;
+  // The worker threads are reused across calls.
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    for (int num_tasks = 0; num_tasks <= 4; ++num_tasks) {
+      std::vector<int> num_calls(4, 0);
+      std::vector<std::thread::id> threads(4);
+      pool.Run(num_tasks, [&](int k) {
+        ++num_calls[k];
+        threads[k] = std::this_thread::get_id();
+      });
+      for (int k = 0; k < 4; ++k) {
+        EXPECT_EQ(num_calls[k], k < num_tasks ? 1 : 0);
+      }
+      if (num_tasks > 0) {
+        EXPECT_EQ(threads[0], calling_thread);
+      }
+      if (num_tasks == 4) {
+        const std::set<std::thread::id> workers(threads.begin() + 1,
+                                                threads.end());
+        EXPECT_EQ(workers.size(), 3u);
+        EXPECT_EQ(workers.count(calling_thread), 0u);
+        if (first_workers.empty()) {
+          first_workers = workers;
+        }
+        EXPECT_EQ(workers, first_workers);
+      }
+    }
+  }
+}
+
+GTEST_TEST(ThreadPoolTest, RethrowsExceptions) {
+  ThreadPool pool(3);
+  for (int throwing_task : {0, 2}) {
+    EXPECT_THROW(pool.Run(3, [&](int k) {
+                   if (k == throwing_task) {
+                     throw std::runtime_error("task failed");
+                   }
+                 }),
+                 std::runtime_error);
+  }
+  // The pool remains usable afterwards.
+  std::atomic<int> num_calls{0};
+  pool.Run(3, [&](int) { ++num_calls; });
+  EXPECT_EQ(num_calls, 3);
+
+  EXPECT_THROW(ThreadPool(0), std::runtime_error);
+}
+
+// Calls to Run() from several threads are serialized.
+GTEST_TEST(ThreadPoolTest, ConcurrentCallers) {
+  ThreadPool pool(2);
+  std::atomic<int> num_running{0};
+  std::atomic<int> max_num_running{0};
+  std::atomic<int> num_calls{0};
+  auto run = [&]() {
+    for (int repeat = 0; repeat < 50; ++repeat) {
+      pool.Run(2, [&](int) {
+        const int running = ++num_running;
+        int expected = max_num_running;
+        while (running > expected &&
+               !max_num_running.compare_exchange_weak(expected, running)) {}
+        ++num_calls;
+        --num_running;
+      });
+    }
+  };
+  std::thread other_caller(run);
+  run();
+  other_caller.join();
+  EXPECT_EQ(num_calls, 200);
+  EXPECT_LE(max_num_running, 2);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
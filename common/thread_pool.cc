@@ -0,0 +1,103 @@
+#include "drake/common/thread_pool.h"
+
+#include <stdexcept>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads) : num_threads_(num_threads) {
+  if (num_threads < 1) {
+    throw std::runtime_error(
+        "ThreadPool: the number of threads must be at least 1.");
+  }
+  workers_.reserve(num_threads - 1);
+  for (int k = 0; k < num_threads - 1; ++k) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, k);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::WorkerLoop(int worker_index) {
+  int64_t last_generation = 0;
+  while (true) {
+    const std::function<void(int)>* task{};
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [&]() {
+        return stop_ || generation_ != last_generation;
+      });
+      if (stop_) {
+        return;
+      }
+      last_generation = generation_;
+      // The worker k runs the task k + 1, if there is one.
+      if (worker_index >= num_worker_tasks_) {
+        continue;
+      }
+      task = task_;
+    }
+    std::exception_ptr exception;
+    try {
+      (*task)(worker_index + 1);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (exception && !exception_) {
+      exception_ = exception;
+    }
+    if (--num_pending_ == 0) {
+      done_.notify_one();
+    }
+  }
+}
+
+void ThreadPool::Run(int num_tasks, const std::function<void(int)>& task) {
+  DRAKE_DEMAND(num_tasks >= 0 && num_tasks <= num_threads_);
+  if (num_tasks == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_worker_tasks_ = num_tasks - 1;
+    num_pending_ = num_tasks - 1;
+    exception_ = nullptr;
+    ++generation_;
+  }
+  if (num_tasks > 1) {
+    start_.notify_all();
+  }
+  std::exception_ptr exception;
+  try {
+    task(0);
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this]() { return num_pending_ == 0; });
+  task_ = nullptr;
+  if (!exception) {
+    exception = exception_;
+  }
+  exception_ = nullptr;
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+/*
+ * A fixed set of worker threads, created once and reused by every call to
+ * Run(), so that code running a parallel loop many times, for instance at
+ * each solver iteration or at each kinematics pass, does not pay for a thread
+ * creation per loop.
+ *
+ * Run() may be called concurrently from several threads, in which case the
+ * calls are serialized. A task must not call Run() on the pool running it.
+ */
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+  /*
+   * Creates a pool running the tasks on `num_threads` threads, the calling
+   * thread of Run() included, and hence num_threads - 1 worker threads.
+   * @throws std::runtime_error if num_threads < 1.
+   */
+  explicit ThreadPool(int num_threads);
+
+  /* Stops and joins the worker threads. */
+  ~ThreadPool();
+
+  int num_threads() const { return num_threads_; }
+
+  /*
+   * Calls `task(k)` for each k in [0, num_tasks), the task 0 on the calling
+   * thread and the task k on the k-th worker thread, and returns once all the
+   * tasks have finished. An exception thrown by a task is rethrown then.
+   * @pre 0 <= num_tasks <= num_threads().
+   */
+  void Run(int num_tasks, const std::function<void(int)>& task);
+
+ private:
+  void WorkerLoop(int worker_index);
+
+  const int num_threads_;
+  std::vector<std::thread> workers_;
+  // Held for the whole duration of a Run(), so that concurrent calls do not
+  // interleave their tasks.
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  // Notified when a new Run() starts or when the pool is stopped.
+  std::condition_variable start_;
+  // Notified when the last worker task of a Run() finishes.
+  std::condition_variable done_;
+  // Incremented by each Run(), so that a worker runs each of them once.
+  int64_t generation_{0};
+  int num_worker_tasks_{0};
+  int num_pending_{0};
+  const std::function<void(int)>* task_{nullptr};
+  std::exception_ptr exception_;
+  bool stop_{false};
+};
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <bitset>
+
+namespace drake {
+namespace geometry {
+
+/** The maximum number of collision filter groups. */
+constexpr int kMaxNumCollisionFilterGroups = 128;
+
+/** A set of collision filter groups, represented as a bitmask where the iᵗʰ
+ bit is set if group i belongs to the set. Each geometry _belongs_ to a set of
+ groups and _ignores_ a set of groups. A pair of geometries is filtered if
+ either geometry belongs to a group ignored by the other. By default, every
+ geometry belongs to group 0 and ignores no group; see
+ @ref collision_filter_group for the analogous concept in RigidBodyTree. */
+using CollisionFilterGroupMask = std::bitset<kMaxNumCollisionFilterGroups>;
+
+}  // namespace geometry
+}  // namespace drake
@@ -25,6 +25,26 @@ using std::to_string;
 
 //-----------------------------------------------------------------------------
 
+namespace {
+
+// Reports true if the pose `X_new` is bitwise identical to `X_old`, in which
+// case none of the quantities derived from it need to be recomputed.
+bool IsPoseUnchanged(const Isometry3<double>& X_old,
+                     const Isometry3<double>& X_new) {
+  return X_old.matrix() == X_new.matrix();
+}
+
+// For AutoDiffXd, equal values do not imply equal derivatives. We therefore
+// always report a change.
+bool IsPoseUnchanged(const Isometry3<AutoDiffXd>&,
+                     const Isometry3<AutoDiffXd>&) {
+  return false;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 // These utility methods help streamline the desired semantics of map lookups.
 // We want to search for a key and throw an exception (with a meaningful
 // message) if not found.
@@ -224,6 +244,7 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   PoseIndex pose_index(X_PF_.size());
   X_PF_.emplace_back(frame.pose());
   X_WF_.emplace_back(Isometry3<double>::Identity());
+  frame_pose_is_stale_.push_back(true);
   DRAKE_ASSERT(pose_index == static_cast<int>(pose_index_to_frame_map_.size()));
   pose_index_to_frame_map_.push_back(frame_id);
   f_set.insert(frame_id);
@@ -264,6 +285,8 @@ GeometryId GeometryState<T>::RegisterGeometry(
 
   // Configure topology.
   frames_[frame_id].add_child(geometry_id);
+  // The world pose of the new geometry is computed on the next pose update.
+  frame_pose_is_stale_[frames_[frame_id].get_pose_index()] = true;
   // TODO(SeanCurtis-TRI): Get name from geometry instance (when available).
   geometries_.emplace(
       geometry_id,
@@ -399,6 +422,81 @@ const FrameIdSet& GeometryState<T>::GetFramesForSource(
   return GetValueOrThrow(source_id, source_frame_id_map_);
 }
 
+template <typename T>
+void GeometryState<T>::ExcludeCollisionsBetween(GeometryId id_A,
+                                                GeometryId id_B) {
+  const bool A_is_dynamic = is_dynamic(id_A);
+  const bool B_is_dynamic = is_dynamic(id_B);
+  if (A_is_dynamic && B_is_dynamic) {
+    geometry_engine_->ExcludeCollisionsBetween(
+        geometries_.at(id_A).get_engine_index(),
+        geometries_.at(id_B).get_engine_index());
+  } else if (A_is_dynamic || B_is_dynamic) {
+    const GeometryId dynamic_id = A_is_dynamic ? id_A : id_B;
+    const GeometryId anchored_id = A_is_dynamic ? id_B : id_A;
+    geometry_engine_->ExcludeCollisionsBetween(
+        geometries_.at(dynamic_id).get_engine_index(),
+        GetValueOrThrow(anchored_id, anchored_geometries_).get_engine_index());
+  } else {
+    // Pairs of anchored geometries are always excluded; only confirm the ids.
+    GetValueOrThrow(id_A, anchored_geometries_);
+    GetValueOrThrow(id_B, anchored_geometries_);
+  }
+}
+
+template <typename T>
+void GeometryState<T>::ExcludeCollisionsBetween(FrameId frame_A,
+                                                FrameId frame_B) {
+  const auto& geometries_A =
+      GetValueOrThrow(frame_A, frames_).get_child_geometries();
+  const auto& geometries_B =
+      GetValueOrThrow(frame_B, frames_).get_child_geometries();
+  for (GeometryId id_A : geometries_A) {
+    const GeometryIndex index_A = geometries_.at(id_A).get_engine_index();
+    for (GeometryId id_B : geometries_B) {
+      const GeometryIndex index_B = geometries_.at(id_B).get_engine_index();
+      if (index_A != index_B) {
+        geometry_engine_->ExcludeCollisionsBetween(index_A, index_B);
+      }
+    }
+  }
+}
+
+template <typename T>
+void GeometryState<T>::AssignCollisionFilterGroups(
+    GeometryId id, const CollisionFilterGroupMask& groups,
+    const CollisionFilterGroupMask& ignored) {
+  if (is_dynamic(id)) {
+    geometry_engine_->AssignCollisionFilterGroups(
+        geometries_.at(id).get_engine_index(), groups, ignored);
+  } else {
+    geometry_engine_->AssignCollisionFilterGroups(
+        GetValueOrThrow(id, anchored_geometries_).get_engine_index(), groups,
+        ignored);
+  }
+}
+
+template <typename T>
+bool GeometryState<T>::CollisionFiltered(GeometryId id_A,
+                                         GeometryId id_B) const {
+  const bool A_is_dynamic = is_dynamic(id_A);
+  const bool B_is_dynamic = is_dynamic(id_B);
+  if (A_is_dynamic && B_is_dynamic) {
+    return geometry_engine_->CollisionFiltered(
+        geometries_.at(id_A).get_engine_index(),
+        geometries_.at(id_B).get_engine_index());
+  } else if (A_is_dynamic || B_is_dynamic) {
+    const GeometryId dynamic_id = A_is_dynamic ? id_A : id_B;
+    const GeometryId anchored_id = A_is_dynamic ? id_B : id_A;
+    return geometry_engine_->CollisionFiltered(
+        geometries_.at(dynamic_id).get_engine_index(),
+        GetValueOrThrow(anchored_id, anchored_geometries_).get_engine_index());
+  }
+  GetValueOrThrow(id_A, anchored_geometries_);
+  GetValueOrThrow(id_B, anchored_geometries_);
+  return true;
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
@@ -411,7 +509,8 @@ void GeometryState<T>::SetFramePoses(const FrameIdVector& ids,
   ValidateFramePoses(ids, poses);
   const Isometry3<T> world_pose = Isometry3<T>::Identity();
   for (auto frame_id : source_root_frame_map_[ids.get_source_id()]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, ids, poses);
+    UpdatePosesRecursively(frames_[frame_id], world_pose,
+                           false /* parent_moved */, ids, poses);
   }
 }
 
@@ -463,37 +562,48 @@ SourceId GeometryState<T>::get_source_id(FrameId frame_id) const {
 template <typename T>
 void GeometryState<T>::UpdatePosesRecursively(
     const internal::InternalFrame& frame, const Isometry3<T>& X_WP,
-    const FrameIdVector& ids, const FramePoseVector<T>& poses) {
+    bool parent_moved, const FrameIdVector& ids,
+    const FramePoseVector<T>& poses) {
   const auto frame_id = frame.get_id();
   int index = ids.GetIndex(frame_id);
   const auto& X_PF = poses.vector().at(index);
-  // Cache this transform for later use.
-  X_PF_[frame.get_pose_index()] = X_PF;
-  Isometry3<T> X_WF = X_WP * X_PF;
-  // TODO(SeanCurtis-TRI): Replace this when we have a transform object that
-  // allows proper multiplication between an AutoDiff type and a double type.
-  // For now, it allows me to perform the multiplication by multiplying the
-  // fully-defined transformation (with [0 0 0 1] on the bottom row).
-  X_WF.makeAffine();
-  X_WF_[frame.get_pose_index()] = X_WF;
-
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.get_child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    auto child_index = child_geometry.get_engine_index();
-    // TODO(SeanCurtis-TRI): See note above about replacing this when we have a
-    // transform that supports autodiff * double.
-    X_FG_[child_index].makeAffine();
-    // TODO(SeanCurtis-TRI): These matrix() shennigans are here because I can't
-    // assign a an Isometry3<double> to an Isometry3<AutoDiffXd>. Replace this
-    // when I can.
-    X_WG_[child_index].matrix() = X_WF.matrix() * X_FG_[child_index].matrix();
+  const PoseIndex pose_index = frame.get_pose_index();
+  const bool moved = parent_moved || frame_pose_is_stale_[pose_index] ||
+      !IsPoseUnchanged(X_PF_[pose_index], X_PF);
+
+  if (moved) {
+    // Cache this transform for later use.
+    X_PF_[pose_index] = X_PF;
+    Isometry3<T> X_WF = X_WP * X_PF;
+    // TODO(SeanCurtis-TRI): Replace this when we have a transform object that
+    // allows proper multiplication between an AutoDiff type and a double type.
+    // For now, it allows me to perform the multiplication by multiplying the
+    // fully-defined transformation (with [0 0 0 1] on the bottom row).
+    X_WF.makeAffine();
+    X_WF_[pose_index] = X_WF;
+    frame_pose_is_stale_[pose_index] = false;
+
+    // Update the geometry which belong to *this* frame.
+    for (auto child_id : frame.get_child_geometries()) {
+      auto& child_geometry = geometries_[child_id];
+      auto child_index = child_geometry.get_engine_index();
+      // TODO(SeanCurtis-TRI): See note above about replacing this when we have
+      // a transform that supports autodiff * double.
+      X_FG_[child_index].makeAffine();
+      // TODO(SeanCurtis-TRI): These matrix() shennigans are here because I
+      // can't assign a an Isometry3<double> to an Isometry3<AutoDiffXd>.
+      // Replace this when I can.
+      X_WG_[child_index].matrix() =
+          X_WF.matrix() * X_FG_[child_index].matrix();
+      dirty_geometry_indices_.push_back(child_index);
+    }
   }
 
-  // Update each child frame.
+  // Update each child frame. Frames that did not move still need to visit
+  // their children since those might have moved relative to them.
   for (auto child_id : frame.get_child_frames()) {
     auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, ids, poses);
+    UpdatePosesRecursively(child_frame, X_WF_[pose_index], moved, ids, poses);
   }
 }
 
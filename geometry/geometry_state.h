@@ -10,6 +10,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
+#include "drake/geometry/collision_filter_groups.h"
 #include "drake/geometry/frame_id_vector.h"
 #include "drake/geometry/frame_kinematics_vector.h"
 #include "drake/geometry/geometry_ids.h"
@@ -325,6 +326,40 @@ class GeometryState {
 
   //@}
 
+  /** @name       Collision filtering
+
+   See GeometrySystem for documentation of these methods. */
+  //@{
+
+  /** Excludes the pair of geometries with the given ids from collision
+   queries. Excluding a pair of anchored geometries has no effect; such pairs
+   are always excluded.
+   @throws std::logic_error if either id does not map to a registered
+                            geometry. */
+  void ExcludeCollisionsBetween(GeometryId id_A, GeometryId id_B);
+
+  /** Excludes all pairs formed by a geometry affixed to frame A and a geometry
+   affixed to frame B from collision queries. If both frames are the same,
+   this excludes all pairs of geometries affixed to that frame. Only the
+   geometries registered at the time of this call are affected.
+   @throws std::logic_error if either id does not map to a registered frame. */
+  void ExcludeCollisionsBetween(FrameId frame_A, FrameId frame_B);
+
+  /** Assigns the collision filter groups the given geometry belongs to and the
+   groups it ignores. See CollisionFilterGroupMask.
+   @throws std::logic_error if `id` does not map to a registered geometry. */
+  void AssignCollisionFilterGroups(GeometryId id,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored);
+
+  /** Reports true if the pair of geometries with the given ids is excluded
+   from collision queries.
+   @throws std::logic_error if either id does not map to a registered
+                            geometry. */
+  bool CollisionFiltered(GeometryId id_A, GeometryId id_B) const;
+
+  //@}
+
   /** @name       Relationship queries
 
    Various methods that map identifiers for one type of entity to its related
@@ -382,6 +417,22 @@ class GeometryState {
         geometry_index_id_map_, anchored_geometry_index_id_map_);
   }
 
+  /** See QueryObject::ComputeSignedDistancePairwiseClosestPoints() for
+   documentation. */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(double max_distance) const {
+    return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
+        geometry_index_id_map_, anchored_geometry_index_id_map_, max_distance);
+  }
+
+  /** See QueryObject::ComputeNearestGeometryToPoint() for documentation. */
+  optional<SignedDistanceToPoint<double>> ComputeNearestGeometryToPoint(
+      const Vector3<double>& p_WQ, double max_distance) const {
+    return geometry_engine_->ComputeNearestGeometryToPoint(
+        p_WQ, geometry_index_id_map_, anchored_geometry_index_id_map_,
+        max_distance);
+  }
+
   //@}
 
   /** @name Scalar conversion */
@@ -415,6 +466,9 @@ class GeometryState {
         anchored_geometry_index_id_map_(source.anchored_geometry_index_id_map_),
         X_FG_(source.X_FG_),
         pose_index_to_frame_map_(source.pose_index_to_frame_map_),
+        // The derivatives of the converted poses are not tracked by the
+        // source; every frame is updated on the first pose update.
+        frame_pose_is_stale_(source.frame_pose_is_stale_.size(), true),
         geometry_engine_(std::move(source.geometry_engine_->ToAutoDiffXd())) {
     // NOTE: Can't assign Isometry3<double> to Isometry3<AutoDiff>. But we *can*
     // assign Matrix<double> to Matrix<AutoDiff>, so that's what we're doing.
@@ -467,8 +521,13 @@ class GeometryState {
                           const FramePoseVector<T>& poses) const;
 
   // Method that performs any final book-keeping/updating on the state after
-  // _all_ of the state's frames have had their poses updated.
-  void FinalizePoseUpdate() { geometry_engine_->UpdateWorldPoses(X_WG_); }
+  // _all_ of the state's frames have had their poses updated. Only the
+  // geometries whose world poses changed since the last call are pushed to the
+  // engine.
+  void FinalizePoseUpdate() {
+    geometry_engine_->UpdateWorldPoses(X_WG_, dirty_geometry_indices_);
+    dirty_geometry_indices_.clear();
+  }
 
   // Gets the source id for the given frame id. Throws std::logic_error if the
   // frame belongs to no registered source.
@@ -476,9 +535,12 @@ class GeometryState {
 
   // Recursively updates the frame and geometry _pose_ information for the tree
   // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
+  // as `X_WP`. Only the world poses of frames whose pose changed, either
+  // relative to their parent or because `parent_moved` is true, are
+  // recomputed; the engine indices of the affected geometries are recorded in
+  // dirty_geometry_indices_.
   void UpdatePosesRecursively(const internal::InternalFrame& frame,
-                              const Isometry3<T>& X_WP,
+                              const Isometry3<T>& X_WP, bool parent_moved,
                               const FrameIdVector& ids,
                               const FramePoseVector<T>& poses);
 
@@ -558,6 +620,20 @@ class GeometryState {
   //      index of this vector.
   std::vector<FrameId> pose_index_to_frame_map_;
 
+  // ---------------------------------------------------------------------
+  // Book-keeping for incremental pose updates.
+
+  // The iᵗʰ entry is true if the world pose of the frame with pose index i,
+  // or of any of its geometries, has not been computed since the frame or
+  // geometry was registered. Such frames are updated on the next call to
+  // SetFramePoses() even if their poses relative to their parents do not
+  // change.
+  std::vector<bool> frame_pose_is_stale_;
+
+  // The engine indices of the geometries whose world poses X_WG changed since
+  // the last call to FinalizePoseUpdate().
+  std::vector<GeometryIndex> dirty_geometry_indices_;
+
   // ---------------------------------------------------------------------
   // These values depend on time-dependent input values (e.g., current frame
   // poses).
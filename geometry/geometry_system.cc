@@ -198,6 +198,28 @@ GeometryId GeometrySystem<T>::RegisterAnchoredGeometry(
                                                   std::move(geometry));
 }
 
+template <typename T>
+void GeometrySystem<T>::ExcludeCollisionsBetween(GeometryId id_A,
+                                                 GeometryId id_B) {
+  GS_THROW_IF_CONTEXT_ALLOCATED
+  initial_state_->ExcludeCollisionsBetween(id_A, id_B);
+}
+
+template <typename T>
+void GeometrySystem<T>::ExcludeCollisionsBetween(FrameId frame_A,
+                                                 FrameId frame_B) {
+  GS_THROW_IF_CONTEXT_ALLOCATED
+  initial_state_->ExcludeCollisionsBetween(frame_A, frame_B);
+}
+
+template <typename T>
+void GeometrySystem<T>::AssignCollisionFilterGroups(
+    GeometryId id, const CollisionFilterGroupMask& groups,
+    const CollisionFilterGroupMask& ignored) {
+  GS_THROW_IF_CONTEXT_ALLOCATED
+  initial_state_->AssignCollisionFilterGroups(id, groups, ignored);
+}
+
 template <typename T>
 void GeometrySystem<T>::MakeSourcePorts(SourceId source_id) {
   // This will fail only if the source generator starts recycling source ids.
@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "drake/geometry/collision_filter_groups.h"
 #include "drake/geometry/geometry_state.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
@@ -381,6 +382,49 @@ class GeometrySystem final : public systems::LeafSystem<T> {
 
   //@}
 
+  /** @name         Collision filtering
+
+   Collision filtering excludes pairs of geometries from the collision queries
+   (see QueryObject). Filtered pairs are rejected by the broadphase and never
+   reach the narrowphase, so filtering, e.g., all pairs of geometries on
+   adjacent links of a robot, reduces the cost of those queries. Pairs of
+   anchored geometries are always filtered.
+
+   There are two complementary mechanisms: explicitly excluded pairs and
+   collision filter groups. A pair of geometries is filtered if it was
+   explicitly excluded _or_ if either geometry belongs to a group ignored by the
+   other one (see CollisionFilterGroupMask).
+
+   Like the topology manipulation methods, these methods can only be invoked
+   before a context has been allocated.  */
+  //@{
+
+  /** Excludes the pair of geometries with the given ids from collision
+   queries.
+   @throws std::logic_error 1. either id does not map to a registered
+                            geometry, or
+                            2. a context has been allocated. */
+  void ExcludeCollisionsBetween(GeometryId id_A, GeometryId id_B);
+
+  /** Excludes all pairs formed by a geometry affixed to frame A and a geometry
+   affixed to frame B from collision queries. If `frame_A` and `frame_B` are
+   the same frame, all pairs of geometries affixed to that frame are excluded.
+   Only the geometries registered before this call are affected.
+   @throws std::logic_error 1. either id does not map to a registered frame, or
+                            2. a context has been allocated. */
+  void ExcludeCollisionsBetween(FrameId frame_A, FrameId frame_B);
+
+  /** Assigns the collision filter groups the geometry with the given `id`
+   belongs to and the groups it ignores. By default, every geometry belongs to
+   group 0 and ignores no group.
+   @throws std::logic_error 1. `id` does not map to a registered geometry, or
+                            2. a context has been allocated. */
+  void AssignCollisionFilterGroups(GeometryId id,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored);
+
+  //@}
+
  private:
   // Friend class to facilitate testing.
   friend class GeometrySystemTester;
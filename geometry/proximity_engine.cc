@@ -1,7 +1,13 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <fcl/fcl.h>
@@ -72,6 +78,9 @@ class EncodedData {
   // Reports the stored index.
   int index() const { return static_cast<int>(data_ & ~kIsDynamicMask); }
 
+  // Reports the raw encoded value; it uniquely identifies the geometry.
+  uintptr_t encoding() const { return data_; }
+
   // Given an fcl object and maps from index to id of both dynamic and anchored
   // geometry, returns the geometry id for the given fcl object.
   GeometryId id(const std::vector<GeometryId>& dynamic_map,
@@ -103,6 +112,93 @@ class EncodedData {
   uintptr_t data_{};
 };
 
+// Key identifying a pair of geometries by their encoded user data, with the
+// smaller encoding first so that the key does not depend on the order in
+// which the broadphase reports the pair.
+using GeometryPairKey = std::pair<uintptr_t, uintptr_t>;
+
+struct GeometryPairKeyHash {
+  size_t operator()(const GeometryPairKey& key) const {
+    return std::hash<uintptr_t>()(key.first) * 31 +
+        std::hash<uintptr_t>()(key.second);
+  }
+};
+
+// Makes the key for the pair of geometries with the given encodings.
+GeometryPairKey MakeGeometryPairKey(const EncodedData& data_A,
+                                    const EncodedData& data_B) {
+  const uintptr_t a = data_A.encoding();
+  const uintptr_t b = data_B.encoding();
+  return a < b ? GeometryPairKey(a, b) : GeometryPairKey(b, a);
+}
+
+// The collision filter data for all geometries in the engine. A pair of
+// geometries is filtered if both are anchored, if either belongs to a
+// collision filter group ignored by the other or if the pair has been
+// explicitly excluded.
+class CollisionFilter {
+ public:
+  // Registers a new geometry with the default filter groups: it belongs to
+  // group 0 and ignores none.
+  void AddGeometry(bool is_dynamic) {
+    CollisionFilterGroupMask groups;
+    groups.set(0);
+    auto& masks = is_dynamic ? dynamic_masks_ : anchored_masks_;
+    masks.emplace_back(groups, CollisionFilterGroupMask());
+  }
+
+  void AssignGroups(const EncodedData& data,
+                    const CollisionFilterGroupMask& groups,
+                    const CollisionFilterGroupMask& ignored) {
+    mutable_masks(data) = std::make_pair(groups, ignored);
+  }
+
+  void ExcludePair(const EncodedData& data_A, const EncodedData& data_B) {
+    excluded_pairs_.insert(MakeGeometryPairKey(data_A, data_B));
+  }
+
+  bool IsFiltered(const EncodedData& data_A,
+                  const EncodedData& data_B) const {
+    if (!data_A.is_dynamic() && !data_B.is_dynamic()) return true;
+    const FilterMasks& masks_A = masks(data_A);
+    const FilterMasks& masks_B = masks(data_B);
+    if ((masks_A.first & masks_B.second).any() ||
+        (masks_B.first & masks_A.second).any()) {
+      return true;
+    }
+    return !excluded_pairs_.empty() &&
+        excluded_pairs_.count(MakeGeometryPairKey(data_A, data_B)) > 0;
+  }
+
+  bool IsFiltered(const fcl::CollisionObjectd& fcl_object_A,
+                  const fcl::CollisionObjectd& fcl_object_B) const {
+    return IsFiltered(EncodedData(fcl_object_A), EncodedData(fcl_object_B));
+  }
+
+ private:
+  // The groups a geometry belongs to (first) and the groups it ignores
+  // (second).
+  using FilterMasks =
+      std::pair<CollisionFilterGroupMask, CollisionFilterGroupMask>;
+
+  const FilterMasks& masks(const EncodedData& data) const {
+    return data.is_dynamic() ? dynamic_masks_[data.index()]
+                             : anchored_masks_[data.index()];
+  }
+
+  FilterMasks& mutable_masks(const EncodedData& data) {
+    return data.is_dynamic() ? dynamic_masks_[data.index()]
+                             : anchored_masks_[data.index()];
+  }
+
+  // The filter masks of each geometry, indexed by engine index.
+  std::vector<FilterMasks> dynamic_masks_;
+  std::vector<FilterMasks> anchored_masks_;
+
+  // The explicitly excluded pairs.
+  std::unordered_set<GeometryPairKey, GeometryPairKeyHash> excluded_pairs_;
+};
+
 // Struct for use in SingleCollisionCallback(). Contains the collision request
 // and accumulates results in a drake::multibody::collision::PointPair vector.
 struct CollisionData {
@@ -116,6 +212,9 @@ struct CollisionData {
   // Collision request
   fcl::CollisionRequestd request;
 
+  // The collision filter; filtered pairs are skipped.
+  const CollisionFilter* collision_filter{};
+
   // Vector of distance results
   std::vector<PenetrationAsPointPair<double>>* contacts{};
 };
@@ -132,15 +231,17 @@ bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
   const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
 
-  // TODO(SeanCurtis-TRI): Introduce collision filtering here.
-  const bool is_filtered = false;
+  // Unpack the callback data
+  auto& collision_data = *static_cast<CollisionData*>(callback_data);
+
+  // Filtered pairs never reach the narrowphase.
+  const bool is_filtered =
+      collision_data.collision_filter->IsFiltered(fcl_object_A, fcl_object_B);
 
   if (!is_filtered) {
-    // Unpack the callback data
-    auto& collision_data = *static_cast<CollisionData*>(callback_data);
     const fcl::CollisionRequestd& request = collision_data.request;
-    const std::vector<GeometryId> dynamic_map = collision_data.dynamic_map;
-    const std::vector<GeometryId> anchored_map = collision_data.anchored_map;
+    const std::vector<GeometryId>& dynamic_map = collision_data.dynamic_map;
+    const std::vector<GeometryId>& anchored_map = collision_data.anchored_map;
 
     // This callback only works for a single contact, this confirms a request
     // hasn't been made for more contacts.
@@ -192,6 +293,263 @@ bool SingleCollisionCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
   return false;
 }
 
+// Computes the signed distance between the two given collision objects and
+// the corresponding witness points on their surfaces, measured and expressed
+// in the world frame. For penetrating objects, the distance is the negative of
+// the penetration depth and the witness points are chosen as in
+// SingleCollisionCallback().
+void CalcSignedDistance(const fcl::CollisionObjectd& fcl_object_A,
+                        const fcl::CollisionObjectd& fcl_object_B,
+                        double* distance, Vector3d* p_WCa, Vector3d* p_WCb) {
+  fcl::DistanceRequestd request;
+  request.enable_nearest_points = true;
+  fcl::DistanceResultd result;
+  fcl::distance(&fcl_object_A, &fcl_object_B, request, result);
+  if (result.min_distance > 0) {
+    *distance = result.min_distance;
+    *p_WCa = result.nearest_points[0];
+    *p_WCb = result.nearest_points[1];
+    return;
+  }
+
+  // FCL's distance query does not report the penetration depth. For
+  // overlapping objects we therefore resort to the collision query.
+  fcl::CollisionRequestd collision_request;
+  collision_request.num_max_contacts = 1;
+  collision_request.enable_contact = true;
+  fcl::CollisionResultd collision_result;
+  fcl::collide(&fcl_object_A, &fcl_object_B, collision_request,
+               collision_result);
+  if (!collision_result.isCollision()) {
+    // The objects are touching.
+    *distance = 0.0;
+    *p_WCa = result.nearest_points[0];
+    *p_WCb = result.nearest_points[1];
+    return;
+  }
+  const fcl::Contactd& contact = collision_result.getContact(0);
+  // By convention, Drake requires the contact normal to point out of B and
+  // into A. FCL uses the opposite convention.
+  const Vector3d drake_normal = -contact.normal;
+  const double depth = contact.penetration_depth;
+  *distance = -depth;
+  *p_WCa = contact.pos - 0.5 * depth * drake_normal;
+  *p_WCb = contact.pos + 0.5 * depth * drake_normal;
+}
+
+// Signed distance result for a pair of geometries, stored with the update
+// count at which it was computed. The witness points are ordered as the pair's
+// key; see UnmovedPairDistances.
+struct CachedSignedDistance {
+  int64_t computed_at{};
+  double distance{};
+  Vector3d p_WCa;
+  Vector3d p_WCb;
+};
+
+// Signed distance results by pair, valid for as long as neither geometry of
+// the pair moves. Results of pairs with a moved geometry are discarded, not
+// used to warm start the new computation.
+using UnmovedPairDistances =
+    std::unordered_map<GeometryPairKey, CachedSignedDistance,
+                       GeometryPairKeyHash>;
+
+// Struct for use in DistanceWithinThresholdCallback(). Accumulates the signed
+// distance of all pairs within the distance threshold.
+struct DistanceData {
+  DistanceData(const std::vector<GeometryId>* dynamic_map_in,
+               const std::vector<GeometryId>* anchored_map_in,
+               double max_distance_in)
+      : dynamic_map(*dynamic_map_in), anchored_map(*anchored_map_in),
+        max_distance(max_distance_in) {}
+  // Maps so the distance call back can map from engine index to geometry id.
+  const std::vector<GeometryId>& dynamic_map;
+  const std::vector<GeometryId>& anchored_map;
+
+  // Pairs farther apart than this distance are not reported. It may be
+  // negative, in which case only pairs penetrating deeper than -max_distance
+  // are reported.
+  const double max_distance;
+
+  // Vector of distance results.
+  std::vector<SignedDistancePair<double>>* pairs{};
+
+  // The collision filter; filtered pairs are skipped.
+  const CollisionFilter* collision_filter{};
+
+  // Signed distance results from the previous query, the results of this query,
+  // the update count at which each dynamic geometry last moved, and the
+  // current update count. See ProximityEngine::Impl.
+  const UnmovedPairDistances* previous_cache{};
+  UnmovedPairDistances* cache{};
+  const std::vector<int64_t>* dynamic_last_moved{};
+  int64_t pose_update_count{};
+
+  // Returns the bound on the distance between bounding boxes beyond which
+  // pairs cannot be within `max_distance`. The bounding boxes of touching or
+  // penetrating geometries are at zero distance, even for a negative
+  // `max_distance`, and FCL only visits the bounding boxes strictly closer
+  // than the bound. The bound is therefore the smallest double greater than
+  // max(max_distance, 0).
+  double pruning_distance() const {
+    return std::nextafter(std::max(max_distance, 0.0),
+                          std::numeric_limits<double>::infinity());
+  }
+
+  // Returns the update count at which the given object last moved.
+  int64_t last_moved(const fcl::CollisionObjectd& fcl_object) const {
+    const EncodedData encoding(fcl_object);
+    return encoding.is_dynamic()
+               ? (*dynamic_last_moved)[encoding.index()] : 0;
+  }
+};
+
+// Computes the signed distance between the two given objects, reusing the
+// result of the previous query in `distance_data` if neither
+// object has moved since it was computed. The result is stored in the cache of
+// this query.
+void CalcSignedDistanceCached(const fcl::CollisionObjectd& fcl_object_A,
+                              const fcl::CollisionObjectd& fcl_object_B,
+                              DistanceData* distance_data, double* distance,
+                              Vector3d* p_WCa, Vector3d* p_WCb) {
+  const auto data_A = reinterpret_cast<uintptr_t>(fcl_object_A.getUserData());
+  const auto data_B = reinterpret_cast<uintptr_t>(fcl_object_B.getUserData());
+  const bool swapped = data_B < data_A;
+  const GeometryPairKey key =
+      swapped ? GeometryPairKey(data_B, data_A) : GeometryPairKey(data_A,
+                                                                  data_B);
+  CachedSignedDistance& cached = (*distance_data->cache)[key];
+  const auto previous = distance_data->previous_cache->find(key);
+  const bool is_valid =
+      previous != distance_data->previous_cache->end() &&
+      previous->second.computed_at > 0 &&
+      distance_data->last_moved(fcl_object_A) <=
+          previous->second.computed_at &&
+      distance_data->last_moved(fcl_object_B) <= previous->second.computed_at;
+  if (is_valid) {
+    cached = previous->second;
+  } else {
+    CalcSignedDistance(swapped ? fcl_object_B : fcl_object_A,
+                       swapped ? fcl_object_A : fcl_object_B,
+                       &cached.distance, &cached.p_WCa, &cached.p_WCb);
+    // Results computed before the first pose update are never reused.
+    cached.computed_at = distance_data->pose_update_count;
+  }
+  *distance = cached.distance;
+  *p_WCa = swapped ? cached.p_WCb : cached.p_WCa;
+  *p_WCb = swapped ? cached.p_WCa : cached.p_WCb;
+}
+
+// Callback function for FCL's broadphase distance() function reporting all
+// pairs within a distance threshold. The broadphase managers prune any pair of
+// bounding volumes that are not strictly closer than the distance reported
+// through `dist`. Since the callback always reports
+// DistanceData::pruning_distance(), rather than the smallest distance found so
+// far, the broadphase visits every pair whose bounding volumes are within the
+// threshold, touching and overlapping bounding volumes included.
+bool DistanceWithinThresholdCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                                     fcl::CollisionObjectd* fcl_object_B_ptr,
+                                     void* callback_data, double& dist) {
+  // NOTE: Although this function *takes* non-const pointers to satisfy the
+  // fcl api, it should not exploit the non-constness to modify the collision
+  // objects.
+  const fcl::CollisionObjectd& fcl_object_A = *fcl_object_A_ptr;
+  const fcl::CollisionObjectd& fcl_object_B = *fcl_object_B_ptr;
+  auto& distance_data = *static_cast<DistanceData*>(callback_data);
+  dist = distance_data.pruning_distance();
+
+  // Filtered pairs never reach the narrowphase.
+  if (distance_data.collision_filter->IsFiltered(fcl_object_A, fcl_object_B)) {
+    return false;
+  }
+
+  // The traversal might still visit a pair whose bounding boxes are farther
+  // apart than the threshold (e.g., the very first pair). Cull them before
+  // performing the narrowphase query.
+  if (fcl_object_A.getAABB().distance(fcl_object_B.getAABB()) >=
+      distance_data.pruning_distance()) {
+    return false;
+  }
+
+  SignedDistancePair<double> pair;
+  CalcSignedDistanceCached(fcl_object_A, fcl_object_B, &distance_data,
+                           &pair.distance, &pair.p_WCa, &pair.p_WCb);
+  if (pair.distance <= distance_data.max_distance) {
+    pair.id_A = EncodedData(fcl_object_A).id(distance_data.dynamic_map,
+                                             distance_data.anchored_map);
+    pair.id_B = EncodedData(fcl_object_B).id(distance_data.dynamic_map,
+                                             distance_data.anchored_map);
+    distance_data.pairs->emplace_back(std::move(pair));
+  }
+
+  // Returning true would tell the broadphase manager to terminate early.
+  return false;
+}
+
+// Struct for use in NearestToPointCallback(). Stores the nearest geometry to
+// the query point found so far.
+struct NearestToPointData {
+  NearestToPointData(const fcl::CollisionObjectd* query_point_in,
+                     double max_distance)
+      : query_point(query_point_in), nearest_distance(max_distance) {}
+  // The collision object representing the query point.
+  const fcl::CollisionObjectd* query_point;
+  // The distance to the nearest geometry found so far, initialized to the
+  // distance threshold.
+  double nearest_distance;
+  // The nearest geometry found so far and the point on its surface nearest to
+  // the query point. `nearest_geometry` is nullptr if none was found yet.
+  const fcl::CollisionObjectd* nearest_geometry{nullptr};
+  Vector3d p_WN;
+
+  // Returns the bound on the distance between bounding boxes beyond which
+  // geometries cannot be nearer than `nearest_distance`. A geometry containing
+  // the query point, at a negative signed distance, has a bounding box at zero
+  // distance, and FCL only visits the bounding boxes strictly closer than the
+  // bound, so the bound is kept positive.
+  double pruning_distance() const {
+    return std::max(nearest_distance, std::numeric_limits<double>::min());
+  }
+};
+
+// Callback function for FCL's broadphase distance() function finding the
+// geometry nearest to a query point. It reports the nearest distance found so
+// far through `dist` so that the broadphase prunes any bounding volume
+// farther away. When the query point is inside some geometries, the one it
+// penetrates deepest is the nearest.
+bool NearestToPointCallback(fcl::CollisionObjectd* fcl_object_A_ptr,
+                            fcl::CollisionObjectd* fcl_object_B_ptr,
+                            void* callback_data, double& dist) {
+  auto& data = *static_cast<NearestToPointData*>(callback_data);
+  const bool A_is_query = fcl_object_A_ptr == data.query_point;
+  const fcl::CollisionObjectd& fcl_geometry =
+      A_is_query ? *fcl_object_B_ptr : *fcl_object_A_ptr;
+  const fcl::CollisionObjectd& fcl_query = *data.query_point;
+  dist = data.pruning_distance();
+
+  if (fcl_geometry.getAABB().distance(fcl_query.getAABB()) >
+      data.pruning_distance()) {
+    return false;
+  }
+
+  double distance;
+  Vector3d p_WCg, p_WCq;
+  CalcSignedDistance(fcl_geometry, fcl_query, &distance, &p_WCg, &p_WCq);
+  if (distance <= data.nearest_distance) {
+    data.nearest_distance = distance;
+    data.nearest_geometry = &fcl_geometry;
+    // When the query point is outside of the geometry, p_WCq is the query
+    // point itself. When it is inside, the witness points of the penetration
+    // need not be on the surfaces, but they are -distance apart along the
+    // direction in which the query point leaves the geometry soonest. In both
+    // cases, their difference added to the query point is the point on the
+    // surface nearest to it.
+    data.p_WN = fcl_query.getTranslation() + (p_WCg - p_WCq);
+    dist = data.pruning_distance();
+  }
+  return false;
+}
+
 // Returns a copy of the given fcl collision geometry; throws an exception for
 // unsupported collision geometry types. This supplements the *missing* cloning
 // functionality in FCL. Issue has been submitted to FCL:
@@ -300,6 +658,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
+
+    // The copy starts with no signed distance results to reuse.
+    dynamic_last_moved_.assign(dynamic_objects_.size(), 0);
+    collision_filter_ = other.collision_filter_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -326,6 +688,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
+    engine->dynamic_last_moved_.assign(dynamic_objects_.size(), 0);
+    engine->collision_filter_ = collision_filter_;
 
     return engine;
   }
@@ -339,6 +703,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     GeometryIndex index(static_cast<int>(dynamic_objects_.size()));
     EncodedData(index, true /* is dynamic */).store_in(fcl_object.get());
     dynamic_objects_.emplace_back(std::move(fcl_object));
+    dynamic_last_moved_.push_back(pose_update_count_);
+    collision_filter_.AddGeometry(true /* is dynamic */);
 
     return index;
   }
@@ -354,6 +720,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     AnchoredGeometryIndex index(static_cast<int>(anchored_objects_.size()));
     EncodedData(index, false /* is dynamic */).store_in(fcl_object.get());
     anchored_objects_.emplace_back(std::move(fcl_object));
+    collision_filter_.AddGeometry(false /* is dynamic */);
 
     return index;
   }
@@ -374,10 +741,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG) {
     DRAKE_DEMAND(X_WG.size() == dynamic_objects_.size());
+    BeginPoseUpdate();
     for (size_t i = 0; i < X_WG.size(); ++i) {
-      dynamic_objects_[i]->setTransform(convert(X_WG[i]));
+      UpdateDynamicPose(static_cast<int>(i), convert(X_WG[i]));
     }
-    dynamic_tree_.update();
+    EndPoseUpdate();
+  }
+
+  void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG,
+                        const std::vector<GeometryIndex>& indices) {
+    DRAKE_DEMAND(X_WG.size() == dynamic_objects_.size());
+    BeginPoseUpdate();
+    for (GeometryIndex index : indices) {
+      UpdateDynamicPose(index, convert(X_WG[index]));
+    }
+    EndPoseUpdate();
   }
 
   // Implementation of ShapeReifier interface
@@ -410,12 +788,52 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_sphere, user_data);
   }
 
+  void AssignCollisionFilterGroups(GeometryIndex index,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored) {
+    DRAKE_DEMAND(index < num_dynamic());
+    collision_filter_.AssignGroups(EncodedData(index, true), groups, ignored);
+  }
+
+  void AssignCollisionFilterGroups(AnchoredGeometryIndex index,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored) {
+    DRAKE_DEMAND(index < num_anchored());
+    collision_filter_.AssignGroups(EncodedData(index, false), groups, ignored);
+  }
+
+  void ExcludeCollisionsBetween(GeometryIndex index_A, GeometryIndex index_B) {
+    DRAKE_DEMAND(index_A < num_dynamic() && index_B < num_dynamic());
+    collision_filter_.ExcludePair(EncodedData(index_A, true),
+                                  EncodedData(index_B, true));
+  }
+
+  void ExcludeCollisionsBetween(GeometryIndex dynamic_index,
+                                AnchoredGeometryIndex anchored_index) {
+    DRAKE_DEMAND(dynamic_index < num_dynamic() &&
+                 anchored_index < num_anchored());
+    collision_filter_.ExcludePair(EncodedData(dynamic_index, true),
+                                  EncodedData(anchored_index, false));
+  }
+
+  bool CollisionFiltered(GeometryIndex index_A, GeometryIndex index_B) const {
+    return collision_filter_.IsFiltered(EncodedData(index_A, true),
+                                        EncodedData(index_B, true));
+  }
+
+  bool CollisionFiltered(GeometryIndex dynamic_index,
+                         AnchoredGeometryIndex anchored_index) const {
+    return collision_filter_.IsFiltered(EncodedData(dynamic_index, true),
+                                        EncodedData(anchored_index, false));
+  }
+
   std::vector<PenetrationAsPointPair<double>> ComputePointPairPenetration(
       const std::vector<GeometryId>& dynamic_map,
       const std::vector<GeometryId>& anchored_map) const {
     std::vector<PenetrationAsPointPair<double>> contacts;
     CollisionData collision_data{&dynamic_map, &anchored_map};
     collision_data.contacts = &contacts;
+    collision_data.collision_filter = &collision_filter_;
     collision_data.request.num_max_contacts = 1;
     collision_data.request.enable_contact = true;
     dynamic_tree_.collide(&collision_data, SingleCollisionCallback);
@@ -432,6 +850,67 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return contacts;
   }
 
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const {
+    std::vector<SignedDistancePair<double>> pairs;
+    // The results of the previous query are taken out of the engine, so that
+    // concurrent queries never share a cache; a query that finds the cache
+    // already taken simply recomputes every pair.
+    UnmovedPairDistances previous_cache;
+    {
+      std::lock_guard<std::mutex> lock(unmoved_pair_distances_mutex_);
+      previous_cache.swap(unmoved_pair_distances_);
+    }
+    UnmovedPairDistances cache;
+    DistanceData distance_data{&dynamic_map, &anchored_map, max_distance};
+    distance_data.pairs = &pairs;
+    distance_data.collision_filter = &collision_filter_;
+    distance_data.previous_cache = &previous_cache;
+    distance_data.cache = &cache;
+    distance_data.dynamic_last_moved = &dynamic_last_moved_;
+    distance_data.pose_update_count = pose_update_count_;
+    dynamic_tree_.distance(&distance_data, DistanceWithinThresholdCallback);
+    // NOTE: See ComputePointPairPenetration() for the const_cast.
+    dynamic_tree_.distance(
+        const_cast<fcl::DynamicAABBTreeCollisionManager<double>*>(
+            &anchored_tree_),
+        &distance_data, DistanceWithinThresholdCallback);
+    // Only the pairs visited by this query are kept for the next one.
+    {
+      std::lock_guard<std::mutex> lock(unmoved_pair_distances_mutex_);
+      unmoved_pair_distances_.swap(cache);
+    }
+    return pairs;
+  }
+
+  optional<SignedDistanceToPoint<double>> ComputeNearestGeometryToPoint(
+      const Vector3<double>& p_WQ,
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const {
+    // The query point is represented by a sphere of zero radius.
+    fcl::CollisionObjectd query_point(make_shared<fcl::Sphered>(0.0));
+    query_point.setTranslation(p_WQ);
+    query_point.computeAABB();
+
+    NearestToPointData data(&query_point, max_distance);
+    // The nearest distance found within the dynamic tree further prunes the
+    // traversal of the anchored tree.
+    dynamic_tree_.distance(&query_point, &data, NearestToPointCallback);
+    anchored_tree_.distance(&query_point, &data, NearestToPointCallback);
+
+    if (data.nearest_geometry == nullptr) return nullopt;
+    SignedDistanceToPoint<double> result;
+    result.id_G =
+        EncodedData(*data.nearest_geometry).id(dynamic_map, anchored_map);
+    result.p_WN = data.p_WN;
+    result.distance = data.nearest_distance;
+    return result;
+  }
+
   // Testing utilities
 
   bool IsDeepCopy(const Impl& other) const {
@@ -478,6 +957,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return false;
   }
 
+  int num_unmoved_pair_distances() const {
+    std::lock_guard<std::mutex> lock(unmoved_pair_distances_mutex_);
+    return static_cast<int>(unmoved_pair_distances_.size());
+  }
+
  private:
   // Engine on one scalar can see the members of other engines.
   friend class ProximityEngineTester;
@@ -487,6 +971,31 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // transmogrify them. Otherwise, while the engine can be transmogrified, the
   // results on an <AutoDiffXd> type will still be double.
 
+  // Starts a new pose update; geometries moved by UpdateDynamicPose() until
+  // the matching EndPoseUpdate() are stamped with the new update count.
+  void BeginPoseUpdate() {
+    ++pose_update_count_;
+    moved_objects_.clear();
+  }
+
+  // Sets the pose of the dynamic geometry with the given `index` if it differs
+  // from its current pose. Geometries whose poses do not change keep their
+  // signed distance results and are not refit in the broadphase tree.
+  void UpdateDynamicPose(int index, const Isometry3<double>& X_WG) {
+    fcl::CollisionObjectd* object = dynamic_objects_[index].get();
+    if (object->getTransform().matrix() == X_WG.matrix()) return;
+    object->setTransform(X_WG);
+    object->computeAABB();
+    dynamic_last_moved_[index] = pose_update_count_;
+    moved_objects_.push_back(object);
+  }
+
+  // Refits the bounding volumes of the geometries moved since the last call to
+  // BeginPoseUpdate().
+  void EndPoseUpdate() {
+    if (!moved_objects_.empty()) dynamic_tree_.update(moved_objects_);
+  }
+
   // Helper method called by the various ImplementGeometry overrides to
   // facilitate the logistics of creating shapes from specifications. `data`
   // is a unique_ptr of an fcl CollisionObject that should be instantiated
@@ -515,6 +1024,28 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // All of the *anchored* collision elements (spanning *all* sources). Their
   // AnchoredGeometryIndex maps to their position in *this* vector.
   std::vector<std::unique_ptr<fcl::CollisionObject<double>>> anchored_objects_;
+
+  // The collision filter data of all geometries.
+  CollisionFilter collision_filter_;
+
+  // Temporal coherence bookkeeping. Each call to UpdateWorldPoses() increments
+  // the update count; the iᵗʰ entry in dynamic_last_moved_ holds the update
+  // count at which the dynamic geometry with GeometryIndex i last moved.
+  // Anchored geometries never move.
+  int64_t pose_update_count_{0};
+  std::vector<int64_t> dynamic_last_moved_;
+
+  // Scratch buffer for the geometries moved during the current pose update.
+  std::vector<fcl::CollisionObjectd*> moved_objects_;
+
+  // Signed distance results of the most recent signed distance query, reused
+  // for as long as neither geometry of the pair moves. Each query replaces the
+  // cache with the pairs it visited, so its size is bounded by the number of
+  // pairs within the query's distance threshold. This is a cache of the
+  // results of const queries and therefore it is mutable; it is only accessed
+  // under unmoved_pair_distances_mutex_.
+  mutable std::mutex unmoved_pair_distances_mutex_;
+  mutable UnmovedPairDistances unmoved_pair_distances_;
 };
 
 template <typename T>
@@ -595,6 +1126,51 @@ void ProximityEngine<T>::UpdateWorldPoses(
   impl_->UpdateWorldPoses(X_WG);
 }
 
+template <typename T>
+void ProximityEngine<T>::UpdateWorldPoses(
+    const std::vector<Isometry3<T>>& X_WG,
+    const std::vector<GeometryIndex>& indices) {
+  impl_->UpdateWorldPoses(X_WG, indices);
+}
+
+template <typename T>
+void ProximityEngine<T>::AssignCollisionFilterGroups(
+    GeometryIndex index, const CollisionFilterGroupMask& groups,
+    const CollisionFilterGroupMask& ignored) {
+  impl_->AssignCollisionFilterGroups(index, groups, ignored);
+}
+
+template <typename T>
+void ProximityEngine<T>::AssignCollisionFilterGroups(
+    AnchoredGeometryIndex index, const CollisionFilterGroupMask& groups,
+    const CollisionFilterGroupMask& ignored) {
+  impl_->AssignCollisionFilterGroups(index, groups, ignored);
+}
+
+template <typename T>
+void ProximityEngine<T>::ExcludeCollisionsBetween(GeometryIndex index_A,
+                                                  GeometryIndex index_B) {
+  impl_->ExcludeCollisionsBetween(index_A, index_B);
+}
+
+template <typename T>
+void ProximityEngine<T>::ExcludeCollisionsBetween(
+    GeometryIndex dynamic_index, AnchoredGeometryIndex anchored_index) {
+  impl_->ExcludeCollisionsBetween(dynamic_index, anchored_index);
+}
+
+template <typename T>
+bool ProximityEngine<T>::CollisionFiltered(GeometryIndex index_A,
+                                           GeometryIndex index_B) const {
+  return impl_->CollisionFiltered(index_A, index_B);
+}
+
+template <typename T>
+bool ProximityEngine<T>::CollisionFiltered(
+    GeometryIndex dynamic_index, AnchoredGeometryIndex anchored_index) const {
+  return impl_->CollisionFiltered(dynamic_index, anchored_index);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<double>>
 ProximityEngine<T>::ComputePointPairPenetration(
@@ -603,6 +1179,27 @@ ProximityEngine<T>::ComputePointPairPenetration(
   return impl_->ComputePointPairPenetration(dynamic_map, anchored_map);
 }
 
+template <typename T>
+std::vector<SignedDistancePair<double>>
+ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map,
+    double max_distance) const {
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(
+      dynamic_map, anchored_map, max_distance);
+}
+
+template <typename T>
+optional<SignedDistanceToPoint<double>>
+ProximityEngine<T>::ComputeNearestGeometryToPoint(
+    const Vector3<double>& p_WQ,
+    const std::vector<GeometryId>& dynamic_map,
+    const std::vector<GeometryId>& anchored_map,
+    double max_distance) const {
+  return impl_->ComputeNearestGeometryToPoint(p_WQ, dynamic_map, anchored_map,
+                                              max_distance);
+}
+
 // Testing utilities
 
 template <typename T>
@@ -610,6 +1207,11 @@ bool ProximityEngine<T>::IsDeepCopy(const ProximityEngine<T>& other) const {
   return impl_->IsDeepCopy(*other.impl_);
 }
 
+template <typename T>
+int ProximityEngine<T>::num_unmoved_pair_distances() const {
+  return impl_->num_unmoved_pair_distances();
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -5,9 +5,12 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_optional.h"
+#include "drake/geometry/collision_filter_groups.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_index.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/signed_distance_pair.h"
+#include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/shape_specification.h"
 
 namespace drake {
@@ -101,6 +104,63 @@ class ProximityEngine {
   //    a vector and the caller sets values there directly.
   void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG);
 
+  /** Updates the poses of only the dynamic geometries whose indices are
+   listed in `indices`; all other geometries keep their current poses. Only
+   the bounding volumes of the geometries that actually moved are refit in the
+   broadphase structure. This is the preferred update when only a small subset
+   of the geometries move between queries.
+   @param X_WG     The poses of each geometry `G` measured and expressed in the
+                   world frame `W`, with the same layout as in
+                   UpdateWorldPoses(). Only the entries listed in `indices` are
+                   read.
+   @param indices  The indices of the geometries whose poses may have changed.
+   */
+  void UpdateWorldPoses(const std::vector<Isometry3<T>>& X_WG,
+                        const std::vector<GeometryIndex>& indices);
+
+
+  //----------------------------------------------------------------------------
+  /** @name                Collision Filtering
+
+   Filtered pairs of geometries are rejected in the broadphase, before any
+   narrowphase computation takes place. They are reported neither by the
+   penetration queries nor by the pairwise signed distance queries. Pairs of
+   anchored geometries are always filtered.  */
+  //@{
+
+  /** Sets the collision filter groups the dynamic geometry with the given
+   `index` belongs to and the groups it ignores. See CollisionFilterGroupMask.
+   @pre `index` refers to a registered dynamic geometry. */
+  void AssignCollisionFilterGroups(GeometryIndex index,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored);
+
+  /** Anchored geometry overload of AssignCollisionFilterGroups(). */
+  void AssignCollisionFilterGroups(AnchoredGeometryIndex index,
+                                   const CollisionFilterGroupMask& groups,
+                                   const CollisionFilterGroupMask& ignored);
+
+  /** Excludes the pair of dynamic geometries with the given indices from
+   collision queries.
+   @pre Both indices refer to registered dynamic geometries. */
+  void ExcludeCollisionsBetween(GeometryIndex index_A, GeometryIndex index_B);
+
+  /** Excludes the pair formed by a dynamic and an anchored geometry from
+   collision queries.
+   @pre Both indices refer to registered geometries. */
+  void ExcludeCollisionsBetween(GeometryIndex dynamic_index,
+                                AnchoredGeometryIndex anchored_index);
+
+  /** Reports true if the pair of dynamic geometries with the given indices is
+   excluded from collision queries. */
+  bool CollisionFiltered(GeometryIndex index_A, GeometryIndex index_B) const;
+
+  /** Reports true if the pair formed by the given dynamic and anchored
+   geometries is excluded from collision queries. */
+  bool CollisionFiltered(GeometryIndex dynamic_index,
+                         AnchoredGeometryIndex anchored_index) const;
+
+  //@}
 
   //----------------------------------------------------------------------------
   /** @name                Collision Queries
@@ -122,13 +182,9 @@ class ProximityEngine {
    of the penetration "depth" of the two objects -- but _not_ the overlapping
    volume.
 
-   @cond
-   // TODO(SeanCurtis-TRI): Once collision filtering is supported, pull this
-   // *out* of the cond tag.
    This method is affected by collision filtering; geometry pairs that
    have been filtered will not produce contacts, even if their collision
    geometry is penetrating.
-   @endcond
 
    @param[in]   dynamic_map   A map from geometry _index_ to the corresponding
                               global geometry identifier for dynamic geometries.
@@ -143,6 +199,71 @@ class ProximityEngine {
 
   //@}
 
+  //----------------------------------------------------------------------------
+  /** @name                Signed Distance Queries
+
+   These queries report the signed distance between geometries, or between a
+   point and geometries, that lie within a given distance threshold. The
+   threshold is used by the broadphase to prune candidate pairs whose
+   bounding volumes are farther apart than the threshold before any
+   narrowphase work is performed. Therefore, smaller thresholds lead to faster
+   queries.  */
+
+  //@{
+
+  /** Computes the signed distance and the witness points for every pair of
+   geometries whose signed distance is smaller than or equal to
+   `max_distance`. Penetrating pairs are reported with negative distance.
+   Pairs of _anchored_ geometry and pairs excluded by collision filtering are
+   not reported.
+
+   The result of a pair found by the previous call is reused, without
+   narrowphase work, if neither geometry of the pair has moved since. Any
+   other pair is computed from scratch; there is no warm start from the
+   witness points of a previous result. ComputePointPairPenetration() does not
+   reuse results.
+
+   @param[in]   dynamic_map   A map from geometry _index_ to the corresponding
+                              global geometry identifier for dynamic geometries.
+   @param[in]   anchored_map  A map from geometry _index_ to the corresponding
+                              global geometry identifier for anchored
+                              geometries.
+   @param[in]   max_distance  The maximum distance at which pairs are reported.
+                              It can be infinite to report all pairs. It can
+                              be negative to only report the pairs
+                              penetrating deeper than `-max_distance`.
+   @returns A vector with the signed distance of all pairs of geometries within
+            `max_distance` of each other. */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const;
+
+  /** Finds the geometry, dynamic or anchored, nearest to the query point Q.
+   Geometries farther than `max_distance` from Q are not considered. If Q is
+   inside of some geometries, the nearest one is the one that Q penetrates
+   deepest.
+
+   @param[in]   p_WQ          The position of the query point Q measured and
+                              expressed in the world frame W.
+   @param[in]   dynamic_map   A map from geometry _index_ to the corresponding
+                              global geometry identifier for dynamic geometries.
+   @param[in]   anchored_map  A map from geometry _index_ to the corresponding
+                              global geometry identifier for anchored
+                              geometries.
+   @param[in]   max_distance  The maximum distance from Q at which geometries
+                              are considered. It can be infinite.
+   @returns The signed distance from Q to the nearest geometry, or nullopt if
+            no geometry lies within `max_distance` of Q. */
+  optional<SignedDistanceToPoint<double>> ComputeNearestGeometryToPoint(
+      const Vector3<double>& p_WQ,
+      const std::vector<GeometryId>& dynamic_map,
+      const std::vector<GeometryId>& anchored_map,
+      double max_distance) const;
+
+  //@}
+
  private:
   ////////////////////////////////////////////////////////////////////////////
 
@@ -154,6 +275,10 @@ class ProximityEngine {
   // Reports true if other is detectably a deep copy of this engine.
   bool IsDeepCopy(const ProximityEngine<T>& other) const;
 
+  // Reports the number of signed distance results of unmoved pairs kept for
+  // the next signed distance query.
+  int num_unmoved_pair_distances() const;
+
   ////////////////////////////////////////////////////////////////////////////
 
   // TODO(SeanCurtis-TRI): Pimpl + template implementation has proven
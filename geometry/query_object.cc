@@ -42,6 +42,30 @@ QueryObject<T>::ComputePointPairPenetration() const {
   return state.ComputePointPairPenetration();
 }
 
+template <typename T>
+std::vector<SignedDistancePair<double>>
+QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    double max_distance) const {
+  ThrowIfDefault();
+
+  // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
+  system_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
+}
+
+template <typename T>
+optional<SignedDistanceToPoint<double>>
+QueryObject<T>::ComputeNearestGeometryToPoint(const Vector3<double>& p_WQ,
+                                              double max_distance) const {
+  ThrowIfDefault();
+
+  // TODO(SeanCurtis-TRI): Modify this when the cache system is in place.
+  system_->FullPoseUpdate(*context_);
+  const GeometryState<T>& state = context_->get_geometry_state();
+  return state.ComputeNearestGeometryToPoint(p_WQ, max_distance);
+}
+
 }  // namespace geometry
 }  // namespace drake
 
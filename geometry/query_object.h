@@ -1,11 +1,15 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "drake/common/drake_optional.h"
 #include "drake/geometry/geometry_context.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
+#include "drake/geometry/query_results/signed_distance_pair.h"
+#include "drake/geometry/query_results/signed_distance_to_point.h"
 
 namespace drake {
 namespace geometry {
@@ -101,12 +105,11 @@ class QueryObject {
    geometry are also not reported. The penetration between two geometries is
    characterized as a point pair (see PenetrationAsPointPair).
 
-   <!--
    This method is affected by collision filtering; element pairs that
    have been filtered will not produce contacts, even if their collision
    geometry is penetrating.
-   TODO(SeanCurtis-TRI): This isn't true yet.
 
+   <!--
    NOTE: This is currently declared as double because we haven't exposed FCL's
    templated functionality yet. When that happens, double -> T.
    -->
@@ -118,6 +121,52 @@ class QueryObject {
 
   //@}
 
+  //----------------------------------------------------------------------------
+  /** @name                Signed Distance Queries
+
+   These queries compute the signed distance between geometries: positive for
+   separated geometries and negative (the penetration depth) for overlapping
+   geometries. Each query takes a distance threshold `max_distance`; geometries
+   farther apart than the threshold are not reported. The threshold is used to
+   prune the broadphase traversal and therefore a tight threshold makes these
+   queries significantly cheaper than an unbounded query on large scenes.  */
+  //@{
+
+  /** Computes the signed distance together with the nearest points across all
+   pairs of geometries in the world whose signed distance is no greater than
+   `max_distance`. Pairs of _anchored_ geometry and pairs excluded by
+   collision filtering are not reported.
+
+   <!--
+   NOTE: This is currently declared as double because we haven't exposed FCL's
+   templated functionality yet. When that happens, double -> T.
+   -->
+
+   @param max_distance  The distance threshold; pairs farther apart are not
+                        reported. A negative threshold only reports the pairs
+                        penetrating deeper than `-max_distance`. Defaults to
+                        infinity.
+   @returns A vector with one SignedDistancePair for each reported pair. */
+  std::vector<SignedDistancePair<double>>
+  ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  /** Finds the geometry nearest to the query point Q, together with the point
+   on its surface nearest to Q, considering only geometries whose signed
+   distance to Q is no greater than `max_distance`. If Q is inside of some
+   geometries, the nearest one is the one that Q penetrates deepest, at a
+   negative signed distance.
+
+   @param p_WQ          The position of the query point Q in the world frame.
+   @param max_distance  The distance threshold. Defaults to infinity.
+   @returns The nearest geometry or nullopt if no geometry lies within
+            `max_distance` of Q. */
+  optional<SignedDistanceToPoint<double>> ComputeNearestGeometryToPoint(
+      const Vector3<double>& p_WQ,
+      double max_distance = std::numeric_limits<double>::infinity()) const;
+
+  //@}
+
  private:
   // GeometrySystem is the only class that can instantiate QueryObjects.
   friend class GeometrySystem<T>;
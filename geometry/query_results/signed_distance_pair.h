@@ -0,0 +1,42 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The data for reporting the signed distance between two geometries, A and B.
+ It provides the ids of the two geometries, the witness points Ca and Cb on the
+ surfaces of A and B, respectively, and the signed distance between them:
+
+     distance = `±|p_WCb - p_WCa|`
+
+ The distance is positive when the geometries are separated. It is negative
+ when they are penetrating, in which case its magnitude is the penetration
+ depth (see PenetrationAsPointPair) and Ca and Cb are the points on A and B
+ that most deeply penetrate the other geometry.
+
+ @tparam T The underlying scalar type. Must be a valid Eigen scalar. */
+template <typename T>
+struct SignedDistancePair {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistancePair)
+  SignedDistancePair() = default;
+
+  /** The id of the first geometry in the pair. */
+  GeometryId id_A;
+  /** The id of the second geometry in the pair. */
+  GeometryId id_B;
+  /** The witness point on geometry A's surface, measured and expressed in the
+   world frame. */
+  Vector3<T> p_WCa;
+  /** The witness point on geometry B's surface, measured and expressed in the
+   world frame. */
+  Vector3<T> p_WCb;
+  /** The signed distance between A and B. */
+  T distance{};
+};
+
+}  // namespace geometry
+}  // namespace drake
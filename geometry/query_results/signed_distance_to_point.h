@@ -0,0 +1,34 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The data for reporting the signed distance from a query point Q to a
+ geometry G. It provides the id of the geometry, the point N on the surface of
+ G nearest to Q and the signed distance from Q to G:
+
+     distance = `±|p_WQ - p_WN|`
+
+ The distance is positive when Q is outside G and negative when Q is inside G.
+
+ @tparam T The underlying scalar type. Must be a valid Eigen scalar. */
+template <typename T>
+struct SignedDistanceToPoint {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistanceToPoint)
+  SignedDistanceToPoint() = default;
+
+  /** The id of the geometry G to which the distance is measured. */
+  GeometryId id_G;
+  /** The point on G's surface nearest to the query point Q, measured and
+   expressed in the world frame. */
+  Vector3<T> p_WN;
+  /** The signed distance from the query point Q to G. */
+  T distance{};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/geometry/geometry_state.h"
 
 #include <memory>
+#include <set>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -100,6 +101,12 @@ class GeometryStateTester {
     state_->SetFramePoses(ids, poses);
   }
 
+  void FinalizePoseUpdate() { state_->FinalizePoseUpdate(); }
+
+  const vector<GeometryIndex>& get_dirty_geometry_indices() const {
+    return state_->dirty_geometry_indices_;
+  }
+
   void ValidateFrameIds(const FrameIdVector& ids) const {
     state_->ValidateFrameIds(ids);
   }
@@ -1014,6 +1021,108 @@ TEST_F(GeometryStateTest, SetFramePoses) {
   }
 }
 
+// Tests that SetFramePoses() only updates the world poses of the geometries
+// affected by a change in frame poses, and that only those geometries are
+// reported to the engine.
+TEST_F(GeometryStateTest, IncrementalPoseUpdate) {
+  SourceId s_id = SetUpSingleSourceTree();
+  FrameIdVector ids(s_id, frames_);
+  vector<Isometry3<double>> frame_poses(kFrameCount,
+                                        Isometry3<double>::Identity());
+
+  auto dirty_set = [this]() {
+    const auto& dirty = gs_tester_.get_dirty_geometry_indices();
+    return std::set<int>(dirty.begin(), dirty.end());
+  };
+
+  // The first update computes the world pose of every geometry, even though
+  // the frame poses match the values given at registration.
+  gs_tester_.SetFramePoses(ids, FramePoseVector<double>(s_id, frame_poses));
+  EXPECT_EQ(dirty_set(), std::set<int>({0, 1, 2, 3, 4, 5}));
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_EQ(gs_tester_.get_dirty_geometry_indices().size(), 0);
+
+  // Setting the same poses again does not touch any geometry.
+  gs_tester_.SetFramePoses(ids, FramePoseVector<double>(s_id, frame_poses));
+  EXPECT_EQ(gs_tester_.get_dirty_geometry_indices().size(), 0);
+
+  // Moving the root frame f1 moves its geometries and those of its child f2.
+  Isometry3<double> offset = Isometry3<double>::Identity();
+  offset.translation() << 0, 1, 0;
+  frame_poses[1] = offset;
+  gs_tester_.SetFramePoses(ids, FramePoseVector<double>(s_id, frame_poses));
+  EXPECT_EQ(dirty_set(), std::set<int>({2, 3, 4, 5}));
+  gs_tester_.FinalizePoseUpdate();
+
+  // Moving the leaf frame f2 only moves its own geometries, which are posed
+  // relative to the unchanged world pose of f1.
+  frame_poses[2] = offset;
+  gs_tester_.SetFramePoses(ids, FramePoseVector<double>(s_id, frame_poses));
+  EXPECT_EQ(dirty_set(), std::set<int>({4, 5}));
+  gs_tester_.FinalizePoseUpdate();
+  const auto& world_poses = gs_tester_.get_geometry_world_poses();
+  for (int i = (kFrameCount - 1) * kGeometryCount;
+       i < kFrameCount * kGeometryCount; ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        world_poses[i].matrix().block<3, 4>(0, 0),
+        (offset * offset * X_FG_[i].matrix()).block<3, 4>(0, 0)));
+  }
+}
+
+// Tests the collision filtering interface. The filtering itself is tested in
+// the ProximityEngine unit tests; this confirms the mapping from ids to engine
+// indices.
+TEST_F(GeometryStateTest, CollisionFiltering) {
+  SetUpSingleSourceTree();
+  // By default, only pairs of anchored geometries are filtered.
+  for (int i = 0; i < kFrameCount * kGeometryCount; ++i) {
+    for (int j = i + 1; j < kFrameCount * kGeometryCount; ++j) {
+      EXPECT_FALSE(
+          geometry_state_.CollisionFiltered(geometries_[i], geometries_[j]));
+    }
+  }
+
+  // Excludes the pairs between frames f1 and f2 (geometries 2, 3 and 4, 5)
+  // and the pairs within frame f0 (geometries 0, 1).
+  geometry_state_.ExcludeCollisionsBetween(frames_[1], frames_[2]);
+  geometry_state_.ExcludeCollisionsBetween(frames_[0], frames_[0]);
+  const std::set<std::pair<int, int>> expected_filtered{
+      {0, 1}, {2, 4}, {2, 5}, {3, 4}, {3, 5}};
+  for (int i = 0; i < kFrameCount * kGeometryCount; ++i) {
+    for (int j = i + 1; j < kFrameCount * kGeometryCount; ++j) {
+      EXPECT_EQ(
+          geometry_state_.CollisionFiltered(geometries_[i], geometries_[j]),
+          expected_filtered.count({i, j}) > 0) << i << ", " << j;
+    }
+  }
+
+  // Geometry 2 in a group ignored by geometry 0.
+  CollisionFilterGroupMask group1;
+  group1.set(1);
+  geometry_state_.AssignCollisionFilterGroups(geometries_[2], group1,
+                                              CollisionFilterGroupMask());
+  CollisionFilterGroupMask group0;
+  group0.set(0);
+  geometry_state_.AssignCollisionFilterGroups(geometries_[0], group0, group1);
+  EXPECT_TRUE(geometry_state_.CollisionFiltered(geometries_[0],
+                                                geometries_[2]));
+  EXPECT_TRUE(geometry_state_.CollisionFiltered(geometries_[2],
+                                                geometries_[0]));
+  EXPECT_FALSE(geometry_state_.CollisionFiltered(geometries_[1],
+                                                 geometries_[2]));
+
+  // Unknown ids.
+  EXPECT_THROW(geometry_state_.ExcludeCollisionsBetween(
+                   geometries_[0], GeometryId::get_new_id()),
+               std::logic_error);
+  EXPECT_THROW(geometry_state_.ExcludeCollisionsBetween(
+                   frames_[0], FrameId::get_new_id()),
+               std::logic_error);
+  EXPECT_THROW(geometry_state_.AssignCollisionFilterGroups(
+                   GeometryId::get_new_id(), group0, group1),
+               std::logic_error);
+}
+
 // Test various frame property queries.
 TEST_F(GeometryStateTest, QueryFrameProperties) {
   SourceId s_id = SetUpSingleSourceTree();
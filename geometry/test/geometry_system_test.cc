@@ -244,6 +244,27 @@ TEST_F(GeometrySystemTest, TopologyAfterAllocation) {
       std::logic_error,
       "The call to RegisterAnchoredGeometry is invalid; a context has already "
       "been allocated.");
+
+  // Collision filtering.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      system_.ExcludeCollisionsBetween(GeometryId::get_new_id(),
+                                       GeometryId::get_new_id()),
+      std::logic_error,
+      "The call to ExcludeCollisionsBetween is invalid; a context has already "
+      "been allocated.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      system_.ExcludeCollisionsBetween(FrameId::get_new_id(),
+                                       FrameId::get_new_id()),
+      std::logic_error,
+      "The call to ExcludeCollisionsBetween is invalid; a context has already "
+      "been allocated.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      system_.AssignCollisionFilterGroups(GeometryId::get_new_id(),
+                                          CollisionFilterGroupMask(),
+                                          CollisionFilterGroupMask()),
+      std::logic_error,
+      "The call to AssignCollisionFilterGroups is invalid; a context has "
+      "already been allocated.");
 }
 
 // Confirms that the direct feedthrough logic is correct -- there is total
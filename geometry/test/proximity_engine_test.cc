@@ -1,6 +1,11 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <set>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -19,6 +24,11 @@ class ProximityEngineTester {
                          const ProximityEngine<T>& ref_engine) {
     return ref_engine.IsDeepCopy(test_engine);
   }
+
+  template <typename T>
+  static int num_unmoved_pair_distances(const ProximityEngine<T>& engine) {
+    return engine.num_unmoved_pair_distances();
+  }
 };
 
 namespace {
@@ -346,6 +356,298 @@ TEST_F(SimplePenetrationTest, PenetrationDynamicAndDynamicSingleSource) {
   ExpectPenetration(origin_id, collide_id, ad_engine.get());
 }
 
+// Performs the collision test between two dynamic spheres whose pair has been
+// excluded through collision filtering; no penetration may be reported.
+TEST_F(SimplePenetrationTest, PenetrationFilteredPairs) {
+  GeometryIndex origin_index = engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+  GeometryIndex collide_index = engine_.AddDynamicGeometry(sphere_);
+  dynamic_map_.push_back(GeometryId::get_new_id());
+  MoveDynamicSphere(collide_index, true /* colliding */);
+  EXPECT_FALSE(engine_.CollisionFiltered(origin_index, collide_index));
+
+  // Filtering by collision filter groups.
+  CollisionFilterGroupMask group1;
+  group1.set(1);
+  CollisionFilterGroupMask group2;
+  group2.set(2);
+  engine_.AssignCollisionFilterGroups(origin_index, group1, group2);
+  engine_.AssignCollisionFilterGroups(collide_index, group2,
+                                      CollisionFilterGroupMask());
+  EXPECT_TRUE(engine_.CollisionFiltered(origin_index, collide_index));
+  ExpectNoPenetration();
+  EXPECT_EQ(engine_.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map_, anchored_map_,
+                std::numeric_limits<double>::infinity()).size(), 0);
+
+  // Restoring the groups brings the penetration back.
+  engine_.AssignCollisionFilterGroups(origin_index, group1,
+                                      CollisionFilterGroupMask());
+  EXPECT_FALSE(engine_.CollisionFiltered(origin_index, collide_index));
+  EXPECT_EQ(engine_.ComputePointPairPenetration(dynamic_map_,
+                                                anchored_map_).size(), 1);
+
+  // Filtering by explicit exclusion; it survives copies.
+  engine_.ExcludeCollisionsBetween(collide_index, origin_index);
+  EXPECT_TRUE(engine_.CollisionFiltered(origin_index, collide_index));
+  ExpectNoPenetration();
+  ProximityEngine<double> copy_engine(engine_);
+  ExpectNoPenetration(&copy_engine);
+}
+
+// Signed distance tests
+
+// A scene with no geometry reports no distances and no nearest geometry.
+GTEST_TEST(ProximityEngineTests, SignedDistanceOnEmptyScene) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> empty_map;
+
+  const double kInf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(
+                empty_map, empty_map, kInf).size(), 0);
+  EXPECT_FALSE(engine.ComputeNearestGeometryToPoint(
+      Vector3<double>::Zero(), empty_map, empty_map, kInf));
+}
+
+// Anchored geometries are never paired with each other.
+GTEST_TEST(ProximityEngineTests, SignedDistanceMultipleAnchored) {
+  ProximityEngine<double> engine;
+  std::vector<GeometryId> dynamic_map;
+  std::vector<GeometryId> anchored_map;
+
+  Sphere sphere{0.5};
+  Isometry3<double> pose = Isometry3<double>::Identity();
+  engine.AddAnchoredGeometry(sphere, pose);
+  anchored_map.push_back(GeometryId::get_new_id());
+  pose.translation() << 2.0, 0, 0;
+  engine.AddAnchoredGeometry(sphere, pose);
+  anchored_map.push_back(GeometryId::get_new_id());
+  EXPECT_EQ(engine.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map, anchored_map,
+                std::numeric_limits<double>::infinity()).size(), 0);
+}
+
+// Two spheres of radius R, one anchored at the origin and one dynamic, placed
+// along the x axis. Confirms distances, witness points and the pruning by the
+// distance threshold.
+class SignedDistanceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    engine_.AddAnchoredGeometry(sphere_, Isometry3<double>::Identity());
+    anchored_id_ = GeometryId::get_new_id();
+    anchored_map_.push_back(anchored_id_);
+    engine_.AddDynamicGeometry(sphere_);
+    dynamic_id_ = GeometryId::get_new_id();
+    dynamic_map_.push_back(dynamic_id_);
+  }
+
+  void MoveDynamicSphere(double x) {
+    std::vector<Isometry3<double>> poses{
+        Isometry3<double>(Translation3d{x, 0, 0})};
+    engine_.UpdateWorldPoses(poses);
+  }
+
+  // Confirms a single pair is reported with the given signed distance between
+  // the anchored sphere at the origin and the dynamic sphere at x.
+  void ExpectSignedDistance(double x, double max_distance) {
+    const std::vector<SignedDistancePair<double>> results =
+        engine_.ComputeSignedDistancePairwiseClosestPoints(
+            dynamic_map_, anchored_map_, max_distance);
+    ASSERT_EQ(results.size(), 1);
+    const SignedDistancePair<double>& pair = results[0];
+    EXPECT_NEAR(pair.distance, x - 2 * radius_, kTolerance);
+
+    // There are no guarantees as to the ordering of which element is A and
+    // which is B.
+    const bool anchored_is_A = pair.id_A == anchored_id_;
+    EXPECT_EQ(anchored_is_A ? pair.id_B : pair.id_A, dynamic_id_);
+    const Vector3<double>& p_WCanchored =
+        anchored_is_A ? pair.p_WCa : pair.p_WCb;
+    const Vector3<double>& p_WCdynamic =
+        anchored_is_A ? pair.p_WCb : pair.p_WCa;
+    EXPECT_TRUE(CompareMatrices(p_WCanchored, Vector3<double>(radius_, 0, 0),
+                                kTolerance, MatrixCompareType::absolute));
+    EXPECT_TRUE(CompareMatrices(p_WCdynamic,
+                                Vector3<double>(x - radius_, 0, 0),
+                                kTolerance, MatrixCompareType::absolute));
+  }
+
+  const double kTolerance{1e-10};
+  ProximityEngine<double> engine_;
+  std::vector<GeometryId> dynamic_map_;
+  std::vector<GeometryId> anchored_map_;
+  GeometryId anchored_id_;
+  GeometryId dynamic_id_;
+  const double radius_{0.5};
+  const Sphere sphere_{radius_};
+};
+
+TEST_F(SignedDistanceTest, SeparatedSpheres) {
+  const double x = 3.0;
+  MoveDynamicSphere(x);
+  ExpectSignedDistance(x, std::numeric_limits<double>::infinity());
+  ExpectSignedDistance(x, 2.5);
+
+  // A threshold smaller than the distance culls the pair.
+  EXPECT_EQ(engine_.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map_, anchored_map_, 1.5).size(), 0);
+}
+
+TEST_F(SignedDistanceTest, PenetratingSpheres) {
+  const double x = 1.5 * radius_;
+  MoveDynamicSphere(x);
+  ExpectSignedDistance(x, 0.0);
+}
+
+// Pairs whose bounding boxes are exactly at the threshold distance are not
+// pruned by the broadphase.
+TEST_F(SignedDistanceTest, PairAtThreshold) {
+  const double x = 3.0;
+  MoveDynamicSphere(x);
+  ExpectSignedDistance(x, x - 2 * radius_);
+}
+
+// Confirms that all pairs among several mutually penetrating geometries are
+// reported with a zero threshold, and that a negative threshold only reports
+// the pairs penetrating deeper than its magnitude. Only the first pair visited
+// by the broadphase would be reported if it pruned touching bounding boxes.
+GTEST_TEST(ProximityEngineTests, SignedDistanceMutuallyPenetrating) {
+  ProximityEngine<double> engine;
+  const double radius = 0.5;
+  const std::vector<double> positions{0.0, 0.2, 0.4, 0.6};
+  std::vector<GeometryId> dynamic_map;
+  std::vector<Isometry3<double>> poses;
+  for (double x : positions) {
+    engine.AddDynamicGeometry(Sphere(radius));
+    dynamic_map.push_back(GeometryId::get_new_id());
+    poses.push_back(Isometry3<double>(Translation3d{x, 0, 0}));
+  }
+  engine.UpdateWorldPoses(poses);
+  const std::vector<GeometryId> anchored_map;
+
+  const std::vector<SignedDistancePair<double>> results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(dynamic_map,
+                                                        anchored_map, 0.0);
+  ASSERT_EQ(results.size(), 6);
+  std::set<std::pair<int64_t, int64_t>> reported_pairs;
+  for (const SignedDistancePair<double>& pair : results) {
+    EXPECT_LT(pair.distance, 0.0);
+    reported_pairs.insert(
+        std::minmax(pair.id_A.get_value(), pair.id_B.get_value()));
+  }
+  EXPECT_EQ(reported_pairs.size(), 6);
+
+  // Signed distances are -0.8 (three pairs), -0.6 (two pairs) and -0.4.
+  const std::vector<SignedDistancePair<double>> deep_results =
+      engine.ComputeSignedDistancePairwiseClosestPoints(dynamic_map,
+                                                        anchored_map, -0.5);
+  ASSERT_EQ(deep_results.size(), 5);
+  for (const SignedDistancePair<double>& pair : deep_results) {
+    EXPECT_LE(pair.distance, -0.5);
+  }
+}
+
+// Confirms that the incremental pose update moves only the listed geometries
+// and that signed distance results of a previous query are not reused once
+// one of the geometries has moved.
+TEST_F(SignedDistanceTest, IncrementalPoseUpdate) {
+  const double kInf = std::numeric_limits<double>::infinity();
+  MoveDynamicSphere(3.0);
+  ExpectSignedDistance(3.0, kInf);
+
+  // An update that lists no geometry leaves the sphere in place.
+  std::vector<Isometry3<double>> poses{
+      Isometry3<double>(Translation3d{4.0, 0, 0})};
+  engine_.UpdateWorldPoses(poses, {});
+  ExpectSignedDistance(3.0, kInf);
+
+  engine_.UpdateWorldPoses(poses, {GeometryIndex(0)});
+  ExpectSignedDistance(4.0, kInf);
+
+  // Repeating the same pose keeps the cached result valid.
+  engine_.UpdateWorldPoses(poses);
+  ExpectSignedDistance(4.0, kInf);
+
+  // Copies start with an empty cache.
+  ProximityEngine<double> copy_engine(engine_);
+  EXPECT_EQ(
+      ProximityEngineTester::num_unmoved_pair_distances(copy_engine), 0);
+  EXPECT_EQ(copy_engine.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map_, anchored_map_, kInf).size(), 1);
+}
+
+// Confirms that only the results of the pairs visited by the most recent query
+// are kept.
+TEST_F(SignedDistanceTest, UnmovedPairDistancesEviction) {
+  const double kInf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(ProximityEngineTester::num_unmoved_pair_distances(engine_), 0);
+  MoveDynamicSphere(3.0);
+  ExpectSignedDistance(3.0, kInf);
+  EXPECT_EQ(ProximityEngineTester::num_unmoved_pair_distances(engine_), 1);
+
+  // The bounding boxes of the spheres are farther apart than the threshold,
+  // so the pair is not visited and its result is dropped.
+  EXPECT_EQ(engine_.ComputeSignedDistancePairwiseClosestPoints(
+                dynamic_map_, anchored_map_, 0.5).size(), 0);
+  EXPECT_EQ(ProximityEngineTester::num_unmoved_pair_distances(engine_), 0);
+
+  // The pair is computed again once it is within the threshold.
+  ExpectSignedDistance(3.0, kInf);
+  EXPECT_EQ(ProximityEngineTester::num_unmoved_pair_distances(engine_), 1);
+}
+
+TEST_F(SignedDistanceTest, NearestGeometryToPoint) {
+  MoveDynamicSphere(3.0);
+
+  // The query point is closer to the dynamic sphere.
+  const Vector3<double> p_WQ(2.0, 0, 0);
+  const optional<SignedDistanceToPoint<double>> nearest =
+      engine_.ComputeNearestGeometryToPoint(
+          p_WQ, dynamic_map_, anchored_map_,
+          std::numeric_limits<double>::infinity());
+  ASSERT_TRUE(nearest);
+  EXPECT_EQ(nearest->id_G, dynamic_id_);
+  EXPECT_NEAR(nearest->distance, 1.0 - radius_, kTolerance);
+  EXPECT_TRUE(CompareMatrices(nearest->p_WN,
+                              Vector3<double>(3.0 - radius_, 0, 0),
+                              kTolerance, MatrixCompareType::absolute));
+
+  // No geometry lies within the threshold.
+  EXPECT_FALSE(engine_.ComputeNearestGeometryToPoint(
+      p_WQ, dynamic_map_, anchored_map_, 0.25));
+}
+
+// When the query point is inside of overlapping geometries, the nearest one is
+// the one it penetrates deepest, even if another penetrated geometry is visited
+// first.
+TEST_F(SignedDistanceTest, NearestGeometryToPointInPenetration) {
+  MoveDynamicSphere(0.6);
+
+  // The query point is 0.35 deep in the anchored sphere, and 0.05 deep in the
+  // dynamic sphere, which is visited first.
+  const Vector3<double> p_WQ(0.15, 0, 0);
+  const optional<SignedDistanceToPoint<double>> nearest =
+      engine_.ComputeNearestGeometryToPoint(
+          p_WQ, dynamic_map_, anchored_map_,
+          std::numeric_limits<double>::infinity());
+  ASSERT_TRUE(nearest);
+  EXPECT_EQ(nearest->id_G, anchored_id_);
+  EXPECT_NEAR(nearest->distance, 0.15 - radius_, kTolerance);
+  EXPECT_TRUE(CompareMatrices(nearest->p_WN, Vector3<double>(radius_, 0, 0),
+                              kTolerance, MatrixCompareType::absolute));
+
+  // The query point is only inside of the dynamic sphere.
+  const optional<SignedDistanceToPoint<double>> nearest_dynamic =
+      engine_.ComputeNearestGeometryToPoint(
+          Vector3<double>(0.8, 0, 0), dynamic_map_, anchored_map_, 0);
+  ASSERT_TRUE(nearest_dynamic);
+  EXPECT_EQ(nearest_dynamic->id_G, dynamic_id_);
+  EXPECT_NEAR(nearest_dynamic->distance, 0.2 - radius_, kTolerance);
+  EXPECT_TRUE(CompareMatrices(nearest_dynamic->p_WN,
+                              Vector3<double>(0.6 + radius_, 0, 0),
+                              kTolerance, MatrixCompareType::absolute));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -101,6 +101,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   EXPECT_DEFAULT_ERROR(default_object->GetFrameId(GeometryId::get_new_id()));
   EXPECT_DEFAULT_ERROR(default_object->GetSourceName(SourceId::get_new_id()));
   EXPECT_DEFAULT_ERROR(default_object->ComputePointPairPenetration());
+  EXPECT_DEFAULT_ERROR(
+      default_object->ComputeSignedDistancePairwiseClosestPoints());
+  EXPECT_DEFAULT_ERROR(
+      default_object->ComputeNearestGeometryToPoint(Vector3<double>::Zero()));
 
 #undef EXPECT_DEFAULT_ERROR
 }
@@ -15,6 +15,8 @@ SingleTimeKinematicConstraintWrapper::SingleTimeKinematicConstraintWrapper(
   Eigen::VectorXd upper_bound;
   rigid_body_constraint->bounds(nullptr, lower_bound, upper_bound);
   set_bounds(lower_bound, upper_bound);
+  // DoEval() updates the kinematics cache shared through kin_helper.
+  set_is_thread_safe(false);
 }
 
 SingleTimeKinematicConstraintWrapper::~SingleTimeKinematicConstraintWrapper() {}
@@ -61,6 +63,8 @@ QuasiStaticConstraintWrapper::QuasiStaticConstraintWrapper(
   Eigen::VectorXd upper_bound;
   rigid_body_constraint->bounds(nullptr, lower_bound, upper_bound);
   set_bounds(lower_bound, upper_bound);
+  // DoEval() updates the kinematics cache shared through kin_helper.
+  set_is_thread_safe(false);
 }
 
 QuasiStaticConstraintWrapper::~QuasiStaticConstraintWrapper() {}
@@ -207,19 +207,21 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     //   mobilizer M.
     // - We are in a base-to-tip recursion and therefore `X_PF(qb_P)` and `X_WP`
     //   have already been updated.
+    // Along with the poses, this updates the entries R_WF, p_PoBo_W and
+    // p_MoBo_F read by the velocity and acceleration passes.
     CalcAcrossMobilizerBodyPoses_BaseToTip(context, pc);
 
     // TODO(amcastro-tri):
     // Update Body specific kinematics. These include:
-    // - p_PB_W: vector from P to B to perform shift operations.
     // - com_W: center of mass.
     // - M_Bo_W: Spatial inertia.
 
-    // TODO(amcastro-tri):
-    // With H_FM(qm) already in the cache (computed by
-    // Mobilizer::UpdatePositionKinematicsCache()) update the cache
-    // entries for H_PB_W, the Jacobian for the SpatialVelocity jump between
-    // body B and its parent body P expressed in the world frame W.
+    // With R_WF and p_MoBo_F already in the cache, update the cache entries
+    // for H_PB_W, the Jacobian for the SpatialVelocity jump between body B
+    // and its parent body P expressed in the world frame W.
+    Eigen::Map<MatrixUpTo6<T>> H_PB_W =
+        GetMutableJacobianFromArray(&pc->get_mutable_H_PB_W_cache());
+    CalcAcrossNodeGeometricJacobianExpressedInWorld(context, *pc, &H_PB_W);
   }
 
   /// This method is used by MultibodyTree within a base-to-tip loop to compute
@@ -332,11 +334,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Shift vector between the parent body P and this node's body B,
     // expressed in the world frame W.
-    // TODO(amcastro-tri): consider computing p_PB_W in
-    // CalcPositionKinematicsCache_BaseToTip() and saving the result in the
-    // position kinematics cache.
-    /* p_PB_W = R_WP * p_PB */
-    Vector3<T> p_PB_W = get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const Vector3<T> p_PB_W = get_p_PoBo_W(pc);
 
     // Since we are in a base-to-tip recursion the parent body P's spatial
     // velocity is already available in the cache.
@@ -449,44 +447,14 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     //       2. V_PB = V_FMb since V_PB = V_PFb + V_FMb + V_MB but since P is
     //          assumed rigid V_PF = 0 and since B is assumed rigid V_MB = 0.
 
-    // Body for this node. Its body frame is also referred to as B whenever no
-    // ambiguity can arise.
-    const Body<T>& body_B = body();
-
-    // Body for this node's parent, or the parent body P. Its body frame is
-    // also referred to as P whenever no ambiguity can arise.
-    const Body<T>& body_P = parent_body();
-
-    // Inboard frame F of this node's mobilizer.
-    const Frame<T>& frame_F = inboard_frame();
-    DRAKE_ASSERT(frame_F.body().index() == body_P.index());
-    // Outboard frame M of this node's mobilizer.
-    const Frame<T>& frame_M = outboard_frame();
-    DRAKE_ASSERT(frame_M.body().index() == body_B.index());
-
     // =========================================================================
     // Computation of A_PB = DtP(V_PB), Eq. (4).
 
-    // TODO(amcastro-tri): consider caching these. Especially true if bodies are
-    // flexible. Also used in velocity kinematics.
-    const Isometry3<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
-    const Isometry3<T> X_MB = frame_M.CalcPoseInBodyFrame(context).inverse();
-
-    // Pose of the parent body P in world frame W.
-    // Available since we are called within a base-to-tip recursion.
-    const Isometry3<T>& X_WP = get_X_WP(pc);
-
-    // Orientation (rotation) of frame F with respect to the world frame W.
-    // TODO(amcastro-tri): consider caching X_WF since it is also used to
-    // compute H_PB_W.
-    const Matrix3<T> R_WF = X_WP.linear() * X_PF.linear();
-
-    // Vector from Mo to Bo expressed in frame F as needed below:
-    // TODO(amcastro-tri): consider caching this since it is also used to
-    // compute H_PB_W.
-    const Vector3<T> p_MB_F =
-        /* p_MB_F = R_FM * p_MB_M */
-        get_X_FM(pc).linear() * X_MB.translation();
+    // Orientation (rotation) of frame F with respect to the world frame W and
+    // vector from Mo to Bo expressed in frame F, both available in the position
+    // kinematics cache.
+    const Matrix3<T> R_WF = get_R_WF(pc);
+    const Vector3<T> p_MB_F = get_p_MoBo_F(pc);
 
     // Across mobilizer velocity is available from the velocity kinematics.
     const SpatialVelocity<T>& V_FM = get_V_FM(vc);
@@ -518,11 +486,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Shift vector between the parent body P and this node's body B,
     // expressed in the world frame W.
-    // TODO(amcastro-tri): consider computing p_PB_W in
-    // CalcPositionKinematicsCache_BaseToTip() and saving the result in the
-    // position kinematics cache.
-    /* p_PB_W = R_WP * p_PB */
-    Vector3<T> p_PB_W = get_X_WP(pc).linear() * get_X_PB(pc).translation();
+    const Vector3<T> p_PB_W = get_p_PoBo_W(pc);
 
     get_mutable_A_WB_from_array(&A_WB_array) =
         A_WP.ComposeWithMovingFrameAcceleration(p_PB_W, V_WP.rotational(),
@@ -678,8 +642,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     DRAKE_DEMAND(frame_M.body().index() == body_B.index());
     const Isometry3<T> X_BM = frame_M.CalcPoseInBodyFrame(context);
     const Vector3<T>& p_BoMo_B = X_BM.translation();
-    const Matrix3<T>& R_WB = get_X_WB(pc).linear();
-    const Vector3<T> p_BoMo_W = R_WB * p_BoMo_B;
+    const Vector3<T> p_BoMo_W = get_R_WB(pc) * p_BoMo_B;
 
     // Output spatial force that would need to be exerted by this node's
     // mobilizer in order to attain the prescribed acceleration A_WB.
@@ -694,16 +657,15 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     for (const BodyNode<T>* child_node : children_) {
       BodyNodeIndex child_node_index = child_node->index();
 
-      // Pose of child body C in this node's body frame B.
-      const Isometry3<T>& X_BC = child_node->get_X_PB(pc);
-      // p_BoCo_W = R_WB * p_BoCo_B:
-      const Vector3<T> p_BoCo_W = R_WB * X_BC.translation();
+      // p_BoCo_W = R_WB * p_BoCo_B, available in the position kinematics
+      // cache:
+      const Vector3<T> p_BoCo_W = child_node->get_p_PoBo_W(pc);
 
       // p_CoMc_W:
       const Frame<T>& frame_Mc = child_node->outboard_frame();
-      const Matrix3<T>& R_WC = child_node->get_X_WB(pc).linear();
       const Isometry3<T> X_CMc = frame_Mc.CalcPoseInBodyFrame(context);
-      const Vector3<T>& p_CoMc_W = R_WC * X_CMc.translation();
+      const Vector3<T> p_CoMc_W =
+          child_node->get_R_WB(pc) * X_CMc.translation();
 
       // Shift position vector from child C outboard mobilizer frame Mc to body
       // B outboard mobilizer Mc. p_MoMc_W:
@@ -733,11 +695,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Re-express F_BMo_W in the inboard frame F before projecting it onto the
     // sub-space generated by H_FM(q).
-    const Isometry3<T> X_PF = inboard_frame().CalcPoseInBodyFrame(context);
-    const Isometry3<T>& X_WP = get_X_WP(pc);
-    // TODO(amcastro-tri): consider caching X_WF since also used in position and
-    // velocity kinematics.
-    const Matrix3<T> R_WF = X_WP.linear() * X_PF.linear();
+    const Matrix3<T> R_WF = get_R_WF(pc);
     const SpatialForce<T> F_BMo_F = R_WF.transpose() * F_BMo_W;
 
     // Generalized velocities and forces use the same indexing.
@@ -776,8 +734,10 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
   ///   node's body B in its parent body P, expressed in W, by
   ///   `V_PB_W = H_PB_W⋅v_B`.
   ///
-  /// @pre The position kinematics cache `pc` was already updated to be in sync
-  /// with `context` by MultibodyTree::CalcPositionKinematicsCache().
+  /// @pre The entries `R_WF` and `p_MoBo_F` for this node are already updated
+  /// in `pc` to be in sync with `context`. This is the case within
+  /// CalcPositionKinematicsCache_BaseToTip(), which uses this method to update
+  /// the `H_PB_W` entries of `pc`.
   void CalcAcrossNodeGeometricJacobianExpressedInWorld(
       const MultibodyTreeContext<T>& context,
       const PositionKinematicsCache<T>& pc,
@@ -788,24 +748,11 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     DRAKE_DEMAND(H_PB_W->rows() == 6);
     DRAKE_DEMAND(H_PB_W->cols() == get_num_mobilizer_velocites());
 
-    // Inboard frame F of this node's mobilizer.
-    const Frame<T>& frame_F = inboard_frame();
-    // Outboard frame M of this node's mobilizer.
-    const Frame<T>& frame_M = outboard_frame();
-
-    const Isometry3<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
-    const Isometry3<T> X_MB = frame_M.CalcPoseInBodyFrame(context).inverse();
-
-    // Pose of the parent body P in world frame W.
-    const Isometry3<T>& X_WP = get_X_WP(pc);
-
     // Orientation (rotation) of frame F with respect to the world frame W.
-    const Matrix3<T> R_WF = X_WP.linear() * X_PF.linear();
+    const Matrix3<T> R_WF = get_R_WF(pc);
 
     // Vector from Mo to Bo expressed in frame F as needed below:
-    const Vector3<T> p_MB_F =
-        /* p_MB_F = R_FM * p_MB_M */
-        get_X_FM(pc).linear() * X_MB.translation();
+    const Vector3<T> p_MB_F = get_p_MoBo_F(pc);
 
     // Compute the imob-th column in J_PB_W:
     VectorUpTo6<T> v = VectorUpTo6<T>::Zero(get_num_mobilizer_velocites());
@@ -967,11 +914,8 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     // Body for this node.
     const Body<T>& body_B = body();
 
-    // Get pose of B in W.
-    const Isometry3<T>& X_WB = get_X_WB(pc);
-
     // Get R_WB.
-    const Matrix3<T> R_WB = X_WB.linear();
+    const Matrix3<T> R_WB = get_R_WB(pc);
 
     // Compute the spatial inertia for this body and re-express in W frame.
     const SpatialInertia<T> M_B = body_B.CalcSpatialInertiaInBodyFrame(context);
@@ -982,12 +926,8 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
 
     // Add articulated body inertia contributions from all children.
     for (const BodyNode<T>* child : children_) {
-      // Get X_BC (which is X_PB for child).
-      const Isometry3<T>& X_BC = child->get_X_PB(pc);
-
-      // Compute shift vector p_CoBo_W.
-      const Vector3<T> p_CoBo_B = -X_BC.translation();
-      const Vector3<T> p_CoBo_W = R_WB * p_CoBo_B;
+      // Shift vector p_CoBo_W, with p_BoCo_W the p_PoBo_W entry for child.
+      const Vector3<T> p_CoBo_W = -child->get_p_PoBo_W(pc);
 
       // Pull Pplus_BC_W from cache (which is Pplus_PB_W for child).
       const ArticulatedBodyInertia<T>& Pplus_BC_W = child->get_Pplus_PB_W(*abc);
@@ -1127,6 +1067,53 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     return pc->get_mutable_X_PB(topology_.index);
   }
 
+  // Returns the orientation R_WB of the body B associated with this node in
+  // the world frame W.
+  typename Isometry3<T>::ConstLinearPart get_R_WB(
+      const PositionKinematicsCache<T>& pc) const {
+    return get_X_WB(pc).linear();
+  }
+
+  // Returns the orientation R_WP of the parent body P in the world frame W.
+  typename Isometry3<T>::ConstLinearPart get_R_WP(
+      const PositionKinematicsCache<T>& pc) const {
+    return get_X_WP(pc).linear();
+  }
+
+  // Returns the orientation R_WF of this node's mobilizer inboard frame F in
+  // the world frame W.
+  const Matrix3<T>& get_R_WF(const PositionKinematicsCache<T>& pc) const {
+    return pc.get_R_WF(topology_.index);
+  }
+
+  // Mutable version of get_R_WF().
+  Matrix3<T>& get_mutable_R_WF(PositionKinematicsCache<T>* pc) const {
+    return pc->get_mutable_R_WF(topology_.index);
+  }
+
+  // Returns the position vector from the origin Po of the parent body P to the
+  // origin Bo of body B, expressed in the world frame W.
+  const Vector3<T>& get_p_PoBo_W(const PositionKinematicsCache<T>& pc) const {
+    return pc.get_p_PoBo_W(topology_.index);
+  }
+
+  // Mutable version of get_p_PoBo_W().
+  Vector3<T>& get_mutable_p_PoBo_W(PositionKinematicsCache<T>* pc) const {
+    return pc->get_mutable_p_PoBo_W(topology_.index);
+  }
+
+  // Returns the position vector from the origin Mo of this node's mobilizer
+  // outboard frame M to the origin Bo of body B, expressed in the inboard
+  // frame F.
+  const Vector3<T>& get_p_MoBo_F(const PositionKinematicsCache<T>& pc) const {
+    return pc.get_p_MoBo_F(topology_.index);
+  }
+
+  // Mutable version of get_p_MoBo_F().
+  Vector3<T>& get_mutable_p_MoBo_F(PositionKinematicsCache<T>* pc) const {
+    return pc->get_mutable_p_MoBo_F(topology_.index);
+  }
+
   // =========================================================================
   // VelocityKinematicsCache Accessors and Mutators.
 
@@ -1319,6 +1306,7 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     // - X_FM(qm_B)
     // - X_WP(q(W:B)), where q(W:B) includes all positions in the kinematics
     //                 path from body B to the world W.
+    const Isometry3<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
     const Isometry3<T> X_MB = frame_M.CalcPoseInBodyFrame(context).inverse();
     const Isometry3<T>& X_FM = get_X_FM(*pc);  // mobilizer.Eval_X_FM(ctx)
     const Isometry3<T>& X_WP = get_X_WP(*pc);  // body_P.EvalPoseInWorld(ctx)
@@ -1342,6 +1330,15 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     X_PB = frame_F.CalcOffsetPoseInBody(context, X_FB);
 
     X_WB = X_WP * X_PB;
+
+    // Quantities read by the velocity and acceleration recursions:
+    // - R_WF = R_WP * R_PF, orientation of the inboard frame F in W.
+    // - p_PoBo_W = R_WP * p_PoBo_P, used to perform shift operations.
+    // - p_MoBo_F = R_FM * p_MoBo_M.
+    const Matrix3<T> R_WP = X_WP.linear();
+    get_mutable_R_WF(pc) = R_WP * X_PF.linear();
+    get_mutable_p_PoBo_W(pc) = R_WP * X_PB.translation();
+    get_mutable_p_MoBo_F(pc) = X_FM.linear() * X_MB.translation();
   }
 
   // Computes position dependent kinematics associated with `this` mobilizer
@@ -1398,11 +1395,8 @@ class BodyNode : public MultibodyTreeElement<BodyNode<T>, BodyNodeIndex> {
     // Body for this node.
     const Body<T>& body_B = body();
 
-    // Pose of B in W.
-    const Isometry3<T>& X_WB = get_X_WB(pc);
-
     // Orientation of B in W.
-    const Matrix3<T> R_WB = X_WB.linear();
+    const Matrix3<T> R_WB = get_R_WB(pc);
 
     // Body spatial velocity in W.
     const SpatialVelocity<T>& V_WB = get_V_WB(vc);
@@ -87,15 +87,7 @@ class MobilizerImpl : public Mobilizer<T> {
   /// positions.
   Eigen::VectorBlock<VectorX<T>, kNq> get_mutable_positions(
       systems::State<T>* state) const {
-    Eigen::VectorBlock<VectorX<T>> xc =
-        dynamic_cast<systems::BasicVector<T>&>(
-            state->get_mutable_continuous_state().get_mutable_vector()).
-            get_mutable_value();
-    // xc.nestedExpression() resolves to "VectorX<T>&" since the continuous
-    // state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().template segment<kNq>(
+    return get_mutable_state_vector(state).template segment<kNq>(
         this->get_positions_start());
   }
 
@@ -104,15 +96,7 @@ class MobilizerImpl : public Mobilizer<T> {
   /// velocities.
   Eigen::VectorBlock<VectorX<T>, kNv> get_mutable_velocities(
       systems::State<T>* state) const {
-    Eigen::VectorBlock<VectorX<T>> xc =
-        dynamic_cast<systems::BasicVector<T>&>(
-            state->get_mutable_continuous_state().get_mutable_vector()).
-            get_mutable_value();
-    // xc.nestedExpression() resolves to "VectorX<T>&" since the continuous
-    // state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().template segment<kNv>(
+    return get_mutable_state_vector(state).template segment<kNv>(
         this->get_velocities_start());
   }
 
@@ -181,6 +165,25 @@ class MobilizerImpl : public Mobilizer<T> {
   }
 
  private:
+  // Returns a mutable reference to the multibody state vector x = [q; v]
+  // stored in `state`. A MultibodyTreeContext stores x either as its only
+  // group of discrete state variables or as continuous state, see
+  // MultibodyTreeContext::is_state_discrete().
+  static VectorX<T>& get_mutable_state_vector(systems::State<T>* state) {
+    Eigen::VectorBlock<VectorX<T>> x =
+        state->get_discrete_state().num_groups() > 0 ?
+        state->get_mutable_discrete_state().get_mutable_vector(0).
+            get_mutable_value() :
+        dynamic_cast<systems::BasicVector<T>&>(
+            state->get_mutable_continuous_state().get_mutable_vector()).
+            get_mutable_value();
+    // x.nestedExpression() resolves to "VectorX<T>&" since the state is a
+    // BasicVector.
+    // If we do return x.segment() directly, we would instead get a
+    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
+    return x.nestedExpression();
+  }
+
   // Returns the index in the global array of generalized coordinates in the
   // MultibodyTree model to the first component of the generalized coordinates
   // vector that corresponds to this mobilizer.
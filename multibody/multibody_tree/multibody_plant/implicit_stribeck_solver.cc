@@ -0,0 +1,227 @@
+#include "drake/multibody/multibody_tree/multibody_plant/implicit_stribeck_solver.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+namespace multibody_plant {
+
+namespace {
+// Maximum number of halvings of the Newton-Raphson step performed by the
+// backtracking line search.
+const int kMaxLineSearchIterations = 10;
+}  // namespace
+
+template <typename T>
+ImplicitStribeckSolver<T>::ImplicitStribeckSolver(int nv) : nv_(nv) {
+  DRAKE_THROW_UNLESS(nv > 0);
+  v_.resize(nv_);
+  v_trial_.resize(nv_);
+  Delta_v_.resize(nv_);
+  R_.resize(nv_);
+  R_trial_.resize(nv_);
+  J_.resize(nv_, nv_);
+  J_lu_ = Eigen::PartialPivLU<MatrixX<T>>(nv_);
+  ResizeContactWorkspace(0);
+}
+
+template <typename T>
+void ImplicitStribeckSolver<T>::set_solver_parameters(
+    const ImplicitStribeckSolverParameters& parameters) {
+  DRAKE_THROW_UNLESS(parameters.stiction_tolerance > 0);
+  DRAKE_THROW_UNLESS(parameters.max_iterations > 0);
+  DRAKE_THROW_UNLESS(parameters.tolerance > 0);
+  parameters_ = parameters;
+}
+
+template <typename T>
+void ImplicitStribeckSolver<T>::ResizeContactWorkspace(int nc) {
+  vn_.resize(nc);
+  vt_.resize(2 * nc);
+  fn_.resize(nc);
+  ft_.resize(2 * nc);
+  Delta_vn_.resize(nc);
+  Delta_vt_.resize(2 * nc);
+  dfn_dvn_.resize(nc);
+  dft_dvt_.resize(2, 2 * nc);
+  dft_dvn_.resize(2 * nc);
+}
+
+template <typename T>
+void ImplicitStribeckSolver<T>::SetProblemData(
+    const MatrixX<T>* M, const MatrixX<T>* Jn, const MatrixX<T>* Jt,
+    const VectorX<T>* p_star, const VectorX<T>* x0,
+    const VectorX<T>* stiffness, const VectorX<T>* dissipation,
+    const VectorX<T>* mu) {
+  DRAKE_THROW_UNLESS(M != nullptr);
+  DRAKE_THROW_UNLESS(Jn != nullptr);
+  DRAKE_THROW_UNLESS(Jt != nullptr);
+  DRAKE_THROW_UNLESS(p_star != nullptr);
+  DRAKE_THROW_UNLESS(x0 != nullptr);
+  DRAKE_THROW_UNLESS(stiffness != nullptr);
+  DRAKE_THROW_UNLESS(dissipation != nullptr);
+  DRAKE_THROW_UNLESS(mu != nullptr);
+  const int nc = x0->size();
+  DRAKE_THROW_UNLESS(M->rows() == nv_ && M->cols() == nv_);
+  DRAKE_THROW_UNLESS(Jn->rows() == nc && Jn->cols() == nv_);
+  DRAKE_THROW_UNLESS(Jt->rows() == 2 * nc && Jt->cols() == nv_);
+  DRAKE_THROW_UNLESS(p_star->size() == nv_);
+  DRAKE_THROW_UNLESS(stiffness->size() == nc);
+  DRAKE_THROW_UNLESS(dissipation->size() == nc);
+  DRAKE_THROW_UNLESS(mu->size() == nc);
+  problem_data_.M = M;
+  problem_data_.Jn = Jn;
+  problem_data_.Jt = Jt;
+  problem_data_.p_star = p_star;
+  problem_data_.x0 = x0;
+  problem_data_.stiffness = stiffness;
+  problem_data_.dissipation = dissipation;
+  problem_data_.mu = mu;
+  ResizeContactWorkspace(nc);
+}
+
+template <typename T>
+void ImplicitStribeckSolver<T>::CalcResidual(
+    double dt, const VectorX<T>& v, VectorX<T>* R, MatrixX<T>* J) {
+  using std::sqrt;
+  const MatrixX<T>& M = *problem_data_.M;
+  const MatrixX<T>& Jn = *problem_data_.Jn;
+  const MatrixX<T>& Jt = *problem_data_.Jt;
+  const VectorX<T>& x0 = *problem_data_.x0;
+  const VectorX<T>& k = *problem_data_.stiffness;
+  const VectorX<T>& d = *problem_data_.dissipation;
+  const VectorX<T>& mu = *problem_data_.mu;
+  const double v_stiction = parameters_.stiction_tolerance;
+  const int nc = num_contacts();
+
+  vn_ = Jn * v;
+  vt_ = Jt * v;
+
+  for (int ic = 0; ic < nc; ++ic) {
+    // Normal force, Eq. (2).
+    const T x = x0(ic) - dt * vn_(ic);
+    const T damping = 1.0 - d(ic) * vn_(ic);
+    if (x > 0 && damping > 0) {
+      fn_(ic) = k(ic) * x * damping;
+      dfn_dvn_(ic) = -k(ic) * (dt * damping + x * d(ic));
+    } else {
+      fn_(ic) = 0;
+      dfn_dvn_(ic) = 0;
+    }
+
+    // Friction force, Eq. (3). We write it as fₜ = -g(‖vₜ‖) fₙ vₜ with
+    // g(‖vₜ‖) = μ(‖vₜ‖)/‖vₜ‖, which is smooth at vₜ = 0.
+    const auto vt_ic = vt_.template segment<2>(2 * ic);
+    const T slip = vt_ic.norm();
+    const T s = slip / v_stiction;
+    auto dft_dvt_ic = dft_dvt_.template block<2, 2>(0, 2 * ic);
+    T g;
+    if (s < 1) {
+      g = mu(ic) * (2.0 - s) / v_stiction;
+      dft_dvt_ic = -fn_(ic) * g * Matrix2<T>::Identity();
+      if (slip > 0) {
+        dft_dvt_ic +=
+            fn_(ic) * mu(ic) / (v_stiction * v_stiction) *
+            vt_ic * vt_ic.transpose() / slip;
+      }
+    } else {
+      g = mu(ic) / slip;
+      const Vector2<T> that = vt_ic / slip;
+      dft_dvt_ic = -fn_(ic) * g *
+          (Matrix2<T>::Identity() - that * that.transpose());
+    }
+    ft_.template segment<2>(2 * ic) = -g * fn_(ic) * vt_ic;
+    dft_dvn_.template segment<2>(2 * ic) = -g * vt_ic * dfn_dvn_(ic);
+  }
+
+  // Residual of Eq. (1).
+  *R = M * v - *problem_data_.p_star -
+      dt * (Jn.transpose() * fn_ + Jt.transpose() * ft_);
+
+  if (J == nullptr) return;
+
+  // Jacobian of the residual, J = ∂R/∂v.
+  *J = M;
+  for (int ic = 0; ic < nc; ++ic) {
+    const auto Jn_ic = Jn.row(ic);
+    const auto Jt_ic = Jt.template middleRows<2>(2 * ic);
+    // Gradient of the friction force with respect to v.
+    const Eigen::Matrix<T, 2, Eigen::Dynamic> dft_dv =
+        dft_dvt_.template block<2, 2>(0, 2 * ic) * Jt_ic +
+        dft_dvn_.template segment<2>(2 * ic) * Jn_ic;
+    *J -= dt * (Jn_ic.transpose() * dfn_dvn_(ic) * Jn_ic +
+                Jt_ic.transpose() * dft_dv);
+  }
+}
+
+template <typename T>
+ImplicitStribeckSolverResult ImplicitStribeckSolver<T>::SolveWithGuess(
+    double dt, const VectorX<T>& v_guess) {
+  using std::abs;
+  using std::max;
+  DRAKE_THROW_UNLESS(dt > 0);
+  DRAKE_THROW_UNLESS(v_guess.size() == nv_);
+  DRAKE_DEMAND(problem_data_.M != nullptr);
+
+  const MatrixX<T>& Jn = *problem_data_.Jn;
+  const MatrixX<T>& Jt = *problem_data_.Jt;
+  const double tolerance =
+      parameters_.tolerance * parameters_.stiction_tolerance;
+
+  statistics_ = ImplicitStribeckSolverIterationStats();
+  v_ = v_guess;
+
+  for (int iter = 0; iter < parameters_.max_iterations; ++iter) {
+    CalcResidual(dt, v_, &R_, &J_);
+    J_lu_.compute(J_);
+    Delta_v_ = -J_lu_.solve(R_);
+    for (int i = 0; i < nv_; ++i) {
+      if (std::isnan(ExtractDoubleOrThrow(Delta_v_(i)))) {
+        return ImplicitStribeckSolverResult::kLinearSolverFailed;
+      }
+    }
+
+    // Backtracking line search on the norm of the residual. If no decrease is
+    // found, the last (and smallest) step is taken.
+    const T residual_norm = R_.norm();
+    double alpha = 1.0;
+    // The step length used to compute v_trial_, which is the one taken.
+    double alpha_accepted = alpha;
+    for (int ls_iter = 0; ls_iter < kMaxLineSearchIterations; ++ls_iter) {
+      alpha_accepted = alpha;
+      v_trial_ = v_ + alpha * Delta_v_;
+      CalcResidual(dt, v_trial_, &R_trial_, nullptr);
+      if (R_trial_.norm() < residual_norm) break;
+      alpha /= 2.0;
+      ++statistics_.num_line_search_iterations;
+    }
+    v_ = v_trial_;
+
+    // Convergence is monitored on the change of the contact velocities.
+    Delta_vn_ = alpha_accepted * (Jn * Delta_v_);
+    Delta_vt_ = alpha_accepted * (Jt * Delta_v_);
+    double error = 0;
+    for (int i = 0; i < Delta_vn_.size(); ++i)
+      error = max(error, abs(ExtractDoubleOrThrow(Delta_vn_(i))));
+    for (int i = 0; i < Delta_vt_.size(); ++i)
+      error = max(error, abs(ExtractDoubleOrThrow(Delta_vt_(i))));
+
+    statistics_.num_iterations = iter + 1;
+    statistics_.contact_velocities_error = error;
+    if (error < tolerance) return ImplicitStribeckSolverResult::kSuccess;
+  }
+
+  return ImplicitStribeckSolverResult::kMaxIterationsReached;
+}
+
+}  // namespace multibody_plant
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class drake::multibody::multibody_plant::ImplicitStribeckSolver)
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <Eigen/LU>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+namespace multibody_plant {
+
+/// The result from ImplicitStribeckSolver::SolveWithGuess() used to report the
+/// success or failure of the solver.
+enum class ImplicitStribeckSolverResult {
+  /// Successful computation.
+  kSuccess = 0,
+
+  /// The maximum number of iterations was reached.
+  kMaxIterationsReached = 1,
+
+  /// The linear solver used within the Newton-Raphson loop failed.
+  /// This might be caused by a divergent iteration that led to an invalid
+  /// Jacobian matrix.
+  kLinearSolverFailed = 2
+};
+
+/// These are the parameters controlling the iteration process of the
+/// ImplicitStribeckSolver solver.
+struct ImplicitStribeckSolverParameters {
+  /// The stiction tolerance vₛ for the slip velocity in the regularized
+  /// Stribeck friction model, in m/s. Roughly, for an externally applied
+  /// tangential forcing fₜ and normal force fₙ, under "stiction", the
+  /// slip velocity will be approximately vₜ ≈ vₛ fₜ/(μfₙ). In other words,
+  /// the maximum slip error of the Stribeck approximation occurs at the edge
+  /// of the friction cone when fₜ = μfₙ and vₜ = vₛ.
+  double stiction_tolerance{1.0e-4};
+
+  /// The maximum number of Newton-Raphson iterations allowed.
+  int max_iterations{100};
+
+  /// The solver is said to converge when the change in the contact velocities
+  /// (normal and tangential) between two consecutive iterations is smaller
+  /// than `tolerance⋅vₛ`, in the max norm, with vₛ the stiction tolerance.
+  double tolerance{1.0e-4};
+};
+
+/// Statistics collected by ImplicitStribeckSolver::SolveWithGuess() during
+/// the last call to that method.
+struct ImplicitStribeckSolverIterationStats {
+  /// The number of Newton-Raphson iterations performed by the solver.
+  int num_iterations{0};
+
+  /// The total number of times the line search halved the Newton-Raphson
+  /// step, accumulated over all iterations.
+  int num_line_search_iterations{0};
+
+  /// The max norm of the change in contact velocities at the last iteration.
+  double contact_velocities_error{-1.0};
+};
+
+/// %ImplicitStribeckSolver solves for the generalized velocities of a
+/// multibody system at the next time step of a discrete, fixed time step,
+/// time stepping scheme in which both the compliant normal contact forces and
+/// the regularized Coulomb friction forces are treated implicitly.
+///
+/// Given the generalized velocities v⁰ and the mass matrix M at the start of
+/// the time step and given the generalized momentum p* = M v⁰ + δt τ, which
+/// includes the effect of all non-contact generalized forces τ, this solver
+/// computes the generalized velocities v at the next time step that satisfy
+/// the momentum balance: <pre>
+///   M v = p* + δt Jₙᵀ fₙ(v) + δt Jₜᵀ fₜ(v)                                 (1)
+/// </pre>
+/// where Jₙ is the `nc x nv` Jacobian of the normal separation velocities
+/// vₙ = Jₙ v, with nc the number of contact points, and Jₜ is the
+/// `2nc x nv` Jacobian of the tangential velocities vₜ = Jₜ v. The tangential
+/// velocity for the i-th contact point corresponds to rows `2i` and `2i+1` in
+/// Jₜ. The normal force at the i-th contact point is modeled as a compliant
+/// force with Hunt-Crossley dissipation, <pre>
+///   fₙ = k (x₀ - δt vₙ)₊ (1 - d vₙ)₊                                     (2)
+/// </pre>
+/// with x₀ the penetration depth at the start of the time step, k the
+/// contact stiffness and d the Hunt-Crossley dissipation. Notice that
+/// vₙ > 0 when the bodies separate and therefore `x = x₀ - δt vₙ` is an
+/// implicit approximation of the penetration depth at the next time step.
+/// Friction is modeled with a regularized Coulomb's law: <pre>
+///   fₜ = -μ(‖vₜ‖) fₙ vₜ/‖vₜ‖                                              (3)
+/// </pre>
+/// where `μ(s) = μ s (2 - s)` for `s = ‖vₜ‖/vₛ < 1` and `μ(s) = μ` otherwise.
+/// This regularization is continuously differentiable and leads to a smooth
+/// function of vₜ in Eq. (3), even at vₜ = 0.
+///
+/// Eq. (1) is solved with a Newton-Raphson iteration on the generalized
+/// velocities v. A backtracking line search on the norm of the residual of
+/// Eq. (1) is used to globalize the iteration.
+///
+/// All the memory that is independent of the number of contact points is
+/// allocated at construction. Memory that depends on the number of contact
+/// points only gets re-allocated when the number of contact points changes.
+///
+/// @tparam T The scalar type. Must be a valid Eigen scalar.
+///
+/// Instantiated templates for the following kinds of T's are provided:
+/// - double
+/// - AutoDiffXd
+///
+/// They are already available to link against in the containing library.
+/// No other values for T are currently supported.
+template <typename T>
+class ImplicitStribeckSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImplicitStribeckSolver)
+
+  /// Instantiates a solver for a problem with `nv` generalized velocities.
+  /// @throws std::exception if `nv` is non-positive.
+  explicit ImplicitStribeckSolver(int nv);
+
+  /// Sets the data for the problem to be solved as outlined by Eq. (1) in this
+  /// class's documentation. The data is referenced by pointer and therefore
+  /// it **must** outlive any subsequent call to SolveWithGuess().
+  ///
+  /// @param[in] M The mass matrix, of size `nv x nv`.
+  /// @param[in] Jn The normal separation velocities Jacobian, of size
+  ///   `nc x nv`.
+  /// @param[in] Jt The tangential velocities Jacobian, of size `2nc x nv`.
+  /// @param[in] p_star The generalized momentum p* = M v⁰ + δt τ, of size
+  ///   `nv`.
+  /// @param[in] x0 The penetration depth of each contact point at the start
+  ///   of the time step, of size `nc`.
+  /// @param[in] stiffness The stiffness k of each contact point, of size `nc`.
+  /// @param[in] dissipation The Hunt-Crossley dissipation d of each contact
+  ///   point, of size `nc`.
+  /// @param[in] mu The friction coefficient μ of each contact point, of size
+  ///   `nc`.
+  ///
+  /// @throws std::exception if any of the pointers is nullptr or if the sizes
+  /// of the input data are not consistent with each other.
+  void SetProblemData(
+      const MatrixX<T>* M, const MatrixX<T>* Jn, const MatrixX<T>* Jt,
+      const VectorX<T>* p_star, const VectorX<T>* x0,
+      const VectorX<T>* stiffness, const VectorX<T>* dissipation,
+      const VectorX<T>* mu);
+
+  /// Given an initial guess `v_guess`, this method uses a Newton-Raphson
+  /// iteration to find a solution for the generalized velocities satisfying
+  /// Eq. (1) in this class's documentation for a time step `dt`.
+  /// The result can be retrieved with get_generalized_velocities() and
+  /// related accessors.
+  /// @pre SetProblemData() was called with data that is still valid.
+  ImplicitStribeckSolverResult SolveWithGuess(
+      double dt, const VectorX<T>& v_guess);
+
+  /// Returns the generalized velocities v solution of Eq. (1), see this
+  /// class's documentation, for the last call to SolveWithGuess().
+  const VectorX<T>& get_generalized_velocities() const { return v_; }
+
+  /// Returns the normal separation velocities vₙ = Jₙ v, of size `nc`.
+  const VectorX<T>& get_normal_velocities() const { return vn_; }
+
+  /// Returns the tangential velocities vₜ = Jₜ v, of size `2nc`.
+  const VectorX<T>& get_tangential_velocities() const { return vt_; }
+
+  /// Returns the normal forces fₙ at each contact point, of size `nc`.
+  const VectorX<T>& get_normal_forces() const { return fn_; }
+
+  /// Returns the friction forces fₜ at each contact point, of size `2nc`.
+  const VectorX<T>& get_friction_forces() const { return ft_; }
+
+  /// Returns statistics recorded during the last call to SolveWithGuess().
+  const ImplicitStribeckSolverIterationStats& get_iteration_statistics()
+  const {
+    return statistics_;
+  }
+
+  /// Returns the current set of parameters controlling the iteration process.
+  const ImplicitStribeckSolverParameters& get_solver_parameters() const {
+    return parameters_;
+  }
+
+  /// Sets the parameters to be used by the solver.
+  /// @throws std::exception if any of the parameters is non-positive.
+  void set_solver_parameters(
+      const ImplicitStribeckSolverParameters& parameters);
+
+ private:
+  // Pointers to the problem data set with SetProblemData().
+  struct ProblemDataPointers {
+    const MatrixX<T>* M{nullptr};
+    const MatrixX<T>* Jn{nullptr};
+    const MatrixX<T>* Jt{nullptr};
+    const VectorX<T>* p_star{nullptr};
+    const VectorX<T>* x0{nullptr};
+    const VectorX<T>* stiffness{nullptr};
+    const VectorX<T>* dissipation{nullptr};
+    const VectorX<T>* mu{nullptr};
+  };
+
+  // Returns the number of contact points in the current problem data.
+  int num_contacts() const {
+    return static_cast<int>(problem_data_.x0->size());
+  }
+
+  // Resizes the workspace that depends on the number of contact points.
+  // It only re-allocates when nc changes.
+  void ResizeContactWorkspace(int nc);
+
+  // Computes the residual R(v) of Eq. (1) together with the contact
+  // velocities and forces for the generalized velocities v. If `J` is not
+  // nullptr, it also computes the Jacobian J = ∂R/∂v of the residual.
+  // On output, vn_, vt_, fn_ and ft_ contain the contact velocities and
+  // forces for `v`.
+  void CalcResidual(
+      double dt, const VectorX<T>& v, VectorX<T>* R, MatrixX<T>* J);
+
+  const int nv_;
+  ImplicitStribeckSolverParameters parameters_;
+  ProblemDataPointers problem_data_;
+  ImplicitStribeckSolverIterationStats statistics_;
+
+  // Workspace sized with the number of generalized velocities.
+  VectorX<T> v_;
+  VectorX<T> v_trial_;
+  VectorX<T> Delta_v_;
+  VectorX<T> R_;
+  VectorX<T> R_trial_;
+  MatrixX<T> J_;
+  Eigen::PartialPivLU<MatrixX<T>> J_lu_;
+
+  // Workspace sized with the number of contact points.
+  VectorX<T> vn_;
+  VectorX<T> vt_;
+  VectorX<T> fn_;
+  VectorX<T> ft_;
+  VectorX<T> Delta_vn_;
+  VectorX<T> Delta_vt_;
+  // ∂fₙ/∂vₙ for each contact point.
+  VectorX<T> dfn_dvn_;
+  // ∂fₜ/∂vₜ for each contact point, stored as 2x2 blocks column by column.
+  MatrixX<T> dft_dvt_;
+  // ∂fₜ/∂vₙ for each contact point.
+  VectorX<T> dft_dvn_;
+};
+
+}  // namespace multibody_plant
+}  // namespace multibody
+}  // namespace drake
@@ -10,6 +10,7 @@
 #include "drake/geometry/frame_kinematics_vector.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
+#include "drake/math/orthonormal_basis.h"
 
 namespace drake {
 namespace multibody {
@@ -48,9 +49,11 @@ using systems::Context;
 using systems::InputPortDescriptor;
 
 template<typename T>
-MultibodyPlant<T>::MultibodyPlant() :
+MultibodyPlant<T>::MultibodyPlant(double time_step) :
     systems::LeafSystem<T>(systems::SystemTypeTag<
-        drake::multibody::multibody_plant::MultibodyPlant>()) {
+        drake::multibody::multibody_plant::MultibodyPlant>()),
+    time_step_(time_step) {
+  DRAKE_THROW_UNLESS(time_step >= 0);
   model_ = std::make_unique<MultibodyTree<T>>();
 }
 
@@ -64,6 +67,10 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other) {
   body_index_to_frame_id_ = other.body_index_to_frame_id_;
   geometry_id_to_body_index_ = other.geometry_id_to_body_index_;
   geometry_id_to_visual_index_ = other.geometry_id_to_visual_index_;
+  // Copy of the discrete model parameters.
+  time_step_ = other.time_step_;
+  friction_coefficient_ = other.friction_coefficient_;
+  solver_parameters_ = other.solver_parameters_;
   // MultibodyTree::CloneToScalar() already called MultibodyTree::Finalize() on
   // the new MultibodyTree on U. Therefore we only Finilize the plant's
   // internals (and not the MultibodyTree).
@@ -105,6 +112,12 @@ void MultibodyPlant<T>::RegisterVisualGeometry(
   } else {
     id = RegisterGeometry(body, X_BG, shape, geometry_system);
   }
+  // Visual geometry belongs to, and ignores, every collision filter group so
+  // that GeometrySystem never pairs it with collision geometry nor with other
+  // visual geometry.
+  const geometry::CollisionFilterGroupMask all_groups =
+      ~geometry::CollisionFilterGroupMask();
+  geometry_system->AssignCollisionFilterGroups(id, all_groups, all_groups);
   const int visual_index = geometry_id_to_visual_index_.size();
   geometry_id_to_visual_index_[id] = visual_index;
 }
@@ -189,6 +202,11 @@ void MultibodyPlant<T>::FinalizePlantOnly() {
   // provided with a valid source id.
   if (source_id_) DeclareGeometrySystemPorts();
   DeclareCacheEntries();
+  if (is_discrete() && num_velocities() > 0) {
+    implicit_stribeck_solver_ =
+        std::make_unique<ImplicitStribeckSolver<double>>(num_velocities());
+    implicit_stribeck_solver_->set_solver_parameters(solver_parameters_);
+  }
   geometry_system_ = nullptr;  // must not be used after Finalize().
   if (get_num_collision_geometries() > 0 &&
       penalty_method_contact_parameters_.time_scale < 0)
@@ -199,13 +217,38 @@ template<typename T>
 std::unique_ptr<systems::LeafContext<T>>
 MultibodyPlant<T>::DoMakeLeafContext() const {
   DRAKE_THROW_UNLESS(is_finalized());
-  return std::make_unique<MultibodyTreeContext<T>>(model_->get_topology());
+  return std::make_unique<MultibodyTreeContext<T>>(
+      model_->get_topology(), is_discrete());
+}
+
+template<typename T>
+void MultibodyPlant<T>::AddJointActuationForces(
+    const systems::Context<T>& context, MultibodyForces<T>* forces) const {
+  DRAKE_DEMAND(forces != nullptr);
+  if (num_actuators() > 0) {
+    Eigen::VectorBlock<const VectorX<T>> u =
+        this->EvalEigenVectorInput(context, actuation_port_);
+    for (JointActuatorIndex actuator_index(0);
+         actuator_index < num_actuators(); ++actuator_index) {
+      const JointActuator<T>& actuator =
+          model().get_joint_actuator(actuator_index);
+      // We only support actuators on single dof joints for now.
+      DRAKE_DEMAND(actuator.joint().num_dofs() == 1);
+      for (int joint_dof = 0;
+           joint_dof < actuator.joint().num_dofs(); ++joint_dof) {
+        actuator.AddInOneForce(context, joint_dof, u[actuator_index], forces);
+      }
+    }
+  }
 }
 
 template<typename T>
 void MultibodyPlant<T>::DoCalcTimeDerivatives(
     const systems::Context<T>& context,
     systems::ContinuousState<T>* derivatives) const {
+  // No derivatives to compute if state is discrete.
+  if (is_discrete()) return;
+
   const auto x =
       dynamic_cast<const systems::BasicVector<T>&>(
           context.get_continuous_state_vector()).get_value();
@@ -229,21 +272,7 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
   model_->CalcForceElementsContribution(context, pc, vc, &forces);
 
   // If there is any input actuation, add it to the multibody forces.
-  if (num_actuators() > 0) {
-    Eigen::VectorBlock<const VectorX<T>> u =
-        this->EvalEigenVectorInput(context, actuation_port_);
-    for (JointActuatorIndex actuator_index(0);
-         actuator_index < num_actuators(); ++actuator_index) {
-      const JointActuator<T>& actuator =
-          model().get_joint_actuator(actuator_index);
-      // We only support actuators on single dof joints for now.
-      DRAKE_DEMAND(actuator.joint().num_dofs() == 1);
-      for (int joint_dof = 0;
-           joint_dof < actuator.joint().num_dofs(); ++joint_dof) {
-        actuator.AddInOneForce(context, joint_dof, u[actuator_index], &forces);
-      }
-    }
-  }
+  AddJointActuationForces(context, &forces);
 
   model_->CalcMassMatrixViaInverseDynamics(context, &M);
 
@@ -280,6 +309,179 @@ void MultibodyPlant<T>::DoCalcTimeDerivatives(
   derivatives->SetFromVector(xdot);
 }
 
+template<typename T>
+void MultibodyPlant<T>::DoCalcDiscreteVariableUpdates(
+    const drake::systems::Context<T>& context0,
+    const std::vector<const drake::systems::DiscreteUpdateEvent<T>*>&,
+    drake::systems::DiscreteValues<T>* updates) const {
+  // Assert this method was called on a context storing discrete state.
+  DRAKE_ASSERT(context0.get_num_discrete_state_groups() == 1);
+  DRAKE_ASSERT(context0.get_continuous_state().size() == 0);
+
+  const double dt = time_step_;  // just a shorter alias.
+  const int nq = this->num_positions();
+  const int nv = this->num_velocities();
+
+  // Get the system state as raw Eigen vectors
+  // (solution at the previous time step).
+  auto x0 = context0.get_discrete_state(0).get_value();
+  VectorX<T> q0 = x0.topRows(nq);
+  VectorX<T> v0 = x0.bottomRows(nv);
+
+  // Mass matrix and its factorization.
+  MatrixX<T> M0(nv, nv);
+  model_->CalcMassMatrixViaInverseDynamics(context0, &M0);
+
+  // Forces at the previous time step.
+  MultibodyForces<T> forces0(*model_);
+  std::vector<SpatialAcceleration<T>> A_WB_array(model_->num_bodies());
+  VectorX<T> vdot = VectorX<T>::Zero(nv);
+
+  const PositionKinematicsCache<T>& pc0 = EvalPositionKinematics(context0);
+  const VelocityKinematicsCache<T>& vc0 = EvalVelocityKinematics(context0);
+
+  // Compute forces applied through force elements. This effectively resets
+  // the forces to zero and adds in contributions due to force elements.
+  model_->CalcForceElementsContribution(context0, pc0, vc0, &forces0);
+
+  // If there is any input actuation, add it to the multibody forces.
+  AddJointActuationForces(context0, &forces0);
+
+  // With vdot = 0, this computes:
+  //   -tau = C(q, v)v - tau_app - ∑ J_WBᵀ(q) Fapp_Bo_W.
+  std::vector<SpatialForce<T>>& F_BBo_W_array = forces0.mutable_body_forces();
+  VectorX<T>& minus_tau = forces0.mutable_generalized_forces();
+  model_->CalcInverseDynamics(
+      context0, pc0, vc0, vdot,
+      F_BBo_W_array, minus_tau,
+      &A_WB_array,
+      &F_BBo_W_array, /* Notice these arrays gets overwritten on output. */
+      &minus_tau);
+
+  // Generalized momentum at the next time step without contact forces.
+  const VectorX<T> p_star = M0 * v0 - dt * minus_tau;
+
+  // Compute the generalized velocities at the next time step.
+  VectorX<T> v_next(nv);
+  if (get_num_collision_geometries() > 0) {
+    CalcVelocityUpdateWithImplicitContact(context0, pc0, M0, p_star, &v_next);
+  } else {
+    v_next = M0.ldlt().solve(p_star);
+  }
+
+  // Advance the generalized positions with the velocities at the next time
+  // step, as in a semi-explicit Euler scheme.
+  VectorX<T> qdot_next(nq);
+  model_->MapVelocityToQDot(context0, v_next, &qdot_next);
+  VectorX<T> x_next(this->num_multibody_states());
+  x_next << q0 + dt * qdot_next, v_next;
+  updates->get_mutable_vector(0).SetFromVector(x_next);
+}
+
+template<>
+void MultibodyPlant<double>::CalcVelocityUpdateWithImplicitContact(
+    const systems::Context<double>& context0,
+    const PositionKinematicsCache<double>& pc0,
+    const MatrixX<double>& M0, const VectorX<double>& p_star,
+    VectorX<double>* v_next) const {
+  const int nv = this->num_velocities();
+
+  const geometry::QueryObject<double>& query_object =
+      this->EvalAbstractInput(context0, geometry_query_port_)
+          ->template GetValue<geometry::QueryObject<double>>();
+
+  std::vector<PenetrationAsPointPair<double>> penetrations =
+      query_object.ComputePointPairPenetration();
+
+  // GeometrySystem already filters out our visual geometry. Pairs involving
+  // geometry registered by other sources are skipped.
+  std::vector<const PenetrationAsPointPair<double>*> contact_pairs;
+  for (const auto& penetration : penetrations) {
+    if (is_collision_geometry(penetration.id_A) &&
+        is_collision_geometry(penetration.id_B))
+      contact_pairs.push_back(&penetration);
+  }
+  const int nc = contact_pairs.size();
+
+  // Contact Jacobians, penetrations and contact parameters.
+  MatrixX<double> Jn = MatrixX<double>::Zero(nc, nv);
+  MatrixX<double> Jt = MatrixX<double>::Zero(2 * nc, nv);
+  VectorX<double> x0(nc);
+  MatrixX<double> p_WC(3, 1);
+  MatrixX<double> Jv_WAc(3, nv);
+  MatrixX<double> Jv_WBc(3, nv);
+  for (int ic = 0; ic < nc; ++ic) {
+    const PenetrationAsPointPair<double>& penetration = *contact_pairs[ic];
+    const BodyIndex bodyA_index =
+        geometry_id_to_body_index_.at(penetration.id_A);
+    const BodyIndex bodyB_index =
+        geometry_id_to_body_index_.at(penetration.id_B);
+    const Body<double>& bodyA = model().get_body(bodyA_index);
+    const Body<double>& bodyB = model().get_body(bodyB_index);
+
+    // Penetration depth, > 0 during penetration.
+    x0(ic) = penetration.depth;
+    const Vector3<double>& nhat_BA_W = penetration.nhat_BA_W;
+
+    // Contact point C.
+    const Vector3<double> p_WCo =
+        0.5 * (penetration.p_WCa + penetration.p_WCb);
+
+    // Jacobian for the velocity of the contact point C moving with body A.
+    const Isometry3<double>& X_WA = pc0.get_X_WB(bodyA.node_index());
+    const Vector3<double> p_AC = X_WA.inverse() * p_WCo;
+    model().CalcPointsGeometricJacobianExpressedInWorld(
+        context0, bodyA.body_frame(), p_AC, &p_WC, &Jv_WAc);
+
+    // Jacobian for the velocity of the contact point C moving with body B.
+    const Isometry3<double>& X_WB = pc0.get_X_WB(bodyB.node_index());
+    const Vector3<double> p_BC = X_WB.inverse() * p_WCo;
+    model().CalcPointsGeometricJacobianExpressedInWorld(
+        context0, bodyB.body_frame(), p_BC, &p_WC, &Jv_WBc);
+
+    // Jacobian for the relative velocity of A with respect to B at C, so that
+    // its projection on nhat_BA_W is positive when the bodies separate.
+    const MatrixX<double> Jv_BcAc_W = Jv_WAc - Jv_WBc;
+
+    // Orthonormal basis with its z axis aligned with nhat_BA_W.
+    const Matrix3<double> R_WC = math::ComputeBasisFromAxis(2, nhat_BA_W);
+    Jn.row(ic) = nhat_BA_W.transpose() * Jv_BcAc_W;
+    Jt.middleRows<2>(2 * ic) =
+        R_WC.leftCols<2>().transpose() * Jv_BcAc_W;
+  }
+
+  const VectorX<double> stiffness = VectorX<double>::Constant(
+      nc, penalty_method_contact_parameters_.stiffness);
+  const VectorX<double> dissipation = VectorX<double>::Constant(
+      nc, penalty_method_contact_parameters_.damping);
+  const VectorX<double> mu = VectorX<double>::Constant(
+      nc, friction_coefficient_);
+
+  DRAKE_DEMAND(implicit_stribeck_solver_ != nullptr);
+  ImplicitStribeckSolver<double>& solver = *implicit_stribeck_solver_;
+  solver.SetProblemData(
+      &M0, &Jn, &Jt, &p_star, &x0, &stiffness, &dissipation, &mu);
+  // The solution without contact forces is used as initial guess.
+  const VectorX<double> v_guess = M0.ldlt().solve(p_star);
+  const ImplicitStribeckSolverResult info =
+      solver.SolveWithGuess(time_step_, v_guess);
+  if (info != ImplicitStribeckSolverResult::kSuccess) {
+    throw std::runtime_error(
+        "MultibodyPlant's discrete update failed. The implicit contact solver "
+        "did not converge at time t = " + std::to_string(context0.get_time()) +
+        ". Consider reducing the time step or increasing the maximum number "
+        "of iterations, see set_implicit_stribeck_solver_parameters().");
+  }
+  *v_next = solver.get_generalized_velocities();
+}
+
+template<typename T>
+void MultibodyPlant<T>::CalcVelocityUpdateWithImplicitContact(
+    const systems::Context<T>&, const PositionKinematicsCache<T>&,
+    const MatrixX<T>&, const VectorX<T>&, VectorX<T>*) const {
+  DRAKE_ABORT_MSG("Only <double> is supported.");
+}
+
 template<typename T>
 void MultibodyPlant<T>::set_penetration_allowance(
     double penetration_allowance) {
@@ -356,8 +558,8 @@ void MultibodyPlant<double>::CalcAndAddContactForcesByPenaltyMethod(
     const GeometryId geometryA_id = penetration.id_A;
     const GeometryId geometryB_id = penetration.id_B;
 
-    // TODO(amcastro-tri): Request GeometrySystem to do this filtering for us
-    // when that capability lands.
+    // GeometrySystem already filters out our visual geometry. Pairs involving
+    // geometry registered by other sources are skipped.
     // TODO(amcastro-tri): consider allowing this id's to belong to a third
     // external system when they correspond to anchored geometry.
     if (!is_collision_geometry(geometryA_id) ||
@@ -473,10 +675,15 @@ void MultibodyPlant<T>::DeclareStateAndPorts() {
   // The model must be finalized.
   DRAKE_DEMAND(this->is_finalized());
 
-  this->DeclareContinuousState(
-      BasicVector<T>(model_->num_states()),
-      model_->num_positions(),
-      model_->num_velocities(), 0 /* num_z */);
+  if (is_discrete()) {
+    this->DeclarePeriodicDiscreteUpdate(time_step_);
+    this->DeclareDiscreteState(num_multibody_states());
+  } else {
+    this->DeclareContinuousState(
+        BasicVector<T>(model_->num_states()),
+        model_->num_positions(),
+        model_->num_velocities(), 0 /* num_z */);
+  }
 
   if (num_actuators() > 0) {
     actuation_port_ =
@@ -484,10 +691,17 @@ void MultibodyPlant<T>::DeclareStateAndPorts() {
             systems::BasicVector<T>(num_actuated_dofs())).get_index();
   }
 
-  continuous_state_output_port_ =
-      this->DeclareVectorOutputPort(
-          BasicVector<T>(num_multibody_states()),
-          &MultibodyPlant::CopyContinuousStateOut).get_index();
+  if (is_discrete()) {
+    discrete_state_output_port_ =
+        this->DeclareVectorOutputPort(
+            BasicVector<T>(num_multibody_states()),
+            &MultibodyPlant::CopyDiscreteStateOut).get_index();
+  } else {
+    continuous_state_output_port_ =
+        this->DeclareVectorOutputPort(
+            BasicVector<T>(num_multibody_states()),
+            &MultibodyPlant::CopyContinuousStateOut).get_index();
+  }
 }
 
 template <typename T>
@@ -497,6 +711,13 @@ void MultibodyPlant<T>::CopyContinuousStateOut(
   state_vector->SetFrom(context.get_continuous_state_vector());
 }
 
+template <typename T>
+void MultibodyPlant<T>::CopyDiscreteStateOut(
+    const Context<T>& context, BasicVector<T>* state_vector) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  state_vector->SetFrom(context.get_discrete_state_vector());
+}
+
 template <typename T>
 const systems::InputPortDescriptor<T>&
 MultibodyPlant<T>::get_actuation_input_port() const {
@@ -509,9 +730,19 @@ template <typename T>
 const systems::OutputPort<T>&
 MultibodyPlant<T>::get_continuous_state_output_port() const {
   DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(!is_discrete());
   return this->get_output_port(continuous_state_output_port_);
 }
 
+template <typename T>
+const systems::OutputPort<T>&
+MultibodyPlant<T>::get_state_output_port() const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  return this->get_output_port(
+      is_discrete() ?
+      discrete_state_output_port_ : continuous_state_output_port_);
+}
+
 template<typename T>
 void MultibodyPlant<T>::DeclareGeometrySystemPorts() {
   geometry_query_port_ = this->DeclareAbstractInputPort().get_index();
@@ -11,6 +11,7 @@
 #include "drake/common/nice_type_name.h"
 #include "drake/geometry/geometry_system.h"
 #include "drake/multibody/multibody_tree/force_element.h"
+#include "drake/multibody/multibody_tree/multibody_plant/implicit_stribeck_solver.h"
 #include "drake/multibody/multibody_tree/multibody_tree.h"
 #include "drake/multibody/multibody_tree/rigid_body.h"
 #include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
@@ -70,6 +71,27 @@ namespace multibody_plant {
 /// generalized forces applied on the system. These can include externally
 /// applied body forces, constraint forces, and contact forces.
 ///
+/// @section discrete_model Discrete time stepping model
+///
+/// A %MultibodyPlant constructed with a strictly positive time step (see
+/// MultibodyPlant(double)) models the multibody system as a discrete system
+/// with a periodic update of period equal to the time step δt. The state
+/// `x = [q; v]` is then stored as discrete state in the Context and it is
+/// advanced from the time step n to n+1 according to: <pre>
+///   M(qⁿ)(vⁿ⁺¹ - vⁿ) = δt (tau(qⁿ, vⁿ) + Jₙᵀ fₙ(vⁿ⁺¹) + Jₜᵀ fₜ(vⁿ⁺¹))
+///   qⁿ⁺¹ = qⁿ + δt N(qⁿ) vⁿ⁺¹
+/// </pre>
+/// where all non-contact forces are evaluated explicitly at the start of the
+/// step while the compliant normal contact forces fₙ and the regularized
+/// Coulomb friction forces fₜ are evaluated implicitly at the next time step,
+/// see ImplicitStribeckSolver for details. Contact points are computed at the
+/// start of the time step with the same GeometrySystem point pair query used
+/// by the continuous model and Jₙ, Jₜ are the Jacobians of the normal and
+/// tangential contact velocities, respectively. Treating contact implicitly
+/// allows to take time steps much larger than the time scale introduced by
+/// the compliant contact model, see get_contact_penalty_method_time_scale(),
+/// without the need for error-controlled integration.
+///
 /// @section adding_elements Adding modeling elements
 ///
 /// @cond
@@ -157,7 +179,13 @@ class MultibodyPlant : public systems::LeafSystem<T> {
 
   /// Default constructor creates a plant with a single "world" body.
   /// Therefore, right after creation, num_bodies() returns one.
-  MultibodyPlant();
+  /// @param[in] time_step
+  ///   An optional parameter indicating whether `this` plant is modeled as a
+  ///   continuous system (`time_step = 0`) or as a discrete system with
+  ///   periodic updates of period `time_step > 0`. See @ref discrete_model
+  ///   "Discrete time stepping model" for details.
+  /// @throws std::exception if `time_step` is negative.
+  explicit MultibodyPlant(double time_step = 0);
 
   /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
   template<typename U>
@@ -482,7 +510,8 @@ class MultibodyPlant : public systems::LeafSystem<T> {
       geometry::GeometrySystem<T>* geometry_system);
 
   /// Registers geometry in a GeometrySystem with a given geometry::Shape to be
-  /// used for visualization of a given `body`.
+  /// used for visualization of a given `body`. Visual geometry is excluded from
+  /// all collision queries through GeometrySystem's collision filter groups.
   ///
   /// @param[in] body
   ///   The body for which geometry is being registered.
@@ -624,9 +653,29 @@ class MultibodyPlant : public systems::LeafSystem<T> {
 
   /// Returns a constant reference to the output port for the full continuous
   /// state of the model.
-  /// @throws std::exception if called pre-finalize.
+  /// @throws std::exception if called pre-finalize or if `this` plant is
+  /// modeled as a discrete system, see is_discrete().
   const systems::OutputPort<T>& get_continuous_state_output_port() const;
 
+  /// Returns a constant reference to the output port for the full multibody
+  /// state `x = [q; v]` of the model. For continuous models this port is the
+  /// same as get_continuous_state_output_port(). For discrete models it
+  /// outputs the discrete state, see is_discrete().
+  /// @throws std::exception if called pre-finalize.
+  const systems::OutputPort<T>& get_state_output_port() const;
+
+  /// Returns `true` if `this` plant is modeled as a discrete system.
+  /// This property of the plant is specified at construction and therefore
+  /// this query can be performed either pre- or post-finalize, see Finalize().
+  bool is_discrete() const { return time_step_ > 0.0; }
+
+  /// The time step (or period) used to model `this` plant as a discrete system
+  /// with periodic updates. Returns 0 (zero) if the plant is modeled as a
+  /// continuous system.
+  /// This property of the plant is specified at construction and therefore
+  /// this query can be performed either pre- or post-finalize, see Finalize().
+  double time_step() const { return time_step_; }
+
   /// Returns a constant reference to the *world* body.
   const RigidBody<T>& world_body() const {
     return model_->world_body();
@@ -777,6 +826,42 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   }
   /// @}
 
+  /// @name Implicit contact in the discrete model
+  /// For plants modeled as a discrete system (see is_discrete()), compliant
+  /// normal contact forces and regularized Coulomb friction forces are solved
+  /// implicitly at each time step with an ImplicitStribeckSolver. The normal
+  /// compliance uses the same stiffness and dissipation estimated from the
+  /// penetration allowance, see set_penetration_allowance().
+  /// @{
+
+  /// Sets the Coulomb friction coefficient μ used for all contact pairs in the
+  /// discrete model. It defaults to zero, i.e. frictionless contact.
+  /// @throws std::exception if `friction_coefficient` is negative.
+  // TODO(amcastro-tri): Allow specifying friction coefficients per geometry at
+  // registration with RegisterCollisionGeometry().
+  void set_friction_coefficient(double friction_coefficient) {
+    DRAKE_THROW_UNLESS(friction_coefficient >= 0);
+    friction_coefficient_ = friction_coefficient;
+  }
+
+  /// Returns the Coulomb friction coefficient used in the discrete model.
+  double get_friction_coefficient() const { return friction_coefficient_; }
+
+  /// Sets the parameters used by the ImplicitStribeckSolver to solve for the
+  /// contact forces of the discrete model at each time step.
+  /// @throws std::exception if any of the parameters is non-positive.
+  void set_implicit_stribeck_solver_parameters(
+      const ImplicitStribeckSolverParameters& parameters) {
+    DRAKE_THROW_UNLESS(parameters.stiction_tolerance > 0);
+    DRAKE_THROW_UNLESS(parameters.max_iterations > 0);
+    DRAKE_THROW_UNLESS(parameters.tolerance > 0);
+    solver_parameters_ = parameters;
+    if (implicit_stribeck_solver_) {
+      implicit_stribeck_solver_->set_solver_parameters(solver_parameters_);
+    }
+  }
+  /// @}
+
   /// Sets the state in `context` so that generalized positions and velocities
   /// are zero.
   /// @throws if called pre-finalize. See Finalize().
@@ -824,6 +909,28 @@ class MultibodyPlant : public systems::LeafSystem<T> {
       const systems::Context<T>& context,
       systems::ContinuousState<T>* derivatives) const override;
 
+  // Implements the discrete system dynamics according to this class's
+  // documentation, see @ref discrete_model.
+  void DoCalcDiscreteVariableUpdates(
+      const systems::Context<T>& context0,
+      const std::vector<const systems::DiscreteUpdateEvent<T>*>& events,
+      systems::DiscreteValues<T>* updates) const override;
+
+  // Helper method to add the generalized forces due to the actuation input
+  // (if any) into `forces`.
+  void AddJointActuationForces(
+      const systems::Context<T>& context, MultibodyForces<T>* forces) const;
+
+  // Helper method to compute the generalized velocities v at the next time
+  // step of the discrete model, given the mass matrix M and the generalized
+  // momentum p_star = M v0 + dt tau at the start of the step. Contact
+  // and friction forces are solved implicitly with an ImplicitStribeckSolver.
+  void CalcVelocityUpdateWithImplicitContact(
+      const systems::Context<T>& context0,
+      const PositionKinematicsCache<T>& pc0,
+      const MatrixX<T>& M0, const VectorX<T>& p_star,
+      VectorX<T>* v_next) const;
+
   void DoMapQDotToVelocity(
       const systems::Context<T>& context,
       const Eigen::Ref<const VectorX<T>>& qdot,
@@ -881,6 +988,10 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   void CopyContinuousStateOut(
       const systems::Context<T>& context, systems::BasicVector<T>* state) const;
 
+  // Calc method for the discrete state vector output port.
+  void CopyDiscreteStateOut(
+      const systems::Context<T>& context, systems::BasicVector<T>* state) const;
+
   // Helper method to declare output ports used by this plant to communicate
   // with a GeometrySystem.
   void DeclareGeometrySystemPorts();
@@ -987,6 +1098,24 @@ class MultibodyPlant : public systems::LeafSystem<T> {
   // Input/Output port indexes:
   int actuation_port_{-1};
   int continuous_state_output_port_{-1};
+  int discrete_state_output_port_{-1};
+
+  // The time step (or period) of the discrete model. Zero for continuous
+  // models.
+  double time_step_{0};
+
+  // Coulomb friction coefficient used in the discrete model for all contact
+  // pairs.
+  double friction_coefficient_{0};
+
+  // Parameters for the implicit contact solver used in the discrete model.
+  ImplicitStribeckSolverParameters solver_parameters_;
+
+  // The implicit contact solver of the discrete model, constructed at
+  // Finalize() for the number of generalized velocities of the plant. Its
+  // contact workspace is resized at each update, to the number of contact
+  // points. Like pc_ and vc_, it is scratch storage of the discrete update.
+  std::unique_ptr<ImplicitStribeckSolver<double>> implicit_stribeck_solver_;
 
   // Temporary solution for fake cache entries to help statbilize the API.
   // TODO(amcastro-tri): Remove these when caching lands.
@@ -0,0 +1,175 @@
+#include "drake/multibody/multibody_tree/multibody_plant/implicit_stribeck_solver.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace multibody {
+namespace multibody_plant {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+// This fixture sets up the problem of a point mass with three translational
+// degrees of freedom in contact with the ground plane z = 0. The mass is
+// subject to gravity and to an external horizontal force fx along the x axis.
+// The generalized velocities are v = [vx, vy, vz], the normal separation
+// velocity is vₙ = vz and the tangential velocities are vₜ = [vx, vy].
+class PointMassOnGround : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    M_ = kMass * MatrixXd::Identity(nv_, nv_);
+    Jn_ = MatrixXd::Zero(1, nv_);
+    Jn_(0, 2) = 1.0;
+    Jt_ = MatrixXd::Zero(2, nv_);
+    Jt_(0, 0) = 1.0;
+    Jt_(1, 1) = 1.0;
+    // Penetration for which the normal force balances the weight at rest.
+    x0_ = VectorXd::Constant(1, kMass * kGravity / kStiffness);
+    stiffness_ = VectorXd::Constant(1, kStiffness);
+    dissipation_ = VectorXd::Constant(1, kDissipation);
+    mu_ = VectorXd::Constant(1, kFrictionCoefficient);
+    solver_.set_solver_parameters(parameters_);
+  }
+
+  // Sets up the problem data for an external force fx and initial velocity
+  // v0 and solves it. Returns the result from the solver.
+  ImplicitStribeckSolverResult Solve(double fx, const Vector3d& v0) {
+    const Vector3d tau(fx, 0.0, -kMass * kGravity);
+    p_star_ = M_ * v0 + kTimeStep * tau;
+    solver_.SetProblemData(
+        &M_, &Jn_, &Jt_, &p_star_, &x0_, &stiffness_, &dissipation_, &mu_);
+    return solver_.SolveWithGuess(kTimeStep, v0);
+  }
+
+  // Verifies that the solution satisfies the momentum balance in Eq. (1) of
+  // ImplicitStribeckSolver's documentation.
+  void VerifyMomentumBalance() const {
+    const VectorXd& v = solver_.get_generalized_velocities();
+    const VectorXd& fn = solver_.get_normal_forces();
+    const VectorXd& ft = solver_.get_friction_forces();
+    const VectorXd residual = M_ * v - p_star_ -
+        kTimeStep * (Jn_.transpose() * fn + Jt_.transpose() * ft);
+    // The residual has units of momentum, we scale it by the magnitude of
+    // the weight's impulse.
+    EXPECT_LT(residual.norm(), 1.0e-6 * kMass * kGravity * kTimeStep);
+  }
+
+  const double kMass{1.0};
+  const double kGravity{9.81};
+  const double kStiffness{1.0e4};
+  const double kDissipation{1.0};
+  const double kFrictionCoefficient{0.5};
+  const double kTimeStep{1.0e-2};
+  const int nv_{3};
+  ImplicitStribeckSolverParameters parameters_;
+  ImplicitStribeckSolver<double> solver_{nv_};
+  MatrixXd M_, Jn_, Jt_;
+  VectorXd p_star_, x0_, stiffness_, dissipation_, mu_;
+};
+
+// An external force within the friction cone keeps the point mass in stiction.
+TEST_F(PointMassOnGround, Stiction) {
+  const double fx = 0.5 * kFrictionCoefficient * kMass * kGravity;
+  const ImplicitStribeckSolverResult result = Solve(fx, Vector3d::Zero());
+  ASSERT_EQ(result, ImplicitStribeckSolverResult::kSuccess);
+  VerifyMomentumBalance();
+
+  const VectorXd& vn = solver_.get_normal_velocities();
+  const VectorXd& vt = solver_.get_tangential_velocities();
+  const VectorXd& ft = solver_.get_friction_forces();
+  const double v_stiction = parameters_.stiction_tolerance;
+
+  // The normal force balances the weight and therefore vₙ = 0.
+  EXPECT_NEAR(vn(0), 0.0, parameters_.tolerance * v_stiction);
+  EXPECT_NEAR(solver_.get_normal_forces()(0), kMass * kGravity,
+              1.0e-8 * kMass * kGravity);
+  // The slip velocity is within the stiction tolerance.
+  EXPECT_LT(vt.norm(), v_stiction);
+  // Friction opposes the applied force and it is within the friction cone.
+  EXPECT_LT(ft(0), 0.0);
+  EXPECT_LT(std::abs(ft(0)), kFrictionCoefficient * kMass * kGravity);
+}
+
+// An external force outside the friction cone makes the point mass slide.
+// Since the normal force balances the weight, the friction force saturates at
+// μmg and the slip velocity at the next time step is known analytically.
+TEST_F(PointMassOnGround, Sliding) {
+  const double fx = 2.0 * kFrictionCoefficient * kMass * kGravity;
+  const Vector3d v0(0.1, 0.0, 0.0);
+  const ImplicitStribeckSolverResult result = Solve(fx, v0);
+  ASSERT_EQ(result, ImplicitStribeckSolverResult::kSuccess);
+  VerifyMomentumBalance();
+
+  const double vx_expected =
+      v0(0) + kTimeStep * (fx - kFrictionCoefficient * kMass * kGravity) /
+      kMass;
+  const Vector3d v_expected(vx_expected, 0.0, 0.0);
+  const double kTolerance =
+      parameters_.tolerance * parameters_.stiction_tolerance;
+  EXPECT_TRUE(CompareMatrices(
+      solver_.get_generalized_velocities(), v_expected, kTolerance,
+      MatrixCompareType::relative));
+  EXPECT_NEAR(solver_.get_friction_forces()(0),
+              -kFrictionCoefficient * kMass * kGravity,
+              1.0e-6 * kMass * kGravity);
+}
+
+// The friction impulse δt μmg is larger than the momentum of a point mass
+// slowly sliding with no external force and it goes into stiction within a
+// single time step. The full Newton-Raphson step from the sliding initial
+// guess reverses the direction of the slip and the line search must shorten
+// it.
+TEST_F(PointMassOnGround, SlidingToStiction) {
+  const Vector3d v0(
+      0.2 * kTimeStep * kFrictionCoefficient * kGravity, 0.0, 0.0);
+  ASSERT_GT(v0(0), parameters_.stiction_tolerance);
+  const ImplicitStribeckSolverResult result = Solve(0.0, v0);
+  ASSERT_EQ(result, ImplicitStribeckSolverResult::kSuccess);
+  VerifyMomentumBalance();
+  EXPECT_GT(solver_.get_iteration_statistics().num_line_search_iterations, 0);
+  EXPECT_LT(solver_.get_tangential_velocities().norm(),
+            parameters_.stiction_tolerance);
+}
+
+// With no contact points the solver must reduce to the solution of the
+// linear system M v = p*.
+TEST_F(PointMassOnGround, NoContact) {
+  Jn_.resize(0, nv_);
+  Jt_.resize(0, nv_);
+  x0_.resize(0);
+  stiffness_.resize(0);
+  dissipation_.resize(0);
+  mu_.resize(0);
+  const Vector3d v0(0.1, -0.2, 0.3);
+  const ImplicitStribeckSolverResult result = Solve(0.0, v0);
+  ASSERT_EQ(result, ImplicitStribeckSolverResult::kSuccess);
+  EXPECT_EQ(solver_.get_iteration_statistics().num_iterations, 1);
+  const Vector3d v_expected = v0 - kTimeStep * kGravity * Vector3d::UnitZ();
+  EXPECT_TRUE(CompareMatrices(
+      solver_.get_generalized_velocities(), v_expected,
+      10 * std::numeric_limits<double>::epsilon(),
+      MatrixCompareType::relative));
+}
+
+TEST_F(PointMassOnGround, WrongSizes) {
+  VectorXd wrong_size_x0 = VectorXd::Zero(2);
+  p_star_ = VectorXd::Zero(nv_);
+  EXPECT_THROW(solver_.SetProblemData(
+      &M_, &Jn_, &Jt_, &p_star_, &wrong_size_x0, &stiffness_, &dissipation_,
+      &mu_), std::exception);
+  EXPECT_THROW(solver_.SetProblemData(
+      &M_, &Jn_, &Jt_, nullptr, &x0_, &stiffness_, &dissipation_, &mu_),
+      std::exception);
+  EXPECT_THROW(ImplicitStribeckSolver<double>(0), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody_plant
+}  // namespace multibody
+}  // namespace drake
@@ -14,6 +14,7 @@
 #include "drake/multibody/benchmarks/pendulum/make_pendulum_plant.h"
 #include "drake/multibody/multibody_tree/joints/revolute_joint.h"
 #include "drake/multibody/multibody_tree/rigid_body.h"
+#include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/continuous_state.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -554,6 +555,207 @@ GTEST_TEST(MultibodyPlantTest, MapVelocityToQdotAndBack) {
       CompareMatrices(v_back.CopyToVector(), v.CopyToVector(), kTolerance));
 }
 
+// Helper to make a simple pendulum model with a point mass at the end of a
+// massless rod of length l, swinging in the x-z plane under gravity.
+std::unique_ptr<MultibodyPlant<double>> MakeSimplePendulum(
+    const PendulumParameters& parameters, double time_step) {
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  const Vector3d p_BoBcm_B = -parameters.l() * Vector3d::UnitZ();
+  const SpatialInertia<double> M_Bo(
+      parameters.m(), p_BoBcm_B, UnitInertia<double>::PointMass(p_BoBcm_B));
+  const RigidBody<double>& point_mass =
+      plant->AddRigidBody(parameters.body_name(), M_Bo);
+  const RevoluteJoint<double>& pin = plant->AddJoint<RevoluteJoint>(
+      parameters.pin_joint_name(), plant->world_body(), {}, point_mass, {},
+      Vector3d::UnitY());
+  plant->AddJointActuator(parameters.actuator_name(), pin);
+  plant->AddForceElement<UniformGravityFieldElement>(
+      -parameters.g() * Vector3d::UnitZ());
+  plant->Finalize();
+  return plant;
+}
+
+// Verifies that a discrete model of a pendulum (with no contact) advances its
+// state according to a semi-explicit Euler scheme on the continuous dynamics.
+GTEST_TEST(MultibodyPlantTest, DiscreteModelWithoutContact) {
+  const double kTimeStep = 1.0e-3;
+  const PendulumParameters parameters;
+  std::unique_ptr<MultibodyPlant<double>> discrete_plant =
+      MakeSimplePendulum(parameters, kTimeStep);
+  std::unique_ptr<MultibodyPlant<double>> continuous_plant =
+      MakeSimplePendulum(parameters, 0.0);
+  EXPECT_TRUE(discrete_plant->is_discrete());
+  EXPECT_EQ(discrete_plant->time_step(), kTimeStep);
+  EXPECT_FALSE(continuous_plant->is_discrete());
+  EXPECT_EQ(continuous_plant->time_step(), 0.0);
+
+  // The continuous state output port is not available for discrete models.
+  EXPECT_THROW(discrete_plant->get_continuous_state_output_port(),
+               std::exception);
+
+  std::unique_ptr<Context<double>> discrete_context =
+      discrete_plant->CreateDefaultContext();
+  std::unique_ptr<Context<double>> continuous_context =
+      continuous_plant->CreateDefaultContext();
+  ASSERT_EQ(discrete_context->get_num_discrete_state_groups(), 1);
+  EXPECT_EQ(discrete_context->get_continuous_state().size(), 0);
+  EXPECT_EQ(discrete_context->get_discrete_state(0).size(),
+            discrete_plant->num_multibody_states());
+
+  // Set the same state and actuation on both models.
+  const Vector2d x0(M_PI / 3.0, -0.5);
+  const double tau = 0.3;
+  discrete_context->get_mutable_discrete_state(0).SetFromVector(x0);
+  continuous_context->get_mutable_continuous_state_vector().SetFromVector(x0);
+  discrete_context->FixInputPort(
+      discrete_plant->get_actuation_input_port().get_index(),
+      Vector1d(tau));
+  continuous_context->FixInputPort(
+      continuous_plant->get_actuation_input_port().get_index(),
+      Vector1d(tau));
+
+  // The state output port outputs the discrete state.
+  std::unique_ptr<AbstractValue> state_value =
+      discrete_plant->get_state_output_port().Allocate(*discrete_context);
+  discrete_plant->get_state_output_port().Calc(
+      *discrete_context, state_value.get());
+  EXPECT_EQ(state_value->GetValueOrThrow<BasicVector<double>>().CopyToVector(),
+            VectorXd(x0));
+
+  // Compute the expected semi-explicit Euler update.
+  std::unique_ptr<ContinuousState<double>> derivatives =
+      continuous_plant->AllocateTimeDerivatives();
+  continuous_plant->CalcTimeDerivatives(
+      *continuous_context, derivatives.get());
+  const double vdot = derivatives->get_vector().GetAtIndex(1);
+  const double v_next = x0(1) + kTimeStep * vdot;
+  const Vector2d x_next_expected(x0(0) + kTimeStep * v_next, v_next);
+
+  std::unique_ptr<systems::DiscreteValues<double>> updates =
+      discrete_plant->AllocateDiscreteVariables();
+  discrete_plant->CalcDiscreteVariableUpdates(
+      *discrete_context, updates.get());
+
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  EXPECT_TRUE(CompareMatrices(
+      updates->get_vector(0).CopyToVector(), x_next_expected, kTolerance,
+      MatrixCompareType::relative));
+}
+
+// Verifies the discrete update of a sphere resting on the ground and slowly
+// sliding along the x axis. The friction impulse over a single time step is
+// enough to stop the slip and therefore the full Newton-Raphson step from the
+// contact-free guess reverses the direction of the slip. This exercises the
+// line search of the implicit contact solver.
+GTEST_TEST(MultibodyPlantTest, DiscreteModelSphereSlidesToStiction) {
+  const double kTimeStep = 1.0e-3;
+  const double kMass = 0.5;
+  const double kRadius = 0.05;
+  const double kGravity = 9.81;
+  const double kFrictionCoefficient = 0.5;
+  const double kPenetrationAllowance = 1.0e-3;
+  const double kSlipVelocity = 1.0e-3;
+
+  DiagramBuilder<double> builder;
+  GeometrySystem<double>* geometry_system =
+      builder.AddSystem<GeometrySystem>();
+  MultibodyPlant<double>* plant =
+      builder.AddSystem<MultibodyPlant>(kTimeStep);
+  plant->RegisterAsSourceForGeometrySystem(geometry_system);
+  // A half-space for the ground geometry, with its normal along the z axis.
+  plant->RegisterCollisionGeometry(
+      plant->world_body(),
+      geometry::HalfSpace::MakePose(Vector3d::UnitZ(), Vector3d::Zero()),
+      geometry::HalfSpace(), geometry_system);
+  const RigidBody<double>& sphere = plant->AddRigidBody(
+      "Sphere", SpatialInertia<double>(
+          kMass, Vector3d::Zero(), UnitInertia<double>::SolidSphere(kRadius)));
+  plant->RegisterCollisionGeometry(sphere, Isometry3d::Identity(),
+                                   geometry::Sphere(kRadius), geometry_system);
+  plant->AddForceElement<UniformGravityFieldElement>(
+      -kGravity * Vector3d::UnitZ());
+  plant->Finalize();
+  plant->set_penetration_allowance(kPenetrationAllowance);
+  plant->set_friction_coefficient(kFrictionCoefficient);
+
+  builder.Connect(
+      plant->get_geometry_ids_output_port(),
+      geometry_system->get_source_frame_id_port(
+          plant->get_source_id().value()));
+  builder.Connect(
+      plant->get_geometry_poses_output_port(),
+      geometry_system->get_source_pose_port(plant->get_source_id().value()));
+  builder.Connect(geometry_system->get_query_output_port(),
+                  plant->get_geometry_query_input_port());
+  std::unique_ptr<Diagram<double>> diagram = builder.Build();
+
+  std::unique_ptr<Context<double>> diagram_context =
+      diagram->CreateDefaultContext();
+  Context<double>& context =
+      diagram->GetMutableSubsystemContext(*plant, diagram_context.get());
+
+  // The sphere starts with the static penetration, at which the contact force
+  // balances its weight, and with a small slip velocity.
+  const double x0 = kPenetrationAllowance;
+  plant->model().SetFreeBodyPoseOrThrow(
+      sphere, Isometry3d(Translation3d(0.0, 0.0, kRadius - x0)), &context);
+  plant->model().SetFreeBodySpatialVelocityOrThrow(
+      sphere,
+      SpatialVelocity<double>(Vector3d::Zero(),
+                              Vector3d(kSlipVelocity, 0.0, 0.0)),
+      &context);
+
+  std::unique_ptr<systems::DiscreteValues<double>> updates =
+      plant->AllocateDiscreteVariables();
+  ASSERT_NO_THROW(plant->CalcDiscreteVariableUpdates(context, updates.get()));
+  context.get_mutable_discrete_state(0).SetFromVector(
+      updates->get_vector(0).CopyToVector());
+  const SpatialVelocity<double>& V_WS =
+      plant->model().EvalBodySpatialVelocityInWorld(context, sphere);
+
+  // With frictionless normal dynamics, the normal velocity vₙ = v_z solves the
+  // momentum balance m vₙ = -δt m g + δt k (x₀ - δt vₙ)(1 - d vₙ), a quadratic
+  // equation in vₙ. The stiffness k and dissipation d are estimated from the
+  // penetration allowance δ as k = m/tc² and d = tc/δ, with tc the contact
+  // time scale.
+  const double tc = plant->get_contact_penalty_method_time_scale();
+  const double k = kMass / (tc * tc);
+  const double d = tc / kPenetrationAllowance;
+  const double dt = kTimeStep;
+  const double a = -dt * dt * k * d;
+  const double b = kMass + dt * k * (x0 * d + dt);
+  const double c = dt * kMass * kGravity - dt * k * x0;
+  // The root with the smallest magnitude, computed with a numerically stable
+  // formula.
+  const double vn_expected = -2.0 * c / (b + std::sqrt(b * b - 4.0 * a * c));
+
+  const ImplicitStribeckSolverParameters solver_parameters;
+  const double kTolerance =
+      solver_parameters.tolerance * solver_parameters.stiction_tolerance;
+  EXPECT_NEAR(V_WS.translational().z(), vn_expected, kTolerance);
+
+  // The contact point C is midway between the deepest points of the sphere
+  // and the ground, at a distance h = r - x₀/2 below the sphere's center. The
+  // slip velocity at C goes into stiction.
+  const double h = kRadius - x0 / 2.0;
+  const Vector3d p_SoC_W = -h * Vector3d::UnitZ();
+  const Vector3d v_WC = V_WS.Shift(p_SoC_W).translational();
+  EXPECT_LT(v_WC.head<2>().norm(), solver_parameters.stiction_tolerance);
+
+  // Since the contact force is applied at C, and the weight is parallel to the
+  // line from C to the sphere's center, the angular momentum about C is
+  // conserved.
+  const double I = kMass * UnitInertia<double>::SolidSphere(kRadius)(1, 1);
+  const double L0 = kMass * h * kSlipVelocity;
+  const double L = I * V_WS.rotational().y() +
+      kMass * h * V_WS.translational().x();
+  EXPECT_NEAR(L, L0, 10 * kTolerance * kMass * kRadius);
+}
+
+GTEST_TEST(MultibodyPlantTest, NegativeTimeStepThrows) {
+  EXPECT_THROW(MultibodyPlant<double>(-1.0), std::exception);
+}
+
 }  // namespace
 }  // namespace multibody_plant
 }  // namespace multibody
@@ -1,17 +1,22 @@
 #include "drake/multibody/multibody_tree/multibody_tree.h"
 
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/math/cross_product.h"
 #include "drake/multibody/multibody_tree/body_node_welded.h"
 #include "drake/multibody/multibody_tree/quaternion_floating_mobilizer.h"
 #include "drake/multibody/multibody_tree/rigid_body.h"
 #include "drake/multibody/multibody_tree/spatial_inertia.h"
+#include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
 
 namespace drake {
 namespace multibody {
@@ -27,6 +32,63 @@ using internal::BodyNodeWelded;
 // pre-finalize.
 #define DRAKE_MBT_THROW_IF_NOT_FINALIZED() ThrowIfNotFinalized(__func__)
 
+namespace {
+// The analytic derivatives of the dynamics below work with spatial vectors
+// measured at the world origin Wo and expressed in the world frame W, stored
+// as Vector6 objects with their rotational components first. With this
+// choice, spatial quantities rigidly attached to a body that moves with the
+// spatial velocity V do not depend on the point at which V is measured and
+// their time derivatives are simply given by the cross product operators
+// below [Featherstone 2008, §2.9].
+
+// Returns the cross product `m1 × m2` of the spatial motion vectors m1 and m2.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& m1, const Vector6<T>& m2) {
+  const auto w1 = m1.template head<3>();
+  const auto v1 = m1.template tail<3>();
+  const auto w2 = m2.template head<3>();
+  const auto v2 = m2.template tail<3>();
+  Vector6<T> m1_x_m2;
+  m1_x_m2 << w1.cross(w2), w1.cross(v2) + v1.cross(w2);
+  return m1_x_m2;
+}
+
+// Returns the cross product `m ×* f` of the spatial motion vector m and the
+// spatial force vector f.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  const auto w = m.template head<3>();
+  const auto v = m.template tail<3>();
+  const auto n = f.template head<3>();
+  const auto fv = f.template tail<3>();
+  Vector6<T> m_x_f;
+  m_x_f << w.cross(n) + v.cross(fv), w.cross(fv);
+  return m_x_f;
+}
+
+// Returns the 6x6 matrix [m×] such that `[m×] * m2 = m × m2`.
+template <typename T>
+Matrix6<T> CrossMotionMatrix(const Vector6<T>& m) {
+  using drake::math::VectorToSkewSymmetric;
+  const Matrix3<T> w_x = VectorToSkewSymmetric(
+      Vector3<T>(m.template head<3>()));
+  Matrix6<T> m_x = Matrix6<T>::Zero();
+  m_x.template topLeftCorner<3, 3>() = w_x;
+  m_x.template bottomRightCorner<3, 3>() = w_x;
+  m_x.template bottomLeftCorner<3, 3>() =
+      VectorToSkewSymmetric(Vector3<T>(m.template tail<3>()));
+  return m_x;
+}
+
+// Returns the spatial motion vector [0; v].
+template <typename T>
+Vector6<T> TranslationalMotion(const Vector3<T>& v) {
+  Vector6<T> m;
+  m << Vector3<T>::Zero(), v;
+  return m;
+}
+}  // namespace
+
 namespace internal {
 template <typename T>
 class JointImplementationBuilder {
@@ -144,10 +206,138 @@ void MultibodyTree<T>::FinalizeInternals() {
     CreateBodyNode(body_node_index);
   }
 
+  CreateBodyNodePartitions();
+
   // TODO(amcastro-tri): Remove when MultibodyCachingEvaluatorInterface lands.
   AllocateFakeCacheEntries();
 }
 
+template <typename T>
+void MultibodyTree<T>::set_max_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  max_num_threads_ = num_threads;
+  CreateBodyNodePartitions();
+}
+
+template <typename T>
+void MultibodyTree<T>::CreateBodyNodePartitions() {
+  body_node_partitions_.clear();
+  thread_pool_.reset();
+  if (!topology_is_valid() || max_num_threads_ == 1) return;
+
+  // Collect the nodes of each subtree attached to the world. Since nodes are
+  // in BFT order, a node's parent is visited before the node itself and each
+  // subtree lists its nodes in increasing index order.
+  const int num_nodes = topology_.get_num_body_nodes();
+  std::vector<std::vector<BodyNodeIndex>> subtrees;
+  std::vector<int> node_subtree(num_nodes, -1);
+  for (BodyNodeIndex body_node_index(1); body_node_index < num_nodes;
+       ++body_node_index) {
+    const BodyNodeTopology& node_topology =
+        topology_.get_body_node(body_node_index);
+    if (node_topology.level == 1) {
+      node_subtree[body_node_index] = static_cast<int>(subtrees.size());
+      subtrees.emplace_back();
+    } else {
+      node_subtree[body_node_index] =
+          node_subtree[node_topology.parent_body_node];
+    }
+    subtrees[node_subtree[body_node_index]].push_back(body_node_index);
+  }
+
+  const int num_partitions =
+      std::min(max_num_threads_, static_cast<int>(subtrees.size()));
+  // There is nothing to gain from a single partition.
+  if (num_partitions < 2) return;
+
+  // Greedily assign subtrees, largest first, to the partition with the least
+  // number of nodes.
+  std::sort(subtrees.begin(), subtrees.end(),
+            [](const std::vector<BodyNodeIndex>& a,
+               const std::vector<BodyNodeIndex>& b) {
+              return a.size() > b.size();
+            });
+  body_node_partitions_.resize(num_partitions);
+  for (const std::vector<BodyNodeIndex>& subtree : subtrees) {
+    std::vector<BodyNodeIndex>& partition = *std::min_element(
+        body_node_partitions_.begin(), body_node_partitions_.end(),
+        [](const std::vector<BodyNodeIndex>& a,
+           const std::vector<BodyNodeIndex>& b) {
+          return a.size() < b.size();
+        });
+    partition.insert(partition.end(), subtree.begin(), subtree.end());
+  }
+  // Increasing index order is a valid base-to-tip order.
+  for (std::vector<BodyNodeIndex>& partition : body_node_partitions_) {
+    std::sort(partition.begin(), partition.end());
+  }
+
+  // The threads are reused by every recursion, rather than launched per call.
+  thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_partitions);
+}
+
+template <typename T>
+template <class NodeOperation>
+void MultibodyTree<T>::ForEachBodyNodeBaseToTip(
+    const NodeOperation& node_operation) const {
+  if (!body_node_partitions_.empty()) {
+    ForEachBodyNodeInParallel(true /* base_to_tip */, node_operation);
+    return;
+  }
+  // This skips the world, level = 0.
+  for (int level = 1; level < tree_height(); ++level) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      DRAKE_ASSERT(node.get_topology().level == level);
+      DRAKE_ASSERT(node.index() == body_node_index);
+      node_operation(node);
+    }
+  }
+}
+
+template <typename T>
+template <class NodeOperation>
+void MultibodyTree<T>::ForEachBodyNodeTipToBase(
+    const NodeOperation& node_operation) const {
+  if (!body_node_partitions_.empty()) {
+    ForEachBodyNodeInParallel(false /* base_to_tip */, node_operation);
+    return;
+  }
+  // This skips the world, level = 0.
+  for (int level = tree_height() - 1; level > 0; --level) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      DRAKE_ASSERT(node.get_topology().level == level);
+      DRAKE_ASSERT(node.index() == body_node_index);
+      node_operation(node);
+    }
+  }
+}
+
+template <typename T>
+template <class NodeOperation>
+void MultibodyTree<T>::ForEachBodyNodeInParallel(
+    bool base_to_tip, const NodeOperation& node_operation) const {
+  auto process_partition =
+      [this, base_to_tip, &node_operation](
+          const std::vector<BodyNodeIndex>& partition) {
+        if (base_to_tip) {
+          for (auto it = partition.begin(); it != partition.end(); ++it)
+            node_operation(*body_nodes_[*it]);
+        } else {
+          for (auto it = partition.rbegin(); it != partition.rend(); ++it)
+            node_operation(*body_nodes_[*it]);
+        }
+      };
+  // The calling thread processes the first partition. Run() re-throws any
+  // exception thrown within the other threads.
+  DRAKE_DEMAND(thread_pool_ != nullptr);
+  thread_pool_->Run(static_cast<int>(body_node_partitions_.size()),
+                    [&](int k) {
+                      process_partition(body_node_partitions_[k]);
+                    });
+}
+
 template <typename T>
 void MultibodyTree<T>::Finalize() {
   DRAKE_MBT_THROW_IF_FINALIZED();
@@ -322,17 +512,10 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
-  for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == level);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Update per-node kinematics.
-      node.CalcPositionKinematicsCache_BaseToTip(mbt_context, pc);
-    }
-  }
+  ForEachBodyNodeBaseToTip([&](const BodyNode<T>& node) {
+    // Update per-node kinematics.
+    node.CalcPositionKinematicsCache_BaseToTip(mbt_context, pc);
+  });
 }
 
 template <typename T>
@@ -347,33 +530,26 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   // TODO(amcastro-tri): Loop over bodies to compute velocity kinematics updates
   // corresponding to flexible bodies.
 
-  // TODO(amcastro-tri): Eval H_PB_W from the cache.
-  std::vector<Vector6<T>> H_PB_W_cache(num_velocities());
-  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+  // Across-node Jacobians H_PB_W, already computed with the position
+  // kinematics.
+  const std::vector<Vector6<T>>& H_PB_W_cache = pc.get_H_PB_W_cache();
 
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
+  ForEachBodyNodeBaseToTip([&](const BodyNode<T>& node) {
+    // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
+    // number of mobilities for this node. Therefore, the return is a
+    // MatrixUpTo6 since the number of columns generally changes with the
+    // node.
+    // It is returned as an Eigen::Map to the memory allocated in the
+    // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
+    // other Eigen matrix object.
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
 
-      // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
-      // number of mobilities for this node. Therefore, the return is a
-      // MatrixUpTo6 since the number of columns generally changes with the
-      // node.
-      // It is returned as an Eigen::Map to the memory allocated in the
-      // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
-      // other Eigen matrix object.
-      Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
-          node.GetJacobianFromArray(H_PB_W_cache);
-
-      // Update per-node kinematics.
-      node.CalcVelocityKinematicsCache_BaseToTip(mbt_context, pc, H_PB_W, vc);
-    }
-  }
+    // Update per-node kinematics.
+    node.CalcVelocityKinematicsCache_BaseToTip(mbt_context, pc, H_PB_W, vc);
+  });
 }
 
 template <typename T>
@@ -399,18 +575,11 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
 
   // Performs a base-to-tip recursion computing body accelerations.
   // This skips the world, depth = 0.
-  for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Update per-node kinematics.
-      node.CalcSpatialAcceleration_BaseToTip(
-          mbt_context, pc, vc, known_vdot, A_WB_array);
-    }
-  }
+  ForEachBodyNodeBaseToTip([&](const BodyNode<T>& node) {
+    // Update per-node kinematics.
+    node.CalcSpatialAcceleration_BaseToTip(
+        mbt_context, pc, vc, known_vdot, A_WB_array);
+  });
 }
 
 template <typename T>
@@ -464,50 +633,42 @@ void MultibodyTree<T>::CalcInverseDynamics(
   // known.
   CalcSpatialAccelerationsFromVdot(context, pc, vc, known_vdot, A_WB_array);
 
-  // Vector of generalized forces per mobilizer.
-  // It has zero size if no forces are applied.
-  VectorUpTo6<T> tau_applied_mobilizer(0);
-
-  // Spatial force applied on B at Bo.
-  // It is left initialized to zero if no forces are applied.
-  SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
-
   // Performs a tip-to-base recursion computing the total spatial force F_BMo_W
   // acting on body B, about point Mo, expressed in the world frame W.
-  // This includes the world (depth = 0) so that F_BMo_W_array[world_index()]
-  // contains the total force of the bodies connected to the world by a
-  // mobilizer.
-  for (int depth = tree_height() - 1; depth >= 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
-
-      // Make a copy to the total applied forces since the call to
-      // CalcInverseDynamics_TipToBase() below could overwrite the entry for the
-      // current body node if the input applied forces arrays are the same
-      // in-memory object as the output arrays.
-      // This allows users to specify the same input and output arrays if
-      // desired to minimize memory footprint.
-      // Leave them initialized to zero if no applied forces were provided.
-      if (tau_applied_size != 0) {
-        tau_applied_mobilizer =
-            node.get_mobilizer().get_generalized_forces_from_array(
-                tau_applied_array);
-      }
-      if (Fapplied_size != 0) {
-        Fapplied_Bo_W = Fapplied_Bo_W_array[body_node_index];
-      }
-
-      // Compute F_BMo_W for the body associated with this node and project it
-      // onto the space of generalized forces for the associated mobilizer.
-      node.CalcInverseDynamics_TipToBase(
-          mbt_context, pc, vc, *A_WB_array,
-          Fapplied_Bo_W, tau_applied_mobilizer,
-          F_BMo_W_array, tau_array);
+  auto calc_inverse_dynamics_tip_to_base = [&](const BodyNode<T>& node) {
+    // Vector of generalized forces per mobilizer.
+    // It has zero size if no forces are applied.
+    VectorUpTo6<T> tau_applied_mobilizer(0);
+
+    // Spatial force applied on B at Bo.
+    // It is left initialized to zero if no forces are applied.
+    SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+
+    // Make a copy to the total applied forces since the call to
+    // CalcInverseDynamics_TipToBase() below could overwrite the entry for the
+    // current body node if the input applied forces arrays are the same
+    // in-memory object as the output arrays.
+    // This allows users to specify the same input and output arrays if
+    // desired to minimize memory footprint.
+    // Leave them initialized to zero if no applied forces were provided.
+    if (tau_applied_size != 0) {
+      tau_applied_mobilizer =
+          node.get_mobilizer().get_generalized_forces_from_array(
+              tau_applied_array);
     }
-  }
+    if (Fapplied_size != 0) {
+      Fapplied_Bo_W = Fapplied_Bo_W_array[node.index()];
+    }
+
+    // Compute F_BMo_W for the body associated with this node and project it
+    // onto the space of generalized forces for the associated mobilizer.
+    node.CalcInverseDynamics_TipToBase(
+        mbt_context, pc, vc, *A_WB_array,
+        Fapplied_Bo_W, tau_applied_mobilizer,
+        F_BMo_W_array, tau_array);
+  };
+  // This skips the world, depth = 0, which has no mobilizer.
+  ForEachBodyNodeTipToBase(calc_inverse_dynamics_tip_to_base);
 }
 
 template <typename T>
@@ -636,6 +797,313 @@ void MultibodyTree<T>::DoCalcBiasTerm(
                       &A_WB_array, &F_BMo_W_array, Cv);
 }
 
+template <typename T>
+Vector3<T> MultibodyTree<T>::GetUniformGravityOrThrow(
+    const char* source_method) const {
+  Vector3<T> g_W = Vector3<T>::Zero();
+  for (const auto& force_element : owned_force_elements_) {
+    const auto* gravity_field =
+        dynamic_cast<const UniformGravityFieldElement<T>*>(
+            force_element.get());
+    if (gravity_field == nullptr) {
+      throw std::logic_error(
+          "Calls to '" + std::string(source_method) + "()' are only "
+          "supported for models with force elements of type "
+          "UniformGravityFieldElement.");
+    }
+    g_W += gravity_field->gravity_vector().template cast<T>();
+  }
+  return g_W;
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv) const {
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(known_vdot.size() == nv);
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dq->rows() == nv && dtau_dq->cols() == nv);
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+  const Vector3<T> g_W = GetUniformGravityOrThrow(__func__);
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  DoCalcInverseDynamicsDerivatives(
+      context, pc, known_vdot, g_W, nullptr, dtau_dq, dtau_dv);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const VectorX<T>& tau_applied,
+    EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv) const {
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(tau_applied.size() == nv);
+  DRAKE_THROW_UNLESS(dvdot_dq != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dq->rows() == nv && dvdot_dq->cols() == nv);
+  DRAKE_THROW_UNLESS(dvdot_dv != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dv->rows() == nv && dvdot_dv->cols() == nv);
+  const Vector3<T> g_W = GetUniformGravityOrThrow(__func__);
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+
+  MatrixX<T> M(nv, nv);
+  DoCalcMassMatrixViaInverseDynamics(context, pc, &M);
+  const Eigen::LDLT<MatrixX<T>> M_ldlt(M);
+
+  // The bias term C(q, v)v - tau_g(q) corresponds to the inverse dynamics
+  // with zero generalized accelerations.
+  VectorX<T> bias(nv);
+  DoCalcInverseDynamicsDerivatives(
+      context, pc, VectorX<T>::Zero(nv), g_W, &bias, nullptr, nullptr);
+  const VectorX<T> vdot = M_ldlt.solve(tau_applied - bias);
+
+  // Since tau(q, v, v̇(q, v, tau_app)) = tau_app for all q and v, the chain
+  // rule gives ∂tau/∂q + M(q)⋅∂v̇/∂q = 0 and similarly for v.
+  DoCalcInverseDynamicsDerivatives(
+      context, pc, vdot, g_W, nullptr, dvdot_dq, dvdot_dv);
+  *dvdot_dq = -M_ldlt.solve(*dvdot_dq);
+  *dvdot_dv = -M_ldlt.solve(*dvdot_dv);
+}
+
+template <typename T>
+void MultibodyTree<T>::DoCalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const PositionKinematicsCache<T>& pc,
+    const VectorX<T>& known_vdot,
+    const Vector3<T>& g_W,
+    EigenPtr<VectorX<T>> tau,
+    EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv) const {
+  // Summary of the algorithm:
+  // All spatial quantities are measured at the world origin Wo and expressed
+  // in the world frame W, see CrossMotion(). For each body node i with parent
+  // node λ, the recursive Newton-Euler algorithm reads:
+  //   Vᵢ = V_λ + Sᵢvᵢ                                                     (1)
+  //   Aᵢ = A_λ + Sᵢv̇ᵢ + Cᵢ                                                (2)
+  //   fᵢ = IᵢAᵢ + Vᵢ ×* IᵢVᵢ                                              (3)
+  //   Fᵢ = fᵢ + Σ_c F_c                                                   (4)
+  //   tauᵢ = SᵢᵀFᵢ                                                        (5)
+  // where Sᵢ is this node's across-mobilizer Jacobian H_PB_W shifted to Wo,
+  // Iᵢ is the spatial inertia of body i about Wo, the summation in (4) is over
+  // the children c of node i and gravity is included by setting the spatial
+  // acceleration of the world to A₀ = [0; -g]. The bias acceleration is
+  //   Cᵢ = V_λ × Sᵢvᵢ + [0; uᵢ × wᵢ]                                      (6)
+  // with wᵢ and uᵢ the angular velocity of the outboard frame M in the
+  // inboard frame F and the translational velocity of Mo in F, respectively,
+  // both expressed in W. The second term in (6) arises from the motion of
+  // the point Mo about which H_FM is defined.
+  //
+  // Derivatives are obtained by differentiating (1)-(5) in a single
+  // base-to-tip and a single tip-to-base pass for each generalized velocity
+  // j, of mobilizer J. A perturbation δq = N(q)⋅eⱼ displaces all bodies
+  // outboard of J rigidly with the spatial velocity sⱼ, the j-th column of
+  // S_J. Therefore quantities X attached to those bodies change as sⱼ × X,
+  // except for S_J itself, which only changes due to the displacement of
+  // Mo. Only nodes in the subtree of J have non-zero derivatives in the
+  // base-to-tip pass.
+  // This derivation assumes that H_FM, expressed in F, is independent of the
+  // mobilizer's configuration, which is true for all mobilizers in this
+  // library.
+  const auto& mbt_context =
+      dynamic_cast<const MultibodyTreeContext<T>&>(context);
+  const int nb = num_bodies();
+  const int nv = num_velocities();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  const auto& v = mbt_context.get_velocities();
+
+  // Across-node Jacobians H_PB_W, already computed with the position
+  // kinematics.
+  const std::vector<Vector6<T>>& H_PB_W_cache = pc.get_H_PB_W_cache();
+
+  // Per-velocity quantities: columns of Sᵢ and the velocity of Mo in F
+  // induced by each generalized velocity. Also the node for each velocity.
+  std::vector<Vector6<T>> S_W(nv);
+  std::vector<Vector3<T>> v_FMo_W(nv);
+  std::vector<BodyNodeIndex> velocity_to_node(nv);
+  // Per-node quantities.
+  std::vector<Vector6<T>> V_W(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A_W(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> F_W(nb, Vector6<T>::Zero());
+  std::vector<Vector6<T>> Sv_W(nb), Svdot_W(nb);
+  std::vector<Vector3<T>> u_W(nb);
+  std::vector<Matrix6<T>> I_W(nb);
+  A_W[world_index()] = TranslationalMotion<T>(-g_W);
+
+  // Base-to-tip recursion for Eqs. (1), (2) and (3).
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    for (BodyNodeIndex i : body_node_levels_[depth]) {
+      const BodyNode<T>& node = *body_nodes_[i];
+      const BodyNodeTopology& node_topology = node.get_topology();
+      const BodyNodeIndex parent = node_topology.parent_body_node;
+      const int start = node_topology.mobilizer_velocities_start_in_v;
+      const int nm = node_topology.num_mobilizer_velocities;
+
+      const Isometry3<T>& X_WB = pc.get_X_WB(i);
+      const Vector3<T>& p_WB = X_WB.translation();
+      const Vector3<T> p_WMo = X_WB *
+          node.get_mobilizer().outboard_frame().CalcPoseInBodyFrame(
+              context).translation();
+
+      Sv_W[i].setZero();
+      Svdot_W[i].setZero();
+      u_W[i].setZero();
+      for (int k = start; k < start + nm; ++k) {
+        const Vector3<T> w = H_PB_W_cache[k].template head<3>();
+        const Vector3<T> v_Bo = H_PB_W_cache[k].template tail<3>();
+        S_W[k] << w, v_Bo + p_WB.cross(w);
+        v_FMo_W[k] = v_Bo + w.cross(p_WMo - p_WB);
+        velocity_to_node[k] = i;
+        Sv_W[i] += S_W[k] * v(k);
+        Svdot_W[i] += S_W[k] * known_vdot(k);
+        u_W[i] += v_FMo_W[k] * v(k);
+      }
+
+      V_W[i] = V_W[parent] + Sv_W[i];
+      const Vector6<T> C_W = CrossMotion(V_W[parent], Sv_W[i]) +
+          TranslationalMotion<T>(
+              u_W[i].cross(Sv_W[i].template head<3>()));
+      A_W[i] = A_W[parent] + Svdot_W[i] + C_W;
+
+      I_W[i] = node.body().CalcSpatialInertiaInBodyFrame(mbt_context).
+          ReExpress(X_WB.linear()).Shift(-p_WB).CopyToFullMatrix6();
+      F_W[i] = I_W[i] * A_W[i] +
+          CrossForce(V_W[i], Vector6<T>(I_W[i] * V_W[i]));
+    }
+  }
+
+  // Tip-to-base recursion for Eq. (4).
+  for (int depth = tree_height() - 1; depth > 0; --depth) {
+    for (BodyNodeIndex i : body_node_levels_[depth]) {
+      F_W[body_nodes_[i]->get_topology().parent_body_node] += F_W[i];
+    }
+  }
+
+  // Eq. (5).
+  if (tau != nullptr) {
+    DRAKE_DEMAND(tau->size() == nv);
+    for (int k = 0; k < nv; ++k)
+      (*tau)(k) = S_W[k].dot(F_W[velocity_to_node[k]]);
+  }
+
+  if (dtau_dq == nullptr && dtau_dv == nullptr) return;
+  DRAKE_DEMAND(dtau_dq != nullptr && dtau_dv != nullptr);
+
+  // Workspace for the derivatives along a single direction.
+  std::vector<bool> in_subtree(nb);
+  std::vector<Vector6<T>> dV_W(nb), dA_W(nb), dF_W(nb);
+
+  // Performs the tip-to-base pass for the derivatives of Eq. (4) and
+  // projects them as in Eq. (5) into column j of dtau. When
+  // `with_respect_to_q` is true, the change of Sᵢ is included.
+  auto project_derivatives = [&](
+      int j, bool with_respect_to_q, EigenPtr<MatrixX<T>> dtau) {
+    for (int depth = tree_height() - 1; depth > 0; --depth) {
+      for (BodyNodeIndex i : body_node_levels_[depth]) {
+        dF_W[body_nodes_[i]->get_topology().parent_body_node] += dF_W[i];
+      }
+    }
+    const BodyNodeIndex J = velocity_to_node[j];
+    for (int k = 0; k < nv; ++k) {
+      const BodyNodeIndex i = velocity_to_node[k];
+      (*dtau)(k, j) = S_W[k].dot(dF_W[i]);
+      if (with_respect_to_q && in_subtree[i]) {
+        const Vector6<T> dS_W = (i == J) ?
+            TranslationalMotion<T>(
+                v_FMo_W[j].cross(S_W[k].template head<3>())) :
+            CrossMotion(S_W[j], S_W[k]);
+        (*dtau)(k, j) += dS_W.dot(F_W[i]);
+      }
+    }
+  };
+
+  for (int j = 0; j < nv; ++j) {
+    const BodyNodeIndex J = velocity_to_node[j];
+    const Vector6<T>& s = S_W[j];
+    const Vector3<T> w_s = s.template head<3>();
+    const Matrix6<T> s_x = CrossMotionMatrix(s);
+
+    // Flag the nodes outboard of J, including J itself.
+    in_subtree[world_index()] = false;
+    for (int depth = 1; depth < tree_height(); ++depth) {
+      for (BodyNodeIndex i : body_node_levels_[depth]) {
+        const BodyNodeIndex parent =
+            body_nodes_[i]->get_topology().parent_body_node;
+        in_subtree[i] = i == J || in_subtree[parent];
+      }
+    }
+
+    // Derivatives with respect to the generalized positions.
+    for (int depth = 0; depth < tree_height(); ++depth) {
+      for (BodyNodeIndex i : body_node_levels_[depth]) {
+        if (!in_subtree[i]) {
+          dV_W[i].setZero();
+          dA_W[i].setZero();
+          dF_W[i].setZero();
+          continue;
+        }
+        const BodyNodeIndex parent =
+            body_nodes_[i]->get_topology().parent_body_node;
+        if (i == J) {
+          // Only the point Mo moves. Therefore S_J changes only due to the
+          // shift from Mo to Wo.
+          const Vector6<T> dSv_W = TranslationalMotion<T>(
+              v_FMo_W[j].cross(Sv_W[i].template head<3>()));
+          dV_W[i] = dSv_W;
+          dA_W[i] = TranslationalMotion<T>(
+              v_FMo_W[j].cross(Svdot_W[i].template head<3>())) +
+              CrossMotion(V_W[parent], dSv_W);
+        } else {
+          const Vector6<T> dSv_W = CrossMotion(s, Sv_W[i]);
+          dV_W[i] = dV_W[parent] + dSv_W;
+          const Vector6<T> dC_W =
+              CrossMotion(dV_W[parent], Sv_W[i]) +
+              CrossMotion(V_W[parent], dSv_W) +
+              CrossMotion(s, TranslationalMotion<T>(
+                  u_W[i].cross(Sv_W[i].template head<3>())));
+          dA_W[i] = dA_W[parent] + CrossMotion(s, Svdot_W[i]) + dC_W;
+        }
+        // Body i moves rigidly with spatial velocity s.
+        const Matrix6<T> dI_W = -s_x.transpose() * I_W[i] - I_W[i] * s_x;
+        const Vector6<T> IV = I_W[i] * V_W[i];
+        dF_W[i] = dI_W * A_W[i] + I_W[i] * dA_W[i] +
+            CrossForce(dV_W[i], IV) +
+            CrossForce(V_W[i], Vector6<T>(dI_W * V_W[i] + I_W[i] * dV_W[i]));
+      }
+    }
+    project_derivatives(j, true, dtau_dq);
+
+    // Derivatives with respect to the generalized velocities.
+    for (int depth = 0; depth < tree_height(); ++depth) {
+      for (BodyNodeIndex i : body_node_levels_[depth]) {
+        if (!in_subtree[i]) {
+          dV_W[i].setZero();
+          dA_W[i].setZero();
+          dF_W[i].setZero();
+          continue;
+        }
+        const BodyNodeIndex parent =
+            body_nodes_[i]->get_topology().parent_body_node;
+        if (i == J) {
+          dV_W[i] = s;
+          dA_W[i] = CrossMotion(V_W[parent], s) + TranslationalMotion<T>(
+              v_FMo_W[j].cross(Sv_W[i].template head<3>()) +
+              u_W[i].cross(w_s));
+        } else {
+          dV_W[i] = dV_W[parent];
+          dA_W[i] = dA_W[parent] + CrossMotion(dV_W[parent], Sv_W[i]);
+        }
+        dF_W[i] = I_W[i] * dA_W[i] +
+            CrossForce(dV_W[i], Vector6<T>(I_W[i] * V_W[i])) +
+            CrossForce(V_W[i], Vector6<T>(I_W[i] * dV_W[i]));
+      }
+    }
+    project_derivatives(j, false, dtau_dv);
+  }
+}
+
 template <typename T>
 Isometry3<T> MultibodyTree<T>::CalcRelativeTransform(
     const systems::Context<T>& context,
@@ -686,35 +1154,6 @@ const SpatialVelocity<T>& MultibodyTree<T>::EvalBodySpatialVelocityInWorld(
   return EvalVelocityKinematics(context).get_V_WB(body_B.node_index());
 }
 
-template <typename T>
-void MultibodyTree<T>::CalcAcrossNodeGeometricJacobianExpressedInWorld(
-    const systems::Context<T>& context,
-    const PositionKinematicsCache<T>& pc,
-    std::vector<Vector6<T>>* H_PB_W_cache) const {
-  DRAKE_DEMAND(H_PB_W_cache != nullptr);
-  DRAKE_DEMAND(static_cast<int>(H_PB_W_cache->size()) == num_velocities());
-
-  const auto& mbt_context =
-      dynamic_cast<const MultibodyTreeContext<T>&>(context);
-
-  for (BodyNodeIndex node_index(1);
-       node_index < num_bodies(); ++node_index) {
-    const BodyNode<T>& node = *body_nodes_[node_index];
-
-    // Jacobian matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the number
-    // of mobilities for this node. Therefore, the return is a MatrixUpTo6 since
-    // the number of columns generally changes with the node.
-    // It is returned as an Eigen::Map to the memory allocated in the
-    // std::vector H_PB_W_cache so that we can work with H_PB_W as with any
-    // other Eigen matrix object.
-    Eigen::Map<MatrixUpTo6<T>> H_PB_W =
-        node.GetMutableJacobianFromArray(H_PB_W_cache);
-
-    node.CalcAcrossNodeGeometricJacobianExpressedInWorld(
-        mbt_context, pc, &H_PB_W);
-  }
-}
-
 template <typename T>
 void MultibodyTree<T>::CalcPointsGeometricJacobianExpressedInWorld(
     const systems::Context<T>& context,
@@ -737,14 +1176,18 @@ void MultibodyTree<T>::CalcPointsGeometricJacobianExpressedInWorld(
 
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
-  // TODO(amcastro-tri): Eval H_PB_W from the cache.
-  std::vector<Vector6<T>> H_PB_W_cache(num_velocities());
-  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+  // Across-node Jacobians H_PB_W, already computed with the position
+  // kinematics.
+  const std::vector<Vector6<T>>& H_PB_W_cache = pc.get_H_PB_W_cache();
 
   CalcPointsPositions(context,
                       frame_B, p_BQi_set,            /* From frame B */
                       world_frame(), p_WQi_set); /* To world frame W */
 
+  // Only the velocities of the nodes in the kinematic path from body_B to the
+  // world contribute to Jv_WQi. The remaining columns are zero.
+  Jv_WQi->setZero();
+
   // Performs a scan of all bodies in the kinematic path from body_B to the
   // world computing each node's contribution to Jv_WQi.
   const int Jnrows = 3 * num_points;  // Number of rows in Jv_WQi.
@@ -802,9 +1245,9 @@ void MultibodyTree<T>::CalcFrameGeometricJacobianExpressedInWorld(
 
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
-  // TODO(amcastro-tri): Eval H_PB_W from the cache.
-  std::vector<Vector6<T>> H_PB_W_cache(num_velocities());
-  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+  // Across-node Jacobians H_PB_W, already computed with the position
+  // kinematics.
+  const std::vector<Vector6<T>>& H_PB_W_cache = pc.get_H_PB_W_cache();
 
   // Compute the position of F's origin in the world frame.
   Vector3<T> p_WoFo_W;
@@ -956,22 +1399,18 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
   const auto& mbt_context =
       dynamic_cast<const MultibodyTreeContext<T>&>(context);
 
-  // TODO(bobbyluig): Eval H_PB_W from the cache.
-  std::vector<Vector6<T>> H_PB_W_cache(num_velocities());
-  CalcAcrossNodeGeometricJacobianExpressedInWorld(context, pc, &H_PB_W_cache);
+  // Across-node Jacobians H_PB_W, already computed with the position
+  // kinematics.
+  const std::vector<Vector6<T>>& H_PB_W_cache = pc.get_H_PB_W_cache();
 
   // Perform tip-to-base recursion, skipping the world.
-  for (int depth = tree_height() - 1; depth > 0; depth--) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
-      // Get hinge mapping matrix.
-      const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
+  ForEachBodyNodeTipToBase([&](const BodyNode<T>& node) {
+    // Get hinge mapping matrix.
+    const MatrixUpTo6<T> H_PB_W = node.GetJacobianFromArray(H_PB_W_cache);
 
-      node.CalcArticulatedBodyInertiaCache_TipToBase(
-          mbt_context, pc, H_PB_W, abc);
-    }
-  }
+    node.CalcArticulatedBodyInertiaCache_TipToBase(
+        mbt_context, pc, H_PB_W, abc);
+  });
 }
 
 // Explicitly instantiates on the most common scalar types.
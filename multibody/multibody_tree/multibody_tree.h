@@ -11,6 +11,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_optional.h"
+#include "drake/common/thread_pool.h"
 #include "drake/multibody/multibody_tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/multibody_tree/body.h"
 #include "drake/multibody/multibody_tree/body_node.h"
@@ -669,6 +670,38 @@ class MultibodyTree {
     return topology_.tree_height();
   }
 
+  /// Sets the maximum number of threads used by the recursive algorithms of
+  /// `this` %MultibodyTree. The default is one, i.e. all recursions run
+  /// serially on the calling thread.
+  ///
+  /// When `num_threads` is larger than one, the subtrees directly attached to
+  /// the world body, which are kinematically independent of each other, are
+  /// distributed into at most `num_threads` groups of similar size. The
+  /// base-to-tip and tip-to-base recursions then process each group on its own
+  /// thread. This applies to CalcPositionKinematicsCache(),
+  /// CalcVelocityKinematicsCache(), CalcAccelerationKinematicsCache(),
+  /// CalcInverseDynamics() and CalcArticulatedBodyInertiaCache().
+  /// Results are identical to those of the serial recursions.
+  ///
+  /// The threads are created once, by this method, and reused by every call to
+  /// these methods. Each call still synchronizes once with these threads. This
+  /// overhead is only amortized for models with many bodies in several
+  /// independent subtrees, for instance several robots within a single model.
+  /// For models with a single subtree, like a single robot arm, the recursions
+  /// always run serially.
+  ///
+  /// The %MultibodyTree methods listed above are only safe to call
+  /// concurrently from these threads if the computations of all its elements
+  /// (bodies, frames, mobilizers) only read from the context, as is the case
+  /// for all the element types provided with %MultibodyTree.
+  ///
+  /// @throws std::exception if `num_threads` is smaller than one.
+  void set_max_num_threads(int num_threads);
+
+  /// Returns the maximum number of threads used by the recursive algorithms of
+  /// `this` %MultibodyTree. See set_max_num_threads().
+  int get_max_num_threads() const { return max_num_threads_; }
+
   /// Returns a constant reference to the *world* body.
   const RigidBody<T>& world_body() const {
     // world_body_ is set in the constructor. So this assert is here only to
@@ -1102,7 +1135,9 @@ class MultibodyTree {
   ///   input set. Therefore `J_WQi` is a matrix of size `3⋅np x nv`, with `nv`
   ///   the number of generalized velocities. On input, matrix `J_WQi` **must**
   ///   have size `3⋅np x nv` or this method throws a std::runtime_error
-  ///   exception.
+  ///   exception. Columns for generalized velocities that do not move frame B
+  ///   are set to zero. In particular, `Jv_WQi` is zero for frames attached
+  ///   to the world body.
   ///
   /// @throws an exception if the output `p_WQi_set` is nullptr or does not have
   /// the same size as the input array `p_BQi_set`.
@@ -1496,6 +1531,95 @@ class MultibodyTree {
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
 
+  /// Computes the partial derivatives of the inverse dynamics with respect to
+  /// the generalized positions and velocities stored in `context`. The inverse
+  /// dynamics considered here is: <pre>
+  ///   tau(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_g(q)
+  /// </pre>
+  /// where `tau_g(q)` are the generalized forces due to the
+  /// UniformGravityFieldElement objects in the model. That is, this method
+  /// computes the derivatives of the generalized forces that must be applied
+  /// to the model, in addition to gravity, to attain the generalized
+  /// accelerations `known_vdot`.
+  ///
+  /// Derivatives are computed analytically with a recursive `O(n⋅nv)`
+  /// algorithm, with n the number of bodies and nv the number of generalized
+  /// velocities, that differentiates each step of the recursive Newton-Euler
+  /// algorithm. Unlike instantiating the model on AutoDiffXd, no dynamic
+  /// memory allocation per scalar operation is required.
+  ///
+  /// Derivatives with respect to the generalized positions are taken along
+  /// the tangent directions `δq = N(q)⋅δv`, see MapVelocityToQDot(). That is,
+  /// on output `dtau_dq = ∂tau/∂q⋅N(q)`. For models in which `N(q)` is the
+  /// identity, like models with revolute joints only, `dtau_dq` is exactly
+  /// `∂tau/∂q`. For models with quaternion floating mobilizers, `dtau_dq` is
+  /// the derivative with respect to a perturbation of the free body's pose
+  /// parameterized by its angular and translational velocities.
+  /// The derivative with respect to `known_vdot` is the mass matrix, see
+  /// CalcMassMatrixViaInverseDynamics().
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] known_vdot
+  ///   A vector with the known generalized accelerations `vdot` for the full
+  ///   %MultibodyTree model. It must be of size num_velocities().
+  /// @param[out] dtau_dq
+  ///   The `nv x nv` matrix `∂tau/∂q⋅N(q)`. It must not be nullptr.
+  /// @param[out] dtau_dv
+  ///   The `nv x nv` matrix `∂tau/∂v`. It must not be nullptr.
+  ///
+  /// @throws std::logic_error if the model contains a ForceElement other than
+  /// a UniformGravityFieldElement, since its derivatives are not available.
+  /// @throws std::exception if any of the sizes is not consistent with this
+  /// model.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context,
+      const VectorX<T>& known_vdot,
+      EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  /// Computes the partial derivatives of the forward dynamics with respect to
+  /// the generalized positions and velocities stored in `context`. The
+  /// forward dynamics considered here is: <pre>
+  ///   v̇(q, v, tau_app) = M(q)⁻¹(tau_app + tau_g(q) - C(q, v)v)
+  /// </pre>
+  /// where `tau_g(q)` are the generalized forces due to the
+  /// UniformGravityFieldElement objects in the model and `tau_app` is a vector
+  /// of applied generalized forces, independent of the state.
+  /// These derivatives are obtained from the derivatives of the inverse
+  /// dynamics as [Carpentier and Mansard, 2018]: <pre>
+  ///   ∂v̇/∂q = -M(q)⁻¹⋅∂tau/∂q,  ∂v̇/∂v = -M(q)⁻¹⋅∂tau/∂v
+  /// </pre>
+  /// with the derivatives of the inverse dynamics evaluated at `v̇(q, v,
+  /// tau_app)`, see CalcInverseDynamicsDerivatives(). The derivative with
+  /// respect to `tau_app` is `M(q)⁻¹`. As for the inverse dynamics,
+  /// derivatives with respect to the generalized positions are taken along
+  /// the tangent directions `δq = N(q)⋅δv`.
+  ///
+  /// - [Carpentier and Mansard, 2018] Carpentier, J. and Mansard, N., 2018.
+  ///   Analytical derivatives of rigid body dynamics algorithms. In Robotics:
+  ///   Science and Systems.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the %MultibodyTree model.
+  /// @param[in] tau_applied
+  ///   The vector of applied generalized forces `tau_app`. It must be of size
+  ///   num_velocities().
+  /// @param[out] dvdot_dq
+  ///   The `nv x nv` matrix `∂v̇/∂q⋅N(q)`. It must not be nullptr.
+  /// @param[out] dvdot_dv
+  ///   The `nv x nv` matrix `∂v̇/∂v`. It must not be nullptr.
+  ///
+  /// @throws std::logic_error if the model contains a ForceElement other than
+  /// a UniformGravityFieldElement, since its derivatives are not available.
+  /// @throws std::exception if any of the sizes is not consistent with this
+  /// model.
+  void CalcForwardDynamicsDerivatives(
+      const systems::Context<T>& context,
+      const VectorX<T>& tau_applied,
+      EigenPtr<MatrixX<T>> dvdot_dq,
+      EigenPtr<MatrixX<T>> dvdot_dv) const;
+
   /// Transforms generalized velocities v to time derivatives `qdot` of the
   /// generalized positions vector `q` (stored in `context`). `v` and `qdot`
   /// are related linearly by `q̇ = N(q)⋅v`.
@@ -1742,6 +1866,7 @@ class MultibodyTree {
     tree_clone->body_name_to_index_ = this->body_name_to_index_;
     tree_clone->joint_name_to_index_ = this->joint_name_to_index_;
     tree_clone->actuator_name_to_index_ = this->actuator_name_to_index_;
+    tree_clone->max_num_threads_ = this->max_num_threads_;
 
     // All other internals templated on T are created with the following call to
     // FinalizeInternals().
@@ -1788,6 +1913,35 @@ class MultibodyTree {
   // previously called on this tree.
   void FinalizeInternals();
 
+  // Partitions the body nodes, excluding the world, into at most
+  // max_num_threads_ groups for the parallel execution of the recursive
+  // algorithms. See set_max_num_threads(). Each group is a set of complete
+  // subtrees attached to the world. It is a no-op if the topology was not yet
+  // finalized.
+  void CreateBodyNodePartitions();
+
+  // Invokes `node_operation(node)` on all body nodes excluding the world, with
+  // each node visited after its parent node. That is, in a base-to-tip order.
+  // Nodes are visited serially in BFT order unless a parallel execution was
+  // requested with set_max_num_threads().
+  template <class NodeOperation>
+  void ForEachBodyNodeBaseToTip(const NodeOperation& node_operation) const;
+
+  // Invokes `node_operation(node)` on all body nodes excluding the world, with
+  // each node visited after all its children nodes. That is, in a tip-to-base
+  // order. See ForEachBodyNodeBaseToTip() for details.
+  template <class NodeOperation>
+  void ForEachBodyNodeTipToBase(const NodeOperation& node_operation) const;
+
+  // Helper for ForEachBodyNodeBaseToTip() and ForEachBodyNodeTipToBase() that
+  // invokes `node_operation(node)` on the nodes of each partition, each
+  // partition on its own thread of thread_pool_. Nodes within each partition
+  // are traversed in increasing index order if `base_to_tip` is true and in
+  // decreasing index order otherwise.
+  template <class NodeOperation>
+  void ForEachBodyNodeInParallel(
+      bool base_to_tip, const NodeOperation& node_operation) const;
+
   // Helper method to add a QuaternionFreeMobilizer to all bodies that do not
   // have a mobilizer. The mobilizer is between each body and the world. To be
   // called at Finalize().
@@ -1822,20 +1976,6 @@ class MultibodyTree {
   // that the error message can include that detail.
   void ThrowIfNotFinalized(const char* source_method) const;
 
-  // Computes the cache entry associated with the geometric Jacobian H_PB_W for
-  // each node.
-  // The geometric Jacobian `H_PB_W` relates to the spatial velocity of B in P
-  // by `V_PB_W = H_PB_W(q)⋅v_B`, where `v_B` corresponds to the generalized
-  // velocities associated to body B. `H_PB_W` has size `6 x nm` with `nm` the
-  // number of mobilities associated with body B.
-  // `H_PB_W_cache` stores the Jacobian matrices for all nodes in the tree as a
-  // vector of the columns of these matrices. Therefore `H_PB_W_cache` has as
-  // many entries as number of generalized velocities in the tree.
-  void CalcAcrossNodeGeometricJacobianExpressedInWorld(
-      const systems::Context<T>& context,
-      const PositionKinematicsCache<T>& pc,
-      std::vector<Vector6<T>>* H_PB_W_cache) const;
-
   // Implementation for CalcMassMatrixViaInverseDynamics().
   // It assumes:
   //  - The position kinematics cache object is already updated to be in sync
@@ -1861,6 +2001,24 @@ class MultibodyTree {
       const VelocityKinematicsCache<T>& vc,
       EigenPtr<VectorX<T>> Cv) const;
 
+  // Returns the sum of the acceleration of gravity vectors of all
+  // UniformGravityFieldElement objects in the model.
+  // Throws std::logic_error if the model contains a force element of any
+  // other type.
+  Vector3<T> GetUniformGravityOrThrow(const char* source_method) const;
+
+  // Implementation of CalcInverseDynamicsDerivatives(). If `tau` is not
+  // nullptr, it also computes the generalized forces `tau(q, v, v̇)`, see
+  // CalcInverseDynamicsDerivatives() for details.
+  void DoCalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context,
+      const PositionKinematicsCache<T>& pc,
+      const VectorX<T>& known_vdot,
+      const Vector3<T>& g_W,
+      EigenPtr<VectorX<T>> tau,
+      EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv) const;
+
   // Implementation of CalcPotentialEnergy().
   // It is assumed that the position kinematics cache pc is in sync with
   // context.
@@ -2089,6 +2247,20 @@ class MultibodyTree {
   // in that level.
   std::vector<std::vector<BodyNodeIndex>> body_node_levels_;
 
+  // Maximum number of threads used by the recursive algorithms.
+  // See set_max_num_threads().
+  int max_num_threads_{1};
+
+  // Partitions of all body nodes, excluding the world, into groups of complete
+  // subtrees attached to the world. Each partition lists its node indexes in
+  // increasing order, which is a valid base-to-tip order. It is empty when the
+  // recursions must run serially. See set_max_num_threads().
+  std::vector<std::vector<BodyNodeIndex>> body_node_partitions_;
+
+  // Threads processing body_node_partitions_, one per partition. It is nullptr
+  // when body_node_partitions_ is empty.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
   MultibodyTreeTopology topology_;
 
   // Temporary solution for fake cache entries to help statbilize the API.
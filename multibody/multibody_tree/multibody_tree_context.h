@@ -14,6 +14,7 @@
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/continuous_state.h"
+#include "drake/systems/framework/discrete_values.h"
 #include "drake/systems/framework/leaf_context.h"
 #include "drake/systems/framework/value.h"
 
@@ -41,40 +42,57 @@ class MultibodyTreeContext: public systems::LeafContext<T> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultibodyTreeContext)
 
-  explicit MultibodyTreeContext(const MultibodyTreeTopology& topology) :
-      systems::LeafContext<T>(), topology_(topology) {
+  /// Creates a context for a MultibodyTree with the given `topology`.
+  /// If `discrete_state` is `true`, the multibody state `x = [q; v]` is stored
+  /// as the only group of discrete state variables in `this` context.
+  /// Otherwise it is stored as continuous state (the default).
+  explicit MultibodyTreeContext(
+      const MultibodyTreeTopology& topology, bool discrete_state = false) :
+      systems::LeafContext<T>(), topology_(topology),
+      is_state_discrete_(discrete_state) {
     using systems::AbstractValue;
     using systems::BasicVector;
     using systems::Context;
     using systems::ContinuousState;
+    using systems::DiscreteValues;
     using systems::LeafContext;
     using systems::Value;
 
-    // Allocate continuous state.
     const int num_positions = topology_.num_positions();
     const int num_velocities = topology_.num_velocities();
     const int num_states = topology_.num_states();
 
-    // TODO(amcastro-tri): Consider inheriting a more specific BasicVector.
-    // See EndlessRoadCar<T>::AllocateContinuousState().
-    auto xc = std::make_unique<ContinuousState<T>>(
-        std::make_unique<BasicVector<T>>(num_states),
-        num_positions, num_velocities, 0);
-    this->set_continuous_state(std::move(xc));
+    if (is_state_discrete_) {
+      // Allocate discrete state.
+      this->set_discrete_state(std::make_unique<DiscreteValues<T>>(
+          std::make_unique<BasicVector<T>>(num_states)));
+    } else {
+      // Allocate continuous state.
+      // TODO(amcastro-tri): Consider inheriting a more specific BasicVector.
+      // See EndlessRoadCar<T>::AllocateContinuousState().
+      auto xc = std::make_unique<ContinuousState<T>>(
+          std::make_unique<BasicVector<T>>(num_states),
+          num_positions, num_velocities, 0);
+      this->set_continuous_state(std::move(xc));
+    }
 
     // TODO(amcastro-tri): Create cache entries.
     // For instance, for PositionKinematicsCache so that it doesn't get
     // re-allocated and re-computed every time is needed.
   }
 
+  /// Returns `true` if the multibody state is stored as discrete state in
+  /// `this` context, and `false` if it is stored as continuous state.
+  bool is_state_discrete() const { return is_state_discrete_; }
+
   /// Returns the size of the generalized positions vector.
   int num_positions() const {
-    return this->get_continuous_state().get_generalized_position().size();
+    return topology_.num_positions();
   }
 
   /// Returns the size of the generalized velocities vector.
   int num_velocities() const {
-    return this->get_continuous_state().get_generalized_velocity().size();
+    return topology_.num_velocities();
   }
 
   /// Returns an Eigen expression of the vector of generalized positions.
@@ -104,18 +122,7 @@ class MultibodyTreeContext: public systems::LeafContext<T> {
   template <int count>
   Eigen::VectorBlock<const VectorX<T>, count> get_state_segment(
       int start) const {
-    // We know that MultibodyTreeContext is a LeafContext and therefore the
-    // continuous state vector must be a BasicVector.
-    // TODO(amcastro-tri): make use of VectorBase::get_contiguous_vector() once
-    // PR #6049 gets merged.
-    Eigen::VectorBlock<const VectorX<T>> xc =
-        dynamic_cast<const systems::BasicVector<T>&>(
-            this->get_continuous_state().get_vector()).get_value();
-    // xc.nestedExpression() resolves to "VectorX<T>&" since the continuous
-    // state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().template segment<count>(start);
+    return get_state_vector().template segment<count>(start);
   }
 
   /// Returns a mutable fixed-size Eigen::VectorBlock of `count` elements
@@ -123,19 +130,7 @@ class MultibodyTreeContext: public systems::LeafContext<T> {
   /// at `start`.
   template <int count>
   Eigen::VectorBlock<VectorX<T>, count> get_mutable_state_segment(int start) {
-    // We know that MultibodyTreeContext is a LeafContext and therefore the
-    // continuous state vector must be a BasicVector.
-    // TODO(amcastro-tri): make use of VectorBase::get_contiguous_vector() once
-    // PR #6049 gets merged.
-    Eigen::VectorBlock<VectorX<T>> xc =
-        dynamic_cast<systems::BasicVector<T>&>(
-            this->get_mutable_continuous_state().get_mutable_vector()).
-            get_mutable_value();
-    // xc.nestedExpression() resolves to "VectorX<T>&" since the continuous
-    // state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().template segment<count>(start);
+    return get_mutable_state_vector().template segment<count>(start);
   }
 
   /// Returns a const fixed-size Eigen::VectorBlock of `count` elements
@@ -143,18 +138,7 @@ class MultibodyTreeContext: public systems::LeafContext<T> {
   /// at `start`.
   Eigen::VectorBlock<const VectorX<T>> get_state_segment(
       int start, int count) const {
-    // We know that MultibodyTreeContext is a LeafContext and therefore the
-    // continuous state vector must be a BasicVector.
-    // TODO(amcastro-tri): make use of VectorBase::get_contiguous_vector() once
-    // PR #6049 gets merged.
-    Eigen::VectorBlock<const VectorX<T>> xc =
-        dynamic_cast<const systems::BasicVector<T>&>(
-            this->get_continuous_state().get_vector()).get_value();
-    // xc.nestedExpression() resolves to "const VectorX<T>&" since the
-    // continuous state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().segment(start, count);
+    return get_state_vector().segment(start, count);
   }
 
   /// Returns a mutable fixed-size Eigen::VectorBlock of `count` elements
@@ -162,23 +146,44 @@ class MultibodyTreeContext: public systems::LeafContext<T> {
   /// at `start`.
   Eigen::VectorBlock<VectorX<T>> get_mutable_state_segment(
       int start, int count) {
+    return get_mutable_state_vector().segment(start, count);
+  }
+
+ private:
+  // Returns a const reference to the full multibody state vector x = [q; v],
+  // stored either as continuous or discrete state.
+  const VectorX<T>& get_state_vector() const {
     // We know that MultibodyTreeContext is a LeafContext and therefore the
-    // continuous state vector must be a BasicVector.
+    // state vector must be a BasicVector.
     // TODO(amcastro-tri): make use of VectorBase::get_contiguous_vector() once
     // PR #6049 gets merged.
-    Eigen::VectorBlock<VectorX<T>> xc =
+    Eigen::VectorBlock<const VectorX<T>> x =
+        is_state_discrete_ ?
+        this->get_discrete_state(0).get_value() :
+        dynamic_cast<const systems::BasicVector<T>&>(
+            this->get_continuous_state().get_vector()).get_value();
+    // x.nestedExpression() resolves to "const VectorX<T>&" since the state
+    // is a BasicVector.
+    // If we do return x.segment() directly, we would instead get a
+    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
+    return x.nestedExpression();
+  }
+
+  // Returns a mutable reference to the full multibody state vector x = [q; v],
+  // stored either as continuous or discrete state.
+  VectorX<T>& get_mutable_state_vector() {
+    Eigen::VectorBlock<VectorX<T>> x =
+        is_state_discrete_ ?
+        this->get_mutable_discrete_state(0).get_mutable_value() :
         dynamic_cast<systems::BasicVector<T>&>(
             this->get_mutable_continuous_state().get_mutable_vector()).
             get_mutable_value();
-    // xc.nestedExpression() resolves to "VectorX<T>&" since the continuous
-    // state is a BasicVector.
-    // If we do return xc.segment() directly, we would instead get a
-    // Block<Block<VectorX>>, which is very different from Block<VectorX>.
-    return xc.nestedExpression().segment(start, count);
+    return x.nestedExpression();
   }
 
- private:
   const MultibodyTreeTopology topology_;
+  // If `true`, the multibody state is stored as discrete state.
+  const bool is_state_discrete_{false};
 };
 
 }  // namespace multibody
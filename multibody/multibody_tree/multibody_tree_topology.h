@@ -864,8 +864,10 @@ class MultibodyTreeTopology {
         node = get_body_node(node).parent_body_node) {
       (*path_to_world)[get_body_node(node).level] = node;
     }
-    // Verify the last added node to the path is a child of the world.
-    DRAKE_DEMAND(get_body_node((*path_to_world)[1]).level == 1);
+    // Verify the last added node to the path is a child of the world, unless
+    // "from" is the world itself.
+    DRAKE_DEMAND(
+        path_size == 1 || get_body_node((*path_to_world)[1]).level == 1);
     (*path_to_world)[0] = BodyNodeIndex(0);  // Add the world.
   }
 
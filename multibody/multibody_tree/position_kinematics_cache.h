@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_stl_types.h"
@@ -20,6 +22,27 @@ namespace multibody {
 /// - Mobilizer's matrices H_FM (with F and M defined above) that map the
 ///   mobilizer's generalized velocities v to cross-joint spatial velocities
 ///   V_FM = H_FM * v.
+/// - Position vectors `p_PoBo_W` from the origin of a body's parent body frame
+///   P to the origin of the body frame B, expressed in the world frame W.
+/// - Across-node Jacobians `H_PB_W` that map a node's generalized velocities
+///   v_B to the spatial velocity `V_PB_W = H_PB_W * v_B` of the node's body B
+///   in its parent body P, expressed in the world frame W.
+///
+/// Each of these quantities is stored in its own contiguous pool. Since body
+/// nodes are indexed in BFT (Breadth-First Traversal) order, entries within
+/// each pool are ordered by tree level and therefore the base-to-tip and
+/// tip-to-base recursions in MultibodyTree traverse these pools sequentially.
+/// `p_PoBo_W` and `H_PB_W` are computed once per position update and reused
+/// by all velocity and acceleration dependent computations.
+///
+/// The BodyNode recursions also read the following quantities, which are
+/// computed along with the poses and stored in pools of their own so that the
+/// velocity and acceleration recursions do not recompute them from the poses
+/// and the mobilizer frames:
+/// - The orientation `R_WF` of the inboard frame F of a node's mobilizer in
+///   the world frame W.
+/// - Position vectors `p_MoBo_F` from the origin of a mobilizer's outboard
+///   frame M to the origin of the node's body frame B, expressed in F.
 ///
 /// @tparam T The mathematical type of the context, which must be a valid Eigen
 ///           scalar.
@@ -37,7 +60,8 @@ class PositionKinematicsCache {
   /// Constructs a position kinematics cache entry for the given
   /// MultibodyTreeTopology.
   explicit PositionKinematicsCache(const MultibodyTreeTopology& topology) :
-      num_nodes_(topology.num_bodies()) {
+      num_nodes_(topology.num_bodies()),
+      num_velocities_(topology.num_velocities()) {
     Allocate();
   }
 
@@ -97,6 +121,65 @@ class PositionKinematicsCache {
     return X_FM_pool_[body_node_index];
   }
 
+  /// Returns a const reference to the rotation matrix `R_WF` of the inboard
+  /// frame F of the mobilizer associated with node `body_node_index` in the
+  /// world frame W.
+  const Matrix3<T>& get_R_WF(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return R_WF_pool_[body_node_index];
+  }
+
+  /// Mutable version of get_R_WF().
+  Matrix3<T>& get_mutable_R_WF(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return R_WF_pool_[body_node_index];
+  }
+
+  /// Returns a const reference to the position vector `p_PoBo_W` from the
+  /// origin Po of the parent body frame P to the origin Bo of the body frame B
+  /// (associated with node `body_node_index`), expressed in the world frame W.
+  const Vector3<T>& get_p_PoBo_W(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return p_PoBo_W_pool_[body_node_index];
+  }
+
+  /// Mutable version of get_p_PoBo_W().
+  Vector3<T>& get_mutable_p_PoBo_W(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return p_PoBo_W_pool_[body_node_index];
+  }
+
+  /// Returns a const reference to the position vector `p_MoBo_F` from the
+  /// origin Mo of the outboard frame M of the mobilizer associated with node
+  /// `body_node_index` to the origin Bo of the node's body frame B, expressed
+  /// in the inboard frame F.
+  const Vector3<T>& get_p_MoBo_F(BodyNodeIndex body_node_index) const {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return p_MoBo_F_pool_[body_node_index];
+  }
+
+  /// Mutable version of get_p_MoBo_F().
+  Vector3<T>& get_mutable_p_MoBo_F(BodyNodeIndex body_node_index) {
+    DRAKE_ASSERT(0 <= body_node_index && body_node_index < num_nodes_);
+    return p_MoBo_F_pool_[body_node_index];
+  }
+
+  /// Returns a const reference to the pool of across-node Jacobians `H_PB_W`
+  /// for all nodes in the tree. The pool has as many entries as generalized
+  /// velocities in the model and stores the columns of the Jacobian matrices
+  /// contiguously, so that the `6 x nm` Jacobian `H_PB_W` for a node with
+  /// `nm` mobilities starts at the node's first generalized velocity.
+  /// Use BodyNode::GetJacobianFromArray() to access the Jacobian of a
+  /// particular node.
+  const std::vector<Vector6<T>>& get_H_PB_W_cache() const {
+    return H_PB_W_cache_;
+  }
+
+  /// Mutable version of get_H_PB_W_cache().
+  std::vector<Vector6<T>>& get_mutable_H_PB_W_cache() {
+    return H_PB_W_cache_;
+  }
+
  private:
   // Pool types:
   // Pools store entries in the same order multibody tree nodes are
@@ -107,6 +190,12 @@ class PositionKinematicsCache {
   // The type of pools for storing poses.
   typedef eigen_aligned_std_vector<Isometry3<T>> X_PoolType;
 
+  // The type of pools for storing rotation matrices.
+  typedef std::vector<Matrix3<T>> Matrix3_PoolType;
+
+  // The type of pools for storing position vectors.
+  typedef std::vector<Vector3<T>> Vector3_PoolType;
+
   // Allocates resources for this position kinematics cache.
   void Allocate() {
     X_WB_pool_.resize(num_nodes_);
@@ -118,8 +207,18 @@ class PositionKinematicsCache {
     X_FM_pool_.resize(num_nodes_);
     X_FM_pool_[world_index()] = NaNPose();  // It should never be used.
 
-    X_MB_pool_.resize(num_nodes_);
-    X_MB_pool_[world_index()] = NaNPose();  // It should never be used.
+    // These entries should never be used for the world node.
+    R_WF_pool_.resize(num_nodes_);
+    R_WF_pool_[world_index()].setConstant(
+        Eigen::NumTraits<double>::quiet_NaN());
+    p_PoBo_W_pool_.resize(num_nodes_);
+    p_PoBo_W_pool_[world_index()].setConstant(
+        Eigen::NumTraits<double>::quiet_NaN());
+    p_MoBo_F_pool_.resize(num_nodes_);
+    p_MoBo_F_pool_[world_index()].setConstant(
+        Eigen::NumTraits<double>::quiet_NaN());
+
+    H_PB_W_cache_.resize(num_velocities_);
   }
 
   // Helper method to initialize poses to NaN.
@@ -130,10 +229,16 @@ class PositionKinematicsCache {
 
   // Number of body nodes in the corresponding MultibodyTree.
   int num_nodes_{0};
+  // Number of generalized velocities in the corresponding MultibodyTree.
+  int num_velocities_{0};
   X_PoolType X_WB_pool_;  // Indexed by BodyNodeIndex.
   X_PoolType X_PB_pool_;  // Indexed by BodyNodeIndex.
   X_PoolType X_FM_pool_;  // Indexed by BodyNodeIndex.
-  X_PoolType X_MB_pool_;  // Indexed by BodyNodeIndex.
+  Matrix3_PoolType R_WF_pool_;  // Indexed by BodyNodeIndex.
+  Vector3_PoolType p_PoBo_W_pool_;  // Indexed by BodyNodeIndex.
+  Vector3_PoolType p_MoBo_F_pool_;  // Indexed by BodyNodeIndex.
+  // Indexed by the generalized velocity index of each column.
+  std::vector<Vector6<T>> H_PB_W_cache_;
 };
 
 }  // namespace multibody
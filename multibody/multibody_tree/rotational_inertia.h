@@ -334,7 +334,15 @@ class RotationalInertia {
   /// @return The Vector that results from multiplying `this` by `w_E`.
   // TODO(Mitiguy) Issue #6145, add direct unit test for this method.
   Vector3<T> operator*(const Vector3<T>& w_E) const {
-    return Vector3<T>(get_symmetric_matrix_view() * w_E);
+    // This product sits in the innermost loops of MultibodyTree's recursive
+    // algorithms. Eigen's general purpose self-adjoint product kernel is not
+    // specialized for fixed small sizes and therefore we explicitly write the
+    // product in terms of the lower-triangular part in use.
+    const Matrix3<T>& I = I_SP_E_;
+    return Vector3<T>(
+        I(0, 0) * w_E(0) + I(1, 0) * w_E(1) + I(2, 0) * w_E(2),
+        I(1, 0) * w_E(0) + I(1, 1) * w_E(1) + I(2, 1) * w_E(2),
+        I(2, 0) * w_E(0) + I(2, 1) * w_E(1) + I(2, 2) * w_E(2));
   }
 
   /// Divides `this` rotational inertia by a positive scalar (> 0).
@@ -518,10 +526,15 @@ class RotationalInertia {
     // parts only. The gain is in accuracy, by having RotationalInertia to only
     // deal with one triangular portion of the matrix.
 
+    // The full symmetric matrix is formed first so that the products below
+    // are fixed-size dense 3x3 products, which Eigen unrolls, instead of
+    // products with a self-adjoint view, which resolve to a general purpose
+    // kernel with run-time loops.
+    const Matrix3<T> I_BP_E = CopyToFullMatrix3();
+    const Matrix3<T> R_AE_times_I_BP_E = R_AE * I_BP_E;
     // Local copy to avoid aliasing that occurs if using triangular view.
     Matrix3<T> I_BP_A;
-    I_BP_A.noalias() = R_AE *
-        I_SP_E_.template selfadjointView<Eigen::Lower>() * R_AE.transpose();
+    I_BP_A.noalias() = R_AE_times_I_BP_E * R_AE.transpose();
 
     // Note: There is no guarantee of a symmetric result in I_SP_A (although it
     // should be symmetric within round-off error). Here we discard the upper-
@@ -385,8 +385,9 @@ class SpatialInertia {
     // |          | = |               |              | * |            |
     // ⌊  f_Bo_E  ⌋   ⌊ -m * p_BoBcm× |   m * Id     ⌋   ⌊  a_WBo_E   ⌋
     return SpatialForce<T>(
-        /* rotational */
-        CalcRotationalInertia() * alpha_WB_E + mp_BoBcm_E.cross(a_WBo_E),
+        /* rotational: I_Bo * w = m * (G_Bo * w), which avoids forming the
+         * rotational inertia I_Bo. */
+        get_mass() * (G_SP_E_ * alpha_WB_E) + mp_BoBcm_E.cross(a_WBo_E),
         /* translational: notice the order of the cross product is the reversed
          * of the documentation above and thus no minus sign is needed. */
         alpha_WB_E.cross(mp_BoBcm_E) + get_mass() * a_WBo_E);
@@ -419,8 +420,9 @@ class SpatialInertia {
     // |       | = |               |              | * |      |
     // ⌊ l_WBp ⌋   ⌊ -m * p_BoBcm× |   m * Id     ⌋   ⌊ v_WP ⌋
     return SpatialMomentum<T>(
-        /* rotational */
-        CalcRotationalInertia() * w_WB_E + mp_BoBcm_E.cross(v_WP_E),
+        /* rotational: I_Bo * w = m * (G_Bo * w), which avoids forming the
+         * rotational inertia I_Bo. */
+        get_mass() * (G_SP_E_ * w_WB_E) + mp_BoBcm_E.cross(v_WP_E),
         /* translational: notice the order of the cross product is the reversed
          * of the documentation above and thus no minus sign is needed. */
         w_WB_E.cross(mp_BoBcm_E) + get_mass() * v_WP_E);
@@ -0,0 +1,186 @@
+// Measures the execution time of the spatial algebra kernels used within
+// MultibodyTree's recursive algorithms, both in isolation and within the
+// base-to-tip and tip-to-base passes over the BodyNode objects of a Kuka iiwa
+// arm model.
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
+#include "drake/multibody/multibody_tree/math/spatial_algebra.h"
+#include "drake/multibody/multibody_tree/multibody_tree.h"
+#include "drake/multibody/multibody_tree/spatial_inertia.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using benchmarks::kuka_iiwa_robot::MakeKukaIiwaModel;
+using common::test::MeasureExecutionTime;
+using Eigen::Matrix3d;
+using Eigen::Quaterniond;
+using Eigen::Vector3d;
+using std::cout;
+using std::endl;
+using std::vector;
+
+// Number of different operands used by the kernel benchmarks. Operands are
+// cycled through so that results can not be computed at compile time.
+const int kNumOperands = 64;
+
+// Number of times each kernel or recursive pass is evaluated.
+const int kNumEvaluations = 200000;
+
+// Operands for the kernels benchmarks.
+struct KernelOperands {
+  vector<Vector3d> p;
+  vector<Matrix3d> R;
+  vector<SpatialVelocity<double>> V;
+  vector<SpatialAcceleration<double>> A;
+  vector<SpatialForce<double>> F;
+  vector<SpatialInertia<double>> M;
+};
+
+KernelOperands MakeKernelOperands() {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  auto random_vector = [&]() {
+    return Vector3d(uniform(generator), uniform(generator), uniform(generator));
+  };
+  KernelOperands ops;
+  for (int i = 0; i < kNumOperands; ++i) {
+    ops.p.push_back(random_vector());
+    ops.R.push_back(Quaterniond(
+        uniform(generator), uniform(generator), uniform(generator),
+        uniform(generator)).normalized().toRotationMatrix());
+    ops.V.emplace_back(random_vector(), random_vector());
+    ops.A.emplace_back(random_vector(), random_vector());
+    ops.F.emplace_back(random_vector(), random_vector());
+    ops.M.push_back(SpatialInertia<double>::MakeFromCentralInertia(
+        1.0 + uniform(generator) * uniform(generator), random_vector(),
+        RotationalInertia<double>(2.0, 2.5, 3.0)));
+  }
+  return ops;
+}
+
+// Evaluates `kernel(i)` kNumEvaluations times, cycling through the operands,
+// and prints the average execution time per evaluation.
+template <typename Kernel>
+void Benchmark(const char* name, Kernel kernel) {
+  Vector6<double> sink = Vector6<double>::Zero();
+  const double elapsed = MeasureExecutionTime([&]() {
+    for (int k = 0; k < kNumEvaluations; ++k) {
+      sink += kernel(k % kNumOperands);
+    }
+  });
+  // Print the sink so that the compiler does not optimize the loop away.
+  cout << name << ": " << 1.0e9 * elapsed / kNumEvaluations << " ns"
+       << "  (checksum " << sink.sum() << ")" << endl;
+}
+
+void BenchmarkKernels() {
+  const KernelOperands ops = MakeKernelOperands();
+  cout << "Spatial algebra kernels:" << endl;
+  Benchmark("  SpatialVelocity::Shift", [&](int i) {
+    return ops.V[i].Shift(ops.p[i]).get_coeffs();
+  });
+  Benchmark("  SpatialVelocity::ComposeWithMovingFrameVelocity", [&](int i) {
+    return ops.V[i].ComposeWithMovingFrameVelocity(
+        ops.p[i], ops.V[(i + 1) % kNumOperands]).get_coeffs();
+  });
+  Benchmark("  SpatialAcceleration::Shift", [&](int i) {
+    return ops.A[i].Shift(ops.p[i], ops.V[i].rotational()).get_coeffs();
+  });
+  Benchmark("  SpatialForce::Shift", [&](int i) {
+    return ops.F[i].Shift(ops.p[i]).get_coeffs();
+  });
+  Benchmark("  Rotation times SpatialForce", [&](int i) {
+    return (ops.R[i] * ops.F[i]).get_coeffs();
+  });
+  Benchmark("  SpatialInertia * SpatialAcceleration", [&](int i) {
+    return (ops.M[i] * ops.A[i]).get_coeffs();
+  });
+  Benchmark("  SpatialInertia * SpatialVelocity", [&](int i) {
+    return (ops.M[i] * ops.V[i]).get_coeffs();
+  });
+  Benchmark("  SpatialInertia::ReExpress", [&](int i) {
+    const SpatialInertia<double> M = ops.M[i].ReExpress(ops.R[i]);
+    Vector6<double> r;
+    r << M.get_com(), M.get_unit_inertia().get_moments();
+    return r;
+  });
+  Benchmark("  SpatialInertia::Shift", [&](int i) {
+    const SpatialInertia<double> M = ops.M[i].Shift(ops.p[i]);
+    Vector6<double> r;
+    r << M.get_com(), M.get_unit_inertia().get_products();
+    return r;
+  });
+}
+
+// Benchmarks MultibodyTree's recursive passes, which are dominated by the
+// kernels above.
+void BenchmarkRecursions() {
+  const auto model = MakeKukaIiwaModel<double>(true /* finalize */);
+  auto context = model->CreateDefaultContext();
+  const int nv = model->num_velocities();
+  const int nb = model->num_bodies();
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(
+          VectorX<double>::LinSpaced(nv, 0.1, 0.7));
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(
+          VectorX<double>::LinSpaced(nv, -0.5, 0.5));
+  const VectorX<double> vdot = VectorX<double>::LinSpaced(nv, 1.0, 2.0);
+
+  PositionKinematicsCache<double> pc(model->get_topology());
+  VelocityKinematicsCache<double> vc(model->get_topology());
+  model->CalcPositionKinematicsCache(*context, &pc);
+  model->CalcVelocityKinematicsCache(*context, pc, &vc);
+  vector<SpatialAcceleration<double>> A_WB_array(nb);
+  vector<SpatialForce<double>> F_BMo_W_array(nb);
+  VectorX<double> tau(nv);
+  MatrixX<double> H(nv, nv);
+
+  auto report = [](const char* name, double elapsed, int num_evaluations) {
+    cout << name << ": " << 1.0e6 * elapsed / num_evaluations << " us"
+         << endl;
+  };
+  const int num_evaluations = kNumEvaluations / 10;
+  cout << "MultibodyTree recursions (Kuka iiwa arm):" << endl;
+  report("  Position kinematics (base-to-tip)", MeasureExecutionTime([&]() {
+    for (int k = 0; k < num_evaluations; ++k)
+      model->CalcPositionKinematicsCache(*context, &pc);
+  }), num_evaluations);
+  report("  Velocity kinematics (base-to-tip)", MeasureExecutionTime([&]() {
+    for (int k = 0; k < num_evaluations; ++k)
+      model->CalcVelocityKinematicsCache(*context, pc, &vc);
+  }), num_evaluations);
+  report("  Inverse dynamics (base-to-tip and tip-to-base)",
+         MeasureExecutionTime([&]() {
+    for (int k = 0; k < num_evaluations; ++k) {
+      model->CalcInverseDynamics(
+          *context, pc, vc, vdot, {}, VectorX<double>(),
+          &A_WB_array, &F_BMo_W_array, &tau);
+    }
+  }), num_evaluations);
+  report("  Mass matrix via inverse dynamics", MeasureExecutionTime([&]() {
+    for (int k = 0; k < num_evaluations; ++k)
+      model->CalcMassMatrixViaInverseDynamics(*context, &H);
+  }), num_evaluations);
+  cout << "  (checksum " << tau.sum() + H.sum() << ")" << endl;
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+int main() {
+  drake::multibody::BenchmarkKernels();
+  drake::multibody::BenchmarkRecursions();
+  return 0;
+}
@@ -3,6 +3,8 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -12,6 +14,9 @@
 #include "drake/multibody/benchmarks/kuka_iiwa_robot/MG/MG_kuka_iiwa_robot.h"
 #include "drake/multibody/benchmarks/kuka_iiwa_robot/make_kuka_iiwa_model.h"
 #include "drake/multibody/multibody_tree/joints/revolute_joint.h"
+#include "drake/multibody/multibody_tree/multibody_forces.h"
+#include "drake/multibody/multibody_tree/rigid_body.h"
+#include "drake/multibody/multibody_tree/uniform_gravity_field_element.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/continuous_state.h"
 
@@ -302,6 +307,29 @@ class KukaIiwaModelTests : public ::testing::Test {
         context_on_T, linkG_on_T.body_frame(), p_EPi, p_WPi, Jv_WPi);
   }
 
+  // Computes the generalized forces tau = M(q)v̇ + C(q, v)v - tau_g(q) needed
+  // to attain the generalized accelerations vdot, including the effect of
+  // gravity.
+  template <typename T>
+  VectorX<T> CalcInverseDynamicsWithGravity(
+      const MultibodyTree<T>& model_on_T, const Context<T>& context_on_T,
+      const VectorX<T>& vdot) const {
+    PositionKinematicsCache<T> pc(model_on_T.get_topology());
+    VelocityKinematicsCache<T> vc(model_on_T.get_topology());
+    model_on_T.CalcPositionKinematicsCache(context_on_T, &pc);
+    model_on_T.CalcVelocityKinematicsCache(context_on_T, pc, &vc);
+    MultibodyForces<T> forces(model_on_T);
+    model_on_T.CalcForceElementsContribution(context_on_T, pc, vc, &forces);
+    std::vector<SpatialAcceleration<T>> A_WB_array(model_on_T.num_bodies());
+    std::vector<SpatialForce<T>> F_BMo_W_array(model_on_T.num_bodies());
+    VectorX<T> tau(model_on_T.num_velocities());
+    model_on_T.CalcInverseDynamics(
+        context_on_T, pc, vc, vdot,
+        forces.body_forces(), forces.generalized_forces(),
+        &A_WB_array, &F_BMo_W_array, &tau);
+    return tau;
+  }
+
  protected:
   // Acceleration of gravity:
   const double gravity_{9.81};
@@ -561,6 +589,43 @@ TEST_F(KukaIiwaModelTests, EvalPoseAndSpatialVelocity) {
                               kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the entries R_WF, p_PoBo_W and p_MoBo_F in the position
+// kinematics cache agree with the poses in the same cache.
+TEST_F(KukaIiwaModelTests, PositionKinematicsCacheMobilizerEntries) {
+  // Numerical tolerance used to verify numerical results.
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  int angle_index = 0;
+  for (const RevoluteJoint<double>* joint : joints_) {
+    joint->set_angle(context_.get(), q[angle_index]);
+    angle_index++;
+  }
+
+  PositionKinematicsCache<double> pc(model_->get_topology());
+  model_->CalcPositionKinematicsCache(*context_, &pc);
+
+  for (const RevoluteJoint<double>* joint : joints_) {
+    const BodyNodeIndex node_index = joint->child_body().node_index();
+    const BodyNodeIndex parent_index = joint->parent_body().node_index();
+    const Isometry3d& X_WP = pc.get_X_WB(parent_index);
+    const Isometry3d X_PF =
+        joint->frame_on_parent().CalcPoseInBodyFrame(*context_);
+    const Isometry3d X_MB =
+        joint->frame_on_child().CalcPoseInBodyFrame(*context_).inverse();
+
+    EXPECT_TRUE(CompareMatrices(
+        pc.get_R_WF(node_index), X_WP.linear() * X_PF.linear(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(
+        pc.get_p_PoBo_W(node_index),
+        X_WP.linear() * pc.get_X_PB(node_index).translation(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(
+        pc.get_p_MoBo_F(node_index),
+        pc.get_X_FM(node_index).linear() * X_MB.translation(), kTolerance));
+  }
+}
+
 TEST_F(KukaIiwaModelTests, CalcFrameGeometricJacobianExpressedInWorld) {
   // The number of generalized positions in the Kuka iiwa robot arm model.
   const int kNumPositions = model_->num_positions();
@@ -622,6 +687,295 @@ TEST_F(KukaIiwaModelTests, CalcFrameGeometricJacobianExpressedInWorld) {
   EXPECT_TRUE(Jv_WF_times_v.IsApprox(V_WEf, kTolerance));
 }
 
+// Verifies the analytic derivatives of the inverse dynamics against the
+// derivatives obtained with automatic differentiation.
+TEST_F(KukaIiwaModelTests, CalcInverseDynamicsDerivatives) {
+  const int nv = model_->num_velocities();
+  const double kTolerance = 1.0e-12;
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  context_->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(q);
+  context_->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(v);
+  const VectorX<double> vdot = VectorX<double>::LinSpaced(nv, -1.0, 2.0);
+
+  MatrixXd dtau_dq(nv, nv), dtau_dv(nv, nv);
+  model_->CalcInverseDynamicsDerivatives(
+      *context_, vdot, &dtau_dq, &dtau_dv);
+
+  // For the Kuka iiwa arm N(q) = I and therefore dtau_dq = ∂tau/∂q.
+  // Seed q and v as the independent variables, in that order.
+  const MatrixXd seed_q =
+      (MatrixXd(nv, 2 * nv) << MatrixXd::Identity(nv, nv),
+                               MatrixXd::Zero(nv, nv)).finished();
+  const MatrixXd seed_v =
+      (MatrixXd(nv, 2 * nv) << MatrixXd::Zero(nv, nv),
+                               MatrixXd::Identity(nv, nv)).finished();
+  context_autodiff_->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(q), seed_q));
+  context_autodiff_->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(v), seed_v));
+  const VectorX<AutoDiffXd> tau_autodiff = CalcInverseDynamicsWithGravity(
+      *model_autodiff_, *context_autodiff_,
+      VectorX<AutoDiffXd>(vdot.cast<AutoDiffXd>()));
+  const MatrixXd tau_derivs = math::autoDiffToGradientMatrix(tau_autodiff);
+
+  EXPECT_TRUE(CompareMatrices(dtau_dq, tau_derivs.leftCols(nv),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, tau_derivs.rightCols(nv),
+                              kTolerance, MatrixCompareType::relative));
+
+  // Wrong sizes are reported.
+  MatrixXd wrong_size(nv, nv + 1);
+  EXPECT_THROW(model_->CalcInverseDynamicsDerivatives(
+      *context_, vdot, &wrong_size, &dtau_dv), std::exception);
+}
+
+// Verifies the analytic derivatives of the forward dynamics against the
+// derivatives obtained with automatic differentiation.
+TEST_F(KukaIiwaModelTests, CalcForwardDynamicsDerivatives) {
+  const int nv = model_->num_velocities();
+  // Entries of the derivatives are as large as O(10²) and both computations
+  // involve the factorization of the mass matrix. We therefore compare them
+  // with an absolute tolerance.
+  const double kTolerance = 1.0e-8;
+
+  VectorX<double> q, v;
+  GetArbitraryNonZeroConfiguration(&q, &v);
+  context_->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(q);
+  context_->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(v);
+  const VectorX<double> tau_applied = VectorX<double>::LinSpaced(nv, 1.0, 7.0);
+
+  MatrixXd dvdot_dq(nv, nv), dvdot_dv(nv, nv);
+  model_->CalcForwardDynamicsDerivatives(
+      *context_, tau_applied, &dvdot_dq, &dvdot_dv);
+
+  const MatrixXd seed_q =
+      (MatrixXd(nv, 2 * nv) << MatrixXd::Identity(nv, nv),
+                               MatrixXd::Zero(nv, nv)).finished();
+  const MatrixXd seed_v =
+      (MatrixXd(nv, 2 * nv) << MatrixXd::Zero(nv, nv),
+                               MatrixXd::Identity(nv, nv)).finished();
+  context_autodiff_->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(q), seed_q));
+  context_autodiff_->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(v), seed_v));
+
+  // Forward dynamics with automatic differentiation.
+  MatrixX<AutoDiffXd> M(nv, nv);
+  model_autodiff_->CalcMassMatrixViaInverseDynamics(*context_autodiff_, &M);
+  const VectorX<AutoDiffXd> bias = CalcInverseDynamicsWithGravity(
+      *model_autodiff_, *context_autodiff_,
+      VectorX<AutoDiffXd>(VectorX<AutoDiffXd>::Zero(nv)));
+  const VectorX<AutoDiffXd> vdot_autodiff =
+      M.ldlt().solve(tau_applied.cast<AutoDiffXd>() - bias);
+  const MatrixXd vdot_derivs = math::autoDiffToGradientMatrix(vdot_autodiff);
+
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, vdot_derivs.leftCols(nv),
+                              kTolerance, MatrixCompareType::absolute));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, vdot_derivs.rightCols(nv),
+                              kTolerance, MatrixCompareType::absolute));
+}
+
+// Verifies the derivatives of the inverse dynamics for a model with a free
+// floating body, for which N(q) ≠ I, with a second body attached to it by a
+// revolute joint. Derivatives with respect to q are taken along the tangent
+// directions δq = N(q)⋅δv and therefore we compare them against the
+// automatic derivatives of tau(q, v) with q seeded with N(q).
+GTEST_TEST(MultibodyTreeDerivatives, FloatingBaseWithRevoluteJoint) {
+  const double kTolerance = 1.0e-12;
+  MultibodyTree<double> model;
+  const RigidBody<double>& body_A = model.AddBody<RigidBody>(
+      SpatialInertia<double>(
+          2.0, Vector3d(0.1, -0.2, 0.3),
+          UnitInertia<double>::SolidBox(0.3, 0.4, 0.5).ShiftFromCenterOfMass(
+              -Vector3d(0.1, -0.2, 0.3))));
+  const RigidBody<double>& body_B = model.AddBody<RigidBody>(
+      SpatialInertia<double>(
+          0.5, Vector3d(0.0, 0.0, -0.4),
+          UnitInertia<double>::SolidBox(0.1, 0.2, 0.8).ShiftFromCenterOfMass(
+              Vector3d(0.0, 0.0, 0.4))));
+  Isometry3d X_AF = Isometry3d::Identity();
+  X_AF.translation() = Vector3d(0.2, 0.1, -0.3);
+  Isometry3d X_BM = Isometry3d::Identity();
+  X_BM.translation() = Vector3d(0.0, 0.0, 0.4);
+  model.AddJoint<RevoluteJoint>(
+      "pin", body_A, X_AF, body_B, X_BM, Vector3d(1.0, 2.0, 3.0).normalized());
+  model.AddForceElement<UniformGravityFieldElement>(
+      Vector3d(0.0, 0.0, -9.81));
+  // Body A is not connected by any joint and therefore Finalize() adds a
+  // QuaternionFloatingMobilizer for it.
+  model.Finalize();
+  const int nq = model.num_positions();
+  const int nv = model.num_velocities();
+  ASSERT_EQ(nq, 8);
+  ASSERT_EQ(nv, 7);
+
+  auto context = model.CreateDefaultContext();
+  // Generalized positions for the floating body, a quaternion followed by
+  // a position, and for the revolute joint.
+  const Eigen::Quaterniond q_WA(
+      Eigen::AngleAxisd(0.7, Vector3d(1.0, -1.0, 2.0).normalized()));
+  VectorX<double> q(nq);
+  q << q_WA.w(), q_WA.x(), q_WA.y(), q_WA.z(), 0.5, -0.3, 1.2, 0.8;
+  const VectorX<double> v = VectorX<double>::LinSpaced(nv, -0.7, 1.1);
+  const VectorX<double> vdot = VectorX<double>::LinSpaced(nv, 2.0, -1.0);
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(q);
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(v);
+
+  MatrixXd dtau_dq(nv, nv), dtau_dv(nv, nv);
+  model.CalcInverseDynamicsDerivatives(*context, vdot, &dtau_dq, &dtau_dv);
+
+  // Compute N(q) one column at a time.
+  MatrixXd N(nq, nv);
+  for (int j = 0; j < nv; ++j) {
+    VectorX<double> qdot(nq);
+    model.MapVelocityToQDot(*context, VectorX<double>::Unit(nv, j), &qdot);
+    N.col(j) = qdot;
+  }
+
+  auto model_autodiff = model.ToAutoDiffXd();
+  auto context_autodiff = model_autodiff->CreateDefaultContext();
+  const MatrixXd seed_q =
+      (MatrixXd(nq, 2 * nv) << N, MatrixXd::Zero(nq, nv)).finished();
+  const MatrixXd seed_v =
+      (MatrixXd(nv, 2 * nv) << MatrixXd::Zero(nv, nv),
+                               MatrixXd::Identity(nv, nv)).finished();
+  context_autodiff->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(q), seed_q));
+  context_autodiff->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(
+          math::initializeAutoDiffGivenGradientMatrix(MatrixXd(v), seed_v));
+
+  PositionKinematicsCache<AutoDiffXd> pc(model_autodiff->get_topology());
+  VelocityKinematicsCache<AutoDiffXd> vc(model_autodiff->get_topology());
+  model_autodiff->CalcPositionKinematicsCache(*context_autodiff, &pc);
+  model_autodiff->CalcVelocityKinematicsCache(*context_autodiff, pc, &vc);
+  MultibodyForces<AutoDiffXd> forces(*model_autodiff);
+  model_autodiff->CalcForceElementsContribution(
+      *context_autodiff, pc, vc, &forces);
+  std::vector<SpatialAcceleration<AutoDiffXd>> A_WB_array(model.num_bodies());
+  std::vector<SpatialForce<AutoDiffXd>> F_BMo_W_array(model.num_bodies());
+  VectorX<AutoDiffXd> tau(nv);
+  model_autodiff->CalcInverseDynamics(
+      *context_autodiff, pc, vc, vdot.cast<AutoDiffXd>(),
+      forces.body_forces(), forces.generalized_forces(),
+      &A_WB_array, &F_BMo_W_array, &tau);
+  const MatrixXd tau_derivs = math::autoDiffToGradientMatrix(tau);
+
+  EXPECT_TRUE(CompareMatrices(dtau_dq, tau_derivs.leftCols(nv),
+                              kTolerance, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, tau_derivs.rightCols(nv),
+                              kTolerance, MatrixCompareType::relative));
+}
+
+// Verifies that the recursive algorithms running in parallel over the
+// subtrees attached to the world produce the same results as the serial
+// recursions. The model consists of several pendulum chains of different
+// lengths attached to the world.
+GTEST_TEST(MultibodyTreeParallelRecursions, MultipleChains) {
+  const std::vector<int> chain_lengths = {4, 1, 3, 5, 2, 3};
+  MultibodyTree<double> model;
+  const SpatialInertia<double> M_Bo_B(
+      1.5, Vector3d(0.0, 0.0, -0.5),
+      UnitInertia<double>::SolidBox(0.1, 0.2, 1.0).ShiftFromCenterOfMass(
+          Vector3d(0.0, 0.0, 0.5)));
+  Isometry3d X_PF = Isometry3d::Identity();
+  X_PF.translation() = Vector3d(0.1, 0.0, -1.0);
+  for (size_t chain = 0; chain < chain_lengths.size(); ++chain) {
+    const Body<double>* parent = &model.world_body();
+    for (int link = 0; link < chain_lengths[chain]; ++link) {
+      const RigidBody<double>& body = model.AddBody<RigidBody>(M_Bo_B);
+      model.AddJoint<RevoluteJoint>(
+          "joint_" + std::to_string(chain) + "_" + std::to_string(link),
+          *parent, X_PF, body, Isometry3d::Identity(),
+          Vector3d(1.0, link, chain).normalized());
+      parent = &body;
+    }
+  }
+  model.Finalize();
+  const int nb = model.num_bodies();
+  const int nv = model.num_velocities();
+
+  auto context = model.CreateDefaultContext();
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_position().SetFromVector(
+          VectorX<double>::LinSpaced(nv, -1.0, 2.0));
+  context->get_mutable_continuous_state().
+      get_mutable_generalized_velocity().SetFromVector(
+          VectorX<double>::LinSpaced(nv, 1.5, -0.5));
+  const VectorX<double> vdot = VectorX<double>::LinSpaced(nv, 0.3, 0.9);
+
+  // Computes all the quantities computed by the recursions.
+  struct Results {
+    std::vector<Isometry3d> X_WB;
+    std::vector<Vector6<double>> V_WB;
+    std::vector<Vector6<double>> A_WB;
+    std::vector<Matrix6<double>> Pplus_PB_W;
+    VectorX<double> tau;
+  };
+  auto calc_results = [&]() {
+    PositionKinematicsCache<double> pc(model.get_topology());
+    VelocityKinematicsCache<double> vc(model.get_topology());
+    ArticulatedBodyInertiaCache<double> abc(model.get_topology());
+    model.CalcPositionKinematicsCache(*context, &pc);
+    model.CalcVelocityKinematicsCache(*context, pc, &vc);
+    model.CalcArticulatedBodyInertiaCache(*context, pc, &abc);
+    std::vector<SpatialAcceleration<double>> A_WB_array(nb);
+    std::vector<SpatialForce<double>> F_BMo_W_array(nb);
+    Results results;
+    results.tau.resize(nv);
+    model.CalcInverseDynamics(
+        *context, pc, vc, vdot, {}, VectorX<double>(),
+        &A_WB_array, &F_BMo_W_array, &results.tau);
+    for (BodyIndex body_index(1); body_index < nb; ++body_index) {
+      const BodyNodeIndex node_index =
+          model.get_body(body_index).node_index();
+      results.X_WB.push_back(pc.get_X_WB(node_index));
+      results.V_WB.push_back(vc.get_V_WB(node_index).get_coeffs());
+      results.A_WB.push_back(A_WB_array[node_index].get_coeffs());
+      results.Pplus_PB_W.push_back(
+          abc.get_Pplus_PB_W(node_index).CopyToFullMatrix6());
+    }
+    return results;
+  };
+
+  EXPECT_EQ(model.get_max_num_threads(), 1);
+  const Results serial = calc_results();
+  model.set_max_num_threads(4);
+  EXPECT_EQ(model.get_max_num_threads(), 4);
+  const Results parallel = calc_results();
+
+  // Each node performs the exact same operations in both cases and therefore
+  // results must be bitwise identical.
+  const double kTolerance = 0.0;
+  for (int i = 0; i < nb - 1; ++i) {
+    EXPECT_TRUE(CompareMatrices(
+        serial.X_WB[i].matrix(), parallel.X_WB[i].matrix(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(serial.V_WB[i], parallel.V_WB[i], kTolerance));
+    EXPECT_TRUE(CompareMatrices(serial.A_WB[i], parallel.A_WB[i], kTolerance));
+    EXPECT_TRUE(CompareMatrices(
+        serial.Pplus_PB_W[i], parallel.Pplus_PB_W[i], kTolerance));
+  }
+  EXPECT_TRUE(CompareMatrices(serial.tau, parallel.tau, kTolerance));
+
+  // The setting is preserved by scalar conversion.
+  EXPECT_EQ(model.ToAutoDiffXd()->get_max_num_threads(), 4);
+
+  EXPECT_THROW(model.set_max_num_threads(0), std::exception);
+}
+
 }  // namespace
 }  // namespace multibody_model
 }  // namespace multibody
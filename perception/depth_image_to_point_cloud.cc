@@ -0,0 +1,155 @@
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+#include <cstdint>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+using drake::systems::sensors::CameraInfo;
+using drake::systems::sensors::ImageDepth32F;
+using drake::systems::sensors::ImageRgba8U;
+using drake::systems::sensors::InvalidDepth;
+
+namespace drake {
+namespace perception {
+
+namespace {
+
+typedef PointCloud::T T;
+typedef PointCloud::C C;
+
+// Tabulates the factors such that the point for the pixel (u, v) with depth z
+// is z * (x_factors[u], y_factors[v], 1).
+void MakeRayTables(const CameraInfo& camera_info, std::vector<T>* x_factors,
+                   std::vector<T>* y_factors) {
+  x_factors->resize(camera_info.width());
+  y_factors->resize(camera_info.height());
+  for (int u = 0; u < camera_info.width(); ++u) {
+    (*x_factors)[u] = (u - camera_info.center_x()) / camera_info.focal_x();
+  }
+  for (int v = 0; v < camera_info.height(); ++v) {
+    (*y_factors)[v] = (v - camera_info.center_y()) / camera_info.focal_y();
+  }
+}
+
+// Implements DepthImageToPointCloud::Convert() given the ray tables.
+void BackProject(const std::vector<T>& x_factors,
+                 const std::vector<T>& y_factors,
+                 const ImageDepth32F& depth_image,
+                 const ImageRgba8U* color_image,
+                 PointCloud* cloud) {
+  DRAKE_THROW_UNLESS(cloud != nullptr);
+  const int width = static_cast<int>(x_factors.size());
+  const int height = static_cast<int>(y_factors.size());
+  DRAKE_THROW_UNLESS(depth_image.width() == width);
+  DRAKE_THROW_UNLESS(depth_image.height() == height);
+  cloud->RequireFields(pc_flags::kXYZs);
+  if (color_image != nullptr) {
+    DRAKE_THROW_UNLESS(color_image->width() == width);
+    DRAKE_THROW_UNLESS(color_image->height() == height);
+    cloud->RequireFields(pc_flags::kRGBs);
+  }
+  if (cloud->size() != width * height) {
+    cloud->resize(width * height, true /* skip_initialize */);
+  }
+
+  // The loops below are free of divisions and branches so that the compiler
+  // can vectorize them. Both kTooClose (zero) and kTooFar (infinity) depths
+  // map to invalid points through the NaN depth, which propagates to X and Y.
+  auto xyzs = cloud->mutable_xyzs();
+  DRAKE_DEMAND(xyzs.outerStride() == 3);
+  T* xyz = xyzs.data();
+  const T* const x_factor = x_factors.data();
+  const T invalid = PointCloud::kDefaultValue;
+  for (int v = 0; v < height; ++v) {
+    const T y_factor = y_factors[v];
+    const T* const depth_row = depth_image.at(0, v);
+    for (int u = 0; u < width; ++u) {
+      const T depth = depth_row[u];
+      const T z = (depth > InvalidDepth::kTooClose &&
+                   depth < InvalidDepth::kTooFar) ?
+          depth : invalid;
+      xyz[3 * u] = z * x_factor[u];
+      xyz[3 * u + 1] = z * y_factor;
+      xyz[3 * u + 2] = z;
+    }
+    xyz += 3 * width;
+  }
+
+  if (color_image != nullptr) {
+    auto rgbs = cloud->mutable_rgbs();
+    DRAKE_DEMAND(rgbs.outerStride() == 3);
+    C* rgb = rgbs.data();
+    const uint8_t* rgba = color_image->at(0, 0);
+    for (int i = 0; i < width * height; ++i) {
+      rgb[3 * i] = rgba[4 * i];
+      rgb[3 * i + 1] = rgba[4 * i + 1];
+      rgb[3 * i + 2] = rgba[4 * i + 2];
+    }
+  }
+}
+
+}  // namespace
+
+DepthImageToPointCloud::DepthImageToPointCloud(
+    const CameraInfo& camera_info, pc_flags::BaseFieldT fields)
+    : width_(camera_info.width()),
+      height_(camera_info.height()),
+      fields_(fields) {
+  DRAKE_THROW_UNLESS(fields == pc_flags::kXYZs ||
+                     fields == (pc_flags::kXYZs | pc_flags::kRGBs));
+  MakeRayTables(camera_info, &x_factors_, &y_factors_);
+
+  depth_image_input_port_index_ =
+      DeclareAbstractInputPort(systems::Value<ImageDepth32F>()).get_index();
+  if (fields_ & pc_flags::kRGBs) {
+    color_image_input_port_index_ =
+        DeclareAbstractInputPort(systems::Value<ImageRgba8U>()).get_index();
+  }
+  point_cloud_output_port_index_ =
+      DeclareAbstractOutputPort(PointCloud(width_ * height_, fields_),
+                                &DepthImageToPointCloud::CalcPointCloud)
+          .get_index();
+}
+
+const systems::InputPortDescriptor<double>&
+DepthImageToPointCloud::depth_image_input_port() const {
+  return this->get_input_port(depth_image_input_port_index_);
+}
+
+const systems::InputPortDescriptor<double>&
+DepthImageToPointCloud::color_image_input_port() const {
+  DRAKE_DEMAND(color_image_input_port_index_ >= 0);
+  return this->get_input_port(color_image_input_port_index_);
+}
+
+const systems::OutputPort<double>&
+DepthImageToPointCloud::point_cloud_output_port() const {
+  return System<double>::get_output_port(point_cloud_output_port_index_);
+}
+
+void DepthImageToPointCloud::Convert(
+    const CameraInfo& camera_info, const ImageDepth32F& depth_image,
+    const ImageRgba8U* color_image, PointCloud* cloud) {
+  std::vector<T> x_factors;
+  std::vector<T> y_factors;
+  MakeRayTables(camera_info, &x_factors, &y_factors);
+  BackProject(x_factors, y_factors, depth_image, color_image, cloud);
+}
+
+void DepthImageToPointCloud::CalcPointCloud(
+    const systems::Context<double>& context, PointCloud* cloud) const {
+  const ImageDepth32F& depth_image =
+      this->EvalAbstractInput(context, depth_image_input_port_index_)
+          ->GetValue<ImageDepth32F>();
+  const ImageRgba8U* color_image = nullptr;
+  if (color_image_input_port_index_ >= 0) {
+    color_image =
+        &this->EvalAbstractInput(context, color_image_input_port_index_)
+             ->GetValue<ImageRgba8U>();
+  }
+  BackProject(x_factors_, y_factors_, depth_image, color_image, cloud);
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+
+/// A %DepthImageToPointCloud takes as input an ImageDepth32F and, optionally,
+/// an ImageRgba8U of the same size, and outputs an AbstractValue containing a
+/// `Value<PointCloud>` with one point per pixel. The points are expressed in
+/// the camera coordinate system (`X-right`, `Y-down`, `Z-forward`, see
+/// systems::sensors::CameraInfo) and are stored in row-major pixel order, i.e.
+/// the point for pixel `(u, v)` is at index `u + v * width`. Pixels with an
+/// invalid depth (see systems::sensors::InvalidDepth) result in points with
+/// XYZ values set to PointCloud::kDefaultValue.
+///
+/// The back-projection of each pixel along its ray reduces to two
+/// multiplications, with factors tabulated per image column and per image row
+/// at construction. The output cloud's storage is reused across evaluations.
+class DepthImageToPointCloud final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DepthImageToPointCloud)
+
+  /// Constructs a system for images described by `camera_info`.
+  /// @param fields The fields of the output cloud, either `pc_flags::kXYZs`
+  ///   or `pc_flags::kXYZs | pc_flags::kRGBs`. The input port for the color
+  ///   image is only declared in the latter case.
+  /// @throws std::exception if `fields` is not one of the values above.
+  explicit DepthImageToPointCloud(
+      const systems::sensors::CameraInfo& camera_info,
+      pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+
+  /// Returns a descriptor of the abstract valued input port containing an
+  /// ImageDepth32F.
+  const systems::InputPortDescriptor<double>& depth_image_input_port() const;
+
+  /// Returns a descriptor of the abstract valued input port containing an
+  /// ImageRgba8U.
+  /// @pre This system was constructed with the `pc_flags::kRGBs` field.
+  const systems::InputPortDescriptor<double>& color_image_input_port() const;
+
+  /// Returns a descriptor of the abstract valued output port that contains a
+  /// `Value<PointCloud>`.
+  const systems::OutputPort<double>& point_cloud_output_port() const;
+
+  /// Back-projects `depth_image` into `cloud`, as described in this class's
+  /// documentation. This is the standalone equivalent of the computation
+  /// performed by this system, for callers that do not use the systems
+  /// framework. The cloud is only resized if its size differs from the number
+  /// of pixels.
+  /// @param color_image If not nullptr, the colors of the points are set from
+  ///   this image.
+  /// @throws std::exception if `cloud` is nullptr, if the size of the images
+  /// differs from that of `camera_info`, or if `cloud` does not have XYZ
+  /// values, or RGB values when `color_image` is not nullptr.
+  static void Convert(const systems::sensors::CameraInfo& camera_info,
+                      const systems::sensors::ImageDepth32F& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      PointCloud* cloud);
+
+ private:
+  void CalcPointCloud(const systems::Context<double>& context,
+                      PointCloud* cloud) const;
+
+  const int width_;
+  const int height_;
+  const pc_flags::BaseFieldT fields_;
+  // The point for the pixel (u, v) with depth z is
+  // z * (x_factors_[u], y_factors_[v], 1).
+  std::vector<PointCloud::T> x_factors_;
+  std::vector<PointCloud::T> y_factors_;
+
+  int depth_image_input_port_index_{-1};
+  int color_image_input_port_index_{-1};
+  int point_cloud_output_port_index_{-1};
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/perception/dev/feedforward_neural_network.h"
 
+#include <algorithm>
+
 namespace drake {
 
 using std::vector;
@@ -62,6 +64,20 @@ FeedforwardNeuralNetwork<T>::FeedforwardNeuralNetwork(
   // Need to store copies of these so we can use them in DoToAutoDiffXd()
   weights_matrices_ = W;
   bias_vectors_ = b;
+
+  // The workspace does not depend on any value in the Context and has nothing
+  // to compute. It is sized for a batch of one input, the one on the input
+  // port.
+  std::unique_ptr<BatchWorkspace> workspace = AllocateBatchWorkspace(1);
+  workspace->port_output_.resize(num_outputs_, 1);
+  const BatchWorkspace model_workspace = *workspace;
+  port_workspace_cache_entry_ = &this->DeclareCacheEntry(
+      "port workspace",
+      [model_workspace]() {
+        return systems::AbstractValue::Make(model_workspace);
+      },
+      [](const systems::ContextBase&, systems::AbstractValue*) {},
+      {this->nothing_ticket()});
 }
 
 namespace {
@@ -91,50 +107,94 @@ FeedforwardNeuralNetwork<T>::FeedforwardNeuralNetwork(
 template <typename T>
 void FeedforwardNeuralNetwork<T>::DoCalcOutput(const Context<T>& context,
                                                BasicVector<T>* output) const {
-  // Read the input
-  VectorX<T> input_value = ReadInput(context);
-
-  // Evaluate each layer
-  VectorX<T> intermediate_value = input_value;
-  std::unique_ptr<MatrixX<T>> weights;
-  std::unique_ptr<VectorX<T>> bias;
-  LayerType layer_type;
-  NonlinearityType nonlinearity;
-  for (int i = 0; i < num_layers_; i++) {
-    weights = get_weight_matrix(i, context);
-    bias = get_bias_vector(i, context);
-    layer_type = layers_[i];
-    nonlinearity = nonlinearities_[i];
-
-    intermediate_value = EvaluateLayer(intermediate_value, *weights, *bias,
-                                       layer_type, nonlinearity);
-  }
-
-  // Write output
-  WriteOutput(intermediate_value, output);
+  // Evaluate the network as a batch of a single input.
+  BatchWorkspace& workspace = get_mutable_port_workspace(context);
+  EvaluateBatch(context, ReadInput(context), &workspace.port_output_,
+                &workspace);
+  WriteOutput(workspace.port_output_.col(0), output);
 }
 
 template <typename T>
-VectorX<T> FeedforwardNeuralNetwork<T>::EvaluateLayer(
-    const VectorX<T>& layerInput, MatrixX<T> Weights, VectorX<T> bias,
-    LayerType layer, NonlinearityType nonlinearity) const {
-  // Only suppports fully-connected RELU at this time
-  DRAKE_DEMAND(layer == LayerType::FullyConnected);
-  DRAKE_DEMAND(nonlinearity == NonlinearityType::Relu);
-  VectorX<T> layer_output = relu(Weights * layerInput + bias);
+typename FeedforwardNeuralNetwork<T>::BatchWorkspace&
+FeedforwardNeuralNetwork<T>::get_mutable_port_workspace(
+    const Context<T>& context) const {
+  // The entry is never evaluated, hence it stays out of date and mutable
+  // access is always granted.
+  systems::CacheEntryValue& value =
+      port_workspace_cache_entry_->get_mutable_cache_entry_value(context);
+  return value.GetMutableValueOrThrow<BatchWorkspace>();
+}
 
-  return layer_output;
+template <typename T>
+std::unique_ptr<typename FeedforwardNeuralNetwork<T>::BatchWorkspace>
+FeedforwardNeuralNetwork<T>::AllocateBatchWorkspace(int max_batch_size) const {
+  DRAKE_THROW_UNLESS(max_batch_size >= 0);
+  // The last layer writes directly to the outputs.
+  int max_hidden_size = 0;
+  for (int i = 0; i + 1 < num_layers_; i++) {
+    max_hidden_size = std::max(max_hidden_size, rows_[i]);
+  }
+  std::unique_ptr<BatchWorkspace> workspace(new BatchWorkspace());
+  for (MatrixX<T>& buffer : workspace->layer_outputs_) {
+    buffer.resize(max_hidden_size, max_batch_size);
+  }
+  return workspace;
 }
 
 template <typename T>
-VectorX<T> FeedforwardNeuralNetwork<T>::relu(VectorX<T> in) const {
-  VectorX<T> result = in;
-  for (int i = 0; i < result.size(); i++) {
-    if (result(i) < 0) {
-      result(i) = 0;
+void FeedforwardNeuralNetwork<T>::EvaluateBatch(
+    const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& inputs,
+    MatrixX<T>* outputs, BatchWorkspace* workspace) const {
+  DRAKE_THROW_UNLESS(outputs != nullptr);
+  DRAKE_THROW_UNLESS(inputs.rows() == num_inputs_);
+  const int batch_size = inputs.cols();
+  std::unique_ptr<BatchWorkspace> owned_workspace;
+  if (workspace == nullptr) {
+    owned_workspace = AllocateBatchWorkspace(batch_size);
+    workspace = owned_workspace.get();
+  }
+  for (MatrixX<T>& buffer : workspace->layer_outputs_) {
+    if (buffer.cols() < batch_size) buffer.resize(buffer.rows(), batch_size);
+  }
+  outputs->resize(num_outputs_, batch_size);
+
+  // Computes layer_output = σ(W⋅layer_input + b) for the i-th layer. The
+  // weights are mapped in place from their row-major encoding in the
+  // Context, and the bias and nonlinearity are applied in a single pass.
+  using RowMajorMatrixX =
+      Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  auto evaluate_layer = [&](int i, const auto& layer_input,
+                            auto&& layer_output) {
+    // Only suppports fully-connected RELU at this time
+    DRAKE_DEMAND(layers_[i] == LayerType::FullyConnected);
+    DRAKE_DEMAND(nonlinearities_[i] == NonlinearityType::Relu);
+    const BasicVector<T>& encoded_weights =
+        this->template GetNumericParameter<BasicVector>(context,
+                                                        weight_indices_[i]);
+    const Eigen::Map<const RowMajorMatrixX> weights(
+        encoded_weights.get_value().data(), rows_[i], cols_[i]);
+    const auto bias = this->template GetNumericParameter<BasicVector>(
+        context, bias_indices_[i]).get_value();
+    layer_output.noalias() = weights * layer_input;
+    layer_output = (layer_output.colwise() + bias).cwiseMax(T(0));
+  };
+  auto hidden_output = [&](int i) {
+    return workspace->layer_outputs_[i % 2].topLeftCorner(rows_[i],
+                                                          batch_size);
+  };
+
+  for (int i = 0; i < num_layers_; i++) {
+    const bool is_last_layer = (i + 1 == num_layers_);
+    if (i == 0 && is_last_layer) {
+      evaluate_layer(i, inputs, *outputs);
+    } else if (i == 0) {
+      evaluate_layer(i, inputs, hidden_output(i));
+    } else if (is_last_layer) {
+      evaluate_layer(i, hidden_output(i - 1), *outputs);
+    } else {
+      evaluate_layer(i, hidden_output(i - 1), hidden_output(i));
     }
   }
-  return result;
 }
 
 template <typename T>
@@ -228,7 +288,7 @@ const OutputPort<T>& FeedforwardNeuralNetwork<T>::output() const {
 }
 
 template <typename T>
-const VectorX<T> FeedforwardNeuralNetwork<T>::ReadInput(
+Eigen::VectorBlock<const VectorX<T>> FeedforwardNeuralNetwork<T>::ReadInput(
     const Context<T>& context) const {
   const BasicVector<T>* input =
       this->template EvalVectorInput<BasicVector>(context, input_index_);
@@ -236,8 +296,8 @@ const VectorX<T> FeedforwardNeuralNetwork<T>::ReadInput(
   return input->get_value();
 }
 template <typename T>
-void FeedforwardNeuralNetwork<T>::WriteOutput(const VectorX<T> value,
-                                              BasicVector<T>* output) const {
+void FeedforwardNeuralNetwork<T>::WriteOutput(
+    const Eigen::Ref<const VectorX<T>>& value, BasicVector<T>* output) const {
   output->set_value(value);
 }
 
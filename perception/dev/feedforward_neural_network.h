@@ -51,26 +51,72 @@ class FeedforwardNeuralNetwork final : public NeuralNetwork<T> {
   std::unique_ptr<MatrixX<T>> DecodeWeightsFromBasicVector(
       int rows, int cols, const systems::BasicVector<T>& vector) const;
 
+  /// Scratch memory used by EvaluateBatch() to store the outputs of the
+  /// hidden layers. Reusing a workspace across calls avoids heap allocations.
+  /// @see AllocateBatchWorkspace().
+  class BatchWorkspace {
+   public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BatchWorkspace)
+
+   private:
+    friend class FeedforwardNeuralNetwork<T>;
+    BatchWorkspace() = default;
+
+    // The outputs of consecutive hidden layers alternate between these two
+    // buffers, each with one column per input in the batch.
+    MatrixX<T> layer_outputs_[2];
+    // The output of the output port, evaluated as a batch of one input.
+    MatrixX<T> port_output_;
+  };
+
+  /// Allocates a workspace for EvaluateBatch() suitable for batches of up to
+  /// `max_batch_size` inputs. Larger batches are also supported, but make the
+  /// workspace grow to accommodate them.
+  /// @throws std::exception if `max_batch_size` is negative.
+  std::unique_ptr<BatchWorkspace> AllocateBatchWorkspace(
+      int max_batch_size) const;
+
+  /// Evaluates the network with the parameters in `context` for each of the
+  /// columns of `inputs`. The i-th column of `outputs` equals the output of
+  /// this system for the i-th column of `inputs` as its input. Each layer is
+  /// evaluated for the whole batch as a single matrix-matrix product,
+  /// followed by a single pass that adds the bias and applies the
+  /// nonlinearity. The input port is not used.
+  ///
+  /// @param[in] inputs The inputs, of size get_num_inputs() x N.
+  /// @param[out] outputs On output, the outputs, of size
+  ///   get_num_outputs() x N. It is only reallocated if its size differs.
+  /// @param[in,out] workspace If not nullptr, the scratch memory used for the
+  ///   hidden layers. Otherwise, scratch memory is allocated for this call.
+  /// @throws std::exception if `outputs` is nullptr or if the number of rows
+  /// of `inputs` differs from get_num_inputs().
+  void EvaluateBatch(const systems::Context<T>& context,
+                     const Eigen::Ref<const MatrixX<T>>& inputs,
+                     MatrixX<T>* outputs,
+                     BatchWorkspace* workspace = nullptr) const;
+
  private:
   // Allow different specializations to access each other's private data.
   template <typename> friend class FeedforwardNeuralNetwork;
 
   void DoCalcOutput(const systems::Context<T>& context,
                     systems::BasicVector<T>* output) const;
-  VectorX<T> EvaluateLayer(const VectorX<T>& layerInput, MatrixX<T> Weights,
-                           VectorX<T> bias, LayerType layer,
-                           NonlinearityType nonlinearity) const;
-  VectorX<T> relu(VectorX<T> in) const;
 
   // TODO(nikos-tri)
   // FeedforwardNeuralNetwork<symbolic::Expression>* DoToSymbolic() const
   // override;
 
   // To improve readability of the main computation
-  const VectorX<T> ReadInput(const systems::Context<T>& context) const;
-  void WriteOutput(const VectorX<T> value,
+  Eigen::VectorBlock<const VectorX<T>> ReadInput(
+      const systems::Context<T>& context) const;
+  void WriteOutput(const Eigen::Ref<const VectorX<T>>& value,
                    systems::BasicVector<T>* output) const;
 
+  // Returns the workspace DoCalcOutput() reuses for every evaluation in
+  // `context`.
+  BatchWorkspace& get_mutable_port_workspace(
+      const systems::Context<T>& context) const;
+
   // The types of layers and nonlinearities in this NN
   std::vector<LayerType> layers_;
   std::vector<NonlinearityType> nonlinearities_;
@@ -91,6 +137,10 @@ class FeedforwardNeuralNetwork final : public NeuralNetwork<T> {
   const int input_index_;
   const int output_index_;
 
+  // The cache entry holding the per-Context workspace of DoCalcOutput(). It
+  // is never evaluated; it only provides scratch memory.
+  const systems::CacheEntry* port_workspace_cache_entry_{};
+
   // Structural parameters inferred from weights and biases given to constructor
   int num_inputs_;
   int num_outputs_;
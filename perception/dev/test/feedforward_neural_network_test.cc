@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
 #include <memory>
 
@@ -221,6 +222,81 @@ GTEST_TEST(FeedforwardNeuralNetworkTest, BasicSanity) {
   TestIO(W, B, input3, expectedOutput3);
 }
 
+// Test that batched evaluation agrees with a layer-by-layer evaluation of each
+// input, with and without a reusable workspace, and that the output port,
+// which reuses a workspace stored in the Context, agrees as well.
+GTEST_TEST(FeedforwardNeuralNetworkTest, EvaluateBatch) {
+  // Entries with mixed signs so that the ReLU is active in all layers.
+  auto signed_matrix = [](int rows, int columns) {
+    MatrixXd matrix = NewMatrix(rows, columns);
+    for (int i = 0; i < matrix.size(); i++) {
+      matrix(i) = (i % 3 == 0 ? -1.0 : 0.5) * matrix(i) / matrix.size();
+    }
+    return matrix;
+  };
+  std::vector<MatrixXd> W{signed_matrix(10, 4), signed_matrix(7, 10),
+                          signed_matrix(3, 7)};
+  std::vector<VectorXd> B{-NewVector(10) / 20, NewVector(7) / 10,
+                          -NewVector(3) / 4};
+  FeedforwardNeuralNetwork<double> dut(W, B, GenerateFullyConnectedLayers(3),
+                                       GenerateReluNonlinearities(3));
+  unique_ptr<Context<double>> context = dut.CreateDefaultContext();
+  unique_ptr<SystemOutput<double>> output = dut.AllocateOutput(*context);
+
+  // Evaluates the network for a single input, one layer at a time.
+  auto evaluate_reference = [&W, &B](const VectorXd& input) {
+    VectorXd layer_output = input;
+    for (size_t i = 0; i < W.size(); i++) {
+      layer_output = (W[i] * layer_output + B[i]).cwiseMax(0.0);
+    }
+    return layer_output;
+  };
+
+  auto workspace = dut.AllocateBatchWorkspace(5);
+  for (const int batch_size : {5, 1, 8}) {
+    MatrixXd inputs(4, batch_size);
+    for (int i = 0; i < inputs.size(); i++) {
+      inputs(i) = std::sin(1.7 * i + batch_size);
+    }
+    MatrixXd outputs;
+    dut.EvaluateBatch(*context, inputs, &outputs, workspace.get());
+    MatrixXd outputs_without_workspace;
+    dut.EvaluateBatch(*context, inputs, &outputs_without_workspace);
+    ASSERT_EQ(outputs.rows(), 3);
+    ASSERT_EQ(outputs.cols(), batch_size);
+    EXPECT_EQ(outputs, outputs_without_workspace);
+
+    for (int j = 0; j < batch_size; j++) {
+      const VectorXd expected = evaluate_reference(inputs.col(j));
+      EXPECT_TRUE(CompareMatrices(outputs.col(j), expected, 1e-14));
+
+      context->FixInputPort(dut.input().get_index(),
+                            VectorXd(inputs.col(j)));
+      dut.CalcOutput(*context, output.get());
+      EXPECT_TRUE(CompareMatrices(
+          output->get_vector_data(dut.output().get_index())->get_value(),
+          expected, 1e-14));
+    }
+  }
+
+  MatrixXd outputs;
+  EXPECT_THROW(dut.EvaluateBatch(*context, MatrixXd::Zero(3, 2), &outputs),
+               std::exception);
+  EXPECT_THROW(dut.EvaluateBatch(*context, MatrixXd::Zero(4, 2), nullptr),
+               std::exception);
+
+  // A network with a single layer has no hidden layers.
+  FeedforwardNeuralNetwork<double> single_layer(
+      {W[0]}, {B[0]}, GenerateFullyConnectedLayers(1),
+      GenerateReluNonlinearities(1));
+  auto single_layer_context = single_layer.CreateDefaultContext();
+  const MatrixXd inputs = MatrixXd::Ones(4, 2);
+  single_layer.EvaluateBatch(*single_layer_context, inputs, &outputs);
+  const MatrixXd expected =
+      ((W[0] * inputs).colwise() + B[0]).cwiseMax(0.0);
+  EXPECT_TRUE(CompareMatrices(outputs, expected, 1e-15));
+}
+
 /********************************
  * Helper function definitions
  ********************************/
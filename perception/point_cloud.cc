@@ -13,10 +13,14 @@ using Eigen::NoChange;
 namespace drake {
 namespace perception {
 
+constexpr PointCloud::T PointCloud::kDefaultValue;
+constexpr PointCloud::C PointCloud::kDefaultColor;
+
 namespace {
 
 // Convenience aliases.
 typedef PointCloud::T T;
+typedef PointCloud::C C;
 typedef PointCloud::D D;
 
 }  // namespace
@@ -46,12 +50,15 @@ class PointCloud::Storage {
     size_ = new_size;
     if (fields_.contains(pc_flags::kXYZs))
       xyzs_.conservativeResize(NoChange, new_size);
+    if (fields_.contains(pc_flags::kRGBs))
+      rgbs_.conservativeResize(NoChange, new_size);
     if (fields_.has_descriptor())
       descriptors_.conservativeResize(NoChange, new_size);
     CheckInvariants();
   }
 
   Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_; }
+  Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_; }
   Eigen::Ref<MatrixX<T>> descriptors() { return descriptors_; }
 
  private:
@@ -60,6 +67,10 @@ class PointCloud::Storage {
       const int xyz_size = xyzs_.cols();
       DRAKE_DEMAND(xyz_size == size());
     }
+    if (fields_.contains(pc_flags::kRGBs)) {
+      const int rgb_size = rgbs_.cols();
+      DRAKE_DEMAND(rgb_size == size());
+    }
     if (fields_.has_descriptor()) {
       const int descriptor_size = descriptors_.cols();
       DRAKE_DEMAND(descriptor_size == size());
@@ -69,6 +80,7 @@ class PointCloud::Storage {
   const pc_flags::Fields fields_;
   int size_{};
   Matrix3X<T> xyzs_;
+  Matrix3X<C> rgbs_;
   MatrixX<T> descriptors_;
 };
 
@@ -172,6 +184,9 @@ void PointCloud::SetDefault(int start, int num) {
   if (has_xyzs()) {
     set(mutable_xyzs(), kDefaultValue);
   }
+  if (has_rgbs()) {
+    set(mutable_rgbs(), kDefaultColor);
+  }
   if (has_descriptors()) {
     set(mutable_descriptors(), kDefaultValue);
   }
@@ -193,6 +208,9 @@ void PointCloud::SetFrom(const PointCloud& other,
   if (fields_resolved.contains(pc_flags::kXYZs)) {
     mutable_xyzs() = other.xyzs();
   }
+  if (fields_resolved.contains(pc_flags::kRGBs)) {
+    mutable_rgbs() = other.rgbs();
+  }
   if (fields_resolved.has_descriptor()) {
     mutable_descriptors() = other.descriptors();
   }
@@ -218,6 +236,18 @@ Eigen::Ref<Matrix3X<T>> PointCloud::mutable_xyzs() {
   return storage_->xyzs();
 }
 
+bool PointCloud::has_rgbs() const {
+  return fields_.contains(pc_flags::kRGBs);
+}
+Eigen::Ref<const Matrix3X<C>> PointCloud::rgbs() const {
+  DRAKE_DEMAND(has_rgbs());
+  return storage_->rgbs();
+}
+Eigen::Ref<Matrix3X<C>> PointCloud::mutable_rgbs() {
+  DRAKE_DEMAND(has_rgbs());
+  return storage_->rgbs();
+}
+
 bool PointCloud::has_descriptors() const {
   return fields_.has_descriptor();
 }
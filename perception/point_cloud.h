@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
@@ -35,6 +36,7 @@ namespace perception {
 ///
 /// This point cloud class provides the following fields:
 ///  - xyz - Cartesian XYZ coordinates (float[3]).
+///  - rgb - RGB colors (uint8_t[3]).
 ///  - descriptor - An descriptor that is run-time defined (float[X]).
 ///
 /// @note "contiguous" here means contiguous in memory. This was chosen to
@@ -67,6 +69,9 @@ class PointCloud final {
   /// Geometric scalar type.
   using T = float;
 
+  /// Color channel scalar type.
+  using C = uint8_t;
+
   /// Descriptor scalar type.
   using D = T;
 
@@ -75,6 +80,9 @@ class PointCloud final {
   static inline bool IsDefaultValue(T value) { return std::isnan(value); }
   static inline bool IsInvalidValue(T value) { return !std::isfinite(value); }
 
+  /// Represents the default color value (black).
+  static constexpr C kDefaultColor{};
+
   /// Constructs a point cloud of a given `new_size`, with the prescribed
   /// `fields`. If `kDescriptors` is one of the fields, then
   /// `descriptor` should be included and should not be `kNone`.
@@ -155,6 +163,32 @@ class PointCloud final {
 
   ///@}
 
+  /// @name Color Values
+  /// @{
+
+  /// Returns if this cloud provides RGB colors.
+  bool has_rgbs() const;
+
+  /// Returns access to RGB colors.
+  /// @pre `has_rgbs()` must be true.
+  Eigen::Ref<const Matrix3X<C>> rgbs() const;
+
+  /// Returns mutable access to RGB colors.
+  /// @pre `has_rgbs()` must be true.
+  Eigen::Ref<Matrix3X<C>> mutable_rgbs();
+
+  /// Returns access to an RGB color.
+  /// @pre `has_rgbs()` must be true.
+  Vector3<C> rgb(int i) const { return rgbs().col(i); }
+
+  /// Returns mutable access to an RGB color.
+  /// @pre `has_rgbs()` must be true.
+  Eigen::Ref<Vector3<C>> mutable_rgb(int i) {
+    return mutable_rgbs().col(i);
+  }
+
+  /// @}
+
   /// @name Run-Time Descriptors
   /// @{
 
@@ -0,0 +1,431 @@
+#include "drake/perception/point_cloud_processing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+namespace {
+
+// Convenience aliases.
+typedef PointCloud::T T;
+typedef Eigen::Matrix<int64_t, 3, 1> Cell;
+
+// Returns true if all the coordinates of `p` are valid.
+bool IsValidPoint(const Eigen::Ref<const Vector3<T>>& p) {
+  return !(PointCloud::IsInvalidValue(p(0)) ||
+           PointCloud::IsInvalidValue(p(1)) ||
+           PointCloud::IsInvalidValue(p(2)));
+}
+
+// Returns the coordinates of the cell of size `cell_size` containing `p`, for
+// a grid whose minimum corner is `origin`. Coordinates beyond ±2⁶⁰ cells,
+// infinite or NaN are clamped to that range, which lies outside of any grid,
+// so that the arithmetic on the cell coordinates of the queries cannot
+// overflow.
+Cell CellOf(const Vector3<T>& origin, T cell_size, const Vector3<T>& p) {
+  const T kMaxCell = static_cast<T>(int64_t{1} << 60);
+  const Vector3<T> x = (p - origin) / cell_size;
+  Cell cell;
+  for (int axis = 0; axis < 3; ++axis) {
+    // NaN compares false and is mapped to the upper end of the range.
+    const T clamped =
+        x(axis) < kMaxCell ? std::max(std::floor(x(axis)), -kMaxCell)
+                           : kMaxCell;
+    cell(axis) = static_cast<int64_t>(clamped);
+  }
+  return cell;
+}
+
+// Returns the key of `cell` in a grid of `dims` cells.
+// @pre `cell` lies within the grid.
+int64_t KeyOf(const Cell& dims, const Cell& cell) {
+  return (cell(0) * dims(1) + cell(1)) * dims(2) + cell(2);
+}
+
+// Computes the smallest grid of cubic cells of size `cell_size` enclosing the
+// valid points in `xyzs` and returns the pairs (key, column) for those points,
+// sorted by key, so that the points within a cell are consecutive.
+std::vector<std::pair<int64_t, int>> SortByCell(
+    const Eigen::Ref<const Matrix3X<T>>& xyzs, T cell_size,
+    Vector3<T>* origin, Cell* dims) {
+  DRAKE_THROW_UNLESS(cell_size > 0);
+  std::vector<int> valid;
+  valid.reserve(xyzs.cols());
+  Vector3<T> lower = Vector3<T>::Constant(std::numeric_limits<T>::max());
+  Vector3<T> upper = Vector3<T>::Constant(std::numeric_limits<T>::lowest());
+  for (int i = 0; i < xyzs.cols(); ++i) {
+    if (!IsValidPoint(xyzs.col(i))) continue;
+    valid.push_back(i);
+    lower = lower.cwiseMin(xyzs.col(i));
+    upper = upper.cwiseMax(xyzs.col(i));
+  }
+  std::vector<std::pair<int64_t, int>> keys;
+  if (valid.empty()) {
+    *origin = Vector3<T>::Zero();
+    *dims = Cell::Zero();
+    return keys;
+  }
+
+  *origin = lower;
+  double num_cells = 1;
+  for (int axis = 0; axis < 3; ++axis) {
+    (*dims)(axis) = static_cast<int64_t>(
+        std::floor((upper(axis) - lower(axis)) / cell_size)) + 1;
+    num_cells *= (*dims)(axis);
+  }
+  if (num_cells > static_cast<double>(int64_t{1} << 62)) {
+    throw std::runtime_error(fmt::format(
+        "Cell size {} is too small for a point cloud with extent [{}, {}, {}]",
+        cell_size, upper(0) - lower(0), upper(1) - lower(1),
+        upper(2) - lower(2)));
+  }
+
+  keys.reserve(valid.size());
+  for (int i : valid) {
+    // Clamp to guard against round-off at the upper boundary of the grid.
+    const Cell cell = CellOf(*origin, cell_size, xyzs.col(i))
+        .cwiseMax(Cell::Zero()).cwiseMin(*dims - Cell::Ones());
+    keys.emplace_back(KeyOf(*dims, cell), i);
+  }
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+// Returns a cloud with the fields of `cloud` and the values of its points in
+// `indices`, in that order.
+PointCloud ExtractPoints(const PointCloud& cloud,
+                         const std::vector<int>& indices) {
+  const int size = static_cast<int>(indices.size());
+  PointCloud result(size, cloud.fields(), true /* skip_initialize */);
+  if (cloud.has_xyzs()) {
+    auto xyzs = result.mutable_xyzs();
+    for (int i = 0; i < size; ++i) xyzs.col(i) = cloud.xyzs().col(indices[i]);
+  }
+  if (cloud.has_rgbs()) {
+    auto rgbs = result.mutable_rgbs();
+    for (int i = 0; i < size; ++i) rgbs.col(i) = cloud.rgbs().col(indices[i]);
+  }
+  if (cloud.has_descriptors()) {
+    auto descriptors = result.mutable_descriptors();
+    for (int i = 0; i < size; ++i) {
+      descriptors.col(i) = cloud.descriptors().col(indices[i]);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+PointCloudIndex::PointCloudIndex(const PointCloud& cloud, T cell_size)
+    : cloud_size_(cloud.size()), cell_size_(cell_size) {
+  cloud.RequireFields(pc_flags::kXYZs);
+  const auto xyzs = cloud.xyzs();
+  const std::vector<std::pair<int64_t, int>> keys =
+      SortByCell(xyzs, cell_size_, &origin_, &dims_);
+  const int num_points = static_cast<int>(keys.size());
+  points_.resize(3, num_points);
+  point_indices_.resize(num_points);
+  cells_.reserve(num_points);
+  int begin = 0;
+  for (int i = 0; i < num_points; ++i) {
+    points_.col(i) = xyzs.col(keys[i].second);
+    point_indices_[i] = keys[i].second;
+    if (i + 1 == num_points || keys[i + 1].first != keys[i].first) {
+      cells_.emplace(keys[i].first, std::make_pair(begin, i + 1));
+      begin = i + 1;
+    }
+  }
+}
+
+void PointCloudIndex::set_max_num_threads(int max_num_threads) {
+  DRAKE_THROW_UNLESS(max_num_threads >= 1);
+  if (max_num_threads == max_num_threads_) return;
+  max_num_threads_ = max_num_threads;
+  thread_pool_.reset();
+  if (max_num_threads > 1) {
+    thread_pool_ =
+        std::make_unique<drake::internal::ThreadPool>(max_num_threads);
+  }
+}
+
+void PointCloudIndex::ParallelFor(
+    int n, const std::function<void(int, int)>& func) const {
+  const int num_tasks =
+      thread_pool_ == nullptr ? 1 : std::min(thread_pool_->num_threads(), n);
+  if (num_tasks <= 1) {
+    if (n > 0) func(0, n);
+    return;
+  }
+  thread_pool_->Run(num_tasks, [&](int task) {
+    func(static_cast<int64_t>(task) * n / num_tasks,
+         static_cast<int64_t>(task + 1) * n / num_tasks);
+  });
+}
+
+PointCloudIndex::Cell PointCloudIndex::CellContaining(
+    const Vector3<T>& p) const {
+  return CellOf(origin_, cell_size_, p);
+}
+
+template <typename Visitor>
+void PointCloudIndex::VisitCells(
+    const Cell& lower, const Cell& upper, Visitor visit) const {
+  const Cell first = lower.cwiseMax(Cell::Zero());
+  const Cell last = upper.cwiseMin(dims_ - Cell::Ones());
+  for (int64_t x = first(0); x <= last(0); ++x) {
+    for (int64_t y = first(1); y <= last(1); ++y) {
+      for (int64_t z = first(2); z <= last(2); ++z) {
+        const auto it = cells_.find(KeyOf(dims_, Cell(x, y, z)));
+        if (it == cells_.end()) continue;
+        for (int i = it->second.first; i < it->second.second; ++i) visit(i);
+      }
+    }
+  }
+}
+
+void PointCloudIndex::FindRadiusNeighbors(
+    const Vector3<T>& query, T radius, std::vector<int>* indices) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(std::isfinite(radius) && radius >= 0);
+  indices->clear();
+  if (!IsValidPoint(query)) return;
+  const T radius_squared = radius * radius;
+  VisitCells(CellContaining(query - Vector3<T>::Constant(radius)),
+             CellContaining(query + Vector3<T>::Constant(radius)),
+             [&](int i) {
+               if ((points_.col(i) - query).squaredNorm() <= radius_squared)
+                 indices->push_back(point_indices_[i]);
+             });
+}
+
+void PointCloudIndex::FindNearestNeighbors(
+    const Vector3<T>& query, int k, std::vector<int>* indices,
+    std::vector<T>* squared_distances) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(k >= 0);
+  indices->clear();
+  if (squared_distances != nullptr) squared_distances->clear();
+  k = std::min(k, num_indexed_points());
+  if (k == 0 || !IsValidPoint(query)) return;
+
+  // Max-heap with the k closest points found so far.
+  std::vector<std::pair<T, int>> heap;
+  heap.reserve(k + 1);
+  auto consider = [&](int i) {
+    const T distance_squared = (points_.col(i) - query).squaredNorm();
+    if (static_cast<int>(heap.size()) < k) {
+      heap.emplace_back(distance_squared, i);
+      std::push_heap(heap.begin(), heap.end());
+    } else if (distance_squared < heap.front().first) {
+      std::pop_heap(heap.begin(), heap.end());
+      heap.back() = std::make_pair(distance_squared, i);
+      std::push_heap(heap.begin(), heap.end());
+    }
+  };
+
+  // Visit the cells in shells of increasing Chebyshev distance s from the
+  // cell containing the query. Points in shells beyond s are at least a
+  // distance s⋅cell_size away from the query, which bounds the search.
+  // The search starts at the first shell that reaches the grid, so that it
+  // does not step through the empty shells of a query far from the grid.
+  const Cell center = CellContaining(query);
+  const Cell last = dims_ - Cell::Ones();
+  const int64_t min_shell = (-center).cwiseMax(center - last)
+                                .cwiseMax(Cell::Zero()).maxCoeff();
+  const int64_t max_shell =
+      center.cwiseMax(last - center).cwiseAbs().maxCoeff();
+  for (int64_t s = min_shell; s <= max_shell; ++s) {
+    const Cell first_cell = (center - Cell::Constant(s)).cwiseMax(Cell::Zero());
+    const Cell last_cell = (center + Cell::Constant(s)).cwiseMin(last);
+    auto visit = [&](int64_t x, int64_t y, int64_t z) {
+      const auto it = cells_.find(KeyOf(dims_, Cell(x, y, z)));
+      if (it == cells_.end()) return;
+      for (int i = it->second.first; i < it->second.second; ++i) consider(i);
+    };
+    for (int64_t x = first_cell(0); x <= last_cell(0); ++x) {
+      for (int64_t y = first_cell(1); y <= last_cell(1); ++y) {
+        if (std::abs(x - center(0)) == s || std::abs(y - center(1)) == s) {
+          for (int64_t z = first_cell(2); z <= last_cell(2); ++z) {
+            visit(x, y, z);
+          }
+        } else {
+          // Only the two faces of the shell normal to the z axis.
+          if (center(2) - s >= 0 && center(2) - s <= last(2)) {
+            visit(x, y, center(2) - s);
+          }
+          if (center(2) + s >= 0 && center(2) + s <= last(2)) {
+            visit(x, y, center(2) + s);
+          }
+        }
+      }
+    }
+    const T bound = s * cell_size_;
+    if (static_cast<int>(heap.size()) == k &&
+        heap.front().first <= bound * bound) {
+      break;
+    }
+  }
+
+  std::sort_heap(heap.begin(), heap.end());
+  indices->reserve(k);
+  for (const auto& entry : heap) {
+    indices->push_back(point_indices_[entry.second]);
+  }
+  if (squared_distances != nullptr) {
+    squared_distances->reserve(k);
+    for (const auto& entry : heap) squared_distances->push_back(entry.first);
+  }
+}
+
+void PointCloudIndex::FindPointsInBox(
+    const Vector3<T>& lower, const Vector3<T>& upper,
+    std::vector<int>* indices) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  indices->clear();
+  VisitCells(CellContaining(lower), CellContaining(upper), [&](int i) {
+    const auto p = points_.col(i);
+    if ((p.array() >= lower.array()).all() &&
+        (p.array() <= upper.array()).all()) {
+      indices->push_back(point_indices_[i]);
+    }
+  });
+  std::sort(indices->begin(), indices->end());
+}
+
+void PointCloudIndex::BatchFindRadiusNeighbors(
+    const Eigen::Ref<const Matrix3X<T>>& queries, T radius,
+    std::vector<std::vector<int>>* indices) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(std::isfinite(radius) && radius >= 0);
+  indices->resize(queries.cols());
+  ParallelFor(queries.cols(), [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      FindRadiusNeighbors(queries.col(i), radius, &(*indices)[i]);
+    }
+  });
+}
+
+void PointCloudIndex::BatchFindNearestNeighbors(
+    const Eigen::Ref<const Matrix3X<T>>& queries, int k,
+    std::vector<std::vector<int>>* indices) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(k >= 0);
+  indices->resize(queries.cols());
+  ParallelFor(queries.cols(), [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      FindNearestNeighbors(queries.col(i), k, &(*indices)[i]);
+    }
+  });
+}
+
+PointCloud VoxelGridDownsample(const PointCloud& cloud, T voxel_size) {
+  cloud.RequireFields(pc_flags::kXYZs);
+  Vector3<T> origin;
+  Cell dims;
+  const std::vector<std::pair<int64_t, int>> keys =
+      SortByCell(cloud.xyzs(), voxel_size, &origin, &dims);
+
+  int num_voxels = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i].first != keys[i - 1].first) ++num_voxels;
+  }
+  PointCloud result(num_voxels, cloud.fields(), true /* skip_initialize */);
+  auto xyzs = result.mutable_xyzs();
+  xyzs.setZero();
+  if (cloud.has_descriptors()) result.mutable_descriptors().setZero();
+  // Colors are accumulated with integers to avoid overflow.
+  Eigen::Matrix3Xi rgb_sums;
+  if (cloud.has_rgbs()) rgb_sums.setZero(3, num_voxels);
+
+  // Accumulate the values of the points in each voxel and average them.
+  int voxel = -1;
+  int count = 0;
+  auto average = [&]() {
+    xyzs.col(voxel) /= count;
+    if (cloud.has_rgbs()) {
+      result.mutable_rgbs().col(voxel) =
+          ((rgb_sums.col(voxel).array() + count / 2) / count)
+              .cast<PointCloud::C>();
+    }
+    if (cloud.has_descriptors()) {
+      result.mutable_descriptors().col(voxel) /= count;
+    }
+  };
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i].first != keys[i - 1].first) {
+      if (voxel >= 0) average();
+      ++voxel;
+      count = 0;
+    }
+    const int index = keys[i].second;
+    xyzs.col(voxel) += cloud.xyzs().col(index);
+    if (cloud.has_rgbs()) {
+      rgb_sums.col(voxel) += cloud.rgbs().col(index).cast<int>();
+    }
+    if (cloud.has_descriptors()) {
+      result.mutable_descriptors().col(voxel) +=
+          cloud.descriptors().col(index);
+    }
+    ++count;
+  }
+  if (voxel >= 0) average();
+  return result;
+}
+
+PointCloud Crop(const PointCloud& cloud, const PointCloudIndex& index,
+                const Vector3<T>& lower, const Vector3<T>& upper) {
+  DRAKE_THROW_UNLESS(cloud.size() == index.cloud_size());
+  std::vector<int> indices;
+  index.FindPointsInBox(lower, upper, &indices);
+  return ExtractPoints(cloud, indices);
+}
+
+void EstimateNormals(
+    const PointCloud& cloud, const PointCloudIndex& index, T radius,
+    Matrix3X<T>* normals, const Vector3<T>& view_point) {
+  DRAKE_THROW_UNLESS(normals != nullptr);
+  DRAKE_THROW_UNLESS(std::isfinite(radius) && radius >= 0);
+  DRAKE_THROW_UNLESS(cloud.size() == index.cloud_size());
+  cloud.RequireFields(pc_flags::kXYZs);
+  const auto xyzs = cloud.xyzs();
+  normals->resize(3, cloud.size());
+  index.ParallelFor(cloud.size(), [&](int begin, int end) {
+    std::vector<int> neighbors;
+    Eigen::SelfAdjointEigenSolver<Matrix3<T>> solver;
+    for (int i = begin; i < end; ++i) {
+      const Vector3<T> p = xyzs.col(i);
+      if (IsValidPoint(p)) index.FindRadiusNeighbors(p, radius, &neighbors);
+      if (!IsValidPoint(p) || neighbors.size() < 3) {
+        normals->col(i).setConstant(PointCloud::kDefaultValue);
+        continue;
+      }
+      // The covariance is computed about the centroid to limit round-off.
+      Vector3<T> centroid = Vector3<T>::Zero();
+      for (int j : neighbors) centroid += xyzs.col(j);
+      centroid /= neighbors.size();
+      Matrix3<T> covariance = Matrix3<T>::Zero();
+      for (int j : neighbors) {
+        const Vector3<T> d = xyzs.col(j) - centroid;
+        covariance += d * d.transpose();
+      }
+      // Eigenvalues are sorted in increasing order.
+      solver.computeDirect(covariance);
+      Vector3<T> normal = solver.eigenvectors().col(0);
+      if (normal.dot(view_point - p) < 0) normal = -normal;
+      normals->col(i) = normal;
+    }
+  });
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/thread_pool.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// Implements a spatial index over the XYZ values of a PointCloud, offering
+/// radius, k-nearest-neighbor and axis-aligned box queries.
+///
+/// The points are bucketed into a uniform grid of cubic cells and stored
+/// sorted by cell, so that the points within a cell are contiguous in memory.
+/// A query only visits the cells that can contain its results. A good choice
+/// for the cell size is the typical radius of the queries.
+///
+/// The index keeps a copy of the XYZ values. Therefore, it does not reflect
+/// later changes to the cloud, and it remains valid after the cloud is
+/// destroyed. The indices reported by the queries refer to the points of the
+/// cloud the index was built from. Points with invalid XYZ values (see
+/// PointCloud::IsInvalidValue()) are not indexed and are never reported.
+///
+/// Single queries run on the calling thread, so that independent queries may
+/// be issued concurrently. Batched queries distribute their work over up to
+/// get_max_num_threads() threads, which are created once and reused by every
+/// batched query; concurrent batched queries on the same index run one after
+/// the other.
+class PointCloudIndex final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudIndex)
+
+  /// Geometric scalar type.
+  using T = PointCloud::T;
+
+  /// Builds the index for the XYZ values of `cloud`, with a grid of cubic
+  /// cells of size `cell_size`.
+  /// @throws std::runtime_error if `cloud` does not have XYZ values or if
+  /// `cell_size` is too small for the extent of the cloud.
+  /// @throws std::exception if `cell_size` is not positive.
+  PointCloudIndex(const PointCloud& cloud, T cell_size);
+
+  /// Returns the size of the cloud this index was built from.
+  int cloud_size() const { return cloud_size_; }
+
+  /// Returns the number of points in the index, i.e. the number of points in
+  /// the cloud with valid XYZ values.
+  int num_indexed_points() const {
+    return static_cast<int>(point_indices_.size());
+  }
+
+  /// Returns the size of the cells of the grid.
+  T cell_size() const { return cell_size_; }
+
+  /// Sets the maximum number of threads used by the batched queries, which
+  /// are created here. Defaults to one, in which case all work happens on the
+  /// calling thread.
+  /// @throws std::exception if `max_num_threads` is less than one.
+  void set_max_num_threads(int max_num_threads);
+
+  /// Returns the maximum number of threads used by the batched queries.
+  int get_max_num_threads() const { return max_num_threads_; }
+
+  /// Finds the points within a distance `radius` of `query`, in no particular
+  /// order. No points are reported for a query with invalid values.
+  /// @param[out] indices On output, the indices of the points found. It is
+  ///   cleared first.
+  /// @throws std::exception if `indices` is nullptr or `radius` is negative
+  ///   or not finite.
+  void FindRadiusNeighbors(
+      const Vector3<T>& query, T radius, std::vector<int>* indices) const;
+
+  /// Finds the `k` points closest to `query`, sorted by increasing distance.
+  /// Fewer than `k` points are reported if the index has fewer points, and
+  /// none for a query with invalid values.
+  /// @param[out] indices On output, the indices of the points found. It is
+  ///   cleared first.
+  /// @param[out] squared_distances If not nullptr, on output the squared
+  ///   distance from `query` to each of the points in `indices`.
+  /// @throws std::exception if `indices` is nullptr or `k` is negative.
+  void FindNearestNeighbors(
+      const Vector3<T>& query, int k, std::vector<int>* indices,
+      std::vector<T>* squared_distances = nullptr) const;
+
+  /// Finds the points inside the axis-aligned box with corners `lower` and
+  /// `upper`, boundary included, sorted by increasing index.
+  /// @param[out] indices On output, the indices of the points found. It is
+  ///   cleared first.
+  /// @throws std::exception if `indices` is nullptr.
+  void FindPointsInBox(
+      const Vector3<T>& lower, const Vector3<T>& upper,
+      std::vector<int>* indices) const;
+
+  /// Batched version of FindRadiusNeighbors() for each of the columns of
+  /// `queries`. Entry `i` in `indices` holds the result for the i-th query.
+  void BatchFindRadiusNeighbors(
+      const Eigen::Ref<const Matrix3X<T>>& queries, T radius,
+      std::vector<std::vector<int>>* indices) const;
+
+  /// Batched version of FindNearestNeighbors() for each of the columns of
+  /// `queries`. Entry `i` in `indices` holds the result for the i-th query.
+  void BatchFindNearestNeighbors(
+      const Eigen::Ref<const Matrix3X<T>>& queries, int k,
+      std::vector<std::vector<int>>* indices) const;
+
+ private:
+  friend void EstimateNormals(
+      const PointCloud& cloud, const PointCloudIndex& index,
+      PointCloud::T radius, Matrix3X<PointCloud::T>* normals,
+      const Vector3<PointCloud::T>& view_point);
+
+  // Calls `func(begin, end)` over contiguous ranges that partition [0, n), on
+  // the threads of thread_pool_, or on the calling thread if there is none.
+  void ParallelFor(int n, const std::function<void(int, int)>& func) const;
+
+  // Integer coordinates of a cell. They may lie outside of the grid.
+  using Cell = Eigen::Matrix<int64_t, 3, 1>;
+
+  // Returns the coordinates of the cell containing `p`, which may lie
+  // outside of the grid.
+  Cell CellContaining(const Vector3<T>& p) const;
+
+  // Invokes `visit(i)` for the position `i` in points_ of each of the points
+  // in the cells with coordinates within [lower, upper], clamped to the grid.
+  template <typename Visitor>
+  void VisitCells(const Cell& lower, const Cell& upper, Visitor visit) const;
+
+  int cloud_size_{};
+  T cell_size_{};
+  int max_num_threads_{1};
+  // The threads of the batched queries, if get_max_num_threads() is more than
+  // one.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+
+  // Corner of the grid with minimum coordinates and number of cells along
+  // each axis.
+  Vector3<T> origin_{Vector3<T>::Zero()};
+  Cell dims_{Cell::Zero()};
+
+  // Indexed points sorted by cell, together with their index in the cloud.
+  Matrix3X<T> points_;
+  std::vector<int> point_indices_;
+
+  // Maps the key of each non-empty cell to the range [begin, end) of its
+  // points in points_.
+  std::unordered_map<int64_t, std::pair<int, int>> cells_;
+};
+
+/// Downsamples `cloud` with a uniform grid of cubic voxels of size
+/// `voxel_size`. The result has the fields of `cloud` and holds one point per
+/// occupied voxel, whose values are the average of those of the points in the
+/// voxel. Points with invalid XYZ values are discarded.
+/// @throws std::runtime_error if `cloud` does not have XYZ values or if
+/// `voxel_size` is too small for the extent of the cloud.
+/// @throws std::exception if `voxel_size` is not positive.
+PointCloud VoxelGridDownsample(const PointCloud& cloud,
+                               PointCloud::T voxel_size);
+
+/// Returns the points of `cloud` inside the axis-aligned box with corners
+/// `lower` and `upper`, boundary included, preserving their order and fields.
+/// The box query is answered by `index`, which must have been built from
+/// `cloud`.
+/// @throws std::exception if the size of `cloud` does not match that of the
+/// cloud `index` was built from.
+PointCloud Crop(const PointCloud& cloud, const PointCloudIndex& index,
+                const Vector3<PointCloud::T>& lower,
+                const Vector3<PointCloud::T>& upper);
+
+/// Estimates the surface normal at each point of `cloud` as the direction of
+/// least variance of the points within a distance `radius`, found with
+/// `index`, which must have been built from `cloud`. Normals are oriented
+/// towards `view_point`. Points with invalid XYZ values or with fewer than
+/// three neighbors get a normal of PointCloud::kDefaultValue's. The work is
+/// distributed over up to `index.get_max_num_threads()` threads.
+/// @param[out] normals On output, the unit normals, of size `3 x N` with N
+///   the size of `cloud`.
+/// @throws std::exception if `normals` is nullptr, `radius` is negative or
+/// not finite, or the size of `cloud` does not match that of the cloud `index`
+/// was built from.
+void EstimateNormals(
+    const PointCloud& cloud, const PointCloudIndex& index,
+    PointCloud::T radius, Matrix3X<PointCloud::T>* normals,
+    const Vector3<PointCloud::T>& view_point = Vector3<PointCloud::T>::Zero());
+
+}  // namespace perception
+}  // namespace drake
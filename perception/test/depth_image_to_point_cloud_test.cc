@@ -0,0 +1,140 @@
+#include "drake/perception/depth_image_to_point_cloud.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3f;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::InvalidDepth;
+
+const int kWidth = 4;
+const int kHeight = 3;
+const double kFocalX = 2.0;
+const double kFocalY = 4.0;
+const double kCenterX = 1.5;
+const double kCenterY = 1.0;
+
+// Returns a depth image whose depth at pixel (u, v) is 1 + u + v, except for
+// two pixels with invalid depths.
+ImageDepth32F MakeDepthImage() {
+  ImageDepth32F depth_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      depth_image.at(u, v)[0] = 1 + u + v;
+    }
+  }
+  depth_image.at(1, 0)[0] = InvalidDepth::kTooClose;
+  depth_image.at(2, 2)[0] = InvalidDepth::kTooFar;
+  return depth_image;
+}
+
+// Returns a color image whose color at pixel (u, v) is (u, v, u + v).
+ImageRgba8U MakeColorImage() {
+  ImageRgba8U color_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      color_image.at(u, v)[0] = u;
+      color_image.at(u, v)[1] = v;
+      color_image.at(u, v)[2] = u + v;
+      color_image.at(u, v)[3] = 255;
+    }
+  }
+  return color_image;
+}
+
+// Verifies the XYZ values, and colors if `check_colors` is true, of a cloud
+// computed from MakeDepthImage() and MakeColorImage().
+void VerifyCloud(const PointCloud& cloud, bool check_colors) {
+  ASSERT_EQ(cloud.size(), kWidth * kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      const int i = u + v * kWidth;
+      if ((u == 1 && v == 0) || (u == 2 && v == 2)) {
+        EXPECT_TRUE(cloud.xyz(i).array().isNaN().all());
+      } else {
+        const float z = 1 + u + v;
+        const Vector3f expected(z * (u - kCenterX) / kFocalX,
+                                z * (v - kCenterY) / kFocalY, z);
+        EXPECT_TRUE(CompareMatrices(cloud.xyz(i), expected, 1e-6));
+      }
+      if (check_colors) {
+        EXPECT_EQ(cloud.rgb(i).cast<int>(), Eigen::Vector3i(u, v, u + v));
+      }
+    }
+  }
+}
+
+GTEST_TEST(DepthImageToPointCloudTest, Convert) {
+  const CameraInfo camera_info(kWidth, kHeight, kFocalX, kFocalY, kCenterX,
+                               kCenterY);
+  const ImageDepth32F depth_image = MakeDepthImage();
+  const ImageRgba8U color_image = MakeColorImage();
+
+  // The cloud is resized as needed.
+  PointCloud cloud(0, pc_flags::kXYZs | pc_flags::kRGBs);
+  DepthImageToPointCloud::Convert(camera_info, depth_image, &color_image,
+                                  &cloud);
+  VerifyCloud(cloud, true);
+
+  PointCloud xyz_cloud(5);
+  DepthImageToPointCloud::Convert(camera_info, depth_image, nullptr,
+                                  &xyz_cloud);
+  VerifyCloud(xyz_cloud, false);
+
+  // Colors require a cloud with RGB values, and image sizes must match.
+  EXPECT_THROW(DepthImageToPointCloud::Convert(
+      camera_info, depth_image, &color_image, &xyz_cloud), std::runtime_error);
+  EXPECT_THROW(DepthImageToPointCloud::Convert(
+      camera_info, ImageDepth32F(kWidth, kHeight + 1), nullptr, &xyz_cloud),
+      std::exception);
+  EXPECT_THROW(DepthImageToPointCloud::Convert(
+      camera_info, depth_image, nullptr, nullptr), std::exception);
+}
+
+GTEST_TEST(DepthImageToPointCloudTest, System) {
+  const CameraInfo camera_info(kWidth, kHeight, kFocalX, kFocalY, kCenterX,
+                               kCenterY);
+  const DepthImageToPointCloud dut(camera_info,
+                                   pc_flags::kXYZs | pc_flags::kRGBs);
+  ASSERT_EQ(dut.get_num_input_ports(), 2);
+
+  auto context = dut.CreateDefaultContext();
+  context->FixInputPort(
+      dut.depth_image_input_port().get_index(),
+      std::make_unique<systems::Value<ImageDepth32F>>(MakeDepthImage()));
+  context->FixInputPort(
+      dut.color_image_input_port().get_index(),
+      std::make_unique<systems::Value<ImageRgba8U>>(MakeColorImage()));
+
+  auto output = dut.AllocateOutput(*context);
+  const int port_index = dut.point_cloud_output_port().get_index();
+  dut.CalcOutput(*context, output.get());
+  const PointCloud& cloud =
+      output->get_data(port_index)->GetValue<PointCloud>();
+  VerifyCloud(cloud, true);
+
+  // The storage of the output cloud is reused.
+  const float* const data = cloud.xyzs().data();
+  dut.CalcOutput(*context, output.get());
+  EXPECT_EQ(output->get_data(port_index)->GetValue<PointCloud>()
+                .xyzs().data(), data);
+
+  // Without colors, there is no color input port.
+  const DepthImageToPointCloud xyz_dut(camera_info);
+  EXPECT_EQ(xyz_dut.get_num_input_ports(), 1);
+  EXPECT_THROW(DepthImageToPointCloud(camera_info, pc_flags::kRGBs),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
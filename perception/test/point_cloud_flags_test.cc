@@ -29,6 +29,11 @@ GTEST_TEST(PointCloudFlagsTest, Basic) {
     os << (pcf::kXYZs | pcf::kDescriptorCurvature);
     EXPECT_EQ("(kXYZs | kDescriptorCurvature)", os.str());
   }
+  {
+    std::ostringstream os;
+    os << pcf::Fields(pcf::kXYZs | pcf::kRGBs);
+    EXPECT_EQ("(kXYZs | kRGBs)", os.str());
+  }
 
   // Check basics.
   pcf::Fields lhs = pcf::kXYZs;
@@ -40,9 +45,9 @@ GTEST_TEST(PointCloudFlagsTest, Basic) {
   EXPECT_NE(lhs, rhs);
   EXPECT_TRUE(lhs.contains(pcf::kDescriptorFPFH));
 
-  // TODO(eric.cousineau): Add check for intersection when there is more
-  // than one `BaseField`.
   EXPECT_EQ(lhs & pcf::kXYZs, pcf::kXYZs);
+  EXPECT_EQ(pcf::Fields(pcf::kXYZs | pcf::kRGBs) & pcf::kRGBs, pcf::kRGBs);
+  EXPECT_FALSE(lhs.contains(pcf::kRGBs));
   EXPECT_EQ(lhs & pcf::kDescriptorFPFH, pcf::kDescriptorFPFH);
 
   // Check implicit conversion.
@@ -0,0 +1,278 @@
+#include "drake/perception/point_cloud_processing.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+using Eigen::Vector3f;
+
+namespace drake {
+namespace perception {
+namespace {
+
+// Creates a cloud of `size` random points within the box [-1, 1]³, with a
+// color and a curvature descriptor derived from the index of each point.
+// Every tenth point has an invalid XYZ value.
+PointCloud MakeRandomCloud(int size) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> uniform(-1.0, 1.0);
+  PointCloud cloud(size, pc_flags::kXYZs | pc_flags::kRGBs |
+                   pc_flags::kDescriptorCurvature);
+  for (int i = 0; i < size; ++i) {
+    cloud.mutable_xyz(i) =
+        Vector3f(uniform(generator), uniform(generator), uniform(generator));
+    cloud.mutable_descriptor(i)(0) = i;
+    cloud.mutable_rgb(i).setConstant(i % 256);
+  }
+  for (int i = 0; i < size; i += 10) {
+    cloud.mutable_xyz(i)(1) = PointCloud::kDefaultValue;
+  }
+  return cloud;
+}
+
+// Returns the indices of the valid points of `cloud` within `radius` of
+// `query`, sorted by increasing index.
+std::vector<int> BruteForceRadiusNeighbors(
+    const PointCloud& cloud, const Vector3f& query, float radius) {
+  std::vector<int> indices;
+  for (int i = 0; i < cloud.size(); ++i) {
+    if ((cloud.xyz(i) - query).norm() <= radius) indices.push_back(i);
+  }
+  return indices;
+}
+
+// Returns the sorted squared distances from `query` to the `k` closest valid
+// points of `cloud`.
+std::vector<float> BruteForceNearestDistances(
+    const PointCloud& cloud, const Vector3f& query, int k) {
+  std::vector<float> distances;
+  for (int i = 0; i < cloud.size(); ++i) {
+    const float d = (cloud.xyz(i) - query).squaredNorm();
+    if (!std::isnan(d)) distances.push_back(d);
+  }
+  std::sort(distances.begin(), distances.end());
+  distances.resize(std::min<int>(k, distances.size()));
+  return distances;
+}
+
+GTEST_TEST(PointCloudIndexTest, RadiusNeighbors) {
+  const PointCloud cloud = MakeRandomCloud(2000);
+  PointCloudIndex index(cloud, 0.1);
+  EXPECT_EQ(index.cloud_size(), 2000);
+  EXPECT_EQ(index.num_indexed_points(), 1800);
+
+  const Matrix3X<float> queries = MakeRandomCloud(50).xyzs();
+  std::vector<int> indices;
+  for (const float radius : {0.0f, 0.05f, 0.2f, 3.0f}) {
+    for (int q = 1; q < queries.cols(); q += 3) {
+      index.FindRadiusNeighbors(queries.col(q), radius, &indices);
+      std::sort(indices.begin(), indices.end());
+      EXPECT_EQ(indices,
+                BruteForceRadiusNeighbors(cloud, queries.col(q), radius));
+    }
+  }
+  // A query outside of the grid.
+  index.FindRadiusNeighbors(Vector3f(5, 5, 5), 0.5, &indices);
+  EXPECT_TRUE(indices.empty());
+  // An invalid query.
+  index.FindRadiusNeighbors(queries.col(0), 0.5, &indices);
+  EXPECT_TRUE(indices.empty());
+
+  // Batched queries agree with single queries for any number of threads,
+  // including when the threads are reused by consecutive batched queries.
+  std::vector<std::vector<int>> batch;
+  for (const int num_threads : {1, 3, 3, 1}) {
+    index.set_max_num_threads(num_threads);
+    index.BatchFindRadiusNeighbors(cloud.xyzs(), 0.15, &batch);
+    ASSERT_EQ(static_cast<int>(batch.size()), cloud.size());
+    for (int i = 1; i < cloud.size(); i += 7) {
+      index.FindRadiusNeighbors(cloud.xyz(i), 0.15, &indices);
+      EXPECT_EQ(batch[i], indices);
+    }
+  }
+
+  // Queries whose cell coordinates do not fit in an integer.
+  index.FindRadiusNeighbors(Vector3f(1e30, 0, 0), 0.5, &indices);
+  EXPECT_TRUE(indices.empty());
+  index.FindRadiusNeighbors(Vector3f::Zero(), 1e30, &indices);
+  EXPECT_EQ(static_cast<int>(indices.size()), index.num_indexed_points());
+
+  const float kInf = std::numeric_limits<float>::infinity();
+  EXPECT_THROW(index.FindRadiusNeighbors(Vector3f::Zero(), -1, &indices),
+               std::exception);
+  EXPECT_THROW(index.FindRadiusNeighbors(Vector3f::Zero(), kInf, &indices),
+               std::exception);
+  EXPECT_THROW(index.BatchFindRadiusNeighbors(queries, kInf, &batch),
+               std::exception);
+  EXPECT_THROW(index.set_max_num_threads(0), std::exception);
+  EXPECT_THROW(PointCloudIndex(cloud, 0), std::exception);
+  EXPECT_THROW(PointCloudIndex(PointCloud(1, pc_flags::kDescriptorCurvature),
+                               0.1),
+               std::runtime_error);
+}
+
+GTEST_TEST(PointCloudIndexTest, NearestNeighbors) {
+  const PointCloud cloud = MakeRandomCloud(2000);
+  PointCloudIndex index(cloud, 0.1);
+
+  std::vector<int> indices;
+  std::vector<float> distances;
+  const Matrix3X<float> queries = MakeRandomCloud(20).xyzs();
+  for (const int k : {1, 8, 50}) {
+    for (int q = 1; q < queries.cols(); ++q) {
+      if (q % 10 == 0) continue;  // Skip the invalid queries.
+      index.FindNearestNeighbors(queries.col(q), k, &indices, &distances);
+      ASSERT_EQ(static_cast<int>(indices.size()), k);
+      EXPECT_EQ(distances,
+                BruteForceNearestDistances(cloud, queries.col(q), k));
+      for (int i = 0; i < k; ++i) {
+        EXPECT_EQ(distances[i],
+                  (cloud.xyz(indices[i]) - queries.col(q)).squaredNorm());
+      }
+    }
+  }
+
+  // A query far from the grid, and more neighbors than indexed points.
+  const Vector3f far_query(-3, 4, 10);
+  index.FindNearestNeighbors(far_query, 5, &indices, &distances);
+  EXPECT_EQ(distances, BruteForceNearestDistances(cloud, far_query, 5));
+  index.FindNearestNeighbors(far_query, 5000, &indices);
+  EXPECT_EQ(static_cast<int>(indices.size()), index.num_indexed_points());
+  // A query whose cell coordinates do not fit in an integer.
+  const Vector3f very_far_query(1e30, -1e30, 0);
+  index.FindNearestNeighbors(very_far_query, 1, &indices);
+  EXPECT_EQ(static_cast<int>(indices.size()), 1);
+  index.FindNearestNeighbors(queries.col(0), 5, &indices);
+  EXPECT_TRUE(indices.empty());
+
+  std::vector<std::vector<int>> batch;
+  index.set_max_num_threads(4);
+  index.BatchFindNearestNeighbors(queries, 8, &batch);
+  ASSERT_EQ(static_cast<int>(batch.size()), queries.cols());
+  for (int q = 0; q < queries.cols(); ++q) {
+    index.FindNearestNeighbors(queries.col(q), 8, &indices);
+    EXPECT_EQ(batch[q], indices);
+  }
+}
+
+GTEST_TEST(PointCloudProcessingTest, Crop) {
+  const PointCloud cloud = MakeRandomCloud(2000);
+  const PointCloudIndex index(cloud, 0.25);
+  const Vector3f lower(-0.5, -0.2, 0.1);
+  const Vector3f upper(0.3, 0.6, 2.0);
+  const PointCloud cropped = Crop(cloud, index, lower, upper);
+  EXPECT_TRUE(cropped.HasExactFields(cloud.fields()));
+
+  std::vector<int> expected;
+  for (int i = 0; i < cloud.size(); ++i) {
+    const Vector3f p = cloud.xyz(i);
+    if ((p.array() >= lower.array()).all() &&
+        (p.array() <= upper.array()).all()) {
+      expected.push_back(i);
+    }
+  }
+  ASSERT_EQ(cropped.size(), static_cast<int>(expected.size()));
+  for (int i = 0; i < cropped.size(); ++i) {
+    EXPECT_EQ(cropped.descriptor(i)(0), expected[i]);
+    EXPECT_EQ(cropped.rgb(i), cloud.rgb(expected[i]));
+    EXPECT_TRUE(CompareMatrices(cropped.xyz(i), cloud.xyz(expected[i])));
+  }
+
+  // An unbounded box keeps all the valid points.
+  const float kInf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(Crop(cloud, index, Vector3f::Constant(-kInf),
+                 Vector3f::Constant(kInf)).size(),
+            index.num_indexed_points());
+
+  EXPECT_THROW(Crop(MakeRandomCloud(10), index, lower, upper),
+               std::exception);
+}
+
+GTEST_TEST(PointCloudProcessingTest, VoxelGridDownsample) {
+  PointCloud cloud(6, pc_flags::kXYZs | pc_flags::kDescriptorCurvature);
+  // Three points in one voxel, two in another and an invalid point.
+  cloud.mutable_xyzs() <<
+      0.1, 0.3, 0.2, 1.1, 1.3, PointCloud::kDefaultValue,
+      0.1, 0.2, 0.3, 0.1, 0.1, 0.0,
+      0.1, 0.1, 0.1, 0.1, 0.3, 0.0;
+  cloud.mutable_descriptors() << 1, 2, 3, 4, 6, 100;
+
+  const PointCloud result = VoxelGridDownsample(cloud, 0.5);
+  EXPECT_TRUE(result.HasExactFields(cloud.fields()));
+  ASSERT_EQ(result.size(), 2);
+  Matrix3X<float> xyzs_expected(3, 2);
+  xyzs_expected <<
+      0.2, 1.2,
+      0.2, 0.1,
+      0.1, 0.2;
+  EXPECT_TRUE(CompareMatrices(result.xyzs(), xyzs_expected, 1e-6));
+  EXPECT_EQ(result.descriptor(0)(0), 2);
+  EXPECT_EQ(result.descriptor(1)(0), 5);
+
+  // Colors are averaged as well.
+  PointCloud color_cloud(3, pc_flags::kXYZs | pc_flags::kRGBs);
+  color_cloud.mutable_xyzs().setZero();
+  color_cloud.mutable_rgbs() <<
+      255, 255, 254,
+      0, 1, 1,
+      10, 20, 40;
+  const PointCloud color_result = VoxelGridDownsample(color_cloud, 0.5);
+  ASSERT_EQ(color_result.size(), 1);
+  EXPECT_EQ(color_result.rgb(0).cast<int>(), Eigen::Vector3i(255, 1, 23));
+
+  // The number of points never increases, and a voxel size larger than the
+  // cloud leaves a single point.
+  const PointCloud random_cloud = MakeRandomCloud(2000);
+  EXPECT_LE(VoxelGridDownsample(random_cloud, 0.1).size(), 1800);
+  EXPECT_EQ(VoxelGridDownsample(random_cloud, 10).size(), 1);
+  EXPECT_EQ(VoxelGridDownsample(PointCloud(0), 0.1).size(), 0);
+  EXPECT_THROW(VoxelGridDownsample(random_cloud, 0), std::exception);
+}
+
+GTEST_TEST(PointCloudProcessingTest, EstimateNormals) {
+  // A grid of points on the plane z = 1 and an isolated point.
+  const int n = 20;
+  PointCloud cloud(n * n + 1);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      cloud.mutable_xyz(i * n + j) = Vector3f(0.05 * i, 0.05 * j, 1.0);
+    }
+  }
+  cloud.mutable_xyz(n * n) = Vector3f(5, 5, 5);
+  PointCloudIndex index(cloud, 0.1);
+  index.set_max_num_threads(3);
+
+  Matrix3X<float> normals;
+  EstimateNormals(cloud, index, 0.11, &normals);
+  ASSERT_EQ(normals.cols(), cloud.size());
+  // Normals point towards the view point at the origin.
+  for (int i = 0; i < n * n; ++i) {
+    EXPECT_TRUE(CompareMatrices(normals.col(i), Vector3f(0, 0, -1), 1e-5));
+  }
+  EXPECT_TRUE(normals.col(n * n).array().isNaN().all());
+
+  EstimateNormals(cloud, index, 0.11, &normals, Vector3f(0, 0, 2));
+  EXPECT_TRUE(CompareMatrices(normals.col(0), Vector3f(0, 0, 1), 1e-5));
+
+  // The normals do not depend on the number of threads.
+  Matrix3X<float> serial_normals;
+  index.set_max_num_threads(1);
+  EstimateNormals(cloud, index, 0.11, &serial_normals, Vector3f(0, 0, 2));
+  EXPECT_TRUE(CompareMatrices(normals.leftCols(n * n),
+                              serial_normals.leftCols(n * n)));
+
+  EXPECT_THROW(EstimateNormals(cloud, index,
+                               std::numeric_limits<float>::infinity(),
+                               &normals),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
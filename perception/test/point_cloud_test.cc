@@ -34,6 +34,19 @@ struct check_helper {
   }
 };
 
+template <>
+struct check_helper<uint8_t> {
+  template <typename XprType>
+  static bool IsDefault(const XprType& xpr) {
+    return (xpr.array() == PointCloud::kDefaultColor).all();
+  }
+
+  template <typename XprTypeA, typename XprTypeB>
+  static AssertionResult Compare(const XprTypeA& a, const XprTypeB& b) {
+    return CompareMatrices(a.template cast<int>(), b.template cast<int>());
+  }
+};
+
 GTEST_TEST(PointCloudTest, Basic) {
   const int count = 5;
 
@@ -141,6 +154,20 @@ GTEST_TEST(PointCloudTest, Basic) {
               [](PointCloud& cloud, int i) { return cloud.mutable_xyz(i); },
               [](PointCloud& cloud, int i) { return cloud.xyz(i); });
 
+  // Colors.
+  Matrix3X<uint8_t> rgbs_expected(3, count);
+  rgbs_expected.transpose() <<
+    1, 2, 3,
+    10, 20, 30,
+    100, 200, 255,
+    4, 5, 6,
+    40, 50, 60;
+  CheckFields(rgbs_expected, pc_flags::kRGBs,
+              [](PointCloud& cloud) { return cloud.mutable_rgbs(); },
+              [](PointCloud& cloud) { return cloud.rgbs(); },
+              [](PointCloud& cloud, int i) { return cloud.mutable_rgb(i); },
+              [](PointCloud& cloud, int i) { return cloud.rgb(i); });
+
   // Descriptors (Curvature).
   Eigen::RowVectorXf descriptors_expected(count);
   descriptors_expected <<
@@ -0,0 +1,623 @@
+#include "drake/solvers/active_set_qp_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+const double kInf = std::numeric_limits<double>::infinity();
+
+// A constraint is considered linearly dependent on the active constraints
+// when the norm of its component outside of their span, in the metric of the
+// Hessian, is below this fraction of its norm.
+const double kDependenceTol = 1e-10;
+
+// The workspace of the dual active-set method of Goldfarb and Idnani for the
+// problem
+//
+//   min 0.5 xᵀGx + gᵀx
+//   s.t. C.col(k)ᵀx = c(k)  for k < num_equalities,
+//        C.col(k)ᵀx ≥ c(k)  for num_equalities ≤ k < C.cols().
+//
+// With G = UᵀU, the Cholesky factorization of the Hessian, and N the matrix
+// whose columns are the num_active constraints of the active set, the method
+// maintains J = U⁻¹Q and R such that QᵀU⁻ᵀN = [R; 0], where Q is orthogonal
+// and R is upper triangular. The first num_active columns of J span the
+// range of G⁻¹N and the remaining ones its complement. Adding or dropping a
+// constraint updates J and R with Givens rotations.
+//
+// The workspace of the last solve of a program is stored with the program.
+// All the members are sized by Resize() when the problem sizes change, and
+// the solve itself makes no heap allocation.
+struct ActiveSetQPSolverData : public MathematicalProgram::SolverData {
+  // Sizes the workspace for n variables and m constraints, of which the first
+  // num_equalities_in are equalities. Memory is only allocated when the sizes
+  // differ from those of the previous solve.
+  void Resize(int n, int m, int num_equalities_in) {
+    if (C.rows() != n || C.cols() != m) {
+      // The active set of another problem is a poor warm start.
+      num_warm_start = 0;
+      is_factored = false;
+    }
+    G.resize(n, n);
+    g.resize(n);
+    C.resize(n, m);
+    c.resize(m);
+    num_equalities = num_equalities_in;
+    U.resize(n, n);
+    J.resize(n, n);
+    R.resize(n, n);
+    x.resize(n);
+    u.resize(n);
+    d.resize(n);
+    z.resize(n);
+    r.resize(n);
+    y.resize(n);
+    active.resize(n);
+    is_active.resize(m);
+    warm_start.resize(n);
+  }
+
+  // Computes U, the Cholesky factor of G, and J = U⁻¹ for the empty active
+  // set. Returns false if G is not positive definite. The factorization of
+  // the previous solve is reused if G has not changed since then.
+  bool Factor() {
+    if (is_factored && G == G_factored) {
+      J = U_inverse;
+      return true;
+    }
+    is_factored = false;
+    const int n = G.rows();
+    U.setZero();
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < j; ++i) {
+        U(i, j) = (G(i, j) - U.col(i).head(i).dot(U.col(j).head(i))) / U(i, i);
+      }
+      const double pivot = G(j, j) - U.col(j).head(j).squaredNorm();
+      if (!(pivot > n * std::numeric_limits<double>::epsilon() *
+                        std::abs(G(j, j)))) {
+        return false;
+      }
+      U(j, j) = std::sqrt(pivot);
+    }
+    J.setZero();
+    for (int j = 0; j < n; ++j) {
+      J(j, j) = 1 / U(j, j);
+      for (int i = j - 1; i >= 0; --i) {
+        double sum = 0;
+        for (int k = i + 1; k <= j; ++k) {
+          sum += U(i, k) * J(k, j);
+        }
+        J(i, j) = -sum / U(i, i);
+      }
+    }
+    G_factored = G;
+    U_inverse = J;
+    is_factored = true;
+    return true;
+  }
+
+  // Adds the constraint k at the end of the active set. Returns false, and
+  // leaves the active set unchanged, if the constraint is linearly dependent
+  // on the active constraints.
+  bool AddConstraint(int k) {
+    const int n = J.rows();
+    const int q = num_active;
+    if (q == n) {
+      return false;
+    }
+    d.noalias() = J.transpose() * C.col(k);
+    const double d_norm = d.norm();
+    // Zero d(q + 1), ..., d(n - 1) by rotating the columns of J past q, which
+    // leaves the invariants on the first q columns intact.
+    for (int j = n - 1; j > q; --j) {
+      double cosine = d(j - 1);
+      double sine = d(j);
+      const double h = std::hypot(cosine, sine);
+      if (h == 0) {
+        continue;
+      }
+      cosine /= h;
+      sine /= h;
+      if (cosine < 0) {
+        cosine = -cosine;
+        sine = -sine;
+        d(j - 1) = -h;
+      } else {
+        d(j - 1) = h;
+      }
+      d(j) = 0;
+      const double nu = sine / (1 + cosine);
+      for (int i = 0; i < n; ++i) {
+        const double a = J(i, j - 1);
+        const double b = J(i, j);
+        J(i, j - 1) = cosine * a + sine * b;
+        J(i, j) = nu * (a + J(i, j - 1)) - b;
+      }
+    }
+    if (!(std::abs(d(q)) > kDependenceTol * d_norm)) {
+      return false;
+    }
+    R.col(q).head(q + 1) = d.head(q + 1);
+    active(q) = k;
+    ++num_active;
+    return true;
+  }
+
+  // Drops the constraint at the given position of the active set, together
+  // with its multiplier.
+  void DropConstraint(int position) {
+    const int n = J.rows();
+    for (int j = position; j < num_active - 1; ++j) {
+      active(j) = active(j + 1);
+      u(j) = u(j + 1);
+      R.col(j).head(j + 2) = R.col(j + 1).head(j + 2);
+    }
+    --num_active;
+    // R is now upper Hessenberg from column `position` on. Zero its
+    // subdiagonal by rotating pairs of rows of R and columns of J.
+    for (int j = position; j < num_active; ++j) {
+      double cosine = R(j, j);
+      double sine = R(j + 1, j);
+      const double h = std::hypot(cosine, sine);
+      if (h == 0) {
+        continue;
+      }
+      cosine /= h;
+      sine /= h;
+      if (cosine < 0) {
+        cosine = -cosine;
+        sine = -sine;
+        R(j, j) = -h;
+      } else {
+        R(j, j) = h;
+      }
+      R(j + 1, j) = 0;
+      const double nu = sine / (1 + cosine);
+      for (int k = j + 1; k < num_active; ++k) {
+        const double a = R(j, k);
+        const double b = R(j + 1, k);
+        R(j, k) = cosine * a + sine * b;
+        R(j + 1, k) = nu * (a + R(j, k)) - b;
+      }
+      for (int i = 0; i < n; ++i) {
+        const double a = J(i, j);
+        const double b = J(i, j + 1);
+        J(i, j) = cosine * a + sine * b;
+        J(i, j + 1) = nu * (a + J(i, j)) - b;
+      }
+    }
+  }
+
+  // Sets x to the minimum of the cost with the active constraints as
+  // equalities, and u to their multipliers, such that Gx + g = Nu.
+  void SolveOnActiveSet() {
+    const int n = J.rows();
+    const int q = num_active;
+    // In the coordinates y = QᵀUx, the active constraints read Rᵀy₁ = c_A,
+    // and the optimality conditions y₂ = -(Jᵀg)₂, Ru = y₁ + (Jᵀg)₁.
+    d.noalias() = J.transpose() * g;
+    for (int j = 0; j < q; ++j) {
+      y(j) = c(active(j));
+    }
+    R.topLeftCorner(q, q).triangularView<Eigen::Upper>().transpose()
+        .solveInPlace(y.head(q));
+    y.tail(n - q) = -d.tail(n - q);
+    x.noalias() = J * y;
+    u.head(q) = y.head(q) + d.head(q);
+    R.topLeftCorner(q, q).triangularView<Eigen::Upper>().solveInPlace(
+        u.head(q));
+  }
+
+  // Computes the primal step direction z and the negative of the dual step
+  // direction r for adding the constraint k to the active set.
+  void ComputeStep(int k) {
+    const int n = J.rows();
+    const int q = num_active;
+    d.noalias() = J.transpose() * C.col(k);
+    z.noalias() = J.rightCols(n - q) * d.tail(n - q);
+    r.head(q) = d.head(q);
+    R.topLeftCorner(q, q).triangularView<Eigen::Upper>().solveInPlace(
+        r.head(q));
+  }
+
+  // Runs the dual active-set method from the warm start, given a factored
+  // Hessian.
+  SolutionResult Solve(double tolerance, int max_iterations) {
+    num_iterations = 0;
+    const int n = J.rows();
+    const int m = C.cols();
+    num_active = 0;
+    is_active.setZero();
+    for (int k = 0; k < num_equalities; ++k) {
+      // Dependent equalities are either redundant or infeasible, which is
+      // checked below.
+      AddConstraint(k);
+    }
+    num_active_equalities = num_active;
+    for (int i = 0; i < num_warm_start; ++i) {
+      const int k = warm_start(i);
+      if (k >= num_equalities && k < m && !is_active(k) && AddConstraint(k)) {
+        is_active(k) = 1;
+      }
+    }
+    num_warm_start = 0;
+    SolveOnActiveSet();
+    for (int k = 0; k < num_equalities; ++k) {
+      if (std::abs(C.col(k).dot(x) - c(k)) > tolerance) {
+        return SolutionResult::kInfeasibleConstraints;
+      }
+    }
+    // Drop the constraints of the warm start with negative multipliers, most
+    // negative first, until x and the active set are a valid starting point.
+    while (true) {
+      int position = -1;
+      double u_min = 0;
+      for (int j = num_active_equalities; j < num_active; ++j) {
+        if (u(j) < u_min) {
+          u_min = u(j);
+          position = j;
+        }
+      }
+      if (position < 0) {
+        break;
+      }
+      is_active(active(position)) = 0;
+      DropConstraint(position);
+      SolveOnActiveSet();
+    }
+
+    while (true) {
+      // Pick the most violated inequality constraint.
+      int p = -1;
+      double s_p = -tolerance;
+      for (int k = num_equalities; k < m; ++k) {
+        if (is_active(k)) {
+          continue;
+        }
+        const double s = C.col(k).dot(x) - c(k);
+        if (s < s_p) {
+          s_p = s;
+          p = k;
+        }
+      }
+      if (p < 0) {
+        for (int j = num_active_equalities; j < num_active; ++j) {
+          warm_start(num_warm_start++) = active(j);
+        }
+        return SolutionResult::kSolutionFound;
+      }
+
+      // Step along the direction that keeps the active constraints satisfied
+      // and increases the multiplier u_p of constraint p, until either p is
+      // satisfied or the multiplier of an active constraint reaches zero, in
+      // which case that constraint is dropped.
+      double u_p = 0;
+      while (true) {
+        if (++num_iterations > max_iterations) {
+          return SolutionResult::kIterationLimit;
+        }
+        ComputeStep(p);
+        const int q = num_active;
+        int blocking = -1;
+        double t_dual = kInf;
+        for (int j = num_active_equalities; j < q; ++j) {
+          if (r(j) > 0) {
+            const double t = std::max(u(j), 0.0) / r(j);
+            if (t < t_dual) {
+              t_dual = t;
+              blocking = j;
+            }
+          }
+        }
+        // zᵀn_p = |d₂|², which vanishes when n_p depends on the active
+        // constraints.
+        const double d2_squared = d.tail(n - q).squaredNorm();
+        const double t_primal =
+            d2_squared > kDependenceTol * kDependenceTol * d.squaredNorm()
+                ? -s_p / d2_squared
+                : kInf;
+        if (blocking < 0 && t_primal == kInf) {
+          return SolutionResult::kInfeasibleConstraints;
+        }
+        const double t = std::min(t_dual, t_primal);
+        if (t_primal < kInf) {
+          x += t * z;
+        }
+        u.head(q) -= t * r.head(q);
+        u_p += t;
+        if (t_primal <= t_dual) {
+          if (!AddConstraint(p)) {
+            return SolutionResult::kInfeasibleConstraints;
+          }
+          u(num_active - 1) = u_p;
+          is_active(p) = 1;
+          break;
+        }
+        is_active(active(blocking)) = 0;
+        DropConstraint(blocking);
+        s_p = C.col(p).dot(x) - c(p);
+      }
+    }
+  }
+
+  Eigen::MatrixXd G;
+  Eigen::VectorXd g;
+  Eigen::MatrixXd C;
+  Eigen::VectorXd c;
+  int num_equalities{0};
+
+  Eigen::MatrixXd U;
+  // The Hessian of the last factorization, and the inverse of its Cholesky
+  // factor.
+  Eigen::MatrixXd G_factored;
+  Eigen::MatrixXd U_inverse;
+  bool is_factored{false};
+  Eigen::MatrixXd J;
+  Eigen::MatrixXd R;
+  Eigen::VectorXd x;
+  // The multipliers of the active constraints.
+  Eigen::VectorXd u;
+  // Scratch vectors.
+  Eigen::VectorXd d;
+  Eigen::VectorXd z;
+  Eigen::VectorXd r;
+  Eigen::VectorXd y;
+  // The indices of the active constraints, equalities first.
+  Eigen::VectorXi active;
+  int num_active{0};
+  int num_active_equalities{0};
+  Eigen::VectorXi is_active;
+  // The active inequality constraints of the last successful solve.
+  Eigen::VectorXi warm_start;
+  int num_warm_start{0};
+  // The number of iterations of the last solve.
+  int num_iterations{0};
+  // For each row of the constraint being parsed, the columns of C of its
+  // lower and upper bounds, or -1.
+  std::vector<int> row_columns;
+};
+
+// Counts the equality and the one-sided inequality constraints in `bindings`.
+template <typename C>
+void CountLinearConstraints(const std::vector<Binding<C>>& bindings,
+                            int* num_equalities, int* num_inequalities) {
+  for (const auto& binding : bindings) {
+    const auto& lb = binding.evaluator()->lower_bound();
+    const auto& ub = binding.evaluator()->upper_bound();
+    for (int i = 0; i < lb.rows(); ++i) {
+      if (lb(i) == ub(i)) {
+        ++*num_equalities;
+      } else {
+        *num_inequalities += !std::isinf(lb(i)) + !std::isinf(ub(i));
+      }
+    }
+  }
+}
+
+// Writes the constraints in `bindings` to the columns of `data->C` and the
+// entries of `data->c`, starting at `*next_equality` for the equality rows
+// and at `*next_inequality` for the inequality rows.
+template <typename C>
+void ParseLinearConstraints(const MathematicalProgram& prog,
+                            const std::vector<Binding<C>>& bindings,
+                            ActiveSetQPSolverData* data, int* next_equality,
+                            int* next_inequality) {
+  std::vector<int>& row_columns = data->row_columns;
+  for (const auto& binding : bindings) {
+    const auto& lb = binding.evaluator()->lower_bound();
+    const auto& ub = binding.evaluator()->upper_bound();
+    row_columns.resize(2 * lb.rows());
+    for (int i = 0; i < lb.rows(); ++i) {
+      row_columns[2 * i] = -1;
+      row_columns[2 * i + 1] = -1;
+      if (lb(i) == ub(i)) {
+        row_columns[2 * i] = *next_equality;
+        data->c(*next_equality) = lb(i);
+        ++*next_equality;
+        continue;
+      }
+      if (!std::isinf(lb(i))) {
+        row_columns[2 * i] = *next_inequality;
+        data->c(*next_inequality) = lb(i);
+        ++*next_inequality;
+      }
+      if (!std::isinf(ub(i))) {
+        // a x ≤ ub is stored as -a x ≥ -ub.
+        row_columns[2 * i + 1] = *next_inequality;
+        data->c(*next_inequality) = -ub(i);
+        ++*next_inequality;
+      }
+    }
+    const Eigen::SparseMatrix<double>& A = binding.evaluator()->get_sparse_A();
+    for (int j = 0; j < A.outerSize(); ++j) {
+      const int var_index =
+          prog.FindDecisionVariableIndex(binding.variables()(j));
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        const int lower_column = row_columns[2 * it.row()];
+        const int upper_column = row_columns[2 * it.row() + 1];
+        if (lower_column >= 0) {
+          data->C(var_index, lower_column) += it.value();
+        }
+        if (upper_column >= 0) {
+          data->C(var_index, upper_column) -= it.value();
+        }
+      }
+    }
+  }
+}
+
+// Writes the quadratic and linear costs of `prog` to `data->G` and `data->g`,
+// and returns their constant term.
+double ParseCosts(const MathematicalProgram& prog,
+                  ActiveSetQPSolverData* data) {
+  data->G.setZero();
+  data->g.setZero();
+  double constant_term = 0;
+  for (const auto& binding : prog.quadratic_costs()) {
+    const auto& variables = binding.variables();
+    const Eigen::SparseMatrix<double>& Q = binding.evaluator()->get_sparse_Q();
+    for (int j = 0; j < Q.outerSize(); ++j) {
+      const int column = prog.FindDecisionVariableIndex(variables(j));
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Q, j); it; ++it) {
+        data->G(prog.FindDecisionVariableIndex(variables(it.row())), column) +=
+            it.value();
+      }
+    }
+    for (int i = 0; i < variables.rows(); ++i) {
+      data->g(prog.FindDecisionVariableIndex(variables(i))) +=
+          binding.evaluator()->b()(i);
+    }
+    constant_term += binding.evaluator()->c();
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const auto& variables = binding.variables();
+    for (int i = 0; i < variables.rows(); ++i) {
+      data->g(prog.FindDecisionVariableIndex(variables(i))) +=
+          binding.evaluator()->a()(i);
+    }
+    constant_term += binding.evaluator()->b();
+  }
+  return constant_term;
+}
+
+// Throws if `prog` is not a QP with linear constraints and continuous
+// variables only.
+void ThrowIfUnsupported(const MathematicalProgram& prog) {
+  const auto throw_unsupported = [](const std::string& what) {
+    throw std::runtime_error("ActiveSetQPSolver does not support " + what +
+                             ".");
+  };
+  if (!prog.generic_costs().empty()) throw_unsupported("generic costs");
+  if (!prog.generic_constraints().empty()) {
+    throw_unsupported("generic constraints");
+  }
+  if (!prog.linear_complementarity_constraints().empty()) {
+    throw_unsupported("linear complementarity constraints");
+  }
+  if (!prog.lorentz_cone_constraints().empty() ||
+      !prog.rotated_lorentz_cone_constraints().empty()) {
+    throw_unsupported("Lorentz cone constraints");
+  }
+  if (!prog.positive_semidefinite_constraints().empty() ||
+      !prog.linear_matrix_inequality_constraints().empty()) {
+    throw_unsupported("semidefinite constraints");
+  }
+  for (int i = 0; i < prog.num_vars(); ++i) {
+    if (prog.decision_variable(i).get_type() !=
+        symbolic::Variable::Type::CONTINUOUS) {
+      throw_unsupported("binary or integer variables");
+    }
+  }
+}
+}  // namespace
+
+bool ActiveSetQPSolver::available() const { return true; }
+
+SolutionResult ActiveSetQPSolver::Solve(MathematicalProgram& prog) const {
+  ThrowIfUnsupported(prog);
+
+  int num_equalities = 0;
+  int num_inequalities = 0;
+  CountLinearConstraints(prog.linear_equality_constraints(), &num_equalities,
+                         &num_inequalities);
+  CountLinearConstraints(prog.linear_constraints(), &num_equalities,
+                         &num_inequalities);
+  CountLinearConstraints(prog.bounding_box_constraints(), &num_equalities,
+                         &num_inequalities);
+  const int n = prog.num_vars();
+  const int m = num_equalities + num_inequalities;
+
+  double feasibility_tol = 1e-9;
+  std::map<std::string, double> options_double =
+      prog.GetSolverOptionsDouble(id());
+  auto it_double = options_double.find("FeasibilityTol");
+  if (it_double != options_double.end()) {
+    if (it_double->second < 0) {
+      throw std::runtime_error(
+          "FeasibilityTol should be a non-negative number.");
+    }
+    feasibility_tol = it_double->second;
+    options_double.erase(it_double);
+  }
+  int max_iterations = 10 * (n + m);
+  std::map<std::string, int> options_int = prog.GetSolverOptionsInt(id());
+  auto it_int = options_int.find("MaxIterations");
+  if (it_int != options_int.end()) {
+    if (it_int->second < 0) {
+      throw std::runtime_error(
+          "MaxIterations should be a non-negative number.");
+    }
+    max_iterations = it_int->second;
+    options_int.erase(it_int);
+  }
+  if (!options_double.empty() || !options_int.empty() ||
+      !prog.GetSolverOptionsStr(id()).empty()) {
+    throw std::runtime_error("Unsupported option in ActiveSetQPSolver.");
+  }
+
+  auto data = prog.GetSolverData<ActiveSetQPSolverData>();
+  data->Resize(n, m, num_equalities);
+  const double constant_term = ParseCosts(prog, data.get());
+  data->C.setZero();
+  int next_equality = 0;
+  int next_inequality = num_equalities;
+  ParseLinearConstraints(prog, prog.linear_equality_constraints(), data.get(),
+                         &next_equality, &next_inequality);
+  ParseLinearConstraints(prog, prog.linear_constraints(), data.get(),
+                         &next_equality, &next_inequality);
+  ParseLinearConstraints(prog, prog.bounding_box_constraints(), data.get(),
+                         &next_equality, &next_inequality);
+  DRAKE_DEMAND(next_equality == num_equalities && next_inequality == m);
+
+  const SolutionResult solution_result =
+      data->Factor() ? data->Solve(feasibility_tol, max_iterations)
+                     : SolutionResult::kInvalidInput;
+
+  SolverResult solver_result(id());
+  if (solution_result != SolutionResult::kInvalidInput) {
+    solver_result.set_num_iterations(data->num_iterations);
+  }
+  switch (solution_result) {
+    case SolutionResult::kSolutionFound: {
+      solver_result.set_decision_variable_values(data->x);
+      data->d.noalias() = data->G * data->x;
+      solver_result.set_optimal_cost(0.5 * data->x.dot(data->d) +
+                                     data->g.dot(data->x) + constant_term);
+      break;
+    }
+    case SolutionResult::kInfeasibleConstraints: {
+      solver_result.set_optimal_cost(
+          MathematicalProgram::kGlobalInfeasibleCost);
+      break;
+    }
+    default: {
+      solver_result.set_optimal_cost(NAN);
+    }
+  }
+  prog.SetSolverResult(solver_result);
+  return solution_result;
+}
+
+SolverId ActiveSetQPSolver::solver_id() const { return id(); }
+
+SolverId ActiveSetQPSolver::id() {
+  static const never_destroyed<SolverId> singleton{"Active set QP"};
+  return singleton.access();
+}
+
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/mathematical_program_solver_interface.h"
+
+namespace drake {
+namespace solvers {
+
+/// Solves strictly convex quadratic programs
+///
+///   min 0.5 xᵀGx + gᵀx
+///   s.t. linear equality, linear inequality and bounding box constraints
+///
+/// with the dual active-set method of Goldfarb and Idnani, which suits small
+/// dense problems (up to a few hundred variables) that are solved repeatedly,
+/// e.g. at every tick of a controller.
+///
+/// The Hessian G must be positive definite; otherwise Solve() returns
+/// SolutionResult::kInvalidInput. The method starts from the unconstrained
+/// minimum, so it needs no feasible initial point, and it adds one violated
+/// constraint to the active set per iteration. The factorization of the KKT
+/// system over the active set is updated with Givens rotations as constraints
+/// enter or leave the active set, at O(n²) cost, rather than refactored.
+///
+/// The solver workspace is stored with the MathematicalProgram and is reused
+/// by the next solve of the same program, so that solving a program again
+/// with the same number of variables and constraints makes no heap allocation
+/// in the solver, and reuses the factorization of the Hessian if the Hessian
+/// did not change. The next solve also warm-starts from the active set of the
+/// last successful solve: the constraints of that set are factored first, and
+/// those whose multipliers turn out negative are dropped before the regular
+/// iterations resume. When the active set does not change between solves,
+/// e.g. as the bounds or the linear cost change slowly, no iteration is
+/// needed at all.
+///
+/// The user can set the following options
+///  - "FeasibilityTol" (double). The largest constraint violation of a
+///    solution. The default is 1e-9.
+///  - "MaxIterations" (int). The largest number of iterations, each of which
+///    adds or drops one constraint of the active set. The default is
+///    10 * (num_vars + num_constraints).
+///
+/// - D. Goldfarb and A. Idnani. A numerically stable dual method for solving
+///   strictly convex quadratic programs. Mathematical Programming, 27(1), 1983.
+class ActiveSetQPSolver : public MathematicalProgramSolverInterface {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ActiveSetQPSolver)
+
+  ActiveSetQPSolver() = default;
+  ~ActiveSetQPSolver() override = default;
+
+  bool available() const override;
+
+  SolutionResult Solve(MathematicalProgram& prog) const override;
+
+  SolverId solver_id() const override;
+
+  /// @return same as MathematicalProgramSolverInterface::solver_id()
+  static SolverId id();
+};
+
+}  // namespace solvers
+}  // namespace drake
@@ -1,12 +1,17 @@
 #include "drake/solvers/branch_and_bound.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <unordered_set>
 #include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
@@ -313,26 +318,36 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
   fixed_binary_value_ = binary_value;
 }
 
-void MixedIntegerBranchAndBoundNode::Branch(
-    const symbolic::Variable& binary_variable) {
-  left_child_.reset(new MixedIntegerBranchAndBoundNode(
+MixedIntegerBranchAndBoundNode::ChildNodes
+MixedIntegerBranchAndBoundNode::CreateChildren(
+    const symbolic::Variable& binary_variable) const {
+  ChildNodes children;
+  children.first.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
-  right_child_.reset(new MixedIntegerBranchAndBoundNode(
+  children.second.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
-  left_child_->FixBinaryVariable(binary_variable, 0);
-  right_child_->FixBinaryVariable(binary_variable, 1);
+  children.first->FixBinaryVariable(binary_variable, 0);
+  children.second->FixBinaryVariable(binary_variable, 1);
+  for (auto child : {children.first.get(), children.second.get()}) {
+    child->solution_result_ =
+        SolveProgramWithSolver(child->prog_.get(), child->solver_id_);
+    if (child->solution_result_ == SolutionResult::kSolutionFound) {
+      child->CheckOptimalSolutionIsIntegral();
+    }
+  }
+  return children;
+}
+
+void MixedIntegerBranchAndBoundNode::AttachChildren(ChildNodes children) {
+  left_child_ = std::move(children.first);
+  right_child_ = std::move(children.second);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ =
-      SolveProgramWithSolver(left_child_->prog_.get(), left_child_->solver_id_);
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      right_child_->prog_.get(), right_child_->solver_id_);
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
-  }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
-  }
+}
+
+void MixedIntegerBranchAndBoundNode::Branch(
+    const symbolic::Variable& binary_variable) {
+  AttachChildren(CreateChildren(binary_variable));
 }
 
 MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
@@ -380,20 +395,26 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
-    // found, then every leaf node is fathomed, the branch-and-bound process
-    // should terminate.
-    // TODO(hongkai.dai) We might need to have a function that picks the
-    // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
-    if (HasConverged()) {
+  if (max_num_threads_ > 1) {
+    if (BranchInParallel()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+  } else {
+    MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
+    while (branching_node) {
+      // Found a branching node, branch on this node. If no branching node is
+      // found, then every leaf node is fathomed, the branch-and-bound process
+      // should terminate.
+      // TODO(hongkai.dai) We might need to have a function that picks the
+      // branching node together with the branching variable simultaneously.
+      const symbolic::Variable* branching_variable =
+          PickBranchingVariable(*branching_node);
+      BranchAndUpdate(branching_node, *branching_variable);
+      if (HasConverged()) {
+        return SolutionResult::kSolutionFound;
+      }
+      branching_node = PickBranchingNode();
+    }
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -406,6 +427,142 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       "Unknown result. The problem is not optimal, infeasible, nor unbounded.");
 }
 
+bool MixedIntegerBranchAndBound::BranchInParallel() {
+  // With a user-defined node selection function, the open nodes are picked
+  // from the tree, otherwise from a queue sorted by increasing priority.
+  const bool use_queue =
+      node_selection_method_ != NodeSelectionMethod::kUserDefined;
+  auto priority = [this](const MixedIntegerBranchAndBoundNode& node) {
+    if (node_selection_method_ == NodeSelectionMethod::kDepthFirst) {
+      // The deepest node has the fewest remaining binary variables.
+      return static_cast<double>(node.remaining_binary_variables().size());
+    }
+    return node.prog()->GetOptimalCost();
+  };
+  std::multimap<double, MixedIntegerBranchAndBoundNode*> open_nodes;
+  if (use_queue) {
+    // Solve() may be called again on a tree that is already branched, so all
+    // of its un-fathomed leaf nodes are open.
+    std::vector<MixedIntegerBranchAndBoundNode*> stack{root_.get()};
+    while (!stack.empty()) {
+      MixedIntegerBranchAndBoundNode* node = stack.back();
+      stack.pop_back();
+      if (!node->IsLeaf()) {
+        stack.push_back(node->mutable_right_child());
+        stack.push_back(node->mutable_left_child());
+      } else if (!IsLeafNodeFathomed(*node)) {
+        open_nodes.emplace(priority(*node), node);
+      }
+    }
+  }
+
+  // The state below is shared by the workers, and guarded by the mutex. The
+  // tree and the data of this object are only accessed with the mutex locked,
+  // except for the nodes being branched on, which are only read.
+  std::mutex mutex;
+  std::condition_variable node_done;
+  std::unordered_set<const MixedIntegerBranchAndBoundNode*> busy_nodes;
+  bool converged = false;
+  bool stop = false;
+  std::exception_ptr error;
+
+  // Returns the next node to branch on, or nullptr if there is none until a
+  // busy node has been branched on.
+  auto pick_node = [&]() -> MixedIntegerBranchAndBoundNode* {
+    if (!use_queue) {
+      MixedIntegerBranchAndBoundNode* node = PickBranchingNode();
+      return busy_nodes.count(node) > 0 ? nullptr : node;
+    }
+    while (!open_nodes.empty()) {
+      MixedIntegerBranchAndBoundNode* node = open_nodes.begin()->second;
+      open_nodes.erase(open_nodes.begin());
+      // The node is pruned if its cost exceeds an upper bound found after it
+      // was queued.
+      if (!IsLeafNodeFathomed(*node)) {
+        return node;
+      }
+    }
+    return nullptr;
+  };
+
+  auto work = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+      MixedIntegerBranchAndBoundNode* node = pick_node();
+      if (node == nullptr) {
+        if (busy_nodes.empty()) {
+          // Every leaf node is fathomed.
+          stop = true;
+          node_done.notify_all();
+        } else {
+          node_done.wait(lock);
+        }
+        continue;
+      }
+      busy_nodes.insert(node);
+      const symbolic::Variable branching_variable =
+          *PickBranchingVariable(*node);
+      lock.unlock();
+
+      // Solving the programs in the child nodes dominates the cost of the
+      // search, and happens concurrently with the other workers.
+      MixedIntegerBranchAndBoundNode::ChildNodes children =
+          node->CreateChildren(branching_variable);
+      const std::array<OptionalIntegralSolution, 2> rounded_solutions =
+          SearchChildrenIntegralSolutionByRounding(*children.first,
+                                                   *children.second);
+
+      lock.lock();
+      busy_nodes.erase(node);
+      node->AttachChildren(std::move(children));
+      UpdateAfterBranch(*node, rounded_solutions);
+      if (use_queue) {
+        for (auto child :
+             {node->mutable_left_child(), node->mutable_right_child()}) {
+          if (!IsLeafNodeFathomed(*child)) {
+            open_nodes.emplace(priority(*child), child);
+          }
+        }
+      }
+      if (HasConverged()) {
+        converged = true;
+        stop = true;
+      }
+      node_done.notify_all();
+    }
+  };
+  auto run_worker = [&]() {
+    try {
+      work();
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      stop = true;
+      node_done.notify_all();
+    }
+  };
+
+  // The calling thread is one of the workers.
+  thread_pool_->Run(max_num_threads_, [&](int) { run_worker(); });
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return converged;
+}
+
+void MixedIntegerBranchAndBound::set_max_num_threads(int max_num_threads) {
+  DRAKE_THROW_UNLESS(max_num_threads >= 1);
+  if (max_num_threads == max_num_threads_) return;
+  max_num_threads_ = max_num_threads;
+  thread_pool_.reset();
+  if (max_num_threads > 1) {
+    thread_pool_ =
+        std::make_unique<drake::internal::ThreadPool>(max_num_threads);
+  }
+}
+
 void MixedIntegerBranchAndBound::NodeCallback(
     const MixedIntegerBranchAndBoundNode& node) {
   if (node_callback_userfun_ != nullptr) {
@@ -680,6 +837,14 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranch(*node,
+                    SearchChildrenIntegralSolutionByRounding(
+                        *node->left_child(), *node->right_child()));
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranch(
+    const MixedIntegerBranchAndBoundNode& node,
+    const std::array<OptionalIntegralSolution, 2>& rounded_solutions) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -687,7 +852,10 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
+  const std::array<const MixedIntegerBranchAndBoundNode*, 2> children{
+      {node.left_child(), node.right_child()}};
+  for (int i = 0; i < 2; ++i) {
+    const MixedIntegerBranchAndBoundNode* child = children[i];
     if (child->solution_result() == SolutionResult::kSolutionFound &&
         child->optimal_solution_is_integral()) {
       const double child_node_optimal_cost = child->prog()->GetOptimalCost();
@@ -695,8 +863,9 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
           child->prog()->GetSolution(child->prog()->decision_variables());
       UpdateIntegralSolution(x_sol, child_node_optimal_cost);
     }
-    if (search_integral_solution_by_rounding_) {
-      SearchIntegralSolutionByRounding(*child);
+    if (rounded_solutions[i]) {
+      UpdateIntegralSolution(rounded_solutions[i]->second,
+                             rounded_solutions[i]->first);
     }
     NodeCallback(*child);
   }
@@ -741,7 +910,10 @@ bool MixedIntegerBranchAndBound::HasConverged() const {
   return false;
 }
 
-void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
+namespace {
+// Solves the program in `node` with its remaining binary variables fixed by
+// rounding their solution, and returns the cost and the solution if found.
+optional<std::pair<double, Eigen::VectorXd>> SolveRoundedProgram(
     const MixedIntegerBranchAndBoundNode& node) {
   // Only searches integral solution by rounding, if the optimization program
   // in this node has an optimal solution, and that solution is non-integral.
@@ -768,11 +940,34 @@ void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
         SolveProgramWithSolver(new_prog.get(), node.solver_id());
     if (result == SolutionResult::kSolutionFound) {
       // Found integral solution.
-      UpdateIntegralSolution(
-          new_prog->GetSolution(new_prog->decision_variables()),
-          new_prog->GetOptimalCost());
+      return std::make_pair(
+          new_prog->GetOptimalCost(),
+          Eigen::VectorXd(
+              new_prog->GetSolution(new_prog->decision_variables())));
     }
   }
+  return nullopt;
+}
+}  // namespace
+
+void MixedIntegerBranchAndBound::SearchIntegralSolutionByRounding(
+    const MixedIntegerBranchAndBoundNode& node) {
+  const OptionalIntegralSolution rounded_solution = SolveRoundedProgram(node);
+  if (rounded_solution) {
+    UpdateIntegralSolution(rounded_solution->second, rounded_solution->first);
+  }
+}
+
+std::array<MixedIntegerBranchAndBound::OptionalIntegralSolution, 2>
+MixedIntegerBranchAndBound::SearchChildrenIntegralSolutionByRounding(
+    const MixedIntegerBranchAndBoundNode& left_child,
+    const MixedIntegerBranchAndBoundNode& right_child) const {
+  std::array<OptionalIntegralSolution, 2> rounded_solutions;
+  if (search_integral_solution_by_rounding_) {
+    rounded_solutions[0] = SolveRoundedProgram(left_child);
+    rounded_solutions[1] = SolveRoundedProgram(right_child);
+  }
+  return rounded_solutions;
 }
 }  // namespace solvers
 }  // namespace drake
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <array>
 #include <list>
 #include <map>
 #include <memory>
 #include <unordered_map>
 #include <utility>
 
+#include "drake/common/drake_optional.h"
+#include "drake/common/thread_pool.h"
 #include "drake/solvers/mathematical_program.h"
 
 namespace drake {
@@ -166,6 +169,11 @@ class MixedIntegerBranchAndBoundNode {
   }
 
  private:
+  friend class MixedIntegerBranchAndBound;
+
+  using ChildNodes = std::pair<std::unique_ptr<MixedIntegerBranchAndBoundNode>,
+                               std::unique_ptr<MixedIntegerBranchAndBoundNode>>;
+
   // Constructs an empty node. Clone the input mathematical program to this
   // node. The child and the parent nodes are all nullptr.
   // @param prog The optimization program whose binary variable constraints are
@@ -184,6 +192,14 @@ class MixedIntegerBranchAndBoundNode {
   void FixBinaryVariable(const symbolic::Variable& binary_variable,
                          bool binary_value);
 
+  // Creates and solves the left and the right child nodes of Branch(), without
+  // attaching them to this node. This node is not modified, so that other
+  // threads can read the tree while the children are solved.
+  ChildNodes CreateChildren(const symbolic::Variable& binary_variable) const;
+
+  // Makes `children`, created by CreateChildren(), the children of this node.
+  void AttachChildren(ChildNodes children);
+
   // Check if the optimal solution to the program in this node satisfies all
   // integral constraints.
   // Only call this function AFTER the program is solved.
@@ -243,6 +259,10 @@ class MixedIntegerBranchAndBoundNode {
  * Notice that we will create a new set of variables in the branch-and-bound
  * process, since we need to replace the binary variables with continuous
  * variables.
+ * The program in each node is solved from scratch. A child node copies the
+ * program of its parent, including the initial guess of the root program, but
+ * neither the parent's solution nor its simplex basis is passed to the
+ * solver, so the relaxations are not warm started.
  */
 class MixedIntegerBranchAndBound {
  public:
@@ -550,6 +570,30 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Sets the maximum number of threads used by Solve(), which are created here
+   * and reused by every call to Solve(). With one thread, which is the
+   * default, Solve() branches on one node at a time. With more threads, a pool
+   * of workers pulls the open nodes from a queue shared by all workers,
+   * ordered according to the node selection method, and each worker branches
+   * on its node and solves the programs in the child nodes concurrently with
+   * the other workers. The best upper bound is shared by all workers, and a
+   * node whose optimal cost exceeds it is pruned when it is pulled from the
+   * queue.
+   *
+   * The user-defined node selection, variable selection and node callback
+   * functions are never called concurrently, but with a user-defined node
+   * selection function, a worker waits while the selected node is being
+   * branched on by another worker. Since the order in which the nodes are
+   * explored depends on the timing of the workers, the solutions() found
+   * other than the optimal one may vary between runs.
+   * @throws std::exception if `max_num_threads` is less than one.
+   */
+  void set_max_num_threads(int max_num_threads);
+
+  /** Getter for the maximum number of threads used by Solve(). */
+  int get_max_num_threads() const { return max_num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -584,6 +628,43 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  // The cost of an integral solution together with the solution, if found.
+  using OptionalIntegralSolution =
+      optional<std::pair<double, Eigen::VectorXd>>;
+
+  /**
+   * Updates the best lower and upper bounds after branching on a node, and
+   * calls the callback function on each of its child nodes.
+   * @param node. The node that was branched.
+   * @param rounded_solutions. The integral solutions found by rounding the
+   * solutions of the left and the right child nodes, see
+   * SearchChildrenIntegralSolutionByRounding().
+   */
+  void UpdateAfterBranch(
+      const MixedIntegerBranchAndBoundNode& node,
+      const std::array<OptionalIntegralSolution, 2>& rounded_solutions);
+
+  /**
+   * Searches for an integral solution by rounding in each of the child nodes
+   * created by branching on a node, if the user called
+   * SetSearchIntegralSolutionByRounding(true). Unlike
+   * SearchIntegralSolutionByRounding(), the solutions found are returned
+   * rather than stored, so that the search can run concurrently in several
+   * threads.
+   */
+  std::array<OptionalIntegralSolution, 2>
+  SearchChildrenIntegralSolutionByRounding(
+      const MixedIntegerBranchAndBoundNode& left_child,
+      const MixedIntegerBranchAndBoundNode& right_child) const;
+
+  /**
+   * Branches on the open nodes with a pool of max_num_threads_ workers, until
+   * either the branch-and-bound has converged, or there is no node left to
+   * branch on.
+   * @retval converged True if the branch-and-bound has converged.
+   */
+  bool BranchInParallel();
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -675,6 +756,12 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  int max_num_threads_{1};
+
+  // The threads of the workers of BranchInParallel(), if max_num_threads_ is
+  // more than one.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -61,12 +61,11 @@ void RotatedLorentzConeConstraint::DoEval(
 void LinearConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
                               Eigen::VectorXd &y) const {
   y.resize(num_constraints());
-  y = A_ * x;
+  y = A_.GetAsSparse() * x;
 }
 void LinearConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
                               AutoDiffVecXd &y) const {
-  y.resize(num_constraints());
-  y = A_.cast<AutoDiffXd>() * x;
+  y = internal::SparseMatrixTimesVector(A_.GetAsSparse(), x);
 }
 
 void BoundingBoxConstraint::DoEval(
@@ -188,6 +187,9 @@ ExpressionConstraint::ExpressionConstraint(
   for (int i = 0; i < vars_.size(); i++) {
     environment_.insert(vars_[i], 0.0);
   }
+
+  // DoEval() writes the value of x to environment_.
+  set_is_thread_safe(false);
 }
 
 void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
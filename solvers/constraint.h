@@ -21,6 +21,7 @@
 #include "drake/solvers/decision_variable.h"
 #include "drake/solvers/evaluator_base.h"
 #include "drake/solvers/function.h"
+#include "drake/solvers/sparse_and_dense_matrix.h"
 
 namespace drake {
 namespace solvers {
@@ -380,7 +381,9 @@ class EvaluatorConstraint : public Constraint {
                       Args&&... args)
       : Constraint(evaluator->num_outputs(), evaluator->num_vars(),
                    std::forward<Args>(args)...),
-        evaluator_(evaluator) {}
+        evaluator_(evaluator) {
+    set_is_thread_safe(evaluator->is_thread_safe());
+  }
 
   using Constraint::UpdateLowerBound;
   using Constraint::UpdateUpperBound;
@@ -447,6 +450,10 @@ class PolynomialConstraint : public EvaluatorConstraint<PolynomialEvaluator> {
 
 /**
  * Implements a constraint of the form @f lb <= Ax <= ub @f
+ *
+ * The matrix A is stored in the form it is given, sparse or dense. The other
+ * form is only computed, and then cached, when it is first needed. Since A is
+ * evaluated through its sparse form, solvers should prefer get_sparse_A().
  */
 class LinearConstraint : public Constraint {
  public:
@@ -460,16 +467,38 @@ class LinearConstraint : public Constraint {
     DRAKE_ASSERT(a.rows() == lb.rows());
   }
 
+  /**
+   * Constructs the constraint from a sparse matrix A, without ever forming
+   * its dense counterpart.
+   */
+  LinearConstraint(const Eigen::SparseMatrix<double>& A,
+                   const Eigen::Ref<const Eigen::VectorXd>& lb,
+                   const Eigen::Ref<const Eigen::VectorXd>& ub)
+      : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
+    DRAKE_ASSERT(A.rows() == lb.rows());
+  }
+
   ~LinearConstraint() override {}
 
   virtual Eigen::SparseMatrix<double> GetSparseMatrix() const {
-    // TODO(eric.cousineau): Consider storing or caching sparse matrix, such
-    // that we can return a const lvalue reference.
-    return A_.sparseView();
+    return A_.GetAsSparse();
   }
+
+  /**
+   * Returns the matrix A in sparse form, which is computed on the first call if
+   * the constraint was constructed from a dense matrix.
+   */
+  const Eigen::SparseMatrix<double>& get_sparse_A() const {
+    return A_.GetAsSparse();
+  }
+
+  /**
+   * Returns the matrix A in dense form, which is computed on the first call if
+   * the constraint was constructed from a sparse matrix.
+   */
   virtual const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& A()
       const {
-    return A_;
+    return A_.GetAsDense();
   }
 
   /**
@@ -486,15 +515,21 @@ class LinearConstraint : public Constraint {
   void UpdateCoefficients(const Eigen::MatrixBase<DerivedA>& new_A,
                           const Eigen::MatrixBase<DerivedL>& new_lb,
                           const Eigen::MatrixBase<DerivedU>& new_ub) {
-    if (new_A.rows() != new_lb.rows() || new_lb.rows() != new_ub.rows() ||
-        new_lb.cols() != 1 || new_ub.cols() != 1) {
-      throw std::runtime_error("New constraints have invalid dimensions");
-    }
-
-    if (new_A.cols() != A_.cols()) {
-      throw std::runtime_error("Can't change the number of decision variables");
-    }
+    CheckNewDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                       new_lb.cols(), new_ub.rows(), new_ub.cols());
+    A_ = new_A;
+    set_num_outputs(A_.rows());
+    set_bounds(new_lb, new_ub);
+  }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p new_A.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_A,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_lb,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_ub) {
+    CheckNewDimensions(new_A.rows(), new_A.cols(), new_lb.rows(),
+                       new_lb.cols(), new_ub.rows(), new_ub.cols());
     A_ = new_A;
     set_num_outputs(A_.rows());
     set_bounds(new_lb, new_ub);
@@ -505,13 +540,26 @@ class LinearConstraint : public Constraint {
   using Constraint::set_bounds;
 
  protected:
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> A_;
+  internal::SparseAndDenseMatrix A_;
 
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd& y) const override;
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
+
+ private:
+  void CheckNewDimensions(int A_rows, int A_cols, int lb_rows, int lb_cols,
+                          int ub_rows, int ub_cols) const {
+    if (A_rows != lb_rows || lb_rows != ub_rows || lb_cols != 1 ||
+        ub_cols != 1) {
+      throw std::runtime_error("New constraints have invalid dimensions");
+    }
+
+    if (A_cols != A_.cols()) {
+      throw std::runtime_error("Can't change the number of decision variables");
+    }
+  }
 };
 
 /**
@@ -526,6 +574,14 @@ class LinearEqualityConstraint : public LinearConstraint {
                            const Eigen::MatrixBase<DerivedB>& beq)
       : LinearConstraint(Aeq, beq, beq) {}
 
+  /**
+   * Constructs the constraint from a sparse matrix Aeq, without ever forming
+   * its dense counterpart.
+   */
+  LinearEqualityConstraint(const Eigen::SparseMatrix<double>& Aeq,
+                           const Eigen::Ref<const Eigen::VectorXd>& beq)
+      : LinearConstraint(Aeq, beq, beq) {}
+
   LinearEqualityConstraint(const Eigen::Ref<const Eigen::RowVectorXd>& a,
                            double beq)
       : LinearEqualityConstraint(a, Vector1d(beq)) {}
@@ -545,6 +601,14 @@ class LinearEqualityConstraint : public LinearConstraint {
     LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
   }
 
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p Aeq.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& Aeq,
+                          const Eigen::Ref<const Eigen::VectorXd>& beq) {
+    LinearConstraint::UpdateCoefficients(Aeq, beq, beq);
+  }
+
  private:
   /**
    * The user should not call this function. Call UpdateCoefficients(Aeq, beq)
@@ -576,8 +640,9 @@ class BoundingBoxConstraint : public LinearConstraint {
   template <typename DerivedLB, typename DerivedUB>
   BoundingBoxConstraint(const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub)
-      : LinearConstraint(Eigen::MatrixXd::Identity(lb.rows(), lb.rows()), lb,
-                         ub) {}
+      : LinearConstraint(Eigen::SparseMatrix<double>(
+                             Eigen::VectorXd::Ones(lb.rows()).asDiagonal()),
+                         lb, ub) {}
 
   ~BoundingBoxConstraint() override {}
 
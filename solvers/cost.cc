@@ -24,16 +24,14 @@ void LinearCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
 void QuadraticCost::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                            Eigen::VectorXd& y) const {
   y.resize(1);
-  y = .5 * x.transpose() * Q_ * x + b_.transpose() * x;
-  y(0) += c_;
+  y(0) = .5 * x.dot(Q_.GetAsSparse() * x) + b_.dot(x) + c_;
 }
 
 void QuadraticCost::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                            AutoDiffVecXd& y) const {
   y.resize(1);
-  y = .5 * x.transpose() * Q_.cast<AutoDiffXd>() * x +
-      b_.cast<AutoDiffXd>().transpose() * x;
-  y(0) += c_;
+  y(0) = .5 * x.dot(internal::SparseMatrixTimesVector(Q_.GetAsSparse(), x)) +
+         b_.cast<AutoDiffXd>().dot(x) + c_;
 }
 
 shared_ptr<QuadraticCost> MakeQuadraticErrorCost(
@@ -10,6 +10,7 @@
 #include <Eigen/SparseCore>
 
 #include "drake/solvers/evaluator_base.h"
+#include "drake/solvers/sparse_and_dense_matrix.h"
 
 namespace drake {
 namespace solvers {
@@ -90,6 +91,11 @@ class LinearCost : public Cost {
 
 /**
  * Implements a cost of the form @f .5 x'Qx + b'x + c @f.
+ *
+ * The matrix Q is stored in the form it is given, sparse or dense. The other
+ * form is only computed, and then cached, when it is first needed. Since the
+ * cost is evaluated through the sparse form of Q, solvers should prefer
+ * get_sparse_Q().
  */
 class QuadraticCost : public Cost {
  public:
@@ -109,10 +115,32 @@ class QuadraticCost : public Cost {
     DRAKE_ASSERT(Q_.cols() == b_.rows());
   }
 
+  /**
+   * Constructs a cost of the form @f .5 x'Qx + b'x + c @f from a sparse
+   * matrix Q, without ever forming its dense counterpart.
+   */
+  QuadraticCost(const Eigen::SparseMatrix<double>& Q,
+                const Eigen::Ref<const Eigen::VectorXd>& b, double c = 0.)
+      : Cost(Q.rows()), Q_(Symmetrize(Q)), b_(b), c_(c) {
+    DRAKE_ASSERT(Q_.rows() == Q_.cols());
+    DRAKE_ASSERT(Q_.cols() == b_.rows());
+  }
+
   ~QuadraticCost() override {}
 
-  /// Returns the symmetric matrix Q, as the Hessian of the cost.
-  const Eigen::MatrixXd& Q() const { return Q_; }
+  /**
+   * Returns the symmetric matrix Q, as the Hessian of the cost. It is computed
+   * on the first call if the cost was constructed from a sparse matrix.
+   */
+  const Eigen::MatrixXd& Q() const { return Q_.GetAsDense(); }
+
+  /**
+   * Returns the symmetric matrix Q in sparse form, which is computed on the
+   * first call if the cost was constructed from a dense matrix.
+   */
+  const Eigen::SparseMatrix<double>& get_sparse_Q() const {
+    return Q_.GetAsSparse();
+  }
 
   const Eigen::VectorXd& b() const { return b_; }
 
@@ -129,28 +157,49 @@ class QuadraticCost : public Cost {
   void UpdateCoefficients(const Eigen::MatrixBase<DerivedQ>& new_Q,
                           const Eigen::MatrixBase<DerivedB>& new_b,
                           double new_c = 0.) {
-    if (new_Q.rows() != new_Q.cols() || new_Q.rows() != new_b.rows() ||
-        new_b.cols() != 1) {
+    CheckNewDimensions(new_Q.rows(), new_Q.cols(), new_b.rows(), new_b.cols());
+    Q_ = (new_Q + new_Q.transpose()) / 2;
+    b_ = new_b;
+    c_ = new_c;
+  }
+
+  /**
+   * Overloads UpdateCoefficients() for a sparse matrix @p new_Q.
+   */
+  void UpdateCoefficients(const Eigen::SparseMatrix<double>& new_Q,
+                          const Eigen::Ref<const Eigen::VectorXd>& new_b,
+                          double new_c = 0.) {
+    CheckNewDimensions(new_Q.rows(), new_Q.cols(), new_b.rows(), new_b.cols());
+    Q_ = Symmetrize(new_Q);
+    b_ = new_b;
+    c_ = new_c;
+  }
+
+ private:
+  static Eigen::SparseMatrix<double> Symmetrize(
+      const Eigen::SparseMatrix<double>& Q) {
+    const Eigen::SparseMatrix<double> Q_transpose = Q.transpose();
+    return 0.5 * (Q + Q_transpose);
+  }
+
+  void CheckNewDimensions(int Q_rows, int Q_cols, int b_rows,
+                          int b_cols) const {
+    if (Q_rows != Q_cols || Q_rows != b_rows || b_cols != 1) {
       throw std::runtime_error("New constraints have invalid dimensions");
     }
 
-    if (new_b.rows() != b_.rows()) {
+    if (b_rows != b_.rows()) {
       throw std::runtime_error("Can't change the number of decision variables");
     }
-
-    Q_ = (new_Q + new_Q.transpose()) / 2;
-    b_ = new_b;
-    c_ = new_c;
   }
 
- private:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd& y) const override;
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd& y) const override;
 
-  Eigen::MatrixXd Q_;
+  internal::SparseAndDenseMatrix Q_;
   Eigen::VectorXd b_;
   double c_{};
 };
@@ -182,6 +231,7 @@ class EvaluatorCost : public Cost {
   explicit EvaluatorCost(const std::shared_ptr<EvaluatorType>& evaluator)
       : Cost(evaluator->num_vars()), evaluator_(evaluator) {
     DRAKE_DEMAND(evaluator->num_outputs() == 1);
+    set_is_thread_safe(evaluator->is_thread_safe());
   }
 
  protected:
@@ -30,8 +30,9 @@ using symbolic::Variables;
 
 using internal::DecomposeLinearExpression;
 using internal::DecomposeQuadraticPolynomial;
-using internal::ExtractAndAppendVariablesFromExpression;
+using internal::DecomposeSparseLinearExpressions;
 using internal::ExtractVariablesFromExpression;
+using internal::IsAffineExpression;
 using internal::SymbolicError;
 
 
@@ -41,48 +42,45 @@ Binding<Constraint> ParseConstraint(
     const Eigen::Ref<const Eigen::VectorXd>& ub) {
   DRAKE_ASSERT(v.rows() == lb.rows() && v.rows() == ub.rows());
 
-  bool is_linear = true;
   // Check that all elements are linear.
   for (int i = 0; i < v.size(); ++i) {
-    if (!v(i).is_polynomial()) {
-      is_linear = false;
-      break;
-    }
-    const Polynomial p{v(i)};
-    if (p.TotalDegree() > 1) {
-      is_linear = false;
-      break;
+    if (!IsAffineExpression(v(i))) {
+      auto constraint = make_shared<ExpressionConstraint>(v, lb, ub);
+      return CreateBinding(constraint, constraint->vars());
     }
-  }
-  if (!is_linear) {
-    auto constraint = make_shared<ExpressionConstraint>(v, lb, ub);
-    return CreateBinding(constraint, constraint->vars());
   }  // else, continue on to linear-specific version below.
 
   if ((ub-lb).isZero()) {
     return ParseLinearEqualityConstraint(v, lb);
   }
 
-  // Setup map_var_to_index and var_vec.
-  // such that map_var_to_index[var(i)] = i
-  unordered_map<Variable::Id, int> map_var_to_index;
-  VectorXDecisionVariable vars(0);
-  for (int i = 0; i < v.size(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
+  // Decompose v = A * vars + constant_terms.
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant_terms;
+  VectorXDecisionVariable vars;
+  DecomposeSparseLinearExpressions(v, &A, &constant_terms, &vars);
+  // For each row of A, count its nonzero coefficients and record the last
+  // one.
+  vector<int> num_row_variables(v.size(), 0);
+  vector<int> row_variable_index(v.size());
+  Eigen::VectorXd row_coeff(v.size());
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      ++num_row_variables[it.row()];
+      row_variable_index[it.row()] = j;
+      row_coeff(it.row()) = it.value();
+    }
   }
 
-  // Construct A, new_lb, new_ub. map_var_to_index is used here.
-  Eigen::MatrixXd A{Eigen::MatrixXd::Zero(v.size(), vars.size())};
+  // Construct new_lb, new_ub.
   Eigen::VectorXd new_lb{v.size()};
   Eigen::VectorXd new_ub{v.size()};
   // We will determine if lb <= v <= ub is a bounding box constraint, namely
   // x_lb <= x <= x_ub.
   bool is_v_bounding_box = true;
   for (int i = 0; i < v.size(); ++i) {
-    double constant_term = 0;
-    int num_vi_variables = DecomposeLinearExpression(v(i), map_var_to_index,
-                                                     A.row(i), &constant_term);
-    if (num_vi_variables == 0 &&
+    const double constant_term = constant_terms(i);
+    if (num_row_variables[i] == 0 &&
         !(lb(i) <= constant_term && constant_term <= ub(i))) {
       // Unsatisfiable constraint with no variables, such as 1 <= 0 <= 2
       throw SymbolicError(v(i), lb(i), ub(i),
@@ -94,7 +92,7 @@ Binding<Constraint> ParseConstraint(
       new_ub(i) = ub(i) - constant_term;
       DRAKE_DEMAND(!std::isnan(new_lb(i)));
       DRAKE_DEMAND(!std::isnan(new_ub(i)));
-      if (num_vi_variables != 1) {
+      if (num_row_variables[i] != 1) {
         is_v_bounding_box = false;
       }
     }
@@ -105,14 +103,8 @@ Binding<Constraint> ParseConstraint(
     VectorXDecisionVariable bounding_box_x(v.size());
     for (int i = 0; i < v.size(); ++i) {
       // v(i) is in the form of c * x
-      double x_coeff = 0;
-      for (const auto& x : v(i).GetVariables()) {
-        const double coeff = A(i, map_var_to_index[x.get_id()]);
-        if (coeff != 0) {
-          x_coeff += coeff;
-          bounding_box_x(i) = x;
-        }
-      }
+      const double x_coeff = row_coeff(i);
+      bounding_box_x(i) = vars(row_variable_index[i]);
       if (x_coeff > 0) {
         new_lb(i) /= x_coeff;
         new_ub(i) /= x_coeff;
@@ -290,15 +282,8 @@ Binding<Constraint> ParseConstraint(const set<Formula>& formulas) {
     }
 
     // Check that elements are linear.
-    if (is_linear) {
-      if (!v(i).is_polynomial()) {
-        is_linear = false;
-      } else {
-        const Polynomial p{v(i)};
-        if (p.TotalDegree() > 1) {
-          is_linear = false;
-        }
-      }
+    if (is_linear && !IsAffineExpression(v(i))) {
+      is_linear = false;
     }
     ++i;
   }
@@ -309,6 +294,33 @@ Binding<Constraint> ParseConstraint(const set<Formula>& formulas) {
   }
 }
 
+void DecomposeRelationalFormula(const Formula& f, Expression* e, double* lb,
+                                double* ub) {
+  if (is_equal_to(f)) {
+    // f := (lhs == rhs)
+    //      (lhs - rhs == 0)
+    *lb = 0.0;
+    *ub = 0.0;
+  } else if (is_less_than_or_equal_to(f)) {
+    // f := (lhs <= rhs)
+    //      (-∞ <= lhs - rhs <= 0)
+    *lb = -numeric_limits<double>::infinity();
+    *ub = 0.0;
+  } else if (is_greater_than_or_equal_to(f)) {
+    // f := (lhs >= rhs)
+    //      (∞ >= lhs - rhs >= 0)
+    *lb = 0.0;
+    *ub = numeric_limits<double>::infinity();
+  } else {
+    ostringstream oss;
+    oss << "ParseConstraint is called with a formula " << f
+        << " which is not a relational formula using one of {==, <=, >=} "
+           "operators.";
+    throw runtime_error(oss.str());
+  }
+  *e = get_lhs_expression(f) - get_rhs_expression(f);
+}
+
 Binding<Constraint> ParseConstraint(const Formula& f) {
   if (is_equal_to(f)) {
     // e1 == e2
@@ -388,19 +400,11 @@ Binding<LinearEqualityConstraint> DoParseLinearEqualityConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& b) {
   DRAKE_DEMAND(v.rows() == b.rows());
-  VectorXDecisionVariable vars(0);
-  unordered_map<Variable::Id, int> map_var_to_index;
-  for (int i = 0; i < v.rows(); ++i) {
-    ExtractAndAppendVariablesFromExpression(v(i), &vars, &map_var_to_index);
-  }
-  // TODO(hongkai.dai): use sparse matrix.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(v.rows(), vars.rows());
-  Eigen::VectorXd beq = Eigen::VectorXd::Zero(v.rows());
-  for (int i = 0; i < v.rows(); ++i) {
-    double constant_term(0);
-    DecomposeLinearExpression(v(i), map_var_to_index, A.row(i), &constant_term);
-    beq(i) = b(i) - constant_term;
-  }
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd constant_terms;
+  VectorXDecisionVariable vars;
+  DecomposeSparseLinearExpressions(v, &A, &constant_terms, &vars);
+  const Eigen::VectorXd beq = b - constant_terms;
   return CreateBinding(make_shared<LinearEqualityConstraint>(A, beq), vars);
 }
 
@@ -54,56 +54,52 @@ Binding<Constraint> ParseConstraint(
     const std::set<symbolic::Formula>& formulas);
 
 /*
- * Assist MathematicalProgram::AddLinearConstraint(...).
+ * Decomposes a relational formula `f` := (e1 ≃ e2), where ≃ is one of {==, <=,
+ * >=}, into lb <= e <= ub with e = e1 - e2, and lb and ub either zero or
+ * infinite.
+ * @throws std::runtime_error if `f` is not such a relational formula.
+ */
+void DecomposeRelationalFormula(const symbolic::Formula& f,
+                                symbolic::Expression* e, double* lb,
+                                double* ub);
+
+/*
+ * Decomposes an array of relational formulas, in column-major order, as by
+ * DecomposeRelationalFormula().
  */
 template <typename Derived>
-typename std::enable_if<is_eigen_scalar_same<Derived, symbolic::Formula>::value,
-                        Binding<Constraint>>::type
-ParseConstraint(const Eigen::ArrayBase<Derived>& formulas) {
+typename std::enable_if<
+    is_eigen_scalar_same<Derived, symbolic::Formula>::value>::type
+DecomposeRelationalFormulas(const Eigen::ArrayBase<Derived>& formulas,
+                            VectorX<symbolic::Expression>* v,
+                            Eigen::VectorXd* lb, Eigen::VectorXd* ub) {
   const auto n = formulas.rows() * formulas.cols();
-
-  // Decomposes 2D-array of formulas into 1D-vector of expression, `v`, and
-  // two 1D-vector of double `lb` and `ub`.
-  constexpr int flat_vector_size{
-      MultiplyEigenSizes<Derived::RowsAtCompileTime,
-                         Derived::ColsAtCompileTime>::value};
-  Eigen::Matrix<symbolic::Expression, flat_vector_size, 1> v{n};
-  Eigen::Matrix<double, flat_vector_size, 1> lb{n};
-  Eigen::Matrix<double, flat_vector_size, 1> ub{n};
+  v->resize(n);
+  lb->resize(n);
+  ub->resize(n);
   int k{0};  // index variable for 1D components.
   for (int j{0}; j < formulas.cols(); ++j) {
     for (int i{0}; i < formulas.rows(); ++i) {
-      const symbolic::Formula& f{formulas(i, j)};
-      if (is_equal_to(f)) {
-        // f(i) := (lhs == rhs)
-        //         (lhs - rhs == 0)
-        v(k) = get_lhs_expression(f) - get_rhs_expression(f);
-        lb(k) = 0.0;
-        ub(k) = 0.0;
-      } else if (is_less_than_or_equal_to(f)) {
-        // f(i) := (lhs <= rhs)
-        //         (-∞ <= lhs - rhs <= 0)
-        v(k) = get_lhs_expression(f) - get_rhs_expression(f);
-        lb(k) = -std::numeric_limits<double>::infinity();
-        ub(k) = 0.0;
-      } else if (is_greater_than_or_equal_to(f)) {
-        // f(i) := (lhs >= rhs)
-        //         (∞ >= lhs - rhs >= 0)
-        v(k) = get_lhs_expression(f) - get_rhs_expression(f);
-        lb(k) = 0.0;
-        ub(k) = std::numeric_limits<double>::infinity();
-      } else {
-        std::ostringstream oss;
-        oss << "ParseConstraint is called with an "
-               "array of formulas which includes a formula "
-            << f
-            << " which is not a relational formula using one of {==, <=, >=} "
-               "operators.";
-        throw std::runtime_error(oss.str());
-      }
+      DecomposeRelationalFormula(formulas(i, j), &(*v)(k), &(*lb)(k),
+                                 &(*ub)(k));
       k++;
     }
   }
+}
+
+/*
+ * Assist MathematicalProgram::AddLinearConstraint(...).
+ */
+template <typename Derived>
+typename std::enable_if<is_eigen_scalar_same<Derived, symbolic::Formula>::value,
+                        Binding<Constraint>>::type
+ParseConstraint(const Eigen::ArrayBase<Derived>& formulas) {
+  // Decomposes 2D-array of formulas into 1D-vector of expression, `v`, and
+  // two 1D-vector of double `lb` and `ub`.
+  VectorX<symbolic::Expression> v;
+  Eigen::VectorXd lb;
+  Eigen::VectorXd ub;
+  DecomposeRelationalFormulas(formulas, &v, &lb, &ub);
   return ParseConstraint(v, lb, ub);
 }
 
@@ -25,56 +25,34 @@ using symbolic::Expression;
 using symbolic::Formula;
 using symbolic::Variable;
 
-using internal::DecomposeLinearExpression;
-using internal::DecomposeQuadraticPolynomial;
-using internal::ExtractAndAppendVariablesFromExpression;
-using internal::ExtractVariablesFromExpression;
+using internal::DecomposeSparseLinearExpressions;
+using internal::DecomposeSparseQuadraticExpression;
+using internal::IsAffineExpression;
+using internal::IsQuadraticExpression;
 using internal::SymbolicError;
 
-namespace {
+Binding<LinearCost> ParseLinearCost(const Expression& e) {
+  Eigen::SparseMatrix<double> a;
+  Eigen::VectorXd constant_term;
+  VectorXDecisionVariable vars_vec;
+  DecomposeSparseLinearExpressions(Vector1<Expression>(e), &a, &constant_term,
+                                   &vars_vec);
+  return CreateBinding(make_shared<LinearCost>(Eigen::VectorXd(a.transpose()),
+                                               constant_term(0)),
+                       vars_vec);
+}
 
-Binding<QuadraticCost> DoParseQuadraticCost(
-    const symbolic::Polynomial& poly, const VectorXDecisionVariable& vars_vec,
-    const unordered_map<Variable::Id, int>& map_var_to_index) {
+Binding<QuadraticCost> ParseQuadraticCost(const Expression& e) {
   // We want to write the expression e in the form 0.5 * x' * Q * x + b' * x + c
-  // TODO(hongkai.dai): use a sparse matrix to represent Q and b.
-  Eigen::MatrixXd Q(vars_vec.size(), vars_vec.size());
-  Eigen::VectorXd b(vars_vec.size());
+  Eigen::SparseMatrix<double> Q;
+  Eigen::VectorXd b;
   double constant_term;
-  DecomposeQuadraticPolynomial(poly, map_var_to_index, &Q, &b, &constant_term);
+  VectorXDecisionVariable vars_vec;
+  DecomposeSparseQuadraticExpression(e, &Q, &b, &constant_term, &vars_vec);
   return CreateBinding(make_shared<QuadraticCost>(Q, b, constant_term),
                        vars_vec);
 }
 
-Binding<LinearCost> DoParseLinearCost(
-    const Expression &e,
-    const VectorXDecisionVariable& vars_vec,
-    const unordered_map<Variable::Id, int>& map_var_to_index) {
-  Eigen::RowVectorXd c(vars_vec.size());
-  double constant_term{};
-  DecomposeLinearExpression(e, map_var_to_index, c, &constant_term);
-  return CreateBinding(make_shared<LinearCost>(c.transpose(), constant_term),
-                       vars_vec);
-}
-
-}  // anonymous namespace
-
-Binding<LinearCost> ParseLinearCost(const Expression& e) {
-  auto p = ExtractVariablesFromExpression(e);
-  return DoParseLinearCost(e, p.first, p.second);
-}
-
-Binding<QuadraticCost> ParseQuadraticCost(const Expression& e) {
-  // First build an Eigen vector, that contains all the bound variables.
-  auto p = ExtractVariablesFromExpression(e);
-  const auto& vars_vec = p.first;
-  const auto& map_var_to_index = p.second;
-
-  // Now decomposes the expression into coefficients and monomials.
-  const symbolic::Polynomial poly{e};
-  return DoParseQuadraticCost(poly, vars_vec, map_var_to_index);
-}
-
 Binding<PolynomialCost> ParsePolynomialCost(const symbolic::Expression& e) {
   if (!e.is_polynomial()) {
     ostringstream oss;
@@ -105,18 +83,12 @@ Binding<Cost> ParseCost(const symbolic::Expression& e) {
         << " support non-polynomial expression.\n";
     throw runtime_error(oss.str());
   }
-  const symbolic::Polynomial poly{e};
-  const int total_degree{poly.TotalDegree()};
-  auto e_extracted = ExtractVariablesFromExpression(e);
-  const VectorXDecisionVariable& vars_vec = e_extracted.first;
-  const auto& map_var_to_index = e_extracted.second;
-
-  if (total_degree > 2) {
-    return ParsePolynomialCost(e);
-  } else if (total_degree == 2) {
-    return DoParseQuadraticCost(poly, vars_vec, map_var_to_index);
+  if (IsAffineExpression(e)) {
+    return ParseLinearCost(e);
+  } else if (IsQuadraticExpression(e)) {
+    return ParseQuadraticCost(e);
   } else {
-    return DoParseLinearCost(e, vars_vec, map_var_to_index);
+    return ParsePolynomialCost(e);
   }
 }
 
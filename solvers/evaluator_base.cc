@@ -1,5 +1,9 @@
 #include "drake/solvers/evaluator_base.h"
 
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
 using std::make_shared;
 using std::shared_ptr;
 using Eigen::MatrixXd;
@@ -8,6 +12,23 @@ using Eigen::VectorXd;
 namespace drake {
 namespace solvers {
 
+void EvaluatorBase::SetGradientSparsityPattern(
+    const std::vector<std::pair<int, int>>& gradient_sparsity_pattern) {
+  std::set<std::pair<int, int>> entries;
+  for (const auto& entry : gradient_sparsity_pattern) {
+    if (entry.first < 0 || entry.first >= num_outputs_ || entry.second < 0 ||
+        (num_vars_ != Eigen::Dynamic && entry.second >= num_vars_)) {
+      throw std::runtime_error(
+          "The gradient sparsity pattern has an out of range entry.");
+    }
+    if (!entries.insert(entry).second) {
+      throw std::runtime_error(
+          "The gradient sparsity pattern has a repeated entry.");
+    }
+  }
+  gradient_sparsity_pattern_ = gradient_sparsity_pattern;
+}
+
 void PolynomialEvaluator::DoEval(const Eigen::Ref<const Eigen::VectorXd> &x,
                                  Eigen::VectorXd &y) const {
   double_evaluation_point_temp_.clear();
@@ -32,5 +53,95 @@ void PolynomialEvaluator::DoEval(const Eigen::Ref<const AutoDiffVecXd> &x,
   }
 }
 
+namespace internal {
+std::vector<std::pair<int, int>> GetGradientEntries(
+    const EvaluatorBase& evaluator, int num_vars) {
+  if (evaluator.gradient_sparsity_pattern()) {
+    return *evaluator.gradient_sparsity_pattern();
+  }
+  std::vector<std::pair<int, int>> entries;
+  entries.reserve(evaluator.num_outputs() * num_vars);
+  for (int i = 0; i < evaluator.num_outputs(); ++i) {
+    for (int j = 0; j < num_vars; ++j) {
+      entries.emplace_back(i, j);
+    }
+  }
+  return entries;
+}
+
+int GetNumGradientEntries(const EvaluatorBase& evaluator, int num_vars) {
+  if (evaluator.gradient_sparsity_pattern()) {
+    return static_cast<int>(evaluator.gradient_sparsity_pattern()->size());
+  }
+  return evaluator.num_outputs() * num_vars;
+}
+
+int EvalWithGradient(const EvaluatorBase& evaluator,
+                     const Eigen::Ref<const Eigen::VectorXd>& x,
+                     Eigen::VectorXd* y, double* gradient) {
+  DRAKE_ASSERT(y != nullptr);
+  AutoDiffVecXd ty(evaluator.num_outputs());
+  const auto& pattern = evaluator.gradient_sparsity_pattern();
+  if (!pattern) {
+    evaluator.Eval(math::initializeAutoDiff(x), ty);
+    *y = math::autoDiffToValueMatrix(ty);
+    for (int i = 0; i < ty.size(); ++i) {
+      const Eigen::VectorXd& derivatives = ty(i).derivatives();
+      for (int j = 0; j < x.size(); ++j) {
+        *(gradient++) = derivatives.size() > 0 ? derivatives(j) : 0;
+      }
+    }
+    return ty.size() * x.size();
+  }
+
+  // Assigns a derivative slot to each input that appears in the pattern.
+  // Inputs that no output depends on jointly share a slot, since each output
+  // then takes the derivative in that slot from only one of them. The slots
+  // are assigned greedily, in input order.
+  std::vector<std::vector<int>> input_rows(x.size());
+  for (const auto& entry : *pattern) {
+    DRAKE_ASSERT(entry.second < x.size());
+    input_rows[entry.second].push_back(entry.first);
+  }
+  std::vector<int> slots(x.size(), -1);
+  // slot_rows[s][i] is true if output i depends on an input in slot s.
+  std::vector<std::vector<bool>> slot_rows;
+  for (int j = 0; j < x.size(); ++j) {
+    if (input_rows[j].empty()) continue;
+    int slot = 0;
+    for (; slot < static_cast<int>(slot_rows.size()); ++slot) {
+      if (std::none_of(input_rows[j].begin(), input_rows[j].end(),
+                       [&](int i) { return slot_rows[slot][i]; })) {
+        break;
+      }
+    }
+    if (slot == static_cast<int>(slot_rows.size())) {
+      slot_rows.emplace_back(evaluator.num_outputs(), false);
+    }
+    for (int i : input_rows[j]) {
+      slot_rows[slot][i] = true;
+    }
+    slots[j] = slot;
+  }
+  const int num_slots = static_cast<int>(slot_rows.size());
+  AutoDiffVecXd tx(x.size());
+  for (int j = 0; j < x.size(); ++j) {
+    tx(j).value() = x(j);
+    tx(j).derivatives() = Eigen::VectorXd::Zero(num_slots);
+    if (slots[j] >= 0) {
+      tx(j).derivatives()(slots[j]) = 1;
+    }
+  }
+  evaluator.Eval(tx, ty);
+  *y = math::autoDiffToValueMatrix(ty);
+  for (const auto& entry : *pattern) {
+    const Eigen::VectorXd& derivatives = ty(entry.first).derivatives();
+    *(gradient++) =
+        derivatives.size() > 0 ? derivatives(slots[entry.second]) : 0;
+  }
+  return static_cast<int>(pattern->size());
+}
+}  // namespace internal
+
 }  // namespace solvers
 }  // namespace drake
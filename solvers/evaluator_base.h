@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -10,6 +11,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/math/autodiff.h"
@@ -85,6 +87,35 @@ class EvaluatorBase {
    */
   int num_outputs() const { return num_outputs_; }
 
+  /**
+   * Returns the entries of the gradient of the outputs with respect to the
+   * inputs that may be nonzero, as (output index, input index) pairs, or
+   * nullopt if the gradient is dense, which is the default.
+   * @see SetGradientSparsityPattern()
+   */
+  const optional<std::vector<std::pair<int, int>>>& gradient_sparsity_pattern()
+      const {
+    return gradient_sparsity_pattern_;
+  }
+
+  /**
+   * Returns true if Eval() may be called concurrently from several threads,
+   * which is the default. Solvers that evaluate the bindings of a program in
+   * parallel, such as SnoptSolver and IpoptSolver, evaluate the evaluators
+   * that are not thread-safe sequentially, on the calling thread.
+   */
+  bool is_thread_safe() const { return is_thread_safe_; }
+
+  /**
+   * Declares whether Eval() may be called concurrently from several threads.
+   * Evaluators whose DoEval() writes to shared state, such as a mutable
+   * scratch member or a cache shared with other evaluators, must be declared
+   * not thread-safe.
+   */
+  void set_is_thread_safe(bool is_thread_safe) {
+    is_thread_safe_ = is_thread_safe;
+  }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -129,12 +160,59 @@ class EvaluatorBase {
   // matrix in the linear constraint is resized.
   void set_num_outputs(int num_outputs) { num_outputs_ = num_outputs; }
 
+  /**
+   * Declares the entries of the gradient of the outputs with respect to the
+   * inputs that may be nonzero, as (output index, input index) pairs. Solvers
+   * then only store and evaluate these entries, and seed the inputs that
+   * appear in the pattern with as few derivatives as the pattern allows (see
+   * internal::EvalWithGradient()).
+   * The gradient entries that are not in the pattern must be zero for all
+   * inputs; they are discarded otherwise.
+   * @throws std::runtime_error if an entry is out of range or is repeated.
+   */
+  void SetGradientSparsityPattern(
+      const std::vector<std::pair<int, int>>& gradient_sparsity_pattern);
+
  private:
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  optional<std::vector<std::pair<int, int>>> gradient_sparsity_pattern_;
+  bool is_thread_safe_{true};
 };
 
+namespace internal {
+/*
+ * Returns the entries of the gradient of `evaluator`, bound to `num_vars`
+ * variables, that solvers should treat as nonzero, as (output index, input
+ * index) pairs: its gradient_sparsity_pattern() if it has one, or else all the
+ * entries in row-major order.
+ */
+std::vector<std::pair<int, int>> GetGradientEntries(
+    const EvaluatorBase& evaluator, int num_vars);
+
+/*
+ * Returns GetGradientEntries(evaluator, num_vars).size(), without allocating.
+ */
+int GetNumGradientEntries(const EvaluatorBase& evaluator, int num_vars);
+
+/*
+ * Evaluates `evaluator` at `x` with a scalar type of AutoDiffXd, writing its
+ * outputs to `y` and the values of the gradient entries returned by
+ * GetGradientEntries() to `gradient`, in the same order. When the evaluator
+ * has a gradient sparsity pattern, only the inputs that appear in it are
+ * seeded with derivatives, and inputs on which no output depends jointly share
+ * a derivative, so that the size of the derivative vectors can be much smaller
+ * than x.size(). For example, inputs that each affect a different output
+ * share a single derivative.
+ * @param[out] gradient An array of GetGradientEntries().size() values.
+ * @return The number of values written to `gradient`.
+ */
+int EvalWithGradient(const EvaluatorBase& evaluator,
+                     const Eigen::Ref<const Eigen::VectorXd>& x,
+                     Eigen::VectorXd* y, double* gradient);
+}  // namespace internal
+
 /**
  * Implements an evaluator of the form P(x, y...) where P is a multivariate
  * polynomial in x, y, ...
@@ -158,7 +236,10 @@ class PolynomialEvaluator : public EvaluatorBase {
                       const std::vector<Polynomiald::VarType>& poly_vars)
       : EvaluatorBase(polynomials.rows(), poly_vars.size()),
         polynomials_(polynomials),
-        poly_vars_(poly_vars) {}
+        poly_vars_(poly_vars) {
+    // DoEval() writes to the evaluation point members below.
+    set_is_thread_safe(false);
+  }
 
   const VectorXPoly& polynomials() const { return polynomials_; }
 
@@ -178,7 +259,6 @@ class PolynomialEvaluator : public EvaluatorBase {
 
   // To avoid repeated allocation, reuse a map for the evaluation point.
   // Do not assume that these values will persist across invocations!
-  // TODO(eric.cousineau): Consider removing this for thread safety?
   mutable std::map<Polynomiald::VarType, double> double_evaluation_point_temp_;
   mutable std::map<Polynomiald::VarType, AutoDiffXd>
       taylor_evaluation_point_temp_;
@@ -201,26 +201,27 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
  * @return error as an integer. The full set of error values are
  * described here :
  * https://www.gurobi.com/documentation/7.5/refman/error_codes.html
- *
- * TODO(hongkai.dai): Use a sparse matrix A.
  */
-template <typename DerivedA, typename DerivedLB, typename DerivedUB>
+template <typename DerivedLB, typename DerivedUB>
 int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::MatrixBase<DerivedA>& A,
+                        const Eigen::SparseMatrix<double>& A,
                         const Eigen::MatrixBase<DerivedLB>& lb,
                         const Eigen::MatrixBase<DerivedUB>& ub,
                         const Eigen::Ref<const VectorXDecisionVariable>& vars,
                         bool is_equality, double sparseness_threshold) {
+  // Gurobi adds the constraints row by row.
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
+  const std::vector<int> var_indices = prog.FindDecisionVariableIndices(vars);
+  std::vector<int> nonzero_var_index(A.cols(), 0);
+  std::vector<double> nonzero_coeff(A.cols(), 0.0);
   for (int i = 0; i < A.rows(); i++) {
     int nonzero_coeff_count = 0;
-    std::vector<int> nonzero_var_index(A.cols(), 0);
-    std::vector<double> nonzero_coeff(A.cols(), 0.0);
-
-    for (int j = 0; j < A.cols(); j++) {
-      if (std::abs(A(i, j)) > sparseness_threshold) {
-        nonzero_coeff[nonzero_coeff_count] = A(i, j);
-        nonzero_var_index[nonzero_coeff_count++] =
-            prog.FindDecisionVariableIndex(vars(j));
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+             A_row_major, i);
+         it; ++it) {
+      if (std::abs(it.value()) > sparseness_threshold) {
+        nonzero_coeff[nonzero_coeff_count] = it.value();
+        nonzero_var_index[nonzero_coeff_count++] = var_indices[it.col()];
       }
     }
     // The sense of the constraint could be ==, <= or >=
@@ -397,7 +398,8 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
   for (const auto& binding : prog.quadratic_costs()) {
     const auto& constraint = binding.evaluator();
     const int constraint_variable_dimension = binding.GetNumElements();
-    const Eigen::MatrixXd& Q = constraint->Q();
+    // Q is symmetric.
+    const Eigen::SparseMatrix<double>& Q = constraint->get_sparse_Q();
     const Eigen::VectorXd& b = constraint->b();
     constant_cost += constraint->c();
 
@@ -412,17 +414,15 @@ int AddCosts(GRBmodel* model, double* pconstant_cost,
           prog.FindDecisionVariableIndex(binding.variables()(i));
     }
 
-    for (int i = 0; i < Q.rows(); i++) {
-      const double Qii = 0.5 * Q(i, i);
-      if (abs(Qii) > sparseness_threshold) {
-        Q_nonzero_coefs.push_back(Eigen::Triplet<double>(
-            constraint_variable_index[i], constraint_variable_index[i], Qii));
-      }
-      for (int j = i + 1; j < Q.cols(); j++) {
-        const double Qij = 0.5 * (Q(i, j) + Q(j, i));
+    // Adds the upper triangular part of Q.
+    for (int j = 0; j < Q.outerSize(); j++) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Q, j); it; ++it) {
+        if (it.row() > j) continue;
+        const double Qij = it.row() == j ? 0.5 * it.value() : it.value();
         if (abs(Qij) > sparseness_threshold) {
-          Q_nonzero_coefs.push_back(Eigen::Triplet<double>(
-              constraint_variable_index[i], constraint_variable_index[j], Qij));
+          Q_nonzero_coefs.push_back(
+              Eigen::Triplet<double>(constraint_variable_index[it.row()],
+                                     constraint_variable_index[j], Qij));
         }
       }
     }
@@ -502,7 +502,7 @@ int ProcessLinearConstraints(GRBmodel* model, MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), true,
         sparseness_threshold);
     if (error) {
@@ -514,7 +514,7 @@ int ProcessLinearConstraints(GRBmodel* model, MathematicalProgram& prog,
     const auto& constraint = binding.evaluator();
 
     const int error = AddLinearConstraint(
-        prog, model, constraint->A(), constraint->lower_bound(),
+        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
         constraint->upper_bound(), binding.variables(), false,
         sparseness_threshold);
     if (error) {
@@ -600,6 +600,28 @@ void AddSecondOrderConeVariables(
     }
   }
 }
+
+// The Gurobi environment used to solve a MathematicalProgram, together with
+// the simplex basis of its last solve.
+//
+// Loading an environment checks out a license, which can take longer than
+// solving a small program, so the environment is loaded once per program.
+// When a continuous LP or QP is solved again with the same number of variables
+// and constraints, e.g. after its bounds or linear cost changed, the simplex
+// starts from the basis of the previous solve.
+struct GurobiSolverData : public MathematicalProgram::SolverData {
+  ~GurobiSolverData() override {
+    if (env != nullptr) {
+      GRBfreeenv(env);
+    }
+  }
+
+  GRBenv* env{nullptr};
+  // The basis status of each variable and of each linear constraint, or empty
+  // if the last solve did not produce a basis.
+  std::vector<int> vbasis;
+  std::vector<int> cbasis;
+};
 }  // anonymous namespace
 
 bool GurobiSolver::available() const { return true; }
@@ -608,8 +630,11 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
   // We only process quadratic costs and linear / bounding box
   // constraints.
 
-  GRBenv* env = nullptr;
-  GRBloadenv(&env, nullptr);
+  auto solver_data = prog.GetSolverData<GurobiSolverData>();
+  if (solver_data->env == nullptr) {
+    GRBloadenv(&solver_data->env, nullptr);
+  }
+  GRBenv* env = solver_data->env;
 
   DRAKE_ASSERT(prog.generic_costs().empty());
   DRAKE_ASSERT(prog.generic_constraints().empty());
@@ -746,6 +771,27 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
 
   GRBupdatemodel(model);
 
+  // The simplex basis is only defined for continuous programs without
+  // quadratic constraints.
+  const bool has_basis = !is_mip && prog.lorentz_cone_constraints().empty() &&
+                         prog.rotated_lorentz_cone_constraints().empty();
+  int num_gurobi_constraints = 0;
+  GRBgetintattr(model, GRB_INT_ATTR_NUMCONSTRS, &num_gurobi_constraints);
+  if (has_basis && !solver_data->vbasis.empty() &&
+      static_cast<int>(solver_data->vbasis.size()) == num_gurobi_vars &&
+      static_cast<int>(solver_data->cbasis.size()) == num_gurobi_constraints) {
+    error = GRBsetintattrarray(model, GRB_INT_ATTR_VBASIS, 0, num_gurobi_vars,
+                               solver_data->vbasis.data());
+    if (!error && num_gurobi_constraints > 0) {
+      error = GRBsetintattrarray(model, GRB_INT_ATTR_CBASIS, 0,
+                                 num_gurobi_constraints,
+                                 solver_data->cbasis.data());
+    }
+    DRAKE_DEMAND(!error);
+  }
+  solver_data->vbasis.clear();
+  solver_data->cbasis.clear();
+
   // If we have been supplied a callback,
   // register it with Gurobi.
   // We initialize callback_info outside of the if() scope
@@ -779,6 +825,15 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
     int optimstatus = 0;
     GRBgetintattr(model, GRB_INT_ATTR_STATUS, &optimstatus);
 
+    // Gurobi counts the simplex and the barrier iterations separately; for
+    // mixed-integer programs, these are summed over all the nodes explored.
+    double simplex_iterations = 0;
+    int barrier_iterations = 0;
+    GRBgetdblattr(model, GRB_DBL_ATTR_ITERCOUNT, &simplex_iterations);
+    GRBgetintattr(model, GRB_INT_ATTR_BARITERCOUNT, &barrier_iterations);
+    solver_result.set_num_iterations(static_cast<int>(simplex_iterations) +
+                                     barrier_iterations);
+
     if (optimstatus != GRB_OPTIMAL && optimstatus != GRB_SUBOPTIMAL) {
       switch (optimstatus) {
         case GRB_INF_OR_UNBD: {
@@ -826,6 +881,25 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
       // Provide Gurobi's computed cost in addition to the constant cost.
       solver_result.set_optimal_cost(optimal_cost + constant_cost);
 
+      // Keep the basis for the next solve. There is none if the barrier
+      // method finished without crossover.
+      if (has_basis) {
+        solver_data->vbasis.resize(num_gurobi_vars);
+        solver_data->cbasis.resize(num_gurobi_constraints);
+        const bool has_vbasis =
+            GRBgetintattrarray(model, GRB_INT_ATTR_VBASIS, 0, num_gurobi_vars,
+                               solver_data->vbasis.data()) == 0;
+        const bool has_cbasis =
+            num_gurobi_constraints == 0 ||
+            GRBgetintattrarray(model, GRB_INT_ATTR_CBASIS, 0,
+                               num_gurobi_constraints,
+                               solver_data->cbasis.data()) == 0;
+        if (!has_vbasis || !has_cbasis) {
+          solver_data->vbasis.clear();
+          solver_data->cbasis.clear();
+        }
+      }
+
       if (is_mip) {
         // If the problem is a mixed-integer optimization program, provide
         // Gurobi's lower bound.
@@ -844,7 +918,6 @@ SolutionResult GurobiSolver::Solve(MathematicalProgram& prog) const {
   prog.SetSolverResult(solver_result);
 
   GRBfreemodel(model);
-  GRBfreeenv(env);
 
   return solution_result;
 }
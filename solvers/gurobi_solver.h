@@ -11,6 +11,16 @@
 namespace drake {
 namespace solvers {
 
+/// Solves linear, quadratic, second-order cone and mixed-integer programs with
+/// Gurobi.
+///
+/// The Gurobi environment is loaded on the first solve of a
+/// MathematicalProgram and stored with it, so that the license is checked out
+/// once per program. When a continuous program without second-order cone
+/// constraints is solved again with the same number of variables and
+/// constraints, e.g. after Constraint::UpdateLowerBound() or
+/// LinearCost::UpdateCoefficients(), the simplex starts from the basis of the
+/// previous solve. The model itself is built from scratch on every solve.
 class GurobiSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GurobiSolver)
@@ -3,10 +3,14 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <IpIpoptApplication.hpp>
+#include <IpIpoptData.hpp>
 #include <IpTNLP.hpp>
 
 #include "drake/common/drake_assert.h"
@@ -15,6 +19,7 @@
 #include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/parallel_evaluation.h"
 
 using Ipopt::Index;
 using Ipopt::IpoptCalculatedQuantities;
@@ -43,7 +48,7 @@ int GetConstraintBounds(const Constraint& c, Number* lb, Number* ub) {
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  *num_grad = internal::GetNumGradientEntries(c, var_count);
   return num_constraints;
 }
 
@@ -63,15 +68,13 @@ size_t GetGradientMatrix(
     const MathematicalProgram& prog, const Constraint& c,
     const Eigen::Ref<const VectorXDecisionVariable>& variables,
     Index constraint_idx, Index* iRow, Index* jCol) {
-  const int m = c.num_constraints();
   size_t grad_index = 0;
 
-  for (int i = 0; i < static_cast<int>(m); ++i) {
-    for (int j = 0; j < variables.rows(); ++j) {
-      iRow[grad_index] = constraint_idx + i;
-      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
-      grad_index++;
-    }
+  for (const auto& entry :
+       internal::GetGradientEntries(c, variables.rows())) {
+    iRow[grad_index] = constraint_idx + entry.first;
+    jCol[grad_index] = prog.FindDecisionVariableIndex(variables(entry.second));
+    grad_index++;
   }
 
   return grad_index;
@@ -108,26 +111,42 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
   }
 
-  AutoDiffVecXd ty(c.num_constraints());
-  c.Eval(math::initializeAutoDiff(this_x), ty);
+  // Only the entries of the gradient in the sparsity pattern of the
+  // constraint, if any, are evaluated.
+  Eigen::VectorXd ty(c.num_constraints());
+  const size_t grad_idx = internal::EvalWithGradient(c, this_x, &ty, grad);
 
   // Store the results.  Since IPOPT directly knows the bounds of the
   // constraint, we don't need to apply any bounding information here.
   for (int i = 0; i < c.num_constraints(); i++) {
-    result[i] = ty(i).value();
+    result[i] = ty(i);
   }
 
-  // Extract the appropriate derivatives from our result into the
-  // gradient array.
-  size_t grad_idx = 0;
+  return grad_idx;
+}
 
-  for (int i = 0; i < c.num_constraints(); i++) {
-    for (int j = 0; j < variables.rows(); j++) {
-      grad[grad_idx++] = ty(i).derivatives()(j);
-    }
-  }
+// A constraint binding evaluated by IpoptSolver_NLP::EvaluateConstraints(),
+// with the locations of its values and gradient entries in the constraint
+// cache.
+struct ConstraintEvaluation {
+  const Constraint* constraint;
+  const VectorXDecisionVariable* variables;
+  Number* result;
+  Number* grad;
+};
 
-  return grad_idx;
+/// Appends the bindings of @p constraint_list to @p evaluations, and advances
+/// @p result and @p grad past their values and gradient entries.
+template <typename C>
+void AppendConstraintEvaluations(
+    const std::vector<Binding<C>>& constraint_list, Number** result,
+    Number** grad, std::vector<ConstraintEvaluation>* evaluations) {
+  for (const auto& binding : constraint_list) {
+    const Constraint& c = *binding.evaluator();
+    evaluations->push_back({&c, &binding.variables(), *result, *grad});
+    *result += c.num_constraints();
+    *grad += internal::GetNumGradientEntries(c, binding.variables().rows());
+  }
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.
@@ -161,8 +180,13 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(MathematicalProgram* problem)
-      : problem_(problem), result_(SolutionResult::kUnknownError) {}
+  // The costs and constraints are evaluated on the threads of `thread_pool`,
+  // or sequentially if it is nullptr.
+  IpoptSolver_NLP(MathematicalProgram* problem,
+                  drake::internal::ThreadPool* thread_pool)
+      : problem_(problem),
+        thread_pool_(thread_pool),
+        result_(SolutionResult::kUnknownError) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -384,9 +408,12 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
                                  const Number* g, const Number* lambda,
                                  Number obj_value, const IpoptData* ip_data,
                                  IpoptCalculatedQuantities* ip_cq) {
-    unused(z_L, z_U, m, g, lambda, ip_data, ip_cq);
+    unused(z_L, z_U, m, g, lambda, ip_cq);
 
     SolverResult solver_result(IpoptSolver::id());
+    if (ip_data != nullptr) {
+      solver_result.set_num_iterations(ip_data->iter_count());
+    }
 
     switch (status) {
       case Ipopt::SUCCESS: {
@@ -433,29 +460,49 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
-    Eigen::VectorXd this_x;
-
     memcpy(cost_cache_->x.data(), x, n * sizeof(Number));
     cost_cache_->result[0] = 0;
     cost_cache_->grad.assign(n, 0);
 
-    for (auto const& binding : problem_->GetAllCosts()) {
+    const std::vector<Binding<Cost>> costs = problem_->GetAllCosts();
+    auto evaluate = [this, &xvec, &costs](int k, AutoDiffVecXd* ty) {
+      const auto& binding = costs[k];
       int num_v_variables = binding.GetNumElements();
-      this_x.resize(num_v_variables);
+      Eigen::VectorXd this_x(num_v_variables);
       for (int i = 0; i < num_v_variables; ++i) {
         this_x(i) =
             xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
       }
+      binding.evaluator()->Eval(math::initializeAutoDiff(this_x), *ty);
+    };
+
+    // Without a thread pool, each cost is evaluated into ty[0] just before it
+    // is summed; otherwise they are all evaluated beforehand, and summed in
+    // the same order.
+    const int num_costs = static_cast<int>(costs.size());
+    std::vector<AutoDiffVecXd> ty(thread_pool_ == nullptr ? 1 : num_costs,
+                                  AutoDiffVecXd(1));
+    if (thread_pool_ != nullptr) {
+      internal::EvaluateInParallel(
+          num_costs, thread_pool_,
+          [&costs](int k) { return costs[k].evaluator()->is_thread_safe(); },
+          [&evaluate, &ty](int k) { evaluate(k, &ty[k]); });
+    }
 
-      binding.evaluator()->Eval(math::initializeAutoDiff(this_x), ty);
+    for (int k = 0; k < num_costs; ++k) {
+      const auto& binding = costs[k];
+      const AutoDiffVecXd& ty_k = thread_pool_ == nullptr ? ty[0] : ty[k];
+      if (thread_pool_ == nullptr) {
+        evaluate(k, &ty[0]);
+      }
 
-      cost_cache_->result[0] += ty(0).value();
+      cost_cache_->result[0] += ty_k(0).value();
 
+      int num_v_variables = binding.GetNumElements();
       for (int j = 0; j < num_v_variables; ++j) {
         const size_t vj_index =
             problem_->FindDecisionVariableIndex(binding.variables()(j));
-        cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
+        cost_cache_->grad[vj_index] += ty_k(0).derivatives()(j);
       }
     }
   }
@@ -467,34 +514,38 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = constraint_cache_->grad.data();
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
+    // The locations of the values and gradient entries of each constraint
+    // are computed beforehand, so that the constraints can be evaluated in
+    // any order.
+    std::vector<ConstraintEvaluation> evaluations;
+    AppendConstraintEvaluations(problem_->generic_constraints(), &result,
+                                &grad, &evaluations);
+    AppendConstraintEvaluations(problem_->lorentz_cone_constraints(), &result,
+                                &grad, &evaluations);
+    AppendConstraintEvaluations(problem_->rotated_lorentz_cone_constraints(),
+                                &result, &grad, &evaluations);
+    AppendConstraintEvaluations(problem_->linear_constraints(), &result,
+                                &grad, &evaluations);
+    AppendConstraintEvaluations(problem_->linear_equality_constraints(),
+                                &result, &grad, &evaluations);
+    DRAKE_ASSERT(grad == constraint_cache_->grad.data() +
+                             constraint_cache_->grad.size());
+
+    internal::EvaluateInParallel(
+        static_cast<int>(evaluations.size()), thread_pool_,
+        [&evaluations](int k) {
+          return evaluations[k].constraint->is_thread_safe();
+        },
+        [this, &xvec, &evaluations](int k) {
+          const ConstraintEvaluation& evaluation = evaluations[k];
+          EvaluateConstraint(*problem_, xvec, *evaluation.constraint,
+                             *evaluation.variables, evaluation.result,
+                             evaluation.grad);
+        });
   }
 
   MathematicalProgram* const problem_;
+  drake::internal::ThreadPool* const thread_pool_;
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   SolutionResult result_;
@@ -526,7 +577,13 @@ SolutionResult IpoptSolver::Solve(MathematicalProgram& prog) const {
     app->Options()->SetNumericValue(it.first, it.second);
   }
 
-  for (const auto& it : prog.GetSolverOptionsInt(id())) {
+  // The number of threads is a Drake option rather than an IPOPT one, so it
+  // is not passed on to IPOPT. The threads are created once and reused at
+  // each iterate.
+  std::map<std::string, int> int_options = prog.GetSolverOptionsInt(id());
+  const std::unique_ptr<drake::internal::ThreadPool> thread_pool =
+      internal::TakeMaxNumThreadsOption("IpoptSolver", &int_options);
+  for (const auto& it : int_options) {
     app->Options()->SetIntegerValue(it.first, it.second);
   }
 
@@ -539,7 +596,8 @@ SolutionResult IpoptSolver::Solve(MathematicalProgram& prog) const {
     return SolutionResult::kInvalidInput;
   }
 
-  Ipopt::SmartPtr<IpoptSolver_NLP> nlp = new IpoptSolver_NLP(&prog);
+  Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
+      new IpoptSolver_NLP(&prog, thread_pool.get());
   status = app->OptimizeTNLP(nlp);
 
   return nlp->result();
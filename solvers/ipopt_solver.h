@@ -8,6 +8,23 @@
 namespace drake {
 namespace solvers {
 
+/**
+ * Solve() evaluates the costs and the nonlinear constraints of the program in
+ * parallel when the int solver option "max_num_threads" is more than one, e.g.
+ * @code
+ *   prog.SetSolverOption(IpoptSolver::id(), "max_num_threads", 4);
+ * @endcode
+ * It is the maximum number of threads, the calling thread included, on which
+ * they are evaluated at each iterate, and is not passed on to the solver
+ * itself. The default is 1, which evaluates them sequentially. The threads are
+ * created once per Solve() and reused at each iterate. The bindings of each
+ * kind of constraint, e.g. the per-knot dynamics constraints of a trajectory
+ * optimization, are split into contiguous chunks, one per thread, and the
+ * costs are summed in the order of the bindings, so that the result does not
+ * depend on the number of threads. The evaluators that are not thread-safe,
+ * see EvaluatorBase::is_thread_safe(), are evaluated on the calling thread.
+ * Solve() throws std::runtime_error if the option is less than one.
+ */
 class IpoptSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IpoptSolver)
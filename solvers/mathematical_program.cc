@@ -113,6 +113,55 @@ AttributesSet kSnoptCapabilities =
 bool is_satisfied(AttributesSet required, AttributesSet available) {
   return ((required & ~available) == kNoCapabilities);
 }
+
+// Returns true if one of `vars` is in `parameters_index`.
+bool ContainsParameter(const Variables& vars,
+                       const internal::ParameterIndex& parameters_index) {
+  for (const Variable& var : vars) {
+    if (parameters_index.count(var.get_id()) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Decomposes a relational formula, or a conjunction of relational formulas,
+// into lb <= v <= ub.
+void DecomposeFormula(const Formula& f, VectorX<Expression>* v,
+                      Eigen::VectorXd* lb, Eigen::VectorXd* ub) {
+  const set<Formula> formulas =
+      is_conjunction(f) ? get_operands(f) : set<Formula>{f};
+  v->resize(formulas.size());
+  lb->resize(formulas.size());
+  ub->resize(formulas.size());
+  int i = 0;
+  for (const Formula& formula : formulas) {
+    internal::DecomposeRelationalFormula(formula, &(*v)(i), &(*lb)(i),
+                                         &(*ub)(i));
+    ++i;
+  }
+}
+
+// Maps the evaluators of a program to their copies in a clone of the program.
+using EvaluatorMap =
+    unordered_map<const EvaluatorBase*, shared_ptr<EvaluatorBase>>;
+
+// Replaces the evaluators of `bindings` that are in `evaluators` with their
+// copies.
+template <typename C>
+void ReplaceEvaluators(const EvaluatorMap& evaluators,
+                       vector<Binding<C>>* bindings) {
+  if (evaluators.empty()) {
+    return;
+  }
+  for (Binding<C>& binding : *bindings) {
+    const auto it = evaluators.find(binding.evaluator().get());
+    if (it != evaluators.end()) {
+      binding = Binding<C>(std::static_pointer_cast<C>(it->second),
+                           binding.variables());
+    }
+  }
+}
 }  // namespace
 
 constexpr double MathematicalProgram::kGlobalInfeasibleCost;
@@ -143,6 +192,19 @@ std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
   // decision_variable_index_ and indeterminate_index_ properly.
   new_prog->AddDecisionVariables(decision_variables_);
   new_prog->AddIndeterminates(indeterminates_);
+  new_prog->parameters_index_ = parameters_index_;
+  new_prog->parameters_ = parameters_;
+  new_prog->parameter_values_ = parameter_values_;
+  // The costs and constraints with parameters are copied, rather than shared,
+  // so that the parameter values of the new program are set independently.
+  EvaluatorMap cloned_evaluators;
+  for (const auto& coefficients : parametric_coefficients_) {
+    shared_ptr<internal::ParametricCoefficients> clone =
+        coefficients->Clone(parameter_values_);
+    cloned_evaluators.emplace(coefficients->evaluator().get(),
+                              clone->evaluator());
+    new_prog->parametric_coefficients_.push_back(clone);
+  }
   // Add costs
   new_prog->generic_costs_ = generic_costs_;
   new_prog->quadratic_costs_ = quadratic_costs_;
@@ -162,6 +224,11 @@ std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
       linear_matrix_inequality_constraint_;
   new_prog->linear_complementarity_constraints_ =
       linear_complementarity_constraints_;
+  ReplaceEvaluators(cloned_evaluators, &new_prog->linear_costs_);
+  ReplaceEvaluators(cloned_evaluators, &new_prog->quadratic_costs_);
+  ReplaceEvaluators(cloned_evaluators, &new_prog->linear_constraints_);
+  ReplaceEvaluators(cloned_evaluators,
+                    &new_prog->linear_equality_constraints_);
 
   new_prog->x_initial_guess_ = x_initial_guess_;
   new_prog->solver_id_ = solver_id_;
@@ -212,6 +279,11 @@ void MathematicalProgram::AddDecisionVariables(
       throw std::runtime_error(fmt::format("{} is already an indeterminate.",
                                            decision_variables(i)));
     }
+    if (parameters_index_.find(decision_variables(i).get_id()) !=
+        parameters_index_.end()) {
+      throw std::runtime_error(fmt::format("{} is already a parameter.",
+                                           decision_variables(i)));
+    }
     decision_variable_index_.insert(std::make_pair(
         decision_variables(i).get_id(), num_existing_decision_vars + i));
   }
@@ -308,7 +380,9 @@ void MathematicalProgram::AddIndeterminates(
     if (indeterminates_index_.find(new_indeterminates(i).get_id()) !=
             indeterminates_index_.end() ||
         decision_variable_index_.find(new_indeterminates(i).get_id()) !=
-            decision_variable_index_.end()) {
+            decision_variable_index_.end() ||
+        parameters_index_.find(new_indeterminates(i).get_id()) !=
+            parameters_index_.end()) {
       throw std::runtime_error(
           fmt::format("{} already exists in the optimization program.",
                       new_indeterminates(i)));
@@ -325,6 +399,74 @@ void MathematicalProgram::AddIndeterminates(
   indeterminates_.tail(new_indeterminates.rows()) = new_indeterminates;
 }
 
+VectorX<Variable> MathematicalProgram::NewParameters(int rows,
+                                                    const string& name) {
+  DRAKE_DEMAND(rows >= 0);
+  const int num_old_parameters = num_parameters();
+  parameters_.conservativeResize(num_old_parameters + rows);
+  parameter_values_.conservativeResize(num_old_parameters + rows);
+  for (int i = 0; i < rows; ++i) {
+    const Variable parameter(name + "(" + to_string(i) + ")");
+    parameters_index_.emplace(parameter.get_id(), num_old_parameters + i);
+    parameters_(num_old_parameters + i) = parameter;
+    parameter_values_(num_old_parameters + i) = 0;
+  }
+  return parameters_.tail(rows);
+}
+
+void MathematicalProgram::SetParameterValues(
+    const Eigen::Ref<const VectorX<Variable>>& parameters,
+    const Eigen::Ref<const Eigen::VectorXd>& values) {
+  DRAKE_DEMAND(parameters.rows() == values.rows());
+  for (int i = 0; i < parameters.rows(); ++i) {
+    const auto it = parameters_index_.find(parameters(i).get_id());
+    if (it == parameters_index_.end()) {
+      throw runtime_error(
+          fmt::format("{} is not a parameter of the program.", parameters(i)));
+    }
+    parameter_values_(it->second) = values(i);
+  }
+  for (const auto& coefficients : parametric_coefficients_) {
+    coefficients->Update(parameter_values_);
+  }
+}
+
+bool MathematicalProgram::HasParameters(const Expression& e) const {
+  return !parameters_index_.empty() &&
+         ContainsParameter(e.GetVariables(), parameters_index_);
+}
+
+bool MathematicalProgram::HasParameters(
+    const Eigen::Ref<const MatrixX<Expression>>& v) const {
+  if (parameters_index_.empty()) {
+    return false;
+  }
+  for (int j = 0; j < v.cols(); ++j) {
+    for (int i = 0; i < v.rows(); ++i) {
+      if (ContainsParameter(v(i, j).GetVariables(), parameters_index_)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool MathematicalProgram::HasParameters(const Formula& f) const {
+  return !parameters_index_.empty() &&
+         ContainsParameter(f.GetFreeVariables(), parameters_index_);
+}
+
+Binding<LinearConstraint> MathematicalProgram::AddParametricLinearConstraint(
+    const Eigen::Ref<const VectorX<Expression>>& v,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub) {
+  const auto parsed = internal::ParseParametricLinearConstraint(
+      v, lb, ub, parameters_index_, parameter_values_);
+  const Binding<LinearConstraint> binding = AddConstraint(parsed.first);
+  parametric_coefficients_.push_back(parsed.second);
+  return binding;
+}
+
 Binding<VisualizationCallback> MathematicalProgram::AddVisualizationCallback(
     const VisualizationCallback::CallbackFunction &callback,
     const Eigen::Ref<const VectorXDecisionVariable> &vars) {
@@ -359,6 +501,13 @@ Binding<LinearCost> MathematicalProgram::AddCost(
 }
 
 Binding<LinearCost> MathematicalProgram::AddLinearCost(const Expression& e) {
+  if (HasParameters(e)) {
+    const auto parsed = internal::ParseParametricLinearCost(
+        e, parameters_index_, parameter_values_);
+    const Binding<LinearCost> binding = AddCost(parsed.first);
+    parametric_coefficients_.push_back(parsed.second);
+    return binding;
+  }
   return AddCost(internal::ParseLinearCost(e));
 }
 
@@ -372,7 +521,7 @@ Binding<QuadraticCost> MathematicalProgram::AddCost(
     const Binding<QuadraticCost>& binding) {
   CheckBinding(binding);
   required_capabilities_ |= kQuadraticCost;
-  DRAKE_ASSERT(binding.evaluator()->Q().rows() ==
+  DRAKE_ASSERT(binding.evaluator()->get_sparse_Q().rows() ==
                    static_cast<int>(binding.GetNumElements()) &&
                binding.evaluator()->b().rows() ==
                    static_cast<int>(binding.GetNumElements()));
@@ -382,6 +531,13 @@ Binding<QuadraticCost> MathematicalProgram::AddCost(
 
 Binding<QuadraticCost> MathematicalProgram::AddQuadraticCost(
     const Expression& e) {
+  if (HasParameters(e)) {
+    const auto parsed = internal::ParseParametricQuadraticCost(
+        e, parameters_index_, parameter_values_);
+    const Binding<QuadraticCost> binding = AddCost(parsed.first);
+    parametric_coefficients_.push_back(parsed.second);
+    return binding;
+  }
   return AddCost(internal::ParseQuadraticCost(e));
 }
 
@@ -406,6 +562,13 @@ Binding<QuadraticCost> MathematicalProgram::AddQuadraticCost(
   return AddQuadraticCost(Q, b, 0., vars);
 }
 
+Binding<QuadraticCost> MathematicalProgram::AddQuadraticCost(
+    const Eigen::SparseMatrix<double>& Q,
+    const Eigen::Ref<const Eigen::VectorXd>& b, double c,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddCost(make_shared<QuadraticCost>(Q, b, c), vars);
+}
+
 Binding<PolynomialCost> MathematicalProgram::AddPolynomialCost(
     const Expression& e) {
   auto binding = AddCost(internal::ParsePolynomialCost(e));
@@ -413,6 +576,12 @@ Binding<PolynomialCost> MathematicalProgram::AddPolynomialCost(
 }
 
 Binding<Cost> MathematicalProgram::AddCost(const Expression& e) {
+  if (HasParameters(e)) {
+    if (internal::GetDecisionVariableDegree(e, parameters_index_) <= 1) {
+      return AddLinearCost(e);
+    }
+    return AddQuadraticCost(e);
+  }
   return AddCost(internal::ParseCost(e));
 }
 
@@ -457,6 +626,10 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
 Binding<Constraint> MathematicalProgram::AddConstraint(const Expression& e,
                                                        const double lb,
                                                        const double ub) {
+  if (HasParameters(e)) {
+    return AddParametricLinearConstraint(Vector1<Expression>(e), Vector1d(lb),
+                                         Vector1d(ub));
+  }
   return AddConstraint(internal::ParseConstraint(e, lb, ub));
 }
 
@@ -464,6 +637,9 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& lb,
     const Eigen::Ref<const Eigen::VectorXd>& ub) {
+  if (HasParameters(v)) {
+    return AddParametricLinearConstraint(v, lb, ub);
+  }
   return AddConstraint(internal::ParseConstraint(v, lb, ub));
 }
 
@@ -473,11 +649,18 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
 }
 
 Binding<Constraint> MathematicalProgram::AddConstraint(const Formula& f) {
+  if (HasParameters(f)) {
+    return AddLinearConstraint(f);
+  }
   return AddConstraint(internal::ParseConstraint(f));
 }
 
 Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
     const Expression& e, const double lb, const double ub) {
+  if (HasParameters(e)) {
+    return AddParametricLinearConstraint(Vector1<Expression>(e), Vector1d(lb),
+                                         Vector1d(ub));
+  }
   Binding<Constraint> binding = internal::ParseConstraint(e, lb, ub);
   Constraint* constraint = binding.evaluator().get();
   if (dynamic_cast<LinearConstraint*>(constraint)) {
@@ -494,6 +677,9 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
     const Eigen::Ref<const VectorX<Expression>>& v,
     const Eigen::Ref<const Eigen::VectorXd>& lb,
     const Eigen::Ref<const Eigen::VectorXd>& ub) {
+  if (HasParameters(v)) {
+    return AddParametricLinearConstraint(v, lb, ub);
+  }
   Binding<Constraint> binding = internal::ParseConstraint(v, lb, ub);
   Constraint* constraint = binding.evaluator().get();
   if (dynamic_cast<LinearConstraint*>(constraint)) {
@@ -508,6 +694,13 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
 
 Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
     const Formula& f) {
+  if (HasParameters(f)) {
+    VectorX<Expression> v;
+    Eigen::VectorXd lb;
+    Eigen::VectorXd ub;
+    DecomposeFormula(f, &v, &lb, &ub);
+    return AddParametricLinearConstraint(v, lb, ub);
+  }
   Binding<Constraint> binding = internal::ParseConstraint(f);
   Constraint* constraint = binding.evaluator().get();
   if (dynamic_cast<LinearConstraint*>(constraint)) {
@@ -535,7 +728,7 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
   } else {
     // TODO(eric.cousineau): This is a good assertion... But seems out of place,
     // possibly redundant w.r.t. the binding infrastructure.
-    DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+    DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                  static_cast<int>(binding.GetNumElements()));
     CheckBinding(binding);
     required_capabilities_ |= kLinearConstraint;
@@ -552,9 +745,17 @@ Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
   return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
 }
 
+Binding<LinearConstraint> MathematicalProgram::AddLinearConstraint(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearConstraint>(A, lb, ub), vars);
+}
+
 Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
     const Binding<LinearEqualityConstraint>& binding) {
-  DRAKE_ASSERT(binding.evaluator()->A().cols() ==
+  DRAKE_ASSERT(binding.evaluator()->get_sparse_A().cols() ==
                static_cast<int>(binding.GetNumElements()));
   CheckBinding(binding);
   required_capabilities_ |= kLinearEqualityConstraint;
@@ -565,6 +766,11 @@ Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
 Binding<LinearEqualityConstraint>
 MathematicalProgram::AddLinearEqualityConstraint(const Expression& e,
                                                  double b) {
+  if (HasParameters(e)) {
+    return internal::BindingDynamicCast<LinearEqualityConstraint>(
+        AddParametricLinearConstraint(Vector1<Expression>(e), Vector1d(b),
+                                      Vector1d(b)));
+  }
   return AddConstraint(internal::ParseLinearEqualityConstraint(e, b));
 }
 
@@ -575,6 +781,21 @@ MathematicalProgram::AddLinearEqualityConstraint(const set<Formula>& formulas) {
 
 Binding<LinearEqualityConstraint>
 MathematicalProgram::AddLinearEqualityConstraint(const Formula& f) {
+  if (HasParameters(f)) {
+    VectorX<Expression> v;
+    Eigen::VectorXd lb;
+    Eigen::VectorXd ub;
+    DecomposeFormula(f, &v, &lb, &ub);
+    if (lb != ub) {
+      throw runtime_error(fmt::format(
+          "AddLinearEqualityConstraint is called with a formula {} which is "
+          "neither an equality formula nor a conjunction of equality "
+          "formulas.",
+          f));
+    }
+    return internal::BindingDynamicCast<LinearEqualityConstraint>(
+        AddParametricLinearConstraint(v, lb, ub));
+  }
   return AddConstraint(internal::ParseLinearEqualityConstraint(f));
 }
 
@@ -586,6 +807,14 @@ MathematicalProgram::AddLinearEqualityConstraint(
   return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
 }
 
+Binding<LinearEqualityConstraint>
+MathematicalProgram::AddLinearEqualityConstraint(
+    const Eigen::SparseMatrix<double>& Aeq,
+    const Eigen::Ref<const Eigen::VectorXd>& beq,
+    const Eigen::Ref<const VectorXDecisionVariable>& vars) {
+  return AddConstraint(make_shared<LinearEqualityConstraint>(Aeq, beq), vars);
+}
+
 Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
     const Binding<BoundingBoxConstraint>& binding) {
   CheckBinding(binding);
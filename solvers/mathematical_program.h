@@ -34,6 +34,7 @@
 #include "drake/solvers/function.h"
 #include "drake/solvers/indeterminate.h"
 #include "drake/solvers/mathematical_program_solver_interface.h"
+#include "drake/solvers/parametric_coefficients.h"
 
 namespace drake {
 namespace solvers {
@@ -106,6 +107,13 @@ namespace solvers {
  *    <td></td>
  *    <td></td>
  * </tr>
+ * <tr><td>ActiveSetQPSolver &Dagger;</td>
+ *    <td></td>
+ *    <td align="center">&diams;</td>
+ *    <td></td>
+ *    <td></td>
+ *    <td></td>
+ * </tr>
  * </table>
  *
  * <b>Mixed-Integer Convex Optimization</b>
@@ -175,6 +183,9 @@ namespace solvers {
  *
  * &dagger; indicates that this is a commercial solver which requires a license
  * (note that some have free licenses for academics).
+ *
+ * &Dagger; indicates that the solver only supports strictly convex QPs, i.e.
+ * with a positive definite Hessian.
  * @}
  */
 
@@ -321,8 +332,11 @@ class MathematicalProgram {
    * - costs
    * - solver settings
    * - initial guess
+   * - parameters and their values
    * However, the clone's x values will be initialized to NaN, and all internal
-   * solvers will be freshly constructed.
+   * solvers will be freshly constructed. The clone shares the costs and
+   * constraints with the source program, except for those that were added
+   * with parameters, which are copied. See NewParameters().
    * @retval new_prog. The newly constructed mathematical program.
    */
   std::unique_ptr<MathematicalProgram> Clone() const;
@@ -762,6 +776,54 @@ class MathematicalProgram {
   void AddIndeterminates(
       const Eigen::Ref<const VectorXIndeterminate>& new_indeterminates);
 
+  /**
+   * Adds parameters to this MathematicalProgram, with default name "p".
+   * Parameters are continuous symbolic variables whose values are given, by
+   * SetParameterValues(), rather than found by the solver. They default to
+   * zero.
+   *
+   * Parameters can appear in the symbolic expressions passed to
+   * AddLinearCost(), AddQuadraticCost(), AddCost(), AddLinearConstraint(),
+   * AddLinearEqualityConstraint() and AddConstraint(), as long as the costs
+   * and constraints are linear (or quadratic, for the costs) in the decision
+   * variables, with coefficients and bounds that are affine in the
+   * parameters. The constant term of a cost can be any polynomial of the
+   * parameters. For example, with decision variables x and parameters p
+   *
+   * @code
+   *   prog.AddQuadraticCost((x - p).dot(x - p));
+   *   prog.AddLinearConstraint(p(0) * x(0) + x(1) <= p(1));
+   * @endcode
+   *
+   * Such an expression is parsed once, into a linear or quadratic cost or
+   * constraint with a fixed sparsity pattern, and into coefficients that are
+   * affine in the parameters. Setting new parameter values then only
+   * evaluates these coefficients, so that a program that is solved repeatedly
+   * with new data, e.g. in model predictive control, is built only once.
+   *
+   * The costs and constraints that are added with parameters are updated in
+   * place. Clone() copies them, so that the parameter values of a clone are
+   * set independently of the original program, whereas all the other costs
+   * and constraints are shared.
+   * @param rows The number of parameters.
+   * @param name The name of the parameters, whose i'th entry is name(i).
+   * @return The new parameters.
+   */
+  VectorX<symbolic::Variable> NewParameters(int rows,
+                                            const std::string& name = "p");
+
+  /**
+   * Sets the values of some of the parameters, and updates the coefficients
+   * of all the costs and constraints that were added with parameters.
+   * @param parameters The parameters, added by NewParameters().
+   * @param values The new values of `parameters`.
+   * @throws std::runtime_error if an entry of `parameters` is not a parameter
+   * of this program.
+   */
+  void SetParameterValues(
+      const Eigen::Ref<const VectorX<symbolic::Variable>>& parameters,
+      const Eigen::Ref<const Eigen::VectorXd>& values);
+
   /**
    * Adds a callback method to visualize intermediate results of the
    * optimization.
@@ -1009,6 +1071,16 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& b,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds a cost term of the form 0.5*x'*Q*x + b'x + c, with a sparse matrix
+   * Q, applied to a subset of the variables. Q is never densified, neither
+   * here nor by the solvers that accept sparse data.
+   */
+  Binding<QuadraticCost> AddQuadraticCost(
+      const Eigen::SparseMatrix<double>& Q,
+      const Eigen::Ref<const Eigen::VectorXd>& b, double c,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds a cost term in the polynomial form.
    * @param e A symbolic expression in the polynomial form.
@@ -1128,7 +1200,11 @@ class MathematicalProgram {
       is_eigen_scalar_same<Derived, symbolic::Formula>::value,
       Binding<Constraint>>::type
   AddConstraint(const Eigen::ArrayBase<Derived>& formulas) {
-    return AddConstraint(internal::ParseConstraint(formulas));
+    VectorX<symbolic::Expression> v;
+    Eigen::VectorXd lb;
+    Eigen::VectorXd ub;
+    internal::DecomposeRelationalFormulas(formulas, &v, &lb, &ub);
+    return AddConstraint(v, lb, ub);
   }
 
   /**
@@ -1183,6 +1259,18 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& ub,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear constraints lb <= A*vars <= ub with a sparse matrix A. A is
+   * never densified, neither here nor by the solvers that accept sparse data.
+   * A sparse matrix can be assembled from triplets with
+   * Eigen::SparseMatrix::setFromTriplets().
+   */
+  Binding<LinearConstraint> AddLinearConstraint(
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear constraint referencing potentially a
    * subset of the decision variables (defined in the vars parameter).
@@ -1297,14 +1385,19 @@ class MathematicalProgram {
       is_eigen_scalar_same<Derived, symbolic::Formula>::value,
       Binding<LinearConstraint>>::type
   AddLinearConstraint(const Eigen::ArrayBase<Derived>& formulas) {
-    Binding<Constraint> binding = internal::ParseConstraint(formulas);
+    VectorX<symbolic::Expression> v;
+    Eigen::VectorXd lb;
+    Eigen::VectorXd ub;
+    internal::DecomposeRelationalFormulas(formulas, &v, &lb, &ub);
+    if (HasParameters(v)) {
+      return AddParametricLinearConstraint(v, lb, ub);
+    }
+    Binding<Constraint> binding = internal::ParseConstraint(v, lb, ub);
     Constraint* constraint = binding.evaluator().get();
     if (dynamic_cast<LinearConstraint*>(constraint)) {
       return AddConstraint(
           internal::BindingDynamicCast<LinearConstraint>(binding));
     } else {
-      std::stringstream oss;
-      oss << "Formulas are non-linear.";
       throw std::runtime_error("AddLinearConstraint called but formulas are "
                                    "non-linear");
     }
@@ -1364,6 +1457,10 @@ class MathematicalProgram {
       Binding<LinearEqualityConstraint>>::type
   AddLinearEqualityConstraint(const Eigen::MatrixBase<DerivedV>& v,
                               const Eigen::MatrixBase<DerivedB>& b) {
+    if (HasParameters(v)) {
+      return internal::BindingDynamicCast<LinearEqualityConstraint>(
+          AddParametricLinearConstraint(v, b, b));
+    }
     return AddConstraint(internal::ParseLinearEqualityConstraint(v, b));
   }
 
@@ -1449,6 +1546,16 @@ class MathematicalProgram {
       const Eigen::Ref<const Eigen::VectorXd>& beq,
       const Eigen::Ref<const VectorXDecisionVariable>& vars);
 
+  /**
+   * Adds linear equality constraints Aeq*vars = beq with a sparse matrix Aeq.
+   * Aeq is never densified, neither here nor by the solvers that accept
+   * sparse data.
+   */
+  Binding<LinearEqualityConstraint> AddLinearEqualityConstraint(
+      const Eigen::SparseMatrix<double>& Aeq,
+      const Eigen::Ref<const Eigen::VectorXd>& beq,
+      const Eigen::Ref<const VectorXDecisionVariable>& vars);
+
   /**
    * Adds one row of linear equality constraint referencing potentially a subset
    * of decision variables.
@@ -2266,6 +2373,14 @@ class MathematicalProgram {
    */
   double GetLowerBoundCost() const { return lower_bound_cost_; }
 
+  /**
+   * Getter for the number of iterations taken by the last solver call. Empty
+   * if the solver does not report it (e.g. SNOPT and NLopt), or if no solver
+   * has been called. See SolverResult::set_num_iterations() for what counts
+   * as an iteration.
+   */
+  const optional<int>& GetNumIterations() const { return num_iterations_; }
+
   /**
    * Getter for all callbacks.
    */
@@ -2583,6 +2698,17 @@ class MathematicalProgram {
     return indeterminates_(i);
   }
 
+  /** Gets the number of parameters in the optimization program. */
+  int num_parameters() const { return parameters_.rows(); }
+
+  /** Getter for all parameters in the program. */
+  const VectorX<symbolic::Variable>& parameters() const { return parameters_; }
+
+  /** Getter for the values of all parameters in the program. */
+  const Eigen::VectorXd& GetParameterValues() const {
+    return parameter_values_;
+  }
+
   /**
    * Solver reports its result back to MathematicalProgram, by passing the
    * solver_result, which contains the solver result.
@@ -2607,6 +2733,14 @@ class MathematicalProgram {
   std::unordered_map<symbolic::Variable::Id, int> indeterminates_index_;
   VectorXIndeterminate indeterminates_;
 
+  internal::ParameterIndex parameters_index_;
+  VectorX<symbolic::Variable> parameters_;
+  Eigen::VectorXd parameter_values_;
+  // The coefficients of the costs and constraints that were added with
+  // parameters, which are updated by SetParameterValues().
+  std::vector<std::shared_ptr<internal::ParametricCoefficients>>
+      parametric_coefficients_;
+
   std::vector<Binding<VisualizationCallback>> visualization_callbacks_;
 
   std::vector<Binding<Cost>> generic_costs_;
@@ -2643,6 +2777,8 @@ class MathematicalProgram {
   // The lower bound of the objective found by the solver, during the
   // optimization process.
   double lower_bound_cost_{};
+  // The number of iterations taken by the solver, if it reports one.
+  optional<int> num_iterations_;
   std::map<SolverId, std::map<std::string, double>> solver_options_double_;
   std::map<SolverId, std::map<std::string, int>> solver_options_int_;
   std::map<SolverId, std::map<std::string, std::string>> solver_options_str_;
@@ -2804,6 +2940,24 @@ class MathematicalProgram {
     CheckIsDecisionVariable(binding.variables());
   }
 
+  // Returns true if `e` contains a parameter of the program.
+  bool HasParameters(const symbolic::Expression& e) const;
+
+  // Returns true if an entry of `v` contains a parameter of the program.
+  bool HasParameters(
+      const Eigen::Ref<const MatrixX<symbolic::Expression>>& v) const;
+
+  // Returns true if `f` contains a parameter of the program.
+  bool HasParameters(const symbolic::Formula& f) const;
+
+  // Adds lb <= v <= ub, where `v` contains parameters, as a linear constraint
+  // whose coefficients are updated by SetParameterValues(). The constraint is
+  // a LinearEqualityConstraint if lb == ub.
+  Binding<LinearConstraint> AddParametricLinearConstraint(
+      const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
+      const Eigen::Ref<const Eigen::VectorXd>& lb,
+      const Eigen::Ref<const Eigen::VectorXd>& ub);
+
   // Adds a constraint represented by a set of symbolic formulas to the
   // program.
   //
@@ -85,11 +85,25 @@ class SolverResult {
     return optimal_cost_lower_bound_;
   }
 
+  /**
+   * Sets the number of iterations taken by the solver. Eventually this number
+   * will be passed to MathematicalProgram, when calling
+   * MathematicalProgram::SetSolverResult(...);
+   * What counts as an iteration depends on the solver, e.g. an interior-point
+   * iteration, a simplex pivot or an ADMM step.
+   */
+  void set_num_iterations(int num_iterations) {
+    num_iterations_ = num_iterations;
+  }
+
+  const optional<int>& num_iterations() const { return num_iterations_; }
+
  private:
   SolverId solver_id_;
   optional<Eigen::VectorXd> decision_variable_values_{nullopt};
   optional<double> optimal_cost_{nullopt};
   optional<double> optimal_cost_lower_bound_{nullopt};
+  optional<int> num_iterations_{nullopt};
 };
 
 /// Interface used by implementations of individual solvers.
@@ -217,6 +217,9 @@ SolutionResult MobyLCPSolver<T>::Solve(MathematicalProgram& prog) const {
   // We don't actually indicate different results.
   SolverResult solver_result(MobyLcpSolverId::id());
 
+  // The number of pivots, summed over all the LCPs.
+  int num_pivots = 0;
+
   Eigen::VectorXd x_sol(prog.num_vars());
   for (const auto& binding : bindings) {
     Eigen::VectorXd constraint_solution(binding.GetNumElements());
@@ -224,6 +227,8 @@ SolutionResult MobyLCPSolver<T>::Solve(MathematicalProgram& prog) const {
         binding.evaluator();
     bool solved = SolveLcpLemkeRegularized(
         constraint->M(), constraint->q(), &constraint_solution);
+    num_pivots += get_num_pivots();
+    solver_result.set_num_iterations(num_pivots);
     if (!solved) {
       prog.SetSolverResult(solver_result);
       return SolutionResult::kUnknownError;
@@ -18,6 +18,8 @@ namespace drake {
 namespace solvers {
 namespace {
 
+using RowMajorSparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
 // Add LinearConstraints and LinearEqualityConstraints to the Mosek task.
 template <typename C>
 MSKrescodee AddLinearConstraintsFromBindings(
@@ -25,9 +27,12 @@ MSKrescodee AddLinearConstraintsFromBindings(
     bool is_equality_constraint, const MathematicalProgram& prog) {
   for (const auto& binding : constraint_list) {
     auto constraint = binding.evaluator();
-    const Eigen::MatrixXd& A = constraint->A();
+    // Iterate over A row by row, visiting only its non-zero entries.
+    const RowMajorSparseMatrix A = constraint->get_sparse_A();
     const Eigen::VectorXd& lb = constraint->lower_bound();
     const Eigen::VectorXd& ub = constraint->upper_bound();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
     MSKint32t constraint_idx = 0;
     MSKrescodee rescode = MSK_getnumcon(*task, &constraint_idx);
     if (rescode != MSK_RES_OK) {
@@ -37,6 +42,8 @@ MSKrescodee AddLinearConstraintsFromBindings(
     if (rescode != MSK_RES_OK) {
       return rescode;
     }
+    std::vector<MSKint32t> A_nonzero_col_idx;
+    std::vector<double> A_nonzero_val;
     // Loop through each row of the constraint, and determine the sense of
     // each constraint. The sense can be equality constraint, less than,
     // greater than, or bounded on both side.
@@ -65,16 +72,12 @@ MSKrescodee AddLinearConstraintsFromBindings(
           return rescode;
         }
       }
-      std::vector<MSKint32t> A_nonzero_col_idx;
-      std::vector<double> A_nonzero_val;
-      A_nonzero_col_idx.reserve(A.cols());
-      A_nonzero_val.reserve(A.cols());
-
-      for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-        if (std::abs(A(i, k)) > Eigen::NumTraits<double>::epsilon()) {
-          A_nonzero_col_idx.push_back(
-              prog.FindDecisionVariableIndex(binding.variables()(k)));
-          A_nonzero_val.push_back(A(i, k));
+      A_nonzero_col_idx.clear();
+      A_nonzero_val.clear();
+      for (RowMajorSparseMatrix::InnerIterator it(A, i); it; ++it) {
+        if (std::abs(it.value()) > Eigen::NumTraits<double>::epsilon()) {
+          A_nonzero_col_idx.push_back(var_indices[it.col()]);
+          A_nonzero_val.push_back(it.value());
         }
       }
 
@@ -449,37 +452,36 @@ MSKrescodee AddCosts(const MathematicalProgram& prog, MSKtask_t* task) {
   double constant_cost = 0.;
   for (const auto& binding : prog.quadratic_costs()) {
     const auto& constraint = binding.evaluator();
-    // The quadratic cost is of form 0.5*x'*Q*x + b*x.
-    const auto& Q = constraint->Q();
+    // The quadratic cost is of form 0.5*x'*Q*x + b*x. Q is stored sparse and
+    // symmetric, so only the non-zero entries of its lower triangular part
+    // are visited.
+    const Eigen::SparseMatrix<double>& Q = constraint->get_sparse_Q();
     const auto& b = constraint->b();
     constant_cost += constraint->c();
-    std::vector<int> var_indices(Q.rows());
-
-    for (int i = 0; i < static_cast<int>(binding.GetNumElements()); ++i) {
-      var_indices[i] = prog.FindDecisionVariableIndex(binding.variables()(i));
-    }
-
-    for (int i = 0; i < Q.rows(); ++i) {
-      int var_index_i = var_indices[i];
-      for (int j = 0; j < i; ++j) {
-        const double Qij = (Q(i, j) + Q(j, i)) / 2;
-        if (std::abs(Qij) > Eigen::NumTraits<double>::epsilon()) {
-          if (var_index_i > var_indices[j]) {
-            Q_lower_triplets.push_back(
-                Eigen::Triplet<double>(var_index_i, var_indices[j], Qij));
-          } else {
-            Q_lower_triplets.push_back(
-                Eigen::Triplet<double>(var_indices[j], var_index_i, Qij));
-          }
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+
+    for (int j = 0; j < Q.outerSize(); ++j) {
+      const int var_index_j = var_indices[j];
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Q, j); it; ++it) {
+        if (it.row() < j ||
+            std::abs(it.value()) <= Eigen::NumTraits<double>::epsilon()) {
+          continue;
+        }
+        const int var_index_i = var_indices[it.row()];
+        if (var_index_i > var_index_j) {
+          Q_lower_triplets.push_back(
+              Eigen::Triplet<double>(var_index_i, var_index_j, it.value()));
+        } else {
+          Q_lower_triplets.push_back(
+              Eigen::Triplet<double>(var_index_j, var_index_i, it.value()));
         }
       }
-      if (std::abs(Q(i, i)) > Eigen::NumTraits<double>::epsilon()) {
-        Q_lower_triplets.push_back(
-            Eigen::Triplet<double>(var_index_i, var_index_i, Q(i, i)));
-      }
+    }
+    for (int i = 0; i < b.rows(); ++i) {
       if (std::abs(b(i)) > Eigen::NumTraits<double>::epsilon()) {
         linear_term_triplets.push_back(
-            Eigen::Triplet<double>(var_index_i, 0, b(i)));
+            Eigen::Triplet<double>(var_indices[i], 0, b(i)));
       }
     }
   }
@@ -724,6 +726,23 @@ SolutionResult MosekSolver::Solve(MathematicalProgram& prog) const {
   SolverResult solver_result(id());
   // TODO(hongkai.dai@tri.global) : Add MOSEK paramaters.
   // Mosek parameter are added by enum, not by string.
+  if (rescode == MSK_RES_OK && solution_type != MSK_SOL_ITG) {
+    // The interior-point iterations, plus the simplex iterations of the
+    // basis identification (or of the simplex optimizer) for a basic solution.
+    MSKint32t num_iterations = 0;
+    MSK_getintinf(task, MSK_IINF_INTPNT_ITER, &num_iterations);
+    if (solution_type == MSK_SOL_BAS) {
+      MSKint32t num_primal_simplex_iterations = 0;
+      MSKint32t num_dual_simplex_iterations = 0;
+      MSK_getintinf(task, MSK_IINF_SIM_PRIMAL_ITER,
+                    &num_primal_simplex_iterations);
+      MSK_getintinf(task, MSK_IINF_SIM_DUAL_ITER,
+                    &num_dual_simplex_iterations);
+      num_iterations +=
+          num_primal_simplex_iterations + num_dual_simplex_iterations;
+    }
+    solver_result.set_num_iterations(num_iterations);
+  }
   if (rescode == MSK_RES_OK) {
     MSKsolstae solution_status;
     if (rescode == MSK_RES_OK) {
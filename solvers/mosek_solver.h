@@ -11,6 +11,16 @@
 namespace drake {
 namespace solvers {
 
+/**
+ * Solves linear, quadratic, second-order cone and semidefinite programs with
+ * MOSEK.
+ *
+ * The license environment is shared by all MosekSolver instances (see
+ * AcquireLicense()), but the task is built from scratch on every solve and
+ * nothing is kept from a previous solve of the same program. MOSEK's
+ * interior-point optimizer, which it uses for conic programs, cannot be warm
+ * started.
+ */
 class MosekSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MosekSolver)
@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -26,7 +30,8 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
 
     // Add quadratic_cost.Q to the Hessian P.
     const std::vector<Eigen::Triplet<double>> Qi_triplets =
-        math::SparseMatrixToTriplets(quadratic_cost.evaluator()->Q());
+        math::SparseMatrixToTriplets(
+            quadratic_cost.evaluator()->get_sparse_Q());
     P_triplets.reserve(P_triplets.size() + Qi_triplets.size());
     for (int i = 0; i < static_cast<int>(Qi_triplets.size()); ++i) {
       P_triplets.emplace_back(x_indices[Qi_triplets[i].row()],
@@ -90,7 +95,7 @@ void ParseLinearConstraints(const MathematicalProgram& prog,
     const std::vector<int> x_indices =
         prog.FindDecisionVariableIndices(constraint.variables());
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
-        math::SparseMatrixToTriplets(constraint.evaluator()->A());
+        math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
     // Append constraint.A to osqp A.
     for (const auto& Ai_triplet : Ai_triplets) {
       A_triplets->emplace_back(*num_A_rows + Ai_triplet.row(),
@@ -193,46 +198,87 @@ void SetOsqpSolverSettings(MathematicalProgram* prog, OSQPSettings* settings) {
   SetOsqpSolverSetting(options_double, "sigma", &(settings->sigma));
   SetOsqpSolverSetting(options_int, "scaling", &(settings->scaling));
   SetOsqpSolverSetting(options_int, "max_iter", &(settings->max_iter));
+  SetOsqpSolverSetting(options_int, "check_termination",
+                       &(settings->check_termination));
   SetOsqpSolverSetting(options_int, "polish_refine_iter",
                        &(settings->polish_refine_iter));
   SetOsqpSolverSetting(options_int, "verbose", &(settings->verbose));
 }
-}  // namespace
 
-bool OsqpSolver::available() const { return true; }
+// Returns true if `a` and `b` have the same size, sparsity pattern and values.
+// Both matrices must be compressed.
+bool AreIdentical(const Eigen::SparseMatrix<c_float>& a,
+                  const Eigen::SparseMatrix<c_float>& b) {
+  DRAKE_ASSERT(a.isCompressed() && b.isCompressed());
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr()) &&
+         std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
 
-SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
-  // OSQP solves a convex quadratic programming problem
-  // min 0.5 xᵀPx + qᵀx
-  // s.t l ≤ Ax ≤ u
-  // OSQP is written in C, so this function will be in C style.
+// The OSQP workspace of the last solve of a MathematicalProgram, together with
+// the problem data and the solver options it was set up with.
+//
+// Setting up the workspace, which includes the factorization of the KKT
+// matrix, dominates the cost of solving small QPs. When the program is solved
+// again with the same P and A matrices and the same options, the workspace is
+// reused: only the changes to q, l and u are pushed to OSQP, and OSQP
+// warm-starts from the previous primal and dual solution.
+struct OsqpSolverData : public MathematicalProgram::SolverData {
+  ~OsqpSolverData() override { Reset(); }
 
-  // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
-  double constant_cost_term{0};
+  void Reset() {
+    if (work != nullptr) {
+      osqp_cleanup(work);
+      work = nullptr;
+    }
+  }
 
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
-  ParseLinearCosts(prog, &q, &constant_cost_term);
+  OSQPWorkspace* work{nullptr};
+  Eigen::SparseMatrix<c_float> P;
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> q;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+  std::map<std::string, double> options_double;
+  std::map<std::string, int> options_int;
+};
 
-  // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
-  std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
+// Sets up the OSQP workspace in `solver_data` for the problem
+// min 0.5 xᵀPx + qᵀx s.t l ≤ Ax ≤ u, given by the members of `solver_data`.
+// If the previous workspace solved a problem of the same size, the new one is
+// warm-started from its solution.
+void SetUpWorkspace(MathematicalProgram* prog, OsqpSolverData* solver_data) {
+  const int n = solver_data->P.cols();
+  const int m = solver_data->A.rows();
+  std::vector<c_float> x_warm;
+  std::vector<c_float> y_warm;
+  if (solver_data->work != nullptr && solver_data->work->data->n == n &&
+      solver_data->work->data->m == m) {
+    x_warm.assign(solver_data->work->solution->x,
+                  solver_data->work->solution->x + n);
+    y_warm.assign(solver_data->work->solution->y,
+                  solver_data->work->solution->y + m);
+  }
+  solver_data->Reset();
 
-  // Now pass the constraint and cost to osqp data.
+  // Now pass the constraint and cost to osqp data. OSQP copies the data into
+  // its workspace during setup.
   OSQPData* data;  // OSQPData
 
   // Populate data.
   data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
 
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+  data->n = n;
+  data->m = m;
+  data->P = EigenSparseToCSC(solver_data->P);
+  data->q = solver_data->q.data();
+  data->A = EigenSparseToCSC(solver_data->A);
+  data->l = solver_data->l.data();
+  data->u = solver_data->u.data();
 
   // Define Solver settings as default.
   // Problem settings
@@ -243,21 +289,94 @@ SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
   // TODO(hongkai.dai): add a setter so that we can turn off polishing.
   settings->polish = 1;
   settings->verbose = 0;
-  SetOsqpSolverSettings(&prog, settings);
+  SetOsqpSolverSettings(prog, settings);
 
   // Setup workspace.
-  // OSQP structures.
-  OSQPWorkspace* work;  // Workspace
-  work = osqp_setup(data, settings);
+  solver_data->work = osqp_setup(data, settings);
+  if (solver_data->work != nullptr && !x_warm.empty()) {
+    osqp_warm_start(solver_data->work, x_warm.data(), y_warm.data());
+  }
+
+  c_free(data->P->x);
+  c_free(data->P->i);
+  c_free(data->P->p);
+  c_free(data->P);
+  c_free(data->A->x);
+  c_free(data->A->i);
+  c_free(data->A->p);
+  c_free(data->A);
+  c_free(data);
+  c_free(settings);
+}
+}  // namespace
+
+bool OsqpSolver::available() const { return true; }
+
+SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
+  // OSQP solves a convex quadratic programming problem
+  // min 0.5 xᵀPx + qᵀx
+  // s.t l ≤ Ax ≤ u
+  // OSQP is written in C, so this function will be in C style.
+
+  // Get the cost for the QP.
+  Eigen::SparseMatrix<c_float> P_sparse;
+  std::vector<c_float> q(prog.num_vars(), 0);
+  double constant_cost_term{0};
+
+  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
+  ParseLinearCosts(prog, &q, &constant_cost_term);
+
+  // Parse the linear constraints.
+  Eigen::SparseMatrix<c_float> A_sparse;
+  std::vector<c_float> l, u;
+  ParseAllLinearConstraints(prog, &A_sparse, &l, &u);
+
+  // Reuse the workspace of the previous solve of this program if only q, l or
+  // u changed since then; set up a new one otherwise. OSQP rejects an update
+  // that fails its data validation (for example l > u) and keeps the old data,
+  // so a rejected update also falls back to a new setup, which reports the
+  // invalid data. The cached vectors always hold the data of the workspace.
+  auto solver_data = prog.GetSolverData<OsqpSolverData>();
+  bool reuse_workspace =
+      solver_data->work != nullptr && AreIdentical(P_sparse, solver_data->P) &&
+      AreIdentical(A_sparse, solver_data->A) &&
+      prog.GetSolverOptionsDouble(id()) == solver_data->options_double &&
+      prog.GetSolverOptionsInt(id()) == solver_data->options_int;
+  if (reuse_workspace && q != solver_data->q) {
+    reuse_workspace = osqp_update_lin_cost(solver_data->work, q.data()) == 0;
+    if (reuse_workspace) {
+      solver_data->q = q;
+    }
+  }
+  if (reuse_workspace && (l != solver_data->l || u != solver_data->u)) {
+    reuse_workspace =
+        osqp_update_bounds(solver_data->work, l.data(), u.data()) == 0;
+    if (reuse_workspace) {
+      solver_data->l = l;
+      solver_data->u = u;
+    }
+  }
+  if (!reuse_workspace) {
+    solver_data->P = std::move(P_sparse);
+    solver_data->A = std::move(A_sparse);
+    solver_data->q = std::move(q);
+    solver_data->l = std::move(l);
+    solver_data->u = std::move(u);
+    solver_data->options_double = prog.GetSolverOptionsDouble(id());
+    solver_data->options_int = prog.GetSolverOptionsInt(id());
+    SetUpWorkspace(&prog, solver_data.get());
+  }
+  OSQPWorkspace* work = solver_data->work;
 
   // Solve Problem.
-  c_int osqp_exitflag = osqp_solve(work);
+  c_int osqp_exitflag = work != nullptr ? osqp_solve(work) : 1;
 
   SolutionResult solution_result;
   SolverResult solver_result(id());
   if (osqp_exitflag) {
     solution_result = SolutionResult::kInvalidInput;
   } else {
+    solver_result.set_num_iterations(work->info->iter);
     switch (work->info->status_val) {
       case OSQP_SOLVED:
       case OSQP_SOLVED_INACCURATE: {
@@ -289,18 +408,10 @@ SolutionResult OsqpSolver::Solve(MathematicalProgram& prog) const {
     }
   }
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Do not warm-start the next solve from the iterates of a failed solve.
+  if (solution_result != SolutionResult::kSolutionFound) {
+    solver_data->Reset();
+  }
 
   prog.SetSolverResult(solver_result);
   return solution_result;
@@ -6,6 +6,15 @@
 namespace drake {
 namespace solvers {
 
+/// Solves convex quadratic programs with OSQP.
+///
+/// The OSQP workspace, which holds the factorization of the problem's KKT
+/// matrix, is stored with the MathematicalProgram. When the same program is
+/// solved again with only its linear cost terms or its constraint bounds
+/// changed, e.g. through LinearCost::UpdateCoefficients() or
+/// Constraint::UpdateLowerBound(), the workspace is updated in place rather
+/// than set up from scratch, and OSQP warm-starts from the previous solution.
+/// Any other change sets up a new workspace.
 class OsqpSolver : public MathematicalProgramSolverInterface {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(OsqpSolver)
@@ -0,0 +1,77 @@
+#include "drake/solvers/parallel_evaluation.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+void EvaluateInParallel(int num_evaluations,
+                        drake::internal::ThreadPool* pool,
+                        const std::function<bool(int)>& is_thread_safe,
+                        const std::function<void(int)>& evaluate) {
+  if (pool == nullptr) {
+    for (int i = 0; i < num_evaluations; ++i) {
+      evaluate(i);
+    }
+    return;
+  }
+  std::vector<int> parallel;
+  std::vector<int> sequential;
+  parallel.reserve(num_evaluations);
+  for (int i = 0; i < num_evaluations; ++i) {
+    (is_thread_safe(i) ? parallel : sequential).push_back(i);
+  }
+  const int num_parallel = static_cast<int>(parallel.size());
+  const int num_chunks = std::min(pool->num_threads(), num_parallel);
+  // The evaluations [begin, end) of `parallel` form the chunk k.
+  auto evaluate_chunk = [&](int k) {
+    const int begin = static_cast<int>(
+        static_cast<int64_t>(num_parallel) * k / num_chunks);
+    const int end = static_cast<int>(
+        static_cast<int64_t>(num_parallel) * (k + 1) / num_chunks);
+    for (int j = begin; j < end; ++j) {
+      evaluate(parallel[j]);
+    }
+  };
+  // The calling thread evaluates the first chunk, then the evaluations that
+  // are not thread-safe.
+  pool->Run(std::max(num_chunks, 1), [&](int k) {
+    if (num_chunks > 0) {
+      evaluate_chunk(k);
+    }
+    if (k == 0) {
+      for (const int i : sequential) {
+        evaluate(i);
+      }
+    }
+  });
+}
+
+std::unique_ptr<drake::internal::ThreadPool> TakeMaxNumThreadsOption(
+    const std::string& solver_name, std::map<std::string, int>* int_options) {
+  DRAKE_DEMAND(int_options != nullptr);
+  int max_num_threads = 1;
+  const auto it = int_options->find("max_num_threads");
+  if (it != int_options->end()) {
+    max_num_threads = it->second;
+    int_options->erase(it);
+  }
+  if (max_num_threads < 1) {
+    throw std::runtime_error(
+        solver_name + ": the option \"max_num_threads\" must be at least 1.");
+  }
+  if (max_num_threads == 1) {
+    return nullptr;
+  }
+  return std::make_unique<drake::internal::ThreadPool>(max_num_threads);
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
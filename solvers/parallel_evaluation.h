@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "drake/common/thread_pool.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/*
+ * Calls `evaluate(i)` for each i in [0, num_evaluations), on the threads of
+ * `pool`. The evaluations i for which `is_thread_safe(i)` is true are split
+ * into contiguous chunks of about the same size, one per thread, and the
+ * others are made sequentially on the calling thread. The evaluations must
+ * therefore write to disjoint outputs; when `pool` is nullptr, they are all
+ * made in order on the calling thread. An exception thrown by an evaluation is
+ * rethrown once all the threads have finished.
+ */
+void EvaluateInParallel(int num_evaluations,
+                        drake::internal::ThreadPool* pool,
+                        const std::function<bool(int)>& is_thread_safe,
+                        const std::function<void(int)>& evaluate);
+
+/*
+ * Removes the solver option "max_num_threads", documented in SnoptSolver and
+ * IpoptSolver, from `int_options`, and returns a thread pool with that many
+ * threads, or nullptr if the option is missing or is 1.
+ * @throws std::runtime_error, prefixed by `solver_name`, if the option is less
+ * than one.
+ */
+std::unique_ptr<drake::internal::ThreadPool> TakeMaxNumThreadsOption(
+    const std::string& solver_name, std::map<std::string, int>* int_options);
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,549 @@
+#include "drake/solvers/parametric_coefficients.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+using std::make_pair;
+using std::make_shared;
+using std::map;
+using std::ostringstream;
+using std::pair;
+using std::runtime_error;
+using std::shared_ptr;
+using std::unique_ptr;
+using std::vector;
+
+using symbolic::Expression;
+using symbolic::Variable;
+using symbolic::Variables;
+
+namespace {
+
+// A scalar c₀ + Σₖ cₖpₖ that is affine in the parameters p.
+struct AffineScalar {
+  AffineScalar& operator+=(const AffineScalar& other) {
+    constant += other.constant;
+    for (const auto& term : other.terms) {
+      terms[term.first] += term.second;
+    }
+    return *this;
+  }
+
+  AffineScalar& operator*=(double scale) {
+    constant *= scale;
+    for (auto& term : terms) {
+      term.second *= scale;
+    }
+    return *this;
+  }
+
+  double constant{0};
+  // Maps the index of a parameter to its coefficient.
+  map<int, double> terms;
+};
+
+// A vector of coefficients that are affine in the parameters,
+//
+//     values = constant + parameter_coefficients * p,
+//
+// where parameter_coefficients has one column for each parameter of the
+// program when the coefficients were built.
+class AffineCoefficients {
+ public:
+  AffineCoefficients() = default;
+
+  explicit AffineCoefficients(const vector<AffineScalar>& scalars)
+      : constant_(scalars.size()) {
+    int num_parameters = 0;
+    vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < static_cast<int>(scalars.size()); ++i) {
+      constant_(i) = scalars[i].constant;
+      for (const auto& term : scalars[i].terms) {
+        triplets.emplace_back(i, term.first, term.second);
+        num_parameters = std::max(num_parameters, term.first + 1);
+      }
+    }
+    parameter_coefficients_.resize(scalars.size(), num_parameters);
+    parameter_coefficients_.setFromTriplets(triplets.begin(), triplets.end());
+  }
+
+  void Eval(const Eigen::VectorXd& parameter_values,
+            Eigen::Ref<Eigen::VectorXd> values) const {
+    DRAKE_ASSERT(parameter_values.rows() >= parameter_coefficients_.cols());
+    values = constant_;
+    values += parameter_coefficients_ *
+              parameter_values.head(parameter_coefficients_.cols());
+  }
+
+ private:
+  Eigen::VectorXd constant_;
+  Eigen::SparseMatrix<double> parameter_coefficients_;
+};
+
+// A sparse matrix whose nonzero entries are affine in the parameters. The
+// sparsity pattern does not depend on the parameter values, so that an
+// update only overwrites the values of the nonzero entries.
+class AffineSparseMatrix {
+ public:
+  AffineSparseMatrix() = default;
+
+  // `entries` maps (column, row) to the value of the entry, so that it is
+  // ordered as the nonzero entries of a compressed column-major matrix.
+  AffineSparseMatrix(int rows, int cols,
+                     const map<pair<int, int>, AffineScalar>& entries) {
+    vector<Eigen::Triplet<double>> triplets;
+    vector<AffineScalar> values;
+    triplets.reserve(entries.size());
+    values.reserve(entries.size());
+    for (const auto& entry : entries) {
+      triplets.emplace_back(entry.first.second, entry.first.first, 0.0);
+      values.push_back(entry.second);
+    }
+    matrix_.resize(rows, cols);
+    matrix_.setFromTriplets(triplets.begin(), triplets.end());
+    matrix_.makeCompressed();
+    DRAKE_DEMAND(matrix_.nonZeros() == static_cast<int>(values.size()));
+    values_ = AffineCoefficients(values);
+  }
+
+  // Evaluates the nonzero entries at `parameter_values` and returns the
+  // matrix.
+  const Eigen::SparseMatrix<double>& Eval(
+      const Eigen::VectorXd& parameter_values) {
+    Eigen::Map<Eigen::VectorXd> nonzeros(matrix_.valuePtr(),
+                                         matrix_.nonZeros());
+    values_.Eval(parameter_values, nonzeros);
+    return matrix_;
+  }
+
+ private:
+  Eigen::SparseMatrix<double> matrix_;
+  AffineCoefficients values_;
+};
+
+// A polynomial Σᵢ cᵢ Πₖ pₖ^dᵢₖ of the parameters p, for the constant term of
+// a cost, e.g. |p|² in |x - p|².
+class ParameterPolynomial {
+ public:
+  ParameterPolynomial() = default;
+
+  ParameterPolynomial(const Expression& e,
+                      const ParameterIndex& parameter_index) {
+    const symbolic::Polynomial poly{e};
+    for (const auto& p : poly.monomial_to_coefficient_map()) {
+      Term term;
+      term.coeff = get_constant_value(p.second);
+      for (const auto& power : p.first.get_powers()) {
+        term.powers.emplace_back(parameter_index.at(power.first.get_id()),
+                                 power.second);
+      }
+      terms_.push_back(std::move(term));
+    }
+  }
+
+  double Eval(const Eigen::VectorXd& parameter_values) const {
+    double value = 0;
+    for (const Term& term : terms_) {
+      double product = term.coeff;
+      for (const auto& power : term.powers) {
+        product *= std::pow(parameter_values(power.first), power.second);
+      }
+      value += product;
+    }
+    return value;
+  }
+
+ private:
+  struct Term {
+    double coeff{};
+    // Pairs of the index of a parameter and its exponent.
+    vector<pair<int, int>> powers;
+  };
+  vector<Term> terms_;
+};
+
+// Returns the variables of `e` that are not parameters.
+Variables GetDecisionVariables(const Expression& e,
+                               const ParameterIndex& parameter_index) {
+  Variables vars;
+  for (const Variable& var : e.GetVariables()) {
+    if (parameter_index.count(var.get_id()) == 0) {
+      vars.insert(var);
+    }
+  }
+  return vars;
+}
+
+// Decomposes `e` as a polynomial of total degree at most `max_degree` in its
+// decision variables, whose coefficients are expressions of the parameters.
+symbolic::Polynomial DecomposeInDecisionVariables(
+    const Expression& e, const ParameterIndex& parameter_index,
+    int max_degree) {
+  if (!e.is_polynomial()) {
+    ostringstream oss;
+    oss << "Expression " << e << " is not a polynomial.";
+    throw runtime_error(oss.str());
+  }
+  const symbolic::Polynomial poly{e,
+                                  GetDecisionVariables(e, parameter_index)};
+  if (poly.TotalDegree() > max_degree) {
+    ostringstream oss;
+    oss << "Expression " << e << " is "
+        << (max_degree == 1 ? "non-linear" : "non-quadratic")
+        << " in the decision variables.";
+    throw runtime_error(oss.str());
+  }
+  return poly;
+}
+
+// Decomposes the coefficient `c` of a monomial of `e` as an affine function
+// of the parameters.
+AffineScalar DecomposeParameterCoefficient(
+    const Expression& c, const ParameterIndex& parameter_index,
+    const Expression& e) {
+  AffineScalar result;
+  if (is_constant(c)) {
+    result.constant = get_constant_value(c);
+    return result;
+  }
+  const symbolic::Polynomial poly{c};
+  if (poly.TotalDegree() > 1) {
+    ostringstream oss;
+    oss << "Expression " << e << " has coefficients that are not affine in "
+        << "the parameters.";
+    throw runtime_error(oss.str());
+  }
+  for (const auto& p : poly.monomial_to_coefficient_map()) {
+    const double coeff = get_constant_value(p.second);
+    if (p.first.total_degree() == 0) {
+      result.constant += coeff;
+    } else {
+      const Variable& parameter = p.first.get_powers().begin()->first;
+      result.terms[parameter_index.at(parameter.get_id())] += coeff;
+    }
+  }
+  return result;
+}
+
+// Appends the decision variables of `poly` that are not in `vars` yet to
+// `vars`, sorted by ID as in ExtractAndAppendVariablesFromExpression().
+void AppendDecisionVariables(
+    const symbolic::Polynomial& poly, vector<Variable>* vars,
+    std::unordered_map<Variable::Id, int>* map_var_to_index) {
+  for (const Variable& var : poly.indeterminates()) {
+    if (map_var_to_index->emplace(var.get_id(), vars->size()).second) {
+      vars->push_back(var);
+    }
+  }
+}
+
+VectorXDecisionVariable ToVector(const vector<Variable>& vars) {
+  VectorXDecisionVariable result(vars.size());
+  for (int i = 0; i < static_cast<int>(vars.size()); ++i) {
+    result(i) = vars[i];
+  }
+  return result;
+}
+
+class ParametricLinearCost final : public ParametricCoefficients {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParametricLinearCost)
+
+  ParametricLinearCost(shared_ptr<LinearCost> cost,
+                       const vector<AffineScalar>& a, ParameterPolynomial b)
+      : cost_(std::move(cost)), a_(a), b_(std::move(b)), a_values_(a.size()) {}
+
+  // Copies the coefficients of `other`, to update `cost`.
+  ParametricLinearCost(shared_ptr<LinearCost> cost,
+                       const ParametricLinearCost& other)
+      : cost_(std::move(cost)), a_(other.a_), b_(other.b_),
+        a_values_(other.a_values_) {}
+
+  void Update(const Eigen::VectorXd& parameter_values) override {
+    a_.Eval(parameter_values, a_values_);
+    cost_->UpdateCoefficients(a_values_, b_.Eval(parameter_values));
+  }
+
+  shared_ptr<EvaluatorBase> evaluator() const override { return cost_; }
+
+  unique_ptr<ParametricCoefficients> Clone(
+      const Eigen::VectorXd& parameter_values) const override {
+    auto cost =
+        make_shared<LinearCost>(Eigen::VectorXd::Zero(a_values_.rows()));
+    cost->set_description(cost_->get_description());
+    auto clone = std::make_unique<ParametricLinearCost>(cost, *this);
+    clone->Update(parameter_values);
+    return clone;
+  }
+
+ private:
+  shared_ptr<LinearCost> cost_;
+  AffineCoefficients a_;
+  ParameterPolynomial b_;
+  Eigen::VectorXd a_values_;
+};
+
+class ParametricQuadraticCost final : public ParametricCoefficients {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParametricQuadraticCost)
+
+  ParametricQuadraticCost(shared_ptr<QuadraticCost> cost,
+                          AffineSparseMatrix Q, const vector<AffineScalar>& b,
+                          ParameterPolynomial c)
+      : cost_(std::move(cost)), Q_(std::move(Q)), b_(b), c_(std::move(c)),
+        b_values_(b.size()) {}
+
+  // Copies the coefficients of `other`, to update `cost`.
+  ParametricQuadraticCost(shared_ptr<QuadraticCost> cost,
+                          const ParametricQuadraticCost& other)
+      : cost_(std::move(cost)), Q_(other.Q_), b_(other.b_), c_(other.c_),
+        b_values_(other.b_values_) {}
+
+  void Update(const Eigen::VectorXd& parameter_values) override {
+    b_.Eval(parameter_values, b_values_);
+    cost_->UpdateCoefficients(Q_.Eval(parameter_values), b_values_,
+                              c_.Eval(parameter_values));
+  }
+
+  shared_ptr<EvaluatorBase> evaluator() const override { return cost_; }
+
+  unique_ptr<ParametricCoefficients> Clone(
+      const Eigen::VectorXd& parameter_values) const override {
+    const int num_vars = b_values_.rows();
+    auto cost = make_shared<QuadraticCost>(
+        Eigen::SparseMatrix<double>(num_vars, num_vars),
+        Eigen::VectorXd::Zero(num_vars));
+    cost->set_description(cost_->get_description());
+    auto clone = std::make_unique<ParametricQuadraticCost>(cost, *this);
+    clone->Update(parameter_values);
+    return clone;
+  }
+
+ private:
+  shared_ptr<QuadraticCost> cost_;
+  AffineSparseMatrix Q_;
+  AffineCoefficients b_;
+  ParameterPolynomial c_;
+  Eigen::VectorXd b_values_;
+};
+
+// Returns a linear constraint with zero coefficients, whose coefficients are
+// set by ParametricLinearConstraint. It is a LinearEqualityConstraint if
+// `is_equality` is true.
+shared_ptr<LinearConstraint> MakeLinearConstraint(int num_rows, int num_vars,
+                                                  bool is_equality) {
+  if (is_equality) {
+    return make_shared<LinearEqualityConstraint>(
+        Eigen::SparseMatrix<double>(num_rows, num_vars),
+        Eigen::VectorXd::Zero(num_rows));
+  }
+  return make_shared<LinearConstraint>(
+      Eigen::SparseMatrix<double>(num_rows, num_vars),
+      Eigen::VectorXd::Zero(num_rows), Eigen::VectorXd::Zero(num_rows));
+}
+
+class ParametricLinearConstraint final : public ParametricCoefficients {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParametricLinearConstraint)
+
+  ParametricLinearConstraint(shared_ptr<LinearConstraint> constraint,
+                             AffineSparseMatrix A,
+                             const vector<AffineScalar>& lb,
+                             const vector<AffineScalar>& ub)
+      : constraint_(std::move(constraint)), A_(std::move(A)), lb_(lb),
+        ub_(ub), lb_values_(lb.size()), ub_values_(ub.size()) {}
+
+  // Copies the coefficients of `other`, to update `constraint`.
+  ParametricLinearConstraint(shared_ptr<LinearConstraint> constraint,
+                             const ParametricLinearConstraint& other)
+      : constraint_(std::move(constraint)), A_(other.A_), lb_(other.lb_),
+        ub_(other.ub_), lb_values_(other.lb_values_),
+        ub_values_(other.ub_values_) {}
+
+  void Update(const Eigen::VectorXd& parameter_values) override {
+    lb_.Eval(parameter_values, lb_values_);
+    ub_.Eval(parameter_values, ub_values_);
+    const Eigen::SparseMatrix<double>& A = A_.Eval(parameter_values);
+    auto equality =
+        dynamic_cast<LinearEqualityConstraint*>(constraint_.get());
+    if (equality) {
+      equality->UpdateCoefficients(A, lb_values_);
+    } else {
+      constraint_->UpdateCoefficients(A, lb_values_, ub_values_);
+    }
+  }
+
+  shared_ptr<EvaluatorBase> evaluator() const override { return constraint_; }
+
+  unique_ptr<ParametricCoefficients> Clone(
+      const Eigen::VectorXd& parameter_values) const override {
+    auto constraint = MakeLinearConstraint(
+        constraint_->num_constraints(), constraint_->num_vars(),
+        dynamic_cast<LinearEqualityConstraint*>(constraint_.get()) != nullptr);
+    constraint->set_description(constraint_->get_description());
+    auto clone =
+        std::make_unique<ParametricLinearConstraint>(constraint, *this);
+    clone->Update(parameter_values);
+    return clone;
+  }
+
+ private:
+  shared_ptr<LinearConstraint> constraint_;
+  AffineSparseMatrix A_;
+  AffineCoefficients lb_;
+  AffineCoefficients ub_;
+  Eigen::VectorXd lb_values_;
+  Eigen::VectorXd ub_values_;
+};
+
+}  // namespace
+
+int GetDecisionVariableDegree(const Expression& e,
+                              const ParameterIndex& parameter_index) {
+  return symbolic::Polynomial(e, GetDecisionVariables(e, parameter_index))
+      .TotalDegree();
+}
+
+pair<Binding<LinearCost>, shared_ptr<ParametricCoefficients>>
+ParseParametricLinearCost(const Expression& e,
+                          const ParameterIndex& parameter_index,
+                          const Eigen::VectorXd& parameter_values) {
+  const symbolic::Polynomial poly =
+      DecomposeInDecisionVariables(e, parameter_index, 1);
+  vector<Variable> vars;
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  AppendDecisionVariables(poly, &vars, &map_var_to_index);
+
+  vector<AffineScalar> a(vars.size());
+  ParameterPolynomial b;
+  for (const auto& p : poly.monomial_to_coefficient_map()) {
+    if (p.first.total_degree() == 0) {
+      b = ParameterPolynomial(p.second, parameter_index);
+    } else {
+      const Variable& var = p.first.get_powers().begin()->first;
+      a[map_var_to_index.at(var.get_id())] +=
+          DecomposeParameterCoefficient(p.second, parameter_index, e);
+    }
+  }
+
+  auto cost = make_shared<LinearCost>(Eigen::VectorXd::Zero(vars.size()));
+  auto coefficients = make_shared<ParametricLinearCost>(cost, a, b);
+  coefficients->Update(parameter_values);
+  return make_pair(CreateBinding(cost, ToVector(vars)), coefficients);
+}
+
+pair<Binding<QuadraticCost>, shared_ptr<ParametricCoefficients>>
+ParseParametricQuadraticCost(const Expression& e,
+                             const ParameterIndex& parameter_index,
+                             const Eigen::VectorXd& parameter_values) {
+  const symbolic::Polynomial poly =
+      DecomposeInDecisionVariables(e, parameter_index, 2);
+  vector<Variable> vars;
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  AppendDecisionVariables(poly, &vars, &map_var_to_index);
+  const int num_vars = vars.size();
+
+  // The cost is 0.5 xᵀQx + bᵀx + c, so that the coefficient of xᵢxⱼ is
+  // Q(i, j) = Q(j, i) for i ≠ j, and the coefficient of xᵢ² is Q(i, i) / 2.
+  map<pair<int, int>, AffineScalar> Q_entries;
+  vector<AffineScalar> b(num_vars);
+  ParameterPolynomial c;
+  for (const auto& p : poly.monomial_to_coefficient_map()) {
+    const auto& powers = p.first.get_powers();
+    const int degree = p.first.total_degree();
+    if (degree == 0) {
+      c = ParameterPolynomial(p.second, parameter_index);
+      continue;
+    }
+    AffineScalar coeff =
+        DecomposeParameterCoefficient(p.second, parameter_index, e);
+    if (degree == 1) {
+      b[map_var_to_index.at(powers.begin()->first.get_id())] += coeff;
+    } else if (powers.size() == 1) {
+      const int i = map_var_to_index.at(powers.begin()->first.get_id());
+      coeff *= 2;
+      Q_entries[make_pair(i, i)] += coeff;
+    } else {
+      const int i = map_var_to_index.at(powers.begin()->first.get_id());
+      const int j = map_var_to_index.at(powers.rbegin()->first.get_id());
+      Q_entries[make_pair(i, j)] += coeff;
+      Q_entries[make_pair(j, i)] += coeff;
+    }
+  }
+
+  auto cost = make_shared<QuadraticCost>(
+      Eigen::SparseMatrix<double>(num_vars, num_vars),
+      Eigen::VectorXd::Zero(num_vars));
+  auto coefficients = make_shared<ParametricQuadraticCost>(
+      cost, AffineSparseMatrix(num_vars, num_vars, Q_entries), b, c);
+  coefficients->Update(parameter_values);
+  return make_pair(CreateBinding(cost, ToVector(vars)), coefficients);
+}
+
+pair<Binding<LinearConstraint>, shared_ptr<ParametricCoefficients>>
+ParseParametricLinearConstraint(
+    const Eigen::Ref<const VectorX<Expression>>& v,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const ParameterIndex& parameter_index,
+    const Eigen::VectorXd& parameter_values) {
+  DRAKE_DEMAND(v.rows() == lb.rows() && v.rows() == ub.rows());
+  const int num_rows = v.rows();
+  vector<Variable> vars;
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  map<pair<int, int>, AffineScalar> A_entries;
+  vector<AffineScalar> lb_rows(num_rows);
+  vector<AffineScalar> ub_rows(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    const symbolic::Polynomial poly =
+        DecomposeInDecisionVariables(v(i), parameter_index, 1);
+    AppendDecisionVariables(poly, &vars, &map_var_to_index);
+    // lb - k <= A x <= ub - k, where k is the constant term of v(i).
+    AffineScalar minus_k;
+    for (const auto& p : poly.monomial_to_coefficient_map()) {
+      const AffineScalar coeff =
+          DecomposeParameterCoefficient(p.second, parameter_index, v(i));
+      if (p.first.total_degree() == 0) {
+        minus_k += coeff;
+      } else {
+        const Variable& var = p.first.get_powers().begin()->first;
+        A_entries[make_pair(map_var_to_index.at(var.get_id()), i)] += coeff;
+      }
+    }
+    minus_k *= -1;
+    lb_rows[i].constant = lb(i);
+    ub_rows[i].constant = ub(i);
+    if (!std::isinf(lb(i))) {
+      lb_rows[i] += minus_k;
+    }
+    if (!std::isinf(ub(i))) {
+      ub_rows[i] += minus_k;
+    }
+  }
+  const int num_vars = vars.size();
+
+  const shared_ptr<LinearConstraint> constraint =
+      MakeLinearConstraint(num_rows, num_vars, lb == ub);
+  auto coefficients = make_shared<ParametricLinearConstraint>(
+      constraint, AffineSparseMatrix(num_rows, num_vars, A_entries), lb_rows,
+      ub_rows);
+  coefficients->Update(parameter_values);
+  return make_pair(CreateBinding(constraint, ToVector(vars)), coefficients);
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic.h"
+#include "drake/solvers/binding.h"
+#include "drake/solvers/constraint.h"
+#include "drake/solvers/cost.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+/*
+ * Maps the ID of each parameter of a program to its index in the vector of
+ * parameter values.
+ */
+using ParameterIndex = std::unordered_map<symbolic::Variable::Id, int>;
+
+/*
+ * The coefficients of a cost or a constraint whose symbolic expression
+ * contains parameters. The expression is decomposed once, into a sparsity
+ * pattern and coefficients that are affine in the parameters. Update() then
+ * sets the coefficients of the evaluator for new parameter values, without
+ * parsing the expression again.
+ */
+class ParametricCoefficients {
+ public:
+  virtual ~ParametricCoefficients() = default;
+
+  /*
+   * Updates the coefficients of the evaluator. The parameters that were added
+   * to the program after the expression was parsed are ignored, so that
+   * `parameter_values` can be longer than when this object was built.
+   */
+  virtual void Update(const Eigen::VectorXd& parameter_values) = 0;
+
+  /*
+   * Returns the cost or constraint whose coefficients are updated.
+   */
+  virtual std::shared_ptr<EvaluatorBase> evaluator() const = 0;
+
+  /*
+   * Returns a copy of this object that updates a new copy of evaluator(),
+   * whose coefficients are evaluated at `parameter_values`. Updating the copy
+   * does not change evaluator().
+   */
+  virtual std::unique_ptr<ParametricCoefficients> Clone(
+      const Eigen::VectorXd& parameter_values) const = 0;
+};
+
+/*
+ * Returns the total degree of `e` in its variables that are not parameters.
+ * @throws std::runtime_error if `e` is not a polynomial in these variables.
+ */
+int GetDecisionVariableDegree(const symbolic::Expression& e,
+                              const ParameterIndex& parameter_index);
+
+/*
+ * Parses an expression `e` that is affine in the decision variables, and
+ * whose coefficients are affine in the parameters, into a linear cost. The
+ * constant term of `e` can be any polynomial of the parameters.
+ * @param e The expression. Its variables that are not in `parameter_index`
+ * are bound by the cost.
+ * @param parameter_index Maps the parameters to `parameter_values`.
+ * @param parameter_values The values at which the cost is evaluated at first.
+ * @retval pair pair.first is the cost, pair.second updates it.
+ * @throws std::runtime_error if `e` is not of that form.
+ */
+std::pair<Binding<LinearCost>, std::shared_ptr<ParametricCoefficients>>
+ParseParametricLinearCost(const symbolic::Expression& e,
+                          const ParameterIndex& parameter_index,
+                          const Eigen::VectorXd& parameter_values);
+
+/*
+ * Parses an expression `e` that is quadratic in the decision variables, and
+ * whose coefficients are affine in the parameters, into a quadratic cost. The
+ * arguments are as in ParseParametricLinearCost().
+ */
+std::pair<Binding<QuadraticCost>, std::shared_ptr<ParametricCoefficients>>
+ParseParametricQuadraticCost(const symbolic::Expression& e,
+                             const ParameterIndex& parameter_index,
+                             const Eigen::VectorXd& parameter_values);
+
+/*
+ * Parses lb <= v <= ub, where each v(i) is affine in the decision variables
+ * with coefficients that are affine in the parameters, into a linear
+ * constraint. The constraint is a LinearEqualityConstraint if lb == ub. The
+ * constant terms of v, and so the bounds of the constraint, are affine in the
+ * parameters too, but infinite bounds stay infinite. The other arguments are
+ * as in ParseParametricLinearCost().
+ */
+std::pair<Binding<LinearConstraint>, std::shared_ptr<ParametricCoefficients>>
+ParseParametricLinearConstraint(
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
+    const Eigen::Ref<const Eigen::VectorXd>& lb,
+    const Eigen::Ref<const Eigen::VectorXd>& ub,
+    const ParameterIndex& parameter_index,
+    const Eigen::VectorXd& parameter_values);
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -4,10 +4,16 @@
 /* clang-format on */
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <map>
+#include <mutex>
 
+#include <Eigen/Sparse>
+
+#include "drake/common/never_destroyed.h"
 #include "drake/math/cross_product.h"
 #include "drake/solvers/bilinear_product_util.h"
 
@@ -439,10 +445,10 @@ void ComputeHalfSpaceRelaxationForBoxSphereIntersection(
     prog_normal.AddLinearConstraint(n_var.dot(pt) >= d_var(0));
   }
 
-  // TODO(hongkai.dai): This optimization is expensive, especially if we have
-  // multiple rotation matrices, all relaxed with the same number of binary
-  // variables per half axis, the result `n` and `d` are the same. Should
-  // consider hard-coding the result, to avoid repeated computation.
+  // This optimization is expensive. The result `n` and `d` only depends on
+  // the number of binary variables per half axis, so the McCormick envelope
+  // constraints that use it are cached by
+  // GetMcCormickVectorConstraintTemplate().
 
   Vector4<symbolic::Expression> lorentz_cone_vars;
   lorentz_cone_vars << 1, n_var;
@@ -522,12 +528,91 @@ void ComputeInnerFacetsForBoxSphereIntersection(
 
 namespace {
 
-void AddMcCormickVectorConstraints(
-    MathematicalProgram* prog, const VectorDecisionVariable<3>& v,
-    const std::vector<Vector3<Expression>>& cpos,
-    const std::vector<Vector3<Expression>>& cneg,
-    const VectorDecisionVariable<3>& v1, const VectorDecisionVariable<3>& v2) {
-  const int N = cpos.size();  // number of discretization points.
+// The constraints that AddMcCormickVectorConstraints() imposes on a unit
+// vector v, and on the vectors v1, v2 that complete it to an orthonormal basis
+// with v2 = v × v1. They are written as lb <= A * x <= ub over the stacked
+// variables
+//   x = [v; v1; v2; Bpos[0]; ...; Bpos[N-1]; Bneg[0]; ...; Bneg[N-1]],
+// where N is the number of binary variables per half axis, and Bpos, Bneg are
+// defined as BRpos, BRneg in AddRotationMatrixMcCormickEnvelopeMilpConstraints.
+// The coefficients only depend on N, so that they are computed once for each
+// N, and are then bound to the variables of every vector.
+struct McCormickVectorConstraintTemplate {
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd lb;
+  Eigen::VectorXd ub;
+};
+
+// Accumulates the rows of a McCormickVectorConstraintTemplate.
+class McCormickVectorConstraintTemplateBuilder {
+ public:
+  explicit McCormickVectorConstraintTemplateBuilder(int N) : N_(N) {}
+
+  // Adds the row
+  //   lb <= a_v * v + a_v1 * v1 + a_v2 * v2 + a_c * c_sum <= ub,
+  // where c_sum = c[xi](0) + c[yi](1) + c[zi](2) is the sum of the expressions
+  // which are 1 iff v is in the box (xi, yi, zi) of the given orthant. As in
+  // AddRotationMatrixMcCormickEnvelopeMilpConstraints,
+  //   c[k] = B[k] - B[k+1] if k < N - 1, otherwise c[k] = B[N-1],
+  // where B is Bpos along the positive axes of the orthant, and Bneg along its
+  // negative axes.
+  void AddRow(const Eigen::Ref<const Eigen::RowVector3d>& a_v,
+              const Eigen::Ref<const Eigen::RowVector3d>& a_v1,
+              const Eigen::Ref<const Eigen::RowVector3d>& a_v2, double a_c,
+              const std::array<int, 3>& box, int orthant, double lb,
+              double ub) {
+    const int row = static_cast<int>(lb_.size());
+    for (int i = 0; i < 3; ++i) {
+      AddCoefficient(row, i, a_v(i));
+      AddCoefficient(row, 3 + i, a_v1(i));
+      AddCoefficient(row, 6 + i, a_v2(i));
+    }
+    if (a_c != 0) {
+      for (int axis = 0; axis < 3; ++axis) {
+        // Same convention as FlipVector() and PickPermutation().
+        const bool is_negative = orthant & (1 << (2 - axis));
+        const int k = box[axis];
+        AddCoefficient(row, BinaryColumn(is_negative, k, axis), a_c);
+        if (k < N_ - 1) {
+          AddCoefficient(row, BinaryColumn(is_negative, k + 1, axis), -a_c);
+        }
+      }
+    }
+    lb_.push_back(lb);
+    ub_.push_back(ub);
+  }
+
+  McCormickVectorConstraintTemplate Build() const {
+    McCormickVectorConstraintTemplate result;
+    result.A.resize(static_cast<int>(lb_.size()), 9 + 6 * N_);
+    result.A.setFromTriplets(triplets_.begin(), triplets_.end());
+    result.lb = Eigen::Map<const Eigen::VectorXd>(lb_.data(), lb_.size());
+    result.ub = Eigen::Map<const Eigen::VectorXd>(ub_.data(), ub_.size());
+    return result;
+  }
+
+ private:
+  int BinaryColumn(bool is_negative, int k, int axis) const {
+    return 9 + (is_negative ? 3 * N_ : 0) + 3 * k + axis;
+  }
+
+  void AddCoefficient(int row, int col, double value) {
+    if (value != 0) {
+      triplets_.emplace_back(row, col, value);
+    }
+  }
+
+  const int N_;
+  std::vector<Eigen::Triplet<double>> triplets_;
+  std::vector<double> lb_;
+  std::vector<double> ub_;
+};
+
+McCormickVectorConstraintTemplate BuildMcCormickVectorConstraintTemplate(
+    int N) {
+  const double kInf = numeric_limits<double>::infinity();
+  const Eigen::RowVector3d zero = Eigen::RowVector3d::Zero();
+  McCormickVectorConstraintTemplateBuilder builder(N);
 
   // Iterate through regions.
   Eigen::Vector3d box_min, box_max;
@@ -540,10 +625,7 @@ void AddMcCormickVectorConstraints(
       for (int zi = 0; zi < N; zi++) {
         box_min(2) = EnvelopeMinValue(zi, N);
         box_max(2) = EnvelopeMinValue(zi + 1, N);
-
-        Vector3<Expression> this_cpos, this_cneg;
-        this_cpos << cpos[xi](0), cpos[yi](1), cpos[zi](2);
-        this_cneg << cneg[xi](0), cneg[yi](1), cneg[zi](2);
+        const std::array<int, 3> box{{xi, yi, zi}};
 
         const double box_min_norm = box_min.lpNorm<2>();
         const double box_max_norm = box_max.lpNorm<2>();
@@ -590,33 +672,29 @@ void AddMcCormickVectorConstraints(
             } else {
               unique_intersection = box_max / box_max_norm;
             }
-            Eigen::Vector3d orthant_u;
-            Vector3<Expression> orthant_c;
             for (int o = 0; o < 8; o++) {  // iterate over orthants
-              orthant_u = FlipVector(unique_intersection, o);
-              orthant_c = PickPermutation(this_cpos, this_cneg, o);
-
-              // TODO(hongkai.dai): remove this for loop when we can handle
-              // Eigen::Array of symbolic formulae.
-              Expression orthant_c_sum = orthant_c.cast<Expression>().sum();
+              const Eigen::Vector3d orthant_u =
+                  FlipVector(unique_intersection, o);
               for (int i = 0; i < 3; ++i) {
-                prog->AddLinearConstraint(v(i) - orthant_u(i) <=
-                                          6 - 2 * orthant_c_sum);
-                prog->AddLinearConstraint(v(i) - orthant_u(i) >=
-                                          2 * orthant_c_sum - 6);
+                const Eigen::RowVector3d e_i = Eigen::RowVector3d::Unit(i);
+                builder.AddRow(e_i, zero, zero, 2, box, o, -kInf,
+                               6 + orthant_u(i));
+                builder.AddRow(e_i, zero, zero, -2, box, o, orthant_u(i) - 6,
+                               kInf);
               }
-              const Expression v_dot_v1 = orthant_u.dot(v1);
-              const Expression v_dot_v2 = orthant_u.dot(v2);
-              prog->AddLinearConstraint(v_dot_v1 <= 3 - orthant_c_sum);
-              prog->AddLinearConstraint(orthant_c_sum - 3 <= v_dot_v1);
-              prog->AddLinearConstraint(v_dot_v2 <= 3 - orthant_c_sum);
-              prog->AddLinearConstraint(orthant_c_sum - 3 <= v_dot_v2);
-              const Vector3<Expression> v_cross_v1 = orthant_u.cross(v1);
+              const Eigen::RowVector3d u_transpose = orthant_u.transpose();
+              builder.AddRow(zero, u_transpose, zero, 1, box, o, -kInf, 3);
+              builder.AddRow(zero, u_transpose, zero, -1, box, o, -3, kInf);
+              builder.AddRow(zero, zero, u_transpose, 1, box, o, -kInf, 3);
+              builder.AddRow(zero, zero, u_transpose, -1, box, o, -3, kInf);
+              // v.cross(v1) = u_hat * v1 when v = u.
+              const Eigen::Matrix3d u_hat =
+                  math::VectorToSkewSymmetric(orthant_u);
               for (int i = 0; i < 3; ++i) {
-                prog->AddLinearConstraint(v_cross_v1(i) - v2(i) <=
-                                          6 - 2 * orthant_c_sum);
-                prog->AddLinearConstraint(v_cross_v1(i) - v2(i) >=
-                                          2 * orthant_c_sum - 6);
+                const Eigen::RowVector3d e_i = Eigen::RowVector3d::Unit(i);
+                builder.AddRow(zero, u_hat.row(i), -e_i, 2, box, o, -kInf, 6);
+                builder.AddRow(zero, u_hat.row(i), -e_i, -2, box, o, -6,
+                               kInf);
               }
             }
           } else {
@@ -643,14 +721,9 @@ void AddMcCormickVectorConstraints(
             double cos_theta = d;
             const double theta = std::acos(cos_theta);
 
-            Eigen::Matrix<double, 1, 6> a;
-            Eigen::Matrix<double, 3, 9> A_cross;
-
-            Eigen::Vector3d orthant_normal;
-            Vector3<Expression> orthant_c;
             for (int o = 0; o < 8; o++) {  // iterate over orthants
-              orthant_normal = FlipVector(normal, o);
-              orthant_c = PickPermutation(this_cpos, this_cneg, o);
+              const Eigen::Vector3d orthant_normal = FlipVector(normal, o);
+              const Eigen::RowVector3d n_transpose = orthant_normal.transpose();
 
               for (int i = 0; i < A.rows(); ++i) {
                 // Add the constraint that A * v <= b, representing the inner
@@ -665,24 +738,19 @@ void AddMcCormickVectorConstraints(
                 //   A.row(i) * v <= b(i)
                 // Otherwise
                 //   A.row(i) * v -b(i) is not constrained
-                Eigen::Vector3d orthant_a =
+                const Eigen::Vector3d orthant_a =
                     -FlipVector(-A.row(i).transpose(), o);
-                prog->AddLinearConstraint(
-                    orthant_a.dot(v) - b(i) <=
-                    3 - 3 * b(i) +
-                        (b(i) - 1) *
-                            orthant_c.cast<symbolic::Expression>().sum());
+                builder.AddRow(orthant_a.transpose(), zero, zero, 1 - b(i),
+                               box, o, -kInf, 3 - 2 * b(i));
               }
 
               // Max vector norm constraint: -1 <= normal'*x <= 1.
               // No need to restrict to this orthant, but also no need to apply
               // the same constraint twice (would be the same for opposite
               // orthants), so skip all of the -x orthants.
-              if (o % 2 == 0)
-                prog->AddLinearConstraint(
-                  orthant_normal.transpose(), -1, 1, v);
-
-              const symbolic::Expression orthant_c_sum{orthant_c.sum()};
+              if (o % 2 == 0) {
+                builder.AddRow(n_transpose, zero, zero, 0, box, o, -1, 1);
+              }
 
               // Dot-product constraint: ideally v.dot(v1) = v.dot(v2) = 0.
               // The cone of (unit) vectors within theta of the normal vector
@@ -721,15 +789,15 @@ void AddMcCormickVectorConstraints(
               // nᵀ * v1 + sinθ >= (-1 + sinθ)*(3 - c_sum)
               // nᵀ * v2 + sinθ >= (-1 + sinθ)*(3 - c_sum)
               const double sin_theta{sin(theta)};
-              prog->AddLinearConstraint(orthant_normal.dot(v1) + sin_theta >=
-                                        (-1 + sin_theta) * (3 - orthant_c_sum));
-              prog->AddLinearConstraint(orthant_normal.dot(v2) + sin_theta >=
-                                        (-1 + sin_theta) * (3 - orthant_c_sum));
+              builder.AddRow(zero, n_transpose, zero, sin_theta - 1, box, o,
+                             2 * sin_theta - 3, kInf);
+              builder.AddRow(zero, zero, n_transpose, sin_theta - 1, box, o,
+                             2 * sin_theta - 3, kInf);
 
-              prog->AddLinearConstraint(orthant_normal.dot(v1) - sin_theta <=
-                                        (1 - sin_theta) * (3 - orthant_c_sum));
-              prog->AddLinearConstraint(orthant_normal.dot(v2) - sin_theta <=
-                                        (1 - sin_theta) * (3 - orthant_c_sum));
+              builder.AddRow(zero, n_transpose, zero, 1 - sin_theta, box, o,
+                             -kInf, 3 - 2 * sin_theta);
+              builder.AddRow(zero, zero, n_transpose, 1 - sin_theta, box, o,
+                             -kInf, 3 - 2 * sin_theta);
 
               // Cross-product constraint: ideally v2 = v.cross(v1).
               // Since v is within theta of normal, we will prove that
@@ -758,32 +826,100 @@ void AddMcCormickVectorConstraints(
               // constraint of the form:
               //   |v2 - normal.cross(v1)| <= 2*sin(θ/2).
               const double sin_theta2 = sin(theta/2);
-              const Vector3<symbolic::Expression> v2_minus_n_cross_v1{
-                  v2 - orthant_normal.cross(v1)};
-              prog->AddLinearConstraint(
-                  v2_minus_n_cross_v1 <=
-                  Vector3<symbolic::Expression>::Constant(
-                      2 * sin_theta2 +
-                      (2 - 2 * sin_theta2) * (3 - orthant_c_sum)));
-              prog->AddLinearConstraint(
-                  v2_minus_n_cross_v1 >=
-                  Vector3<symbolic::Expression>::Constant(
-                      -2 * sin_theta2 +
-                      (-2 + 2 * sin_theta2) * (3 - orthant_c_sum)));
+              const Eigen::Matrix3d n_hat =
+                  math::VectorToSkewSymmetric(orthant_normal);
+              for (int i = 0; i < 3; ++i) {
+                const Eigen::RowVector3d e_i = Eigen::RowVector3d::Unit(i);
+                builder.AddRow(zero, -n_hat.row(i), e_i, 2 - 2 * sin_theta2,
+                               box, o, -kInf, 6 - 4 * sin_theta2);
+                builder.AddRow(zero, -n_hat.row(i), e_i, 2 * sin_theta2 - 2,
+                               box, o, 4 * sin_theta2 - 6, kInf);
+              }
             }
           }
         } else {
           // This box does not intersect with the surface of the sphere.
           for (int o = 0; o < 8; ++o) {  // iterate over orthants
-            prog->AddLinearConstraint(PickPermutation(this_cpos, this_cneg, o)
-                                          .cast<Expression>()
-                                          .sum(),
-                                      0.0, 2.0);
+            builder.AddRow(zero, zero, zero, 1, box, o, 0, 2);
           }
         }
       }
     }
   }
+  return builder.Build();
+}
+
+// The templates built so far, indexed by N, and the number of times that
+// BuildMcCormickVectorConstraintTemplate() was called to fill them.
+struct McCormickVectorConstraintTemplateCache {
+  std::mutex mutex;
+  std::map<int, McCormickVectorConstraintTemplate> templates;
+  int num_builds{0};
+};
+
+McCormickVectorConstraintTemplateCache& GetMcCormickCache() {
+  static never_destroyed<McCormickVectorConstraintTemplateCache> cache;
+  return cache.access();
+}
+
+// Returns the McCormickVectorConstraintTemplate for N binary variables per
+// half axis, building it the first time that it is requested. Building it
+// solves an optimization program for each box whose intersection with the
+// unit sphere has more than 3 non co-planar vertices. Only the distinct N
+// requested by the process are kept, each template holding O(N³) rows.
+const McCormickVectorConstraintTemplate& GetMcCormickVectorConstraintTemplate(
+    int N) {
+  McCormickVectorConstraintTemplateCache& cache = GetMcCormickCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto it = cache.templates.find(N);
+  if (it == cache.templates.end()) {
+    it = cache.templates
+             .emplace(N, BuildMcCormickVectorConstraintTemplate(N))
+             .first;
+    ++cache.num_builds;
+  }
+  // std::map never moves its elements, so the reference outlives the lock.
+  return it->second;
+}
+}  // namespace
+
+namespace internal {
+// Returns the number of McCormick vector constraint templates built so far by
+// the process, so that tests can check that they are reused.
+int GetNumMcCormickVectorConstraintTemplateBuilds() {
+  McCormickVectorConstraintTemplateCache& cache = GetMcCormickCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.num_builds;
+}
+}  // namespace internal
+
+namespace {
+// Adds the McCormick envelope constraints on the unit vector v, and on the
+// vectors v1, v2 with v2 = v × v1, where v(i) is in the k'th interval of the
+// positive (negative) half axis iff Bpos[k](i) - Bpos[k+1](i) = 1
+// (Bneg[k](i) - Bneg[k+1](i) = 1). The coefficients are those of
+// `constraint_template`, returned by GetMcCormickVectorConstraintTemplate()
+// for N = Bpos.size().
+void AddMcCormickVectorConstraints(
+    MathematicalProgram* prog,
+    const McCormickVectorConstraintTemplate& constraint_template,
+    const VectorDecisionVariable<3>& v,
+    const std::vector<VectorDecisionVariable<3>>& Bpos,
+    const std::vector<VectorDecisionVariable<3>>& Bneg,
+    const VectorDecisionVariable<3>& v1, const VectorDecisionVariable<3>& v2) {
+  const int N = Bpos.size();  // number of discretization points.
+  DRAKE_ASSERT(static_cast<int>(Bneg.size()) == N);
+  DRAKE_ASSERT(constraint_template.A.cols() == 9 + 6 * N);
+  VectorXDecisionVariable x(9 + 6 * N);
+  x.segment<3>(0) = v;
+  x.segment<3>(3) = v1;
+  x.segment<3>(6) = v2;
+  for (int k = 0; k < N; ++k) {
+    x.segment<3>(9 + 3 * k) = Bpos[k];
+    x.segment<3>(9 + 3 * (N + k)) = Bneg[k];
+  }
+  prog->AddLinearConstraint(constraint_template.A, constraint_template.lb,
+                            constraint_template.ub, x);
 }
 
 /**
@@ -1131,39 +1267,66 @@ AddRotationMatrixMcCormickEnvelopeMilpConstraints(
   CRneg.push_back(
     BRneg[num_binary_vars_per_half_axis - 1].cast<symbolic::Expression>());
 
+  // The constraints between R(i,j) and the binary variables are
+  //   lb <= A_interval * [R(i,j); BRpos[0](i,j); ...; BRpos[N-1](i,j);
+  //                       BRneg[0](i,j); ...; BRneg[N-1](i,j)] <= ub,
+  // with N = num_binary_vars_per_half_axis, and the same A_interval, lb, ub
+  // for every entry (i,j).
+  const int N = num_binary_vars_per_half_axis;
+  Eigen::MatrixXd A_interval = Eigen::MatrixXd::Zero(4 * N, 2 * N + 1);
+  Eigen::VectorXd lb_interval(4 * N);
+  Eigen::VectorXd ub_interval(4 * N);
+  A_interval.col(0).setOnes();
+  for (int k = 0; k < N; k++) {
+    // R(i,j) > phi(k) => BRpos[k](i,j) = 1
+    // R(i,j) < phi(k) => BRpos[k](i,j) = 0
+    // R(i,j) = phi(k) => BRpos[k](i,j) = 0 or 1
+    // Since -s1 <= R(i, j) - phi(k) <= s2,
+    // where s1 = 1 + phi(k), s2 = 1 - phi(k). The point
+    // [R(i,j) - phi(k), BRpos[k](i,j)] has to lie within the convex hull,
+    // whose vertices are (-s1, 0), (0, 0), (s2, 1), (0, 1). By computing
+    // the edges of this convex hull, we get
+    // -s1 + s1*BRpos[k](i,j) <= R(i,j)-phi(k) <= s2 * BRpos[k](i,j)
+    double s1 = 1 + phi(k);
+    double s2 = 1 - phi(k);
+    A_interval(4 * k, 1 + k) = -s1;
+    lb_interval(4 * k) = phi(k) - s1;
+    ub_interval(4 * k) = numeric_limits<double>::infinity();
+    A_interval(4 * k + 1, 1 + k) = -s2;
+    lb_interval(4 * k + 1) = -numeric_limits<double>::infinity();
+    ub_interval(4 * k + 1) = phi(k);
+
+    // -R(i,j) > phi(k) => BRneg[k](i,j) = 1
+    // -R(i,j) < phi(k) => BRneg[k](i,j) = 0
+    // -R(i,j) = phi(k) => BRneg[k](i,j) = 0 or 1
+    // Since -s2 <= R(i, j) + phi(k) <= s1,
+    // where s1 = 1 + phi(k), s2 = 1 - phi(k). The point
+    // [R(i,j) + phi(k), BRneg[k](i,j)] has to lie within the convex hull
+    // whose vertices are (-s2, 1), (0, 0), (s1, 0), (0, 1). By computing
+    // the edges of the convex hull, we get
+    // -s2 * BRneg[k](i,j) <= R(i,j)+phi(k) <= s1-s1*BRneg[k](i,j)
+    A_interval(4 * k + 2, 1 + N + k) = s1;
+    lb_interval(4 * k + 2) = -numeric_limits<double>::infinity();
+    ub_interval(4 * k + 2) = s1 - phi(k);
+    A_interval(4 * k + 3, 1 + N + k) = s2;
+    lb_interval(4 * k + 3) = -phi(k);
+    ub_interval(4 * k + 3) = numeric_limits<double>::infinity();
+  }
+
+  VectorXDecisionVariable interval_vars(2 * N + 1);
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 3; j++) {
-      for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
-        // R(i,j) > phi(k) => BRpos[k](i,j) = 1
-        // R(i,j) < phi(k) => BRpos[k](i,j) = 0
-        // R(i,j) = phi(k) => BRpos[k](i,j) = 0 or 1
-        // Since -s1 <= R(i, j) - phi(k) <= s2,
-        // where s1 = 1 + phi(k), s2 = 1 - phi(k). The point
-        // [R(i,j) - phi(k), BRpos[k](i,j)] has to lie within the convex hull,
-        // whose vertices are (-s1, 0), (0, 0), (s2, 1), (0, 1). By computing
-        // the edges of this convex hull, we get
-        // -s1 + s1*BRpos[k](i,j) <= R(i,j)-phi(k) <= s2 * BRpos[k](i,j)
-        double s1 = 1 + phi(k);
-        double s2 = 1 - phi(k);
-        prog->AddLinearConstraint(R(i, j) - phi(k) >=
-                                  -s1 + s1 * BRpos[k](i, j));
-        prog->AddLinearConstraint(R(i, j) - phi(k) <= s2 * BRpos[k](i, j));
-
-        // -R(i,j) > phi(k) => BRneg[k](i,j) = 1
-        // -R(i,j) < phi(k) => BRneg[k](i,j) = 0
-        // -R(i,j) = phi(k) => BRneg[k](i,j) = 0 or 1
-        // Since -s2 <= R(i, j) + phi(k) <= s1,
-        // where s1 = 1 + phi(k), s2 = 1 - phi(k). The point
-        // [R(i,j) + phi(k), BRneg[k](i,j)] has to lie within the convex hull
-        // whose vertices are (-s2, 1), (0, 0), (s1, 0), (0, 1). By computing
-        // the edges of the convex hull, we get
-        // -s2 * BRneg[k](i,j) <= R(i,j)+phi(k) <= s1-s1*BRneg[k](i,j)
-        prog->AddLinearConstraint(R(i, j) + phi(k)
-                                      <= s1 - s1 * BRneg[k](i, j));
-        prog->AddLinearConstraint(R(i, j) + phi(k) >= -s2 * BRneg[k](i, j));
+      interval_vars(0) = R(i, j);
+      for (int k = 0; k < N; k++) {
+        interval_vars(1 + k) = BRpos[k](i, j);
+        interval_vars(1 + N + k) = BRneg[k](i, j);
       }
+      prog->AddLinearConstraint(A_interval, lb_interval, ub_interval,
+                                interval_vars);
       // R(i,j) has to pick a side, either non-positive or non-negative.
-      prog->AddLinearConstraint(BRpos[0](i, j) + BRneg[0](i, j) == 1);
+      prog->AddLinearEqualityConstraint(
+          Eigen::RowVector2d::Ones(), 1,
+          {BRpos[0].block<1, 1>(i, j), BRneg[0].block<1, 1>(i, j)});
 
       // for debugging: constrain to positive orthant.
       //      prog->AddBoundingBoxConstraint(1,1,{BRpos[0].block<1,1>(i,j)});
@@ -1181,27 +1344,32 @@ AddRotationMatrixMcCormickEnvelopeMilpConstraints(
   AddBoundingBoxConstraintsImpliedByRollPitchYawLimitsToBinary(prog, BRpos[0],
                                                                limits);
 
-  // Add constraints to the column and row vectors.
-  std::vector<Vector3<Expression>>
-      cpos(num_binary_vars_per_half_axis),
-      cneg(num_binary_vars_per_half_axis);
+  // Add constraints to the column and row vectors. Their coefficients only
+  // depend on num_binary_vars_per_half_axis, so that they are shared by the six
+  // vectors, and by every rotation matrix with the same
+  // num_binary_vars_per_half_axis.
+  const McCormickVectorConstraintTemplate& constraint_template =
+      GetMcCormickVectorConstraintTemplate(num_binary_vars_per_half_axis);
+  std::vector<VectorDecisionVariable<3>>
+      bpos(num_binary_vars_per_half_axis),
+      bneg(num_binary_vars_per_half_axis);
   for (int i = 0; i < 3; i++) {
     // Make lists of the decision variables in terms of column vectors and row
     // vectors to facilitate the calls below.
-    // TODO(russt): Consider reorganizing the original CRpos/CRneg variables to
-    // avoid this (albeit minor) cost?
     for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
-      cpos[k] = CRpos[k].col(i);
-      cneg[k] = CRneg[k].col(i);
+      bpos[k] = BRpos[k].col(i);
+      bneg[k] = BRneg[k].col(i);
     }
-    AddMcCormickVectorConstraints(prog, R.col(i), cpos, cneg,
-                                  R.col((i + 1) % 3), R.col((i + 2) % 3));
+    AddMcCormickVectorConstraints(prog, constraint_template, R.col(i), bpos,
+                                  bneg, R.col((i + 1) % 3),
+                                  R.col((i + 2) % 3));
 
     for (int k = 0; k < num_binary_vars_per_half_axis; k++) {
-      cpos[k] = CRpos[k].row(i).transpose();
-      cneg[k] = CRneg[k].row(i).transpose();
+      bpos[k] = BRpos[k].row(i).transpose();
+      bneg[k] = BRneg[k].row(i).transpose();
     }
-    AddMcCormickVectorConstraints(prog, R.row(i).transpose(), cpos, cneg,
+    AddMcCormickVectorConstraints(prog, constraint_template,
+                                  R.row(i).transpose(), bpos, bneg,
                                   R.row((i + 1) % 3).transpose(),
                                   R.row((i + 2) % 3).transpose());
   }
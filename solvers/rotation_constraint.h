@@ -123,6 +123,18 @@ std::tuple<std::vector<Matrix3<symbolic::Expression>>,
  *    layered so that constraining one region establishes constraints
  *    on large portions of SO(3), and confers hopefully "useful" constraints
  *    the on other binary variables.
+ *
+ * Note: The McCormick envelope constraints on each of the three rows and
+ * three columns of R are added as a single sparse LinearConstraint, rather
+ * than one LinearConstraint per envelope facet, so that this function adds
+ * far fewer bindings to prog.linear_constraints() than the number of rows of
+ * the envelope. Code that counts or indexes those bindings should use
+ * LinearConstraint::num_constraints() instead. The coefficients of these
+ * constraints only depend on num_binary_vars_per_half_axis. They are computed
+ * the first time that this function is called with a given
+ * num_binary_vars_per_half_axis, and then reused, so that adding the
+ * constraints for many rotation matrices (e.g. for every body in global
+ * inverse kinematics) is much cheaper than the first call.
  * @param prog The mathematical program to which the constraints are added.
  * @param R The rotation matrix
  * @param num_binary_vars_per_half_axis number of binary variables for a half
@@ -22,6 +22,8 @@ bool AreAllVerticesCoPlanar(const std::vector<Eigen::Vector3d>& pts,
 void ComputeInnerFacetsForBoxSphereIntersection(
     const std::vector<Eigen::Vector3d>& pts,
     Eigen::Matrix<double, Eigen::Dynamic, 3>* A, Eigen::VectorXd* b);
+
+int GetNumMcCormickVectorConstraintTemplateBuilds();
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
@@ -170,40 +170,36 @@ void ParseLinearConstraint(const MathematicalProgram& prog,
     const Eigen::VectorXd& ub = linear_constraint.evaluator()->upper_bound();
     const Eigen::VectorXd& lb = linear_constraint.evaluator()->lower_bound();
     const VectorXDecisionVariable& x = linear_constraint.variables();
-    const Eigen::MatrixXd& Ai = linear_constraint.evaluator()->A();
-    for (int i = 0; i < linear_constraint.evaluator()->num_constraints();
-         ++i) {
-      const bool is_ub_finite{!std::isinf(ub(i))};
-      const bool is_lb_finite{!std::isinf(lb(i))};
-      if (is_ub_finite || is_lb_finite) {
-        // If lb != -∞, then the constraint -aᵀx + s = lb will be added to the
-        // matrix A, in the row lower_bound_row_index.
-        const int lower_bound_row_index =
-            *A_row_count + num_linear_constraint_rows;
-        // If ub != ∞, then the constraint aᵀx + s = ub will be added to the
-        // matrix A, in the row upper_bound_row_index.
-        const int upper_bound_row_index =
-            *A_row_count + num_linear_constraint_rows + (is_lb_finite ? 1 : 0);
-        for (int j = 0; j < x.rows(); ++j) {
-          if (Ai(i, j) != 0) {
-            const int xj_index = prog.FindDecisionVariableIndex(x(j));
-            if (is_ub_finite) {
-              A_triplets->emplace_back(upper_bound_row_index, xj_index,
-                                       Ai(i, j));
-            }
-            if (is_lb_finite) {
-              A_triplets->emplace_back(lower_bound_row_index, xj_index,
-                                       -Ai(i, j));
-            }
-          }
-        }
-        if (is_lb_finite) {
-          b->push_back(-lb(i));
-          ++num_linear_constraint_rows;
+    const Eigen::SparseMatrix<double>& Ai =
+        linear_constraint.evaluator()->get_sparse_A();
+    // If lb(i) != -∞, then the constraint -aᵢᵀx + s = lb(i) is added to the
+    // matrix A, in the row lower_bound_row_index[i]. If ub(i) != ∞, then the
+    // constraint aᵢᵀx + s = ub(i) is added to the matrix A, in the row
+    // upper_bound_row_index[i]. The row index is -1 otherwise.
+    std::vector<int> lower_bound_row_index(Ai.rows(), -1);
+    std::vector<int> upper_bound_row_index(Ai.rows(), -1);
+    for (int i = 0; i < Ai.rows(); ++i) {
+      if (!std::isinf(lb(i))) {
+        lower_bound_row_index[i] = *A_row_count + num_linear_constraint_rows;
+        b->push_back(-lb(i));
+        ++num_linear_constraint_rows;
+      }
+      if (!std::isinf(ub(i))) {
+        upper_bound_row_index[i] = *A_row_count + num_linear_constraint_rows;
+        b->push_back(ub(i));
+        ++num_linear_constraint_rows;
+      }
+    }
+    const std::vector<int> x_indices = prog.FindDecisionVariableIndices(x);
+    for (int j = 0; j < Ai.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(Ai, j); it; ++it) {
+        if (upper_bound_row_index[it.row()] >= 0) {
+          A_triplets->emplace_back(upper_bound_row_index[it.row()],
+                                   x_indices[j], it.value());
         }
-        if (is_ub_finite) {
-          b->push_back(ub(i));
-          ++num_linear_constraint_rows;
+        if (lower_bound_row_index[it.row()] >= 0) {
+          A_triplets->emplace_back(lower_bound_row_index[it.row()],
+                                   x_indices[j], -it.value());
         }
       }
     }
@@ -221,8 +217,8 @@ void ParseLinearEqualityConstraint(
   // A x + s = b. s in zero cone.
   for (const auto& linear_equality_constraint :
        prog.linear_equality_constraints()) {
-    const Eigen::SparseMatrix<double> Ai =
-        linear_equality_constraint.evaluator()->GetSparseMatrix();
+    const Eigen::SparseMatrix<double>& Ai =
+        linear_equality_constraint.evaluator()->get_sparse_A();
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
         math::SparseMatrixToTriplets(Ai);
     A_triplets->reserve(A_triplets->size() + Ai_triplets.size());
@@ -610,6 +606,7 @@ SolutionResult ScsSolver::Solve(MathematicalProgram& prog) const {
 
   SolutionResult solution_result{SolutionResult::kUnknownError};
   SolverResult solver_result(id());
+  solver_result.set_num_iterations(scs_info.iter);
   if (scs_status == SCS_SOLVED || scs_status == SCS_SOLVED_INACCURATE) {
     solution_result = SolutionResult::kSolutionFound;
     solver_result.set_decision_variable_values(
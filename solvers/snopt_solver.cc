@@ -6,13 +6,18 @@
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/parallel_evaluation.h"
 
 // TODO(#7984) The SNOPT includes we use below are from an older f2c-based
 // implementation.  SNOPT has since switched to wrapping using F90 per the
@@ -55,7 +60,7 @@ extern "C" {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
-// todo(sammy-tri) :  implement sparsity inside each cost/constraint
+// todo(sammy-tri) :  implement sparsity inside each cost
 // todo(sammy-tri) :  handle snopt options
 // todo(sammy-tri) :  return more information that just the solution (INFO,
 // infeasible constraints, ...)
@@ -156,6 +161,9 @@ struct SNOPTData : public MathematicalProgram::SolverData {
 struct SnoptUserFunInfo {
   const MathematicalProgram* prog_;
   const std::unordered_set<int>* cost_gradient_indices_;
+  // The threads evaluating the costs and constraints, or nullptr to evaluate
+  // them sequentially.
+  drake::internal::ThreadPool* thread_pool_;
 };
 
 struct SNOPTRun {
@@ -244,27 +252,48 @@ int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
   return 1;
 }
 
+// Return the number of gradient entries of the nonlinear constraint.
+template <typename C>
+int SingleNonlinearConstraintNumGradients(const Binding<C>& binding) {
+  return internal::GetNumGradientEntries(*binding.evaluator(),
+                                         binding.GetNumElements());
+}
+
+template <>
+int SingleNonlinearConstraintNumGradients<LinearComplementarityConstraint>(
+    const Binding<LinearComplementarityConstraint>& binding) {
+  return binding.GetNumElements();
+}
+
 // Evaluate a single nonlinear constraints. For generic Constraint,
 // LorentzConeConstraint, RotatedLorentzConeConstraint, we call Eval function
-// of the constraint directly. For some other constraint, such as
+// of the constraint directly, and only evaluate the gradient entries in its
+// sparsity pattern. For some other constraint, such as
 // LinearComplementaryConstraint, we will evaluate its nonlinear constraint
 // differently, than its Eval function.
+// @return The number of gradient entries written to G.
 template <typename C>
-void EvaluateSingleNonlinearConstraint(const C& constraint,
-                                       const Eigen::VectorXd& this_x,
-                                       AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(math::initializeAutoDiff(this_x), *ty);
+int EvaluateSingleNonlinearConstraint(const C& constraint,
+                                      const Eigen::VectorXd& this_x,
+                                      Eigen::VectorXd* y,
+                                      snopt::doublereal G[]) {
+  return internal::EvalWithGradient(constraint, this_x, y, G);
 }
 
 template <>
-void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
+int EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
     const LinearComplementarityConstraint& constraint,
-    const Eigen::VectorXd& this_x, AutoDiffVecXd* ty) {
-  ty->resize(1);
+    const Eigen::VectorXd& this_x, Eigen::VectorXd* y,
+    snopt::doublereal G[]) {
   auto tx = math::initializeAutoDiff(this_x);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+  const AutoDiffXd ty = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
+                               constraint.q().cast<AutoDiffXd>());
+  y->resize(1);
+  (*y)(0) = ty.value();
+  for (int j = 0; j < this_x.size(); ++j) {
+    G[j] = static_cast<snopt::doublereal>(ty.derivatives()(j));
+  }
+  return this_x.size();
 }
 
 /*
@@ -280,41 +309,73 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
  * in the optimization problem.
  * @param tx the AutoDiffMatrixType that stores the value of the decision
  * variable.
+ * @param thread_pool The threads evaluating the constraints, or nullptr to
+ * evaluate them sequentially. With a pool, the offsets of the values and
+ * gradient entries of each constraint in F and G are computed beforehand,
+ * and the constraints are evaluated by internal::EvaluateInParallel().
  */
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
     const std::vector<Binding<C>>& constraint_list, snopt::doublereal F[],
     snopt::doublereal G[], size_t* constraint_index, size_t* grad_index,
-    const Eigen::VectorXd& xvec) {
-  Eigen::VectorXd this_x;
-  for (const auto& binding : constraint_list) {
+    const Eigen::VectorXd& xvec, drake::internal::ThreadPool* thread_pool) {
+  // Evaluates the constraint binding, writing its values to F + f_index and
+  // its gradient entries to G + g_index.
+  auto evaluate = [&prog, &xvec, F, G](const Binding<C>& binding,
+                                      size_t f_index, size_t g_index) {
     const auto& c = binding.evaluator();
     int num_constraints = SingleNonlinearConstraintSize(*c);
 
     int num_v_variables = binding.GetNumElements();
-    this_x.resize(num_v_variables);
+    Eigen::VectorXd this_x(num_v_variables);
     for (int i = 0; i < num_v_variables; ++i) {
       this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
     }
 
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x, &ty);
+    Eigen::VectorXd ty;
+    const int num_gradients =
+        EvaluateSingleNonlinearConstraint(*c, this_x, &ty, G + g_index);
+    DRAKE_ASSERT(ty.size() == num_constraints);
 
     for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
          i++) {
-      F[(*constraint_index)++] = static_cast<snopt::doublereal>(ty(i).value());
+      F[f_index + i] = static_cast<snopt::doublereal>(ty(i));
     }
-
-    for (snopt::integer i = 0; i < static_cast<snopt::integer>(num_constraints);
-         i++) {
-      for (int j = 0; j < num_v_variables; ++j) {
-        G[(*grad_index)++] =
-            static_cast<snopt::doublereal>(ty(i).derivatives()(j));
-      }
+    return std::make_pair(num_constraints, num_gradients);
+  };
+
+  if (thread_pool == nullptr) {
+    for (const auto& binding : constraint_list) {
+      const auto sizes = evaluate(binding, *constraint_index, *grad_index);
+      *constraint_index += sizes.first;
+      *grad_index += sizes.second;
     }
-  }
+    return;
+  }
+
+  const int num_bindings = static_cast<int>(constraint_list.size());
+  std::vector<size_t> f_indices(num_bindings);
+  std::vector<size_t> g_indices(num_bindings);
+  for (int k = 0; k < num_bindings; ++k) {
+    f_indices[k] = *constraint_index;
+    g_indices[k] = *grad_index;
+    *constraint_index +=
+        SingleNonlinearConstraintSize(*constraint_list[k].evaluator());
+    *grad_index += SingleNonlinearConstraintNumGradients(constraint_list[k]);
+  }
+  internal::EvaluateInParallel(
+      num_bindings, thread_pool,
+      [&constraint_list](int k) {
+        return constraint_list[k].evaluator()->is_thread_safe();
+      },
+      [&](int k) {
+        const auto sizes =
+            evaluate(constraint_list[k], f_indices[k], g_indices[k]);
+        DRAKE_ASSERT(sizes.second ==
+                     SingleNonlinearConstraintNumGradients(constraint_list[k]));
+        unused(sizes);
+      });
 }
 
 /*
@@ -334,32 +395,56 @@ std::unordered_set<int> GetCostNonzeroGradientIndices(
   return cost_gradient_indices;
 }
 
+/*
+ * Evaluates the costs, adding their sum to F[0], and writing the entries of
+ * its gradient in cost_gradient_indices to G. With a thread pool, the costs
+ * are evaluated by internal::EvaluateInParallel(), and then summed in the
+ * same order as without one, so that the result is the same.
+ */
 void EvaluateAllCosts(const MathematicalProgram& prog,
                       const std::unordered_set<int>& cost_gradient_indices,
                       snopt::doublereal F[], snopt::doublereal G[],
-                      size_t* grad_index, const Eigen::VectorXd& xvec) {
+                      size_t* grad_index, const Eigen::VectorXd& xvec,
+                      drake::internal::ThreadPool* thread_pool) {
   // evaluate cost
-  Eigen::VectorXd this_x;
-  AutoDiffVecXd ty(1);
-
-  std::vector<snopt::doublereal> cost_gradient(prog.num_vars(), 0);
-  for (auto const& binding : prog.GetAllCosts()) {
-    auto const& obj = binding.evaluator();
-
+  const std::vector<Binding<Cost>> costs = prog.GetAllCosts();
+  auto evaluate = [&prog, &xvec, &costs](int k, AutoDiffVecXd* ty) {
+    const auto& binding = costs[k];
     int num_v_variables = binding.GetNumElements();
-    this_x.resize(num_v_variables);
+    Eigen::VectorXd this_x(num_v_variables);
     for (int j = 0; j < num_v_variables; ++j) {
       this_x(j) = xvec(prog.FindDecisionVariableIndex(binding.variables()(j)));
     }
+    binding.evaluator()->Eval(math::initializeAutoDiff(this_x), *ty);
+  };
 
-    obj->Eval(math::initializeAutoDiff(this_x), ty);
+  const int num_costs = static_cast<int>(costs.size());
+  // Without a thread pool, each cost is evaluated into ty[0] just before it
+  // is summed; otherwise they are all evaluated beforehand.
+  std::vector<AutoDiffVecXd> ty(thread_pool == nullptr ? 1 : num_costs,
+                                AutoDiffVecXd(1));
+  if (thread_pool != nullptr) {
+    internal::EvaluateInParallel(
+        num_costs, thread_pool,
+        [&costs](int k) { return costs[k].evaluator()->is_thread_safe(); },
+        [&evaluate, &ty](int k) { evaluate(k, &ty[k]); });
+  }
+
+  std::vector<snopt::doublereal> cost_gradient(prog.num_vars(), 0);
+  for (int k = 0; k < num_costs; ++k) {
+    const auto& binding = costs[k];
+    const AutoDiffVecXd& ty_k = thread_pool == nullptr ? ty[0] : ty[k];
+    if (thread_pool == nullptr) {
+      evaluate(k, &ty[0]);
+    }
 
-    F[0] += static_cast<snopt::doublereal>(ty(0).value());
+    F[0] += static_cast<snopt::doublereal>(ty_k(0).value());
 
+    int num_v_variables = binding.GetNumElements();
     for (int j = 0; j < num_v_variables; ++j) {
       size_t vj_index = prog.FindDecisionVariableIndex(binding.variables()(j));
       cost_gradient[vj_index] +=
-          static_cast<snopt::doublereal>(ty(0).derivatives()(j));
+          static_cast<snopt::doublereal>(ty_k(0).derivatives()(j));
     }
   }
   for (const auto cost_gradient_index : cost_gradient_indices) {
@@ -389,6 +474,8 @@ int snopt_userfun(snopt::integer* Status, snopt::integer* n,
   MathematicalProgram const* current_problem = snopt_userfun_info->prog_;
   std::unordered_set<int> const* cost_gradient_indices =
       snopt_userfun_info->cost_gradient_indices_;
+  drake::internal::ThreadPool* const thread_pool =
+      snopt_userfun_info->thread_pool_;
 
   snopt::integer i;
   Eigen::VectorXd xvec(*n);
@@ -404,24 +491,24 @@ int snopt_userfun(snopt::integer* Status, snopt::integer* n,
   current_problem->EvalVisualizationCallbacks(xvec);
 
   EvaluateAllCosts(*current_problem, *cost_gradient_indices, F, G, &grad_index,
-                   xvec);
+                   xvec, thread_pool);
 
   // The constraint index starts at 1 because the cost is the
   // first row.
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
-  EvaluateNonlinearConstraints(*current_problem,
-                               current_problem->generic_constraints(), F, G,
-                               &constraint_index, &grad_index, xvec);
-  EvaluateNonlinearConstraints(*current_problem,
-                               current_problem->lorentz_cone_constraints(), F,
-                               G, &constraint_index, &grad_index, xvec);
+  EvaluateNonlinearConstraints(
+      *current_problem, current_problem->generic_constraints(), F, G,
+      &constraint_index, &grad_index, xvec, thread_pool);
+  EvaluateNonlinearConstraints(
+      *current_problem, current_problem->lorentz_cone_constraints(), F, G,
+      &constraint_index, &grad_index, xvec, thread_pool);
   EvaluateNonlinearConstraints(
       *current_problem, current_problem->rotated_lorentz_cone_constraints(), F,
-      G, &constraint_index, &grad_index, xvec);
+      G, &constraint_index, &grad_index, xvec, thread_pool);
   EvaluateNonlinearConstraints(
       *current_problem, current_problem->linear_complementarity_constraints(),
-      F, G, &constraint_index, &grad_index, xvec);
+      F, G, &constraint_index, &grad_index, xvec, thread_pool);
 
   return 0;
 }
@@ -441,7 +528,8 @@ void UpdateNumNonlinearConstraintsAndGradients(
   for (auto const& binding : constraint_list) {
     auto const& c = binding.evaluator();
     int n = c->num_constraints();
-    *max_num_gradients += n * binding.GetNumElements();
+    *max_num_gradients +=
+        internal::GetNumGradientEntries(*c, binding.GetNumElements());
     *num_nonlinear_constraints += n;
   }
 }
@@ -478,13 +566,12 @@ void UpdateConstraintBoundsAndGradients(
       Fupp[*constraint_index + i] = static_cast<snopt::doublereal>(ub(i));
     }
 
-    for (int i = 0; i < n; i++) {
-      for (int j = 0; j < static_cast<int>(binding.GetNumElements()); ++j) {
-        iGfun[*grad_index] = *constraint_index + i + 1;  // row order
-        jGvar[*grad_index] =
-            prog.FindDecisionVariableIndex(binding.variables()(j)) + 1;
-        (*grad_index)++;
-      }
+    for (const auto& entry :
+         internal::GetGradientEntries(*c, binding.GetNumElements())) {
+      iGfun[*grad_index] = *constraint_index + entry.first + 1;
+      jGvar[*grad_index] =
+          prog.FindDecisionVariableIndex(binding.variables()(entry.second)) + 1;
+      (*grad_index)++;
     }
 
     (*constraint_index) += n;
@@ -606,6 +693,13 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
   SnoptUserFunInfo snopt_userfun_info;
   snopt_userfun_info.prog_ = &prog;
   snopt_userfun_info.cost_gradient_indices_ = &cost_gradient_indices;
+  // The number of threads is a Drake option rather than a SNOPT one, so it is
+  // not passed on to snSeti() below.
+  std::map<std::string, int> int_options = prog.GetSolverOptionsInt(id());
+  // The threads are created once and reused by each call to snopt_userfun.
+  const std::unique_ptr<drake::internal::ThreadPool> thread_pool =
+      internal::TakeMaxNumThreadsOption("SnoptSolver", &int_options);
+  snopt_userfun_info.thread_pool_ = thread_pool.get();
   SNOPTRun cur(d.get(), &snopt_userfun_info);
 
   snopt::integer nx = prog.num_vars();
@@ -791,7 +885,7 @@ SolutionResult SnoptSolver::Solve(MathematicalProgram& prog) const {
     cur.snSetr(it.first, it.second);
   }
 
-  for (const auto it : prog.GetSolverOptionsInt(id())) {
+  for (const auto it : int_options) {
     cur.snSeti(it.first, it.second);
   }
 
@@ -15,7 +15,8 @@ enum class SolverType {
   kOsqp,
   kSnopt,
   kScs,
-  kUnrevisedLemke
+  kUnrevisedLemke,
+  kActiveSetQP
 };
 
 }  // namespace solvers
@@ -1,6 +1,7 @@
 #include "drake/solvers/solver_type_converter.h"
 
 #include "drake/common/drake_assert.h"
+#include "drake/solvers/active_set_qp_solver.h"
 #include "drake/solvers/dreal_solver.h"
 #include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -43,6 +44,8 @@ SolverId SolverTypeConverter::TypeToId(SolverType solver_type) {
       return ScsSolver::id();
     case SolverType::kUnrevisedLemke:
       return UnrevisedLemkeSolverId::id();
+    case SolverType::kActiveSetQP:
+      return ActiveSetQPSolver::id();
   }
   DRAKE_ABORT();
 }
@@ -72,6 +75,8 @@ optional<SolverType> SolverTypeConverter::IdToType(SolverId solver_id) {
     return SolverType::kScs;
   } else if (solver_id == UnrevisedLemkeSolverId::id()) {
     return SolverType::kUnrevisedLemke;
+  } else if (solver_id == ActiveSetQPSolver::id()) {
+    return SolverType::kActiveSetQP;
   } else {
     return nullopt;
   }
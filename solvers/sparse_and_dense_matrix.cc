@@ -0,0 +1,85 @@
+#include "drake/solvers/sparse_and_dense_matrix.h"
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+SparseAndDenseMatrix::SparseAndDenseMatrix(
+    const Eigen::SparseMatrix<double>& sparse) {
+  *this = sparse;
+}
+
+SparseAndDenseMatrix::SparseAndDenseMatrix(
+    const Eigen::Ref<const Eigen::MatrixXd>& dense) {
+  *this = dense;
+}
+
+SparseAndDenseMatrix& SparseAndDenseMatrix::operator=(
+    const Eigen::SparseMatrix<double>& sparse) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  rows_ = sparse.rows();
+  cols_ = sparse.cols();
+  sparse_ = sparse;
+  sparse_.makeCompressed();
+  is_sparse_computed_ = true;
+  dense_.resize(0, 0);
+  is_dense_computed_ = false;
+  return *this;
+}
+
+SparseAndDenseMatrix& SparseAndDenseMatrix::operator=(
+    const Eigen::Ref<const Eigen::MatrixXd>& dense) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  rows_ = dense.rows();
+  cols_ = dense.cols();
+  dense_ = dense;
+  is_dense_computed_ = true;
+  sparse_ = Eigen::SparseMatrix<double>();
+  is_sparse_computed_ = false;
+  return *this;
+}
+
+const Eigen::SparseMatrix<double>& SparseAndDenseMatrix::GetAsSparse() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!is_sparse_computed_) {
+    sparse_ = dense_.sparseView();
+    is_sparse_computed_ = true;
+  }
+  return sparse_;
+}
+
+const Eigen::MatrixXd& SparseAndDenseMatrix::GetAsDense() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!is_dense_computed_) {
+    dense_ = sparse_.toDense();
+    is_dense_computed_ = true;
+  }
+  return dense_;
+}
+
+bool SparseAndDenseMatrix::is_sparse_computed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_sparse_computed_;
+}
+
+bool SparseAndDenseMatrix::is_dense_computed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_dense_computed_;
+}
+
+AutoDiffVecXd SparseMatrixTimesVector(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const AutoDiffVecXd>& x) {
+  DRAKE_ASSERT(A.cols() == x.rows());
+  AutoDiffVecXd y = AutoDiffVecXd::Zero(A.rows());
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      y(it.row()) += it.value() * x(j);
+    }
+  }
+  return y;
+}
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
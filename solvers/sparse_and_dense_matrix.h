@@ -0,0 +1,77 @@
+#pragma once
+
+#include <mutex>
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+/*
+ * Stores a matrix in the form it is given, sparse or dense, and computes the
+ * other form on demand.
+ *
+ * The linear constraints and quadratic costs of large problems typically have
+ * few nonzero entries per row. Storing their matrices in sparse form keeps the
+ * memory and the cost of the solver translations proportional to the number of
+ * nonzero entries. A matrix given in dense form is not converted unless a
+ * caller asks for the sparse form. Either form is only computed once.
+ *
+ * GetAsSparse() and GetAsDense() may be called concurrently from several
+ * threads.
+ */
+class SparseAndDenseMatrix {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseAndDenseMatrix)
+
+  explicit SparseAndDenseMatrix(const Eigen::SparseMatrix<double>& sparse);
+
+  explicit SparseAndDenseMatrix(const Eigen::Ref<const Eigen::MatrixXd>& dense);
+
+  SparseAndDenseMatrix& operator=(const Eigen::SparseMatrix<double>& sparse);
+
+  SparseAndDenseMatrix& operator=(
+      const Eigen::Ref<const Eigen::MatrixXd>& dense);
+
+  int rows() const { return rows_; }
+
+  int cols() const { return cols_; }
+
+  // Returns the sparse form, computing it on the first call after
+  // construction or assignment from a dense matrix. The entries equal to zero
+  // are not stored. The reference remains valid until the next assignment.
+  const Eigen::SparseMatrix<double>& GetAsSparse() const;
+
+  // Returns the dense form, computing it on the first call after
+  // construction or assignment from a sparse matrix. The reference remains
+  // valid until the next assignment.
+  const Eigen::MatrixXd& GetAsDense() const;
+
+  // Returns true if the sparse form has been computed.
+  bool is_sparse_computed() const;
+
+  // Returns true if the dense form has been computed.
+  bool is_dense_computed() const;
+
+ private:
+  int rows_{};
+  int cols_{};
+  mutable std::mutex mutex_;
+  // Guarded by mutex_. At least one of the two forms is always computed.
+  mutable Eigen::SparseMatrix<double> sparse_;
+  mutable Eigen::MatrixXd dense_;
+  mutable bool is_sparse_computed_{false};
+  mutable bool is_dense_computed_{false};
+};
+
+// Returns A * x, where the derivatives of the result are accumulated over the
+// nonzero entries of A only.
+AutoDiffVecXd SparseMatrixTimesVector(const Eigen::SparseMatrix<double>& A,
+                                      const Eigen::Ref<const AutoDiffVecXd>& x);
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -1,11 +1,15 @@
 #include "drake/solvers/symbolic_extraction.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
@@ -24,6 +28,7 @@ using std::pair;
 using std::runtime_error;
 using std::string;
 using std::unordered_map;
+using std::vector;
 
 using symbolic::Expression;
 using symbolic::Formula;
@@ -149,6 +154,414 @@ void DecomposeQuadraticPolynomial(
   }
 }
 
+namespace {
+
+// The term coeff * var of a polynomial.
+struct LinearTerm {
+  Variable var;
+  double coeff{};
+};
+
+// The term coeff * x * y of a polynomial.
+struct QuadraticTerm {
+  Variable x;
+  Variable y;
+  double coeff{};
+};
+
+// Collects the terms of polynomials of total degree at most `max_degree`,
+// which is one or two, by walking their expression trees. Sums, products with
+// constants and products of two affine factors are expanded directly, while
+// any other structure is expanded through symbolic::Polynomial. The constant,
+// linear and quadratic terms are added to the given sinks, which may be
+// nullptr to only check the degree of the polynomial.
+class TermCollector {
+ public:
+  TermCollector(int max_degree, double* constant, vector<LinearTerm>* linear,
+                vector<QuadraticTerm>* quadratic)
+      : max_degree_(max_degree),
+        constant_(constant),
+        linear_(linear),
+        quadratic_(quadratic) {}
+
+  // Collects the terms of `e`. Returns false, leaving the terms collected so
+  // far, if `e` is not a polynomial of total degree at most `max_degree`.
+  bool Collect(const Expression& e) {
+    const double constant = constant_ != nullptr ? *constant_ : 0;
+    const size_t num_linear = linear_ != nullptr ? linear_->size() : 0;
+    const size_t num_quadratic = quadratic_ != nullptr ? quadratic_->size() : 0;
+    if (Collect(e, 1.0)) {
+      return true;
+    }
+    // Terms of higher degree may still cancel out, as in (x + 1)³ - x³, in
+    // which case the whole expression is expanded at once.
+    if (constant_ != nullptr) *constant_ = constant;
+    if (linear_ != nullptr) linear_->resize(num_linear);
+    if (quadratic_ != nullptr) quadratic_->resize(num_quadratic);
+    return CollectPolynomial(e, 1.0);
+  }
+
+ private:
+  // Collects the terms of `scale * e`.
+  bool Collect(const Expression& e, double scale) {
+    if (is_constant(e)) {
+      AddConstant(scale * get_constant_value(e));
+      return true;
+    }
+    if (is_variable(e)) {
+      AddLinear(get_variable(e), scale);
+      return true;
+    }
+    if (is_addition(e)) {
+      AddConstant(scale * get_constant_in_addition(e));
+      for (const auto& p : get_expr_to_coeff_map_in_addition(e)) {
+        if (!Collect(p.first, scale * p.second)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (is_multiplication(e)) {
+      const double c = get_constant_in_multiplication(e);
+      const auto& base_to_exponent =
+          get_base_to_exponent_map_in_multiplication(e);
+      const auto& p1 = *base_to_exponent.begin();
+      if (base_to_exponent.size() == 1) {
+        if (is_one(p1.second)) {
+          return Collect(p1.first, scale * c);
+        }
+        if (is_two(p1.second)) {
+          return CollectProduct(e, p1.first, p1.first, scale * c);
+        }
+      } else if (base_to_exponent.size() == 2) {
+        const auto& p2 = *std::next(base_to_exponent.begin());
+        if (is_one(p1.second) && is_one(p2.second)) {
+          return CollectProduct(e, p1.first, p2.first, scale * c);
+        }
+      }
+      return CollectPolynomial(e, scale);
+    }
+    if (is_division(e) && is_constant(get_second_argument(e))) {
+      return Collect(get_first_argument(e),
+                     scale / get_constant_value(get_second_argument(e)));
+    }
+    if (is_pow(e) && is_two(get_second_argument(e))) {
+      return CollectProduct(e, get_first_argument(e), get_first_argument(e),
+                            scale);
+    }
+    return CollectPolynomial(e, scale);
+  }
+
+  // Collects the terms of `scale * e`, where `e` = `f1 * f2`.
+  bool CollectProduct(const Expression& e, const Expression& f1,
+                      const Expression& f2, double scale) {
+    if (max_degree_ < 2) {
+      return false;
+    }
+    if (is_variable(f1) && is_variable(f2)) {
+      AddQuadratic(get_variable(f1), get_variable(f2), scale);
+      return true;
+    }
+    double c1 = 0;
+    double c2 = 0;
+    vector<LinearTerm> terms1;
+    vector<LinearTerm> terms2;
+    if (!TermCollector(1, &c1, &terms1, nullptr).Collect(f1, 1.0) ||
+        !TermCollector(1, &c2, &terms2, nullptr).Collect(f2, 1.0)) {
+      return CollectPolynomial(e, scale);
+    }
+    AddConstant(scale * c1 * c2);
+    for (const LinearTerm& t1 : terms1) {
+      AddLinear(t1.var, scale * c2 * t1.coeff);
+    }
+    for (const LinearTerm& t2 : terms2) {
+      AddLinear(t2.var, scale * c1 * t2.coeff);
+    }
+    for (const LinearTerm& t1 : terms1) {
+      for (const LinearTerm& t2 : terms2) {
+        AddQuadratic(t1.var, t2.var, scale * t1.coeff * t2.coeff);
+      }
+    }
+    return true;
+  }
+
+  bool CollectPolynomial(const Expression& e, double scale) {
+    if (!e.is_polynomial()) {
+      return false;
+    }
+    const symbolic::Polynomial poly{e};
+    if (poly.TotalDegree() > max_degree_) {
+      return false;
+    }
+    for (const auto& p : poly.monomial_to_coefficient_map()) {
+      DRAKE_ASSERT(is_constant(p.second));
+      const double coeff = scale * get_constant_value(p.second);
+      const auto& powers = p.first.get_powers();
+      if (powers.empty()) {
+        AddConstant(coeff);
+      } else if (powers.size() == 2) {
+        AddQuadratic(powers.begin()->first, std::next(powers.begin())->first,
+                     coeff);
+      } else if (powers.begin()->second == 2) {
+        AddQuadratic(powers.begin()->first, powers.begin()->first, coeff);
+      } else {
+        AddLinear(powers.begin()->first, coeff);
+      }
+    }
+    return true;
+  }
+
+  void AddConstant(double value) {
+    if (constant_ != nullptr) {
+      *constant_ += value;
+    }
+  }
+
+  void AddLinear(const Variable& var, double coeff) {
+    if (linear_ != nullptr) {
+      linear_->push_back({var, coeff});
+    }
+  }
+
+  void AddQuadratic(const Variable& x, const Variable& y, double coeff) {
+    if (quadratic_ != nullptr) {
+      quadratic_->push_back({x, y, coeff});
+    }
+  }
+
+  const int max_degree_;
+  double* const constant_;
+  vector<LinearTerm>* const linear_;
+  vector<QuadraticTerm>* const quadratic_;
+};
+
+// Returns true if the quadratic terms in `terms` cancel out. The terms are
+// reordered.
+bool QuadraticTermsCancelOut(vector<QuadraticTerm>* terms) {
+  for (QuadraticTerm& term : *terms) {
+    if (term.y.get_id() < term.x.get_id()) {
+      std::swap(term.x, term.y);
+    }
+  }
+  std::sort(terms->begin(), terms->end(),
+            [](const QuadraticTerm& t1, const QuadraticTerm& t2) {
+              return std::make_pair(t1.x.get_id(), t1.y.get_id()) <
+                     std::make_pair(t2.x.get_id(), t2.y.get_id());
+            });
+  for (auto it = terms->begin(); it != terms->end();) {
+    double coeff = 0;
+    const auto first = it;
+    for (; it != terms->end() && it->x.get_id() == first->x.get_id() &&
+           it->y.get_id() == first->y.get_id();
+         ++it) {
+      coeff += it->coeff;
+    }
+    if (coeff != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Maps variables to consecutive indices in order of insertion. Variable IDs
+// come from a global counter, so the variables of a program usually span a
+// narrow range of IDs; they are then looked up in a flat table indexed by
+// their offset from the smallest ID, and in a hash map otherwise.
+class VariableIndexTable {
+ public:
+  VariableIndexTable(Variable::Id min_id, Variable::Id max_id,
+                     int num_variables_bound)
+      : min_id_(min_id) {
+    DRAKE_DEMAND(min_id <= max_id);
+    if (max_id - min_id <= 4 * static_cast<Variable::Id>(num_variables_bound) +
+                               1024) {
+      flat_.resize(max_id - min_id + 1, -1);
+    } else {
+      map_.reserve(num_variables_bound);
+    }
+  }
+
+  // Returns the index of `var`, appending `var` to `vars` if it is new.
+  int GetOrAppend(const Variable& var, vector<Variable>* vars) {
+    int& index = flat_.empty() ? map_.emplace(var.get_id(), -1).first->second
+                               : flat_[var.get_id() - min_id_];
+    if (index < 0) {
+      index = static_cast<int>(vars->size());
+      vars->push_back(var);
+    }
+    return index;
+  }
+
+ private:
+  const Variable::Id min_id_;
+  vector<int> flat_;
+  unordered_map<Variable::Id, int> map_;
+};
+
+VectorXDecisionVariable ToVector(const vector<Variable>& var_list) {
+  VectorXDecisionVariable vars(var_list.size());
+  for (int i = 0; i < vars.size(); ++i) {
+    vars(i) = var_list[i];
+  }
+  return vars;
+}
+
+[[noreturn]] void ThrowNotPolynomial(const Expression& e, int max_degree) {
+  ostringstream oss;
+  if (!e.is_polynomial()) {
+    oss << "Expression " << e << " is not a polynomial.";
+  } else if (max_degree == 1) {
+    oss << "Expression " << e << " is non-linear.";
+  } else {
+    oss << "Expression " << e << " has order higher than " << max_degree
+        << ".";
+  }
+  throw runtime_error(oss.str());
+}
+
+}  // namespace
+
+bool IsAffineExpression(const Expression& e) {
+  vector<QuadraticTerm> quadratic_terms;
+  return TermCollector(2, nullptr, nullptr, &quadratic_terms).Collect(e) &&
+         QuadraticTermsCancelOut(&quadratic_terms);
+}
+
+bool IsQuadraticExpression(const Expression& e) {
+  return TermCollector(2, nullptr, nullptr, nullptr).Collect(e);
+}
+
+void DecomposeSparseLinearExpressions(
+    const Eigen::Ref<const MatrixX<Expression>>& M,
+    Eigen::SparseMatrix<double>* A, Eigen::VectorXd* b,
+    VectorXDecisionVariable* vars) {
+  const int num_rows = M.size();
+  b->resize(num_rows);
+  // 1. Collect the terms of all entries, where row_begin[i] is the first term
+  // of the row i.
+  vector<LinearTerm> terms;
+  terms.reserve(2 * num_rows);
+  vector<int> row_begin(num_rows + 1);
+  vector<QuadraticTerm> quadratic_terms;
+  for (int j = 0; j < M.cols(); ++j) {
+    for (int i = 0; i < M.rows(); ++i) {
+      const int row = i + j * M.rows();
+      row_begin[row] = static_cast<int>(terms.size());
+      double constant_term = 0;
+      quadratic_terms.clear();
+      TermCollector collector(2, &constant_term, &terms, &quadratic_terms);
+      if (!collector.Collect(M(i, j)) ||
+          !QuadraticTermsCancelOut(&quadratic_terms)) {
+        ThrowNotPolynomial(M(i, j), 1);
+      }
+      (*b)(row) = constant_term;
+    }
+  }
+  row_begin[num_rows] = static_cast<int>(terms.size());
+
+  // 2. Sort the terms of each row by variable ID, and merge the terms of the
+  // same variable in place.
+  int num_merged = 0;
+  for (int row = 0; row < num_rows; ++row) {
+    const auto first = terms.begin() + row_begin[row];
+    const auto last = terms.begin() + row_begin[row + 1];
+    std::sort(first, last, [](const LinearTerm& t1, const LinearTerm& t2) {
+      return t1.var.get_id() < t2.var.get_id();
+    });
+    row_begin[row] = num_merged;
+    for (auto it = first; it != last; ++it) {
+      if (num_merged > row_begin[row] &&
+          terms[num_merged - 1].var.get_id() == it->var.get_id()) {
+        terms[num_merged - 1].coeff += it->coeff;
+      } else {
+        terms[num_merged++] = *it;
+      }
+    }
+  }
+  row_begin[num_rows] = num_merged;
+  terms.resize(num_merged);
+
+  // 3. Index the variables and emit the triplets of A.
+  Variable::Id min_id = terms.empty() ? 0 : terms[0].var.get_id();
+  Variable::Id max_id = min_id;
+  for (const LinearTerm& term : terms) {
+    min_id = std::min(min_id, term.var.get_id());
+    max_id = std::max(max_id, term.var.get_id());
+  }
+  VariableIndexTable table(min_id, max_id, num_merged);
+  vector<Variable> var_list;
+  vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(num_merged);
+  for (int row = 0; row < num_rows; ++row) {
+    for (int k = row_begin[row]; k < row_begin[row + 1]; ++k) {
+      const int index = table.GetOrAppend(terms[k].var, &var_list);
+      if (terms[k].coeff != 0) {
+        triplets.emplace_back(row, index, terms[k].coeff);
+      }
+    }
+  }
+  *vars = ToVector(var_list);
+  A->resize(num_rows, var_list.size());
+  A->setFromTriplets(triplets.begin(), triplets.end());
+}
+
+void DecomposeSparseQuadraticExpression(const Expression& e,
+                                        Eigen::SparseMatrix<double>* Q,
+                                        Eigen::VectorXd* b, double* c,
+                                        VectorXDecisionVariable* vars) {
+  *c = 0;
+  vector<LinearTerm> linear_terms;
+  vector<QuadraticTerm> quadratic_terms;
+  TermCollector collector(2, c, &linear_terms, &quadratic_terms);
+  if (!collector.Collect(e)) {
+    ThrowNotPolynomial(e, 2);
+  }
+
+  // Index the variables sorted by ID.
+  vector<Variable> sorted_vars;
+  sorted_vars.reserve(linear_terms.size() + 2 * quadratic_terms.size());
+  for (const LinearTerm& term : linear_terms) {
+    sorted_vars.push_back(term.var);
+  }
+  for (const QuadraticTerm& term : quadratic_terms) {
+    sorted_vars.push_back(term.x);
+    sorted_vars.push_back(term.y);
+  }
+  auto less = [](const Variable& x, const Variable& y) {
+    return x.get_id() < y.get_id();
+  };
+  std::sort(sorted_vars.begin(), sorted_vars.end(), less);
+  VariableIndexTable table(
+      sorted_vars.empty() ? 0 : sorted_vars.front().get_id(),
+      sorted_vars.empty() ? 0 : sorted_vars.back().get_id(),
+      static_cast<int>(sorted_vars.size()));
+  vector<Variable> var_list;
+  for (const Variable& var : sorted_vars) {
+    table.GetOrAppend(var, &var_list);
+  }
+
+  const int num_vars = static_cast<int>(var_list.size());
+  *b = Eigen::VectorXd::Zero(num_vars);
+  for (const LinearTerm& term : linear_terms) {
+    (*b)(table.GetOrAppend(term.var, &var_list)) += term.coeff;
+  }
+  vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(2 * quadratic_terms.size());
+  for (const QuadraticTerm& term : quadratic_terms) {
+    const int i = table.GetOrAppend(term.x, &var_list);
+    const int j = table.GetOrAppend(term.y, &var_list);
+    if (i == j) {
+      triplets.emplace_back(i, i, 2 * term.coeff);
+    } else {
+      triplets.emplace_back(i, j, term.coeff);
+      triplets.emplace_back(j, i, term.coeff);
+    }
+  }
+  *vars = ToVector(var_list);
+  Q->resize(num_vars, num_vars);
+  Q->setFromTriplets(triplets.begin(), triplets.end());
+}
+
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
@@ -7,6 +7,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include <Eigen/Sparse>
+
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic.h"
 #include "drake/math/matrix_util.h"
@@ -176,6 +178,63 @@ DecomposeLinearExpression(
   return num_variable;
 }
 
+/*
+ * Returns true if `e` is a polynomial of total degree at most one. Sums,
+ * products with constants and products of two affine factors are expanded by
+ * walking the expression tree, without constructing a symbolic::Polynomial.
+ */
+bool IsAffineExpression(const symbolic::Expression& e);
+
+/*
+ * Returns true if `e` is a polynomial of total degree at most two, with the
+ * same fast path as IsAffineExpression().
+ */
+bool IsQuadraticExpression(const symbolic::Expression& e);
+
+/*
+ * Decomposes all the affine expressions in `M` at once as
+ *
+ *     vec(M) = A * vars + b
+ *
+ * where vec(M) stacks the columns of M, i.e. M(i, j) is row i + j * M.rows()
+ * of A and b. The variables are ordered as by ExtractVariablesFromExpression()
+ * called on each entry in turn: by first appearance, with the new variables
+ * of each entry sorted by ID.
+ *
+ * This is the batched counterpart of DecomposeLinearExpression(), meant for
+ * programs with many constraints. The expression trees are walked as in
+ * IsAffineExpression(), variables are mapped to columns through a flat table
+ * indexed by variable ID instead of a hash map, and A is assembled from
+ * triplets without ever forming a dense matrix.
+ * @param[in] M A matrix of affine expressions.
+ * @param[out] A The sparse matrix of linear coefficients. Coefficients that
+ * cancel out are not stored.
+ * @param[out] b The vector of constant terms.
+ * @param[out] vars All variables in `M`.
+ * @throws std::runtime_error if an entry of `M` is not affine.
+ */
+void DecomposeSparseLinearExpressions(
+    const Eigen::Ref<const MatrixX<symbolic::Expression>>& M,
+    Eigen::SparseMatrix<double>* A, Eigen::VectorXd* b,
+    VectorXDecisionVariable* vars);
+
+/*
+ * Decomposes a quadratic expression `e` as 0.5 * vars' * Q * vars + b' * vars
+ * + c, with the same machinery as DecomposeSparseLinearExpressions(). This is
+ * the sparse counterpart of DecomposeQuadraticPolynomial().
+ * @param[in] e A polynomial of total degree at most two.
+ * @param[out] Q The symmetric sparse Hessian.
+ * @param[out] b The linear coefficients.
+ * @param[out] c The constant term.
+ * @param[out] vars All variables in `e`, sorted by ID as by
+ * ExtractVariablesFromExpression().
+ * @throws std::runtime_error if `e` is not a quadratic polynomial.
+ */
+void DecomposeSparseQuadraticExpression(const symbolic::Expression& e,
+                                        Eigen::SparseMatrix<double>* Q,
+                                        Eigen::VectorXd* b, double* c,
+                                        VectorXDecisionVariable* vars);
+
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
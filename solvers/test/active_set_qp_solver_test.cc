@@ -0,0 +1,306 @@
+#include "drake/solvers/active_set_qp_solver.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/test/quadratic_program_examples.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+GTEST_TEST(ActiveSetQPSolverTest, TestUnconstrainedQP) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost((x(0) - 1) * (x(0) - 1) + 2 * x(1) * x(1) +
+                        x(0) * x(1));
+  prog.AddLinearCost(x(1) + 3);
+
+  ActiveSetQPSolver solver;
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  // The minimum of (x₀ - 1)² + 2x₁² + x₀x₁ + x₁ solves 2(x₀ - 1) + x₁ = 0 and
+  // 4x₁ + x₀ + 1 = 0.
+  const Eigen::Vector2d x_expected(9.0 / 7, -4.0 / 7);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_expected, 1E-12));
+  const double cost_expected =
+      std::pow(x_expected(0) - 1, 2) + 2 * std::pow(x_expected(1), 2) +
+      x_expected(0) * x_expected(1) + x_expected(1) + 3;
+  EXPECT_NEAR(prog.GetOptimalCost(), cost_expected, 1E-12);
+  EXPECT_EQ(prog.GetSolverId(), ActiveSetQPSolver::id());
+}
+
+TEST_P(QuadraticProgramTest, TestQP) {
+  ActiveSetQPSolver solver;
+  prob()->RunProblem(&solver);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    ActiveSetQPSolverTest, QuadraticProgramTest,
+    ::testing::Combine(::testing::ValuesIn(quadratic_cost_form()),
+                       ::testing::ValuesIn(linear_constraint_form()),
+                       ::testing::ValuesIn(quadratic_problems())));
+
+GTEST_TEST(ActiveSetQPSolverTest, TestUnitBallExample) {
+  ActiveSetQPSolver solver;
+  TestQPonUnitBallExample(solver);
+}
+
+GTEST_TEST(ActiveSetQPSolverTest, TestInvalidAndInfeasible) {
+  ActiveSetQPSolver solver;
+  {
+    // The Hessian is only positive semidefinite.
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost(x(0) * x(0) + x(1));
+    prog.AddBoundingBoxConstraint(0, 1, x);
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kInvalidInput);
+  }
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost(x(0) * x(0) + 2 * x(1) * x(1));
+    prog.AddLinearConstraint(x(0) + 2 * x(1) == 2);
+    prog.AddLinearConstraint(x(0) >= 1);
+    prog.AddLinearConstraint(x(1) >= 2);
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kInfeasibleConstraints);
+    EXPECT_EQ(prog.GetOptimalCost(),
+              MathematicalProgram::kGlobalInfeasibleCost);
+  }
+  {
+    // Redundant equality constraints are fine, inconsistent ones are not.
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+    prog.AddLinearConstraint(x(0) + x(1) == 1);
+    auto constraint =
+        prog.AddLinearConstraint(2 * x(0) + 2 * x(1) == 2).evaluator();
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x),
+                                Eigen::Vector2d(0.5, 0.5), 1E-12));
+    constraint->UpdateLowerBound(Vector1d(3));
+    constraint->UpdateUpperBound(Vector1d(3));
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kInfeasibleConstraints);
+  }
+  {
+    // Inconsistent equality constraints are detected before any iteration,
+    // also after a solve that needed some.
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost((x(0) - 2) * (x(0) - 2) + x(1) * x(1));
+    prog.AddLinearConstraint(x(0) + x(1) == 1);
+    auto constraint =
+        prog.AddLinearConstraint(2 * x(0) + 2 * x(1) == 2).evaluator();
+    prog.AddLinearConstraint(x(0) <= 0.8);
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x),
+                                Eigen::Vector2d(0.8, 0.2), 1E-12));
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_GT(*prog.GetNumIterations(), 0);
+    constraint->UpdateLowerBound(Vector1d(3));
+    constraint->UpdateUpperBound(Vector1d(3));
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kInfeasibleConstraints);
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_EQ(*prog.GetNumIterations(), 0);
+  }
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<1>();
+    prog.AddQuadraticCost(x(0) * x(0));
+    prog.SetSolverOption(ActiveSetQPSolver::id(), "Verbose", 1);
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+}
+
+// Programs that are not QPs with linear constraints are rejected, also in
+// release builds.
+GTEST_TEST(ActiveSetQPSolverTest, TestUnsupportedPrograms) {
+  ActiveSetQPSolver solver;
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+    prog.AddLorentzConeConstraint(x);
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>();
+    prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1));
+    prog.AddLinearComplementarityConstraint(Eigen::Matrix2d::Identity(),
+                                            Eigen::Vector2d::Ones(), x);
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+  {
+    MathematicalProgram prog;
+    auto X = prog.NewSymmetricContinuousVariables<2>();
+    prog.AddPositiveSemidefiniteConstraint(X);
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<1>();
+    auto b = prog.NewBinaryVariables<1>();
+    prog.AddQuadraticCost(x(0) * x(0) + b(0));
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+  {
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<1>();
+    prog.AddCost(x(0) * x(0) * x(0) * x(0));
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+}
+
+// Checks the optimality conditions of the solution of `prog`, the QP
+// min 0.5 xᵀGx + gᵀx s.t. lb ≤ Ax ≤ ub, Aeq x = beq.
+void CheckOptimality(const MathematicalProgram& prog,
+                     const VectorXDecisionVariable& x,
+                     const Eigen::MatrixXd& G, const Eigen::VectorXd& g,
+                     const Eigen::MatrixXd& A, const Eigen::VectorXd& lb,
+                     const Eigen::VectorXd& ub, const Eigen::MatrixXd& Aeq,
+                     const Eigen::VectorXd& beq) {
+  const double tol = 1E-8;
+  const Eigen::VectorXd x_sol = prog.GetSolution(x);
+  const Eigen::VectorXd Ax = A * x_sol;
+  EXPECT_TRUE(CompareMatrices(Aeq * x_sol, beq, tol));
+  EXPECT_TRUE((Ax.array() >= lb.array() - tol).all());
+  EXPECT_TRUE((Ax.array() <= ub.array() + tol).all());
+
+  // The gradient of the cost is a combination of the gradients of the active
+  // constraints, with multipliers of the right sign for the inequalities.
+  Eigen::MatrixXd N(x_sol.rows(), Aeq.rows() + A.rows());
+  N.leftCols(Aeq.rows()) = Aeq.transpose();
+  int num_active = Aeq.rows();
+  for (int i = 0; i < A.rows(); ++i) {
+    if (Ax(i) <= lb(i) + 1E-7) {
+      N.col(num_active++) = A.row(i).transpose();
+    } else if (Ax(i) >= ub(i) - 1E-7) {
+      N.col(num_active++) = -A.row(i).transpose();
+    }
+  }
+  const Eigen::MatrixXd N_active = N.leftCols(num_active);
+  const Eigen::VectorXd gradient = G * x_sol + g;
+  const Eigen::VectorXd multipliers =
+      N_active.colPivHouseholderQr().solve(gradient);
+  EXPECT_TRUE(CompareMatrices(N_active * multipliers, gradient, 1E-7));
+  EXPECT_TRUE(
+      (multipliers.tail(num_active - Aeq.rows()).array() >= -1E-7).all());
+  EXPECT_NEAR(prog.GetOptimalCost(),
+              0.5 * x_sol.dot(G * x_sol) + g.dot(x_sol), 1E-8);
+}
+
+// Solves a sequence of random QPs whose linear cost and constraint bounds
+// drift slowly, as for a model predictive controller, so that each solve
+// warm-starts from an active set close to the optimal one.
+GTEST_TEST(ActiveSetQPSolverTest, TestRepeatedSolves) {
+  const int num_vars = 20;
+  const int num_constraints = 30;
+  const int num_equalities = 3;
+  std::srand(1234);
+  const Eigen::MatrixXd M = Eigen::MatrixXd::Random(num_vars, num_vars);
+  const Eigen::MatrixXd G =
+      M * M.transpose() + Eigen::MatrixXd::Identity(num_vars, num_vars);
+  Eigen::VectorXd g = 5 * Eigen::VectorXd::Random(num_vars);
+  const Eigen::MatrixXd A =
+      Eigen::MatrixXd::Random(num_constraints, num_vars);
+  Eigen::VectorXd lb = -Eigen::VectorXd::Random(num_constraints).cwiseAbs();
+  Eigen::VectorXd ub = Eigen::VectorXd::Random(num_constraints).cwiseAbs();
+  const Eigen::MatrixXd Aeq =
+      Eigen::MatrixXd::Random(num_equalities, num_vars);
+  const Eigen::VectorXd beq = 0.1 * Eigen::VectorXd::Random(num_equalities);
+
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(num_vars, "x");
+  prog.AddQuadraticCost(G, Eigen::VectorXd::Zero(num_vars), x);
+  auto linear_cost = prog.AddLinearCost(g, x).evaluator();
+  auto constraint = prog.AddLinearConstraint(A, lb, ub, x).evaluator();
+  prog.AddLinearEqualityConstraint(Aeq, beq, x);
+  prog.AddBoundingBoxConstraint(-10, 10, x);
+  Eigen::VectorXd lb_all(num_constraints + num_vars);
+  Eigen::VectorXd ub_all(num_constraints + num_vars);
+  Eigen::MatrixXd A_all(num_constraints + num_vars, num_vars);
+  A_all << A, Eigen::MatrixXd::Identity(num_vars, num_vars);
+
+  ActiveSetQPSolver solver;
+  for (int i = 0; i < 20; ++i) {
+    linear_cost->UpdateCoefficients(g);
+    constraint->UpdateLowerBound(lb);
+    constraint->UpdateUpperBound(ub);
+    ASSERT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    lb_all << lb, Eigen::VectorXd::Constant(num_vars, -10);
+    ub_all << ub, Eigen::VectorXd::Constant(num_vars, 10);
+    CheckOptimality(prog, x, G, g, A_all, lb_all, ub_all, Aeq, beq);
+
+    // A fresh program, solved without a warm start, agrees.
+    MathematicalProgram cold_prog;
+    auto y = cold_prog.NewContinuousVariables(num_vars, "y");
+    cold_prog.AddQuadraticCost(G, g, y);
+    cold_prog.AddLinearConstraint(A, lb, ub, y);
+    cold_prog.AddLinearEqualityConstraint(Aeq, beq, y);
+    cold_prog.AddBoundingBoxConstraint(-10, 10, y);
+    ASSERT_EQ(solver.Solve(cold_prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(cold_prog.GetSolution(y), prog.GetSolution(x),
+                                1E-8));
+
+    g += 0.2 * Eigen::VectorXd::Random(num_vars);
+    lb += 0.02 * Eigen::VectorXd::Random(num_constraints);
+    ub = ub.cwiseMax(lb);
+  }
+}
+
+GTEST_TEST(ActiveSetQPSolverTest, TestWarmStart) {
+  // The minimum of |x - x_d|² over the box [-1, 1]² is the projection of x_d,
+  // which has x₀ = 1 active while x_d(0) > 1 and -1 < x_d(1) < 1.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticCost(2 * Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(-4, 0), x)
+                  .evaluator();
+  prog.AddBoundingBoxConstraint(-1, 1, x);
+  ActiveSetQPSolver solver;
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1, 0),
+                              1E-12));
+
+  // With the same active set, the warm start needs no iteration.
+  prog.SetSolverOption(ActiveSetQPSolver::id(), "MaxIterations", 0);
+  cost->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d(-6, 1));
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1, -0.5),
+                              1E-12));
+  ASSERT_TRUE(prog.GetNumIterations());
+  EXPECT_EQ(*prog.GetNumIterations(), 0);
+
+  // Dropping x₀ = 1 from the active set needs no iteration either, but
+  // adding x₁ = 1 does.
+  cost->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d(0, 0.5));
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(0, -0.25),
+                              1E-12));
+  cost->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d(0, -4));
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kIterationLimit);
+  prog.SetSolverOption(ActiveSetQPSolver::id(), "MaxIterations", 1);
+  EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(0, 1),
+                              1E-12));
+  ASSERT_TRUE(prog.GetNumIterations());
+  EXPECT_EQ(*prog.GetNumIterations(), 1);
+
+  // A program of the same size, solved from scratch, needs an iteration.
+  MathematicalProgram cold_prog;
+  auto y = cold_prog.NewContinuousVariables<2>();
+  cold_prog.AddQuadraticCost(2 * Eigen::Matrix2d::Identity(),
+                             Eigen::Vector2d(0, -4), y);
+  cold_prog.AddBoundingBoxConstraint(-1, 1, y);
+  cold_prog.SetSolverOption(ActiveSetQPSolver::id(), "MaxIterations", 0);
+  EXPECT_EQ(solver.Solve(cold_prog), SolutionResult::kIterationLimit);
+}
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,90 @@
+// Measures the time taken to construct a MathematicalProgram from symbolic
+// expressions, which is dominated by the extraction of the linear and
+// quadratic coefficients in symbolic_extraction.h. The number of constraints
+// defaults to 50000, and can be given as the first command line argument.
+
+#include <cstdlib>
+#include <iostream>
+
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using std::cout;
+using std::endl;
+using symbolic::Expression;
+
+// Number of terms of the quadratic cost. Summing symbolic expressions one
+// term at a time is quadratic in the number of terms, hence the smaller size.
+const int kNumCostTerms = 2000;
+
+void Report(const char* name, double elapsed, int num_rows) {
+  cout << name << ": " << elapsed << " s  (" << 1.0e6 * elapsed / num_rows
+       << " us per row)" << endl;
+}
+
+void BenchmarkProgramConstruction(int num_constraints) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables(num_constraints + 2, "x");
+
+  // Second differences x(i) - 2 x(i + 1) + x(i + 2), as in the discretization
+  // of trajectory optimization problems.
+  VectorX<Expression> v(num_constraints);
+  const double expression_time = MeasureExecutionTime([&]() {
+    for (int i = 0; i < num_constraints; ++i) {
+      v(i) = x(i) - 2 * x(i + 1) + x(i + 2);
+    }
+  });
+  const Eigen::VectorXd lb = Eigen::VectorXd::Constant(num_constraints, -1);
+  const Eigen::VectorXd ub = Eigen::VectorXd::Constant(num_constraints, 1);
+
+  cout << "MathematicalProgram construction (" << num_constraints
+       << " constraints):" << endl;
+  Report("  Creating the expressions", expression_time, num_constraints);
+  Report("  AddLinearConstraint(vector of expressions)",
+         MeasureExecutionTime([&]() {
+    prog.AddLinearConstraint(v, lb, ub);
+  }), num_constraints);
+  Report("  AddLinearEqualityConstraint(vector of expressions)",
+         MeasureExecutionTime([&]() {
+    prog.AddLinearEqualityConstraint(v, lb);
+  }), num_constraints);
+  Report("  AddLinearConstraint(expression), row by row",
+         MeasureExecutionTime([&]() {
+    for (int i = 0; i < num_constraints; ++i) {
+      prog.AddLinearConstraint(v(i), -1, 1);
+    }
+  }), num_constraints);
+  Report("  AddConstraint(formula), row by row", MeasureExecutionTime([&]() {
+    for (int i = 0; i < num_constraints; ++i) {
+      prog.AddConstraint(v(i) <= 1);
+    }
+  }), num_constraints);
+
+  Expression cost;
+  for (int i = 0; i < kNumCostTerms; ++i) {
+    cost += (x(i) - x(i + 1)) * (x(i) - x(i + 1)) + x(i);
+  }
+  Report("  AddQuadraticCost(expression)", MeasureExecutionTime([&]() {
+    prog.AddQuadraticCost(cost);
+  }), kNumCostTerms);
+  Report("  AddCost(expression)", MeasureExecutionTime([&]() {
+    prog.AddCost(cost);
+  }), kNumCostTerms);
+  cout << "  (" << prog.linear_constraints().size() << " linear constraints, "
+       << prog.quadratic_costs().size() << " quadratic costs)" << endl;
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  const int num_constraints = argc > 1 ? std::atoi(argv[1]) : 50000;
+  drake::solvers::BenchmarkProgramConstruction(num_constraints);
+  return 0;
+}
@@ -0,0 +1,510 @@
+// Measures every available MathematicalProgram backend on a set of
+// representative programs: random sparse LPs, QPs, SOCPs and SDPs, the
+// DirectCollocation swing-ups of the pendulum and of the acrobot, the global
+// inverse kinematics of the KUKA iiwa arm, whose rotation matrices are relaxed
+// with the mixed-integer McCormick envelopes of rotation_constraint.h, and the
+// impact LCPs of ConstraintSolver. The random programs have 100 variables by
+// default, which can be changed with the first command line argument.
+//
+// For each program and backend, this reports
+//  - the setup time, taken to build the program,
+//  - the solve time, taken by Solve(), which includes the translation of the
+//    program into the data of the backend,
+//  - the number of iterations, if the backend reports it (see
+//    MathematicalProgram::GetNumIterations()),
+//  - the optimal cost,
+//  - the residual, the largest violation of a constraint at the solution, and
+//  - the solution result.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/measure_execution.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/examples/acrobot/acrobot_plant.h"
+#include "drake/examples/pendulum/pendulum_plant.h"
+#include "drake/multibody/global_inverse_kinematics.h"
+#include "drake/multibody/joints/floating_base_types.h"
+#include "drake/multibody/parsers/urdf_parser.h"
+#include "drake/solvers/active_set_qp_solver.h"
+#include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/moby_lcp_solver.h"
+#include "drake/solvers/mosek_solver.h"
+#include "drake/solvers/nlopt_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/solvers/snopt_solver.h"
+#include "drake/solvers/unrevised_lemke_solver.h"
+#include "drake/systems/trajectory_optimization/direct_collocation.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using common::test::MeasureExecutionTime;
+using std::cout;
+using std::endl;
+using symbolic::Expression;
+using systems::trajectory_optimization::DirectCollocation;
+using trajectories::PiecewisePolynomial;
+
+const double kInf = std::numeric_limits<double>::infinity();
+
+// A program, together with the backends to measure it with.
+struct Benchmark {
+  std::string name;
+  // Builds the program from scratch. It is called once per backend, so that
+  // every backend solves a fresh program.
+  std::function<std::unique_ptr<MathematicalProgram>()> make_program;
+  std::vector<SolverId> solver_ids;
+};
+
+// Returns an m × n matrix whose entries are nonzero, and normally distributed,
+// with probability `density`.
+Eigen::SparseMatrix<double> RandomSparseMatrix(int m, int n, double density,
+                                               std::mt19937* generator) {
+  std::uniform_real_distribution<double> uniform(0, 1);
+  std::normal_distribution<double> normal;
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      if (uniform(*generator) < density) {
+        triplets.emplace_back(i, j, normal(*generator));
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> A(m, n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+Eigen::VectorXd RandomVector(int n, std::mt19937* generator) {
+  std::normal_distribution<double> normal;
+  Eigen::VectorXd v(n);
+  for (int i = 0; i < n; ++i) {
+    v(i) = normal(*generator);
+  }
+  return v;
+}
+
+// About five nonzero entries per row of the random constraints.
+double Density(int num_vars) { return std::min(1.0, 5.0 / num_vars); }
+
+// Adds the constraints A x ≤ b with a random sparse A, and the box
+// -10 ≤ x ≤ 10, that have a strictly feasible point in the box.
+void AddRandomLinearConstraints(int num_constraints,
+                                const VectorXDecisionVariable& x,
+                                std::mt19937* generator,
+                                MathematicalProgram* prog) {
+  std::uniform_real_distribution<double> uniform(0, 1);
+  const Eigen::SparseMatrix<double> A = RandomSparseMatrix(
+      num_constraints, x.rows(), Density(x.rows()), generator);
+  Eigen::VectorXd x0(x.rows());
+  for (int i = 0; i < x.rows(); ++i) {
+    x0(i) = 2 * uniform(*generator) - 1;
+  }
+  Eigen::VectorXd b = A * x0;
+  for (int i = 0; i < num_constraints; ++i) {
+    b(i) += uniform(*generator);
+  }
+  prog->AddLinearConstraint(
+      A, Eigen::VectorXd::Constant(num_constraints, -kInf), b, x);
+  prog->AddBoundingBoxConstraint(-10, 10, x);
+}
+
+std::unique_ptr<MathematicalProgram> MakeRandomLp(int num_vars) {
+  std::mt19937 generator(1);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewContinuousVariables(num_vars, "x");
+  AddRandomLinearConstraints(2 * num_vars, x, &generator, prog.get());
+  prog->AddLinearCost(RandomVector(num_vars, &generator), x);
+  return prog;
+}
+
+std::unique_ptr<MathematicalProgram> MakeRandomQp(int num_vars) {
+  std::mt19937 generator(2);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewContinuousVariables(num_vars, "x");
+  AddRandomLinearConstraints(num_vars, x, &generator, prog.get());
+  // Q = PᵀP + I is sparse and positive definite.
+  const Eigen::SparseMatrix<double> P =
+      RandomSparseMatrix(num_vars, num_vars, Density(num_vars), &generator);
+  Eigen::SparseMatrix<double> identity(num_vars, num_vars);
+  identity.setIdentity();
+  const Eigen::SparseMatrix<double> Q =
+      Eigen::SparseMatrix<double>(P.transpose() * P) + identity;
+  prog->AddQuadraticCost(Q, RandomVector(num_vars, &generator), 0, x);
+  return prog;
+}
+
+std::unique_ptr<MathematicalProgram> MakeRandomSocp(int num_vars) {
+  std::mt19937 generator(3);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewContinuousVariables(num_vars, "x");
+  AddRandomLinearConstraints(num_vars, x, &generator, prog.get());
+  // Cones A x + b with b strictly inside the cone, such that x = 0 is
+  // strictly feasible.
+  const int kConeSize = 6;
+  for (int i = 0; i < std::max(1, num_vars / 10); ++i) {
+    const Eigen::MatrixXd A = RandomSparseMatrix(
+        kConeSize, num_vars, Density(num_vars), &generator).toDense();
+    Eigen::VectorXd b = RandomVector(kConeSize, &generator);
+    b(0) = b.tail(kConeSize - 1).norm() + 1;
+    prog->AddLorentzConeConstraint(A, b, x);
+  }
+  // |x| ≤ 10.
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(num_vars + 1, num_vars);
+  A.bottomRows(num_vars).setIdentity();
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(num_vars + 1);
+  b(0) = 10;
+  prog->AddLorentzConeConstraint(A, b, x);
+  prog->AddLinearCost(RandomVector(num_vars, &generator), x);
+  return prog;
+}
+
+// Returns a random symmetric n × n matrix.
+Eigen::MatrixXd RandomSymmetricMatrix(int n, std::mt19937* generator) {
+  const Eigen::VectorXd v = RandomVector(n * n, generator);
+  const Eigen::MatrixXd B = Eigen::Map<const Eigen::MatrixXd>(v.data(), n, n);
+  return B + B.transpose();
+}
+
+// min trace(C X) s.t. trace(Aᵢ X) = bᵢ, X ≽ 0, where X has about
+// `num_vars` entries, C is positive definite and the bᵢ are those of a
+// positive definite matrix.
+std::unique_ptr<MathematicalProgram> MakeRandomSdp(int num_vars) {
+  std::mt19937 generator(4);
+  auto prog = std::make_unique<MathematicalProgram>();
+  const int n = std::max(2, static_cast<int>(std::sqrt(num_vars)));
+  const auto X = prog->NewSymmetricContinuousVariables(n, "X");
+  prog->AddPositiveSemidefiniteConstraint(X);
+  const Eigen::MatrixXd B = RandomSymmetricMatrix(n, &generator);
+  const Eigen::MatrixXd X0 =
+      B * B.transpose() + Eigen::MatrixXd::Identity(n, n);
+  for (int k = 0; k < n; ++k) {
+    const Eigen::MatrixXd A = RandomSymmetricMatrix(n, &generator);
+    Expression e;
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        e += A(i, j) * X(i, j);
+      }
+    }
+    prog->AddLinearEqualityConstraint(e, (A * X0).trace());
+  }
+  const Eigen::MatrixXd D = RandomSymmetricMatrix(n, &generator);
+  const Eigen::MatrixXd C = D * D + Eigen::MatrixXd::Identity(n, n);
+  Expression cost;
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      cost += C(i, j) * X(i, j);
+    }
+  }
+  prog->AddLinearCost(cost);
+  return prog;
+}
+
+// The swing-up of examples/pendulum/trajectory_optimization_simulation.cc.
+std::unique_ptr<MathematicalProgram> MakePendulumSwingUp(
+    const examples::pendulum::PendulumPlant<double>& pendulum) {
+  auto context = pendulum.CreateDefaultContext();
+  auto dircol = std::make_unique<DirectCollocation>(&pendulum, *context, 21,
+                                                    0.2, 0.5);
+  dircol->AddEqualTimeIntervalsConstraints();
+  const double kTorqueLimit = 3.0;
+  const VectorXDecisionVariable& u = dircol->input();
+  dircol->AddConstraintToAllKnotPoints(-kTorqueLimit <= u(0));
+  dircol->AddConstraintToAllKnotPoints(u(0) <= kTorqueLimit);
+  const Eigen::Vector2d x0(0, 0);
+  const Eigen::Vector2d xG(M_PI, 0);
+  dircol->AddLinearConstraint(dircol->initial_state() == x0);
+  dircol->AddLinearConstraint(dircol->final_state() == xG);
+  const double R = 10;  // Cost on input "effort".
+  dircol->AddRunningCost((R * u) * u);
+  dircol->SetInitialTrajectory(
+      PiecewisePolynomial<double>(),
+      PiecewisePolynomial<double>::FirstOrderHold({0, 4}, {x0, xG}));
+  return dircol;
+}
+
+// The swing-up of examples/acrobot/test/run_swing_up_traj_optimization.cc.
+std::unique_ptr<MathematicalProgram> MakeAcrobotSwingUp(
+    const examples::acrobot::AcrobotPlant<double>& acrobot) {
+  auto context = acrobot.CreateDefaultContext();
+  auto dircol = std::make_unique<DirectCollocation>(&acrobot, *context, 21,
+                                                    0.2, 0.5);
+  dircol->AddEqualTimeIntervalsConstraints();
+  const double kTorqueLimit = 8;
+  const VectorXDecisionVariable& u = dircol->input();
+  dircol->AddConstraintToAllKnotPoints(-kTorqueLimit <= u(0));
+  dircol->AddConstraintToAllKnotPoints(u(0) <= kTorqueLimit);
+  const Eigen::Vector4d x0(0, 0, 0, 0);
+  const Eigen::Vector4d xG(M_PI, 0, 0, 0);
+  dircol->AddLinearConstraint(dircol->initial_state() == x0);
+  dircol->AddLinearConstraint(dircol->final_state() == xG);
+  const double R = 10;  // Cost on input "effort".
+  dircol->AddRunningCost((R * u) * u);
+  dircol->SetInitialTrajectory(
+      PiecewisePolynomial<double>(),
+      PiecewisePolynomial<double>::FirstOrderHold({0, 4}, {x0, xG}));
+  return dircol;
+}
+
+std::unique_ptr<RigidBodyTreed> MakeKuka() {
+  auto tree = std::make_unique<RigidBodyTreed>();
+  parsers::urdf::AddModelInstanceFromUrdfFile(
+      FindResourceOrThrow("drake/manipulation/models/iiwa_description/urdf/"
+                          "iiwa14_polytope_collision.urdf"),
+      multibody::joints::kFixed, nullptr, tree.get());
+  return tree;
+}
+
+// Reaches the end-effector pose of a posture within the joint limits, as in
+// multibody/dev/test/global_inverse_kinematics_test.cc.
+std::unique_ptr<MathematicalProgram> MakeGlobalIk(const RigidBodyTreed& kuka) {
+  auto global_ik = std::make_unique<multibody::GlobalInverseKinematics>(kuka);
+  const Eigen::VectorXd& q_lb = kuka.joint_limit_min;
+  const Eigen::VectorXd& q_ub = kuka.joint_limit_max;
+  Eigen::VectorXd q = q_lb;
+  for (int i = 0; i < q.rows(); ++i) {
+    q(i) += (q_ub(i) - q_lb(i)) * i / 10.0;
+  }
+  const KinematicsCache<double> cache = kuka.doKinematics(q);
+  const int ee_idx = kuka.FindBodyIndex("iiwa_link_ee");
+  const Eigen::Isometry3d X_WE =
+      kuka.CalcBodyPoseInWorldFrame(cache, kuka.get_body(ee_idx));
+  global_ik->AddWorldPositionConstraint(ee_idx, Eigen::Vector3d::Zero(),
+                                        X_WE.translation(), X_WE.translation());
+  global_ik->AddWorldOrientationConstraint(
+      ee_idx, Eigen::Quaterniond(X_WE.linear()), 0);
+  return global_ik;
+}
+
+// The LCP of an impact at `num_contacts` frictional contacts, with the block
+// structure formed by ConstraintSolver::FormImpactingConstraintLCP() (whose
+// formation is private, hence reproduced here), without joint limits:
+//   MM = | N M⁻¹ Nᵀ  N M⁻¹ Dᵀ  0 |   qq = | N v |
+//        | D M⁻¹ Nᵀ  D M⁻¹ Dᵀ  E |        | D v |
+//        | μ         -Eᵀ       0 |        | 0   |
+// where D = [F; -F] spans two tangent directions per contact, and the
+// generalized inertia M is random positive definite.
+std::unique_ptr<MathematicalProgram> MakeImpactLcp(int num_contacts) {
+  const double kFrictionCoefficient = 0.5;
+  std::mt19937 generator(5);
+  const int nc = num_contacts;
+  const int nr = 2 * nc;
+  const int nk = 2 * nr;
+  const int ngv = 3 * nc;
+  const Eigen::VectorXd b = RandomVector(ngv * ngv, &generator);
+  const Eigen::MatrixXd B = Eigen::Map<const Eigen::MatrixXd>(b.data(), ngv,
+                                                              ngv);
+  const Eigen::MatrixXd M =
+      B * B.transpose() + Eigen::MatrixXd::Identity(ngv, ngv);
+  const Eigen::MatrixXd N =
+      RandomSparseMatrix(nc, ngv, Density(ngv), &generator).toDense();
+  const Eigen::MatrixXd F =
+      RandomSparseMatrix(nr, ngv, Density(ngv), &generator).toDense();
+  Eigen::MatrixXd D(nk, ngv);
+  D << F, -F;
+  Eigen::MatrixXd E = Eigen::MatrixXd::Zero(nk, nc);
+  for (int i = 0; i < nc; ++i) {
+    E.block(2 * i, i, 2, 1).setOnes();
+    E.block(nr + 2 * i, i, 2, 1).setOnes();
+  }
+  const Eigen::LLT<Eigen::MatrixXd> llt(M);
+  const Eigen::MatrixXd iM_NT = llt.solve(N.transpose());
+  const Eigen::MatrixXd iM_DT = llt.solve(D.transpose());
+  const Eigen::VectorXd v = RandomVector(ngv, &generator);
+
+  Eigen::MatrixXd MM = Eigen::MatrixXd::Zero(2 * nc + nk, 2 * nc + nk);
+  MM.block(0, 0, nc, nc) = N * iM_NT;
+  MM.block(0, nc, nc, nk) = N * iM_DT;
+  MM.block(nc, 0, nk, nc) = D * iM_NT;
+  MM.block(nc, nc, nk, nk) = D * iM_DT;
+  MM.block(nc, nc + nk, nk, nc) = E;
+  MM.block(nc + nk, 0, nc, nc) = kFrictionCoefficient *
+                                 Eigen::MatrixXd::Identity(nc, nc);
+  MM.block(nc + nk, nc, nc, nk) = -E.transpose();
+  Eigen::VectorXd qq = Eigen::VectorXd::Zero(2 * nc + nk);
+  qq.head(nc) = N * v;
+  qq.segment(nc, nk) = D * v;
+
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto z = prog->NewContinuousVariables(2 * nc + nk, "z");
+  prog->AddLinearComplementarityConstraint(MM, qq, z);
+  return prog;
+}
+
+// Returns the largest violation of the bounds of the constraints in
+// `bindings`, at the solution of `prog`.
+template <typename C>
+double MaxBoundViolation(const MathematicalProgram& prog,
+                         const std::vector<Binding<C>>& bindings) {
+  double violation = 0;
+  for (const auto& binding : bindings) {
+    const Eigen::VectorXd y = prog.EvalBindingAtSolution(binding);
+    if (y.rows() == 0) {
+      continue;
+    }
+    const Eigen::VectorXd& lb = binding.evaluator()->lower_bound();
+    const Eigen::VectorXd& ub = binding.evaluator()->upper_bound();
+    violation = std::max(
+        {violation, (lb - y).maxCoeff(), (y - ub).maxCoeff()});
+  }
+  return violation;
+}
+
+// Returns the largest violation of a constraint of `prog` at its solution.
+// For a complementarity constraint 0 ≤ z ⊥ Mz + q ≥ 0, this is the largest
+// of -z, -(Mz + q) and |z ∘ (Mz + q)|.
+double MaxResidual(const MathematicalProgram& prog) {
+  double residual = std::max({
+      MaxBoundViolation(prog, prog.generic_constraints()),
+      MaxBoundViolation(prog, prog.linear_equality_constraints()),
+      MaxBoundViolation(prog, prog.linear_constraints()),
+      MaxBoundViolation(prog, prog.bounding_box_constraints()),
+      MaxBoundViolation(prog, prog.lorentz_cone_constraints()),
+      MaxBoundViolation(prog, prog.rotated_lorentz_cone_constraints()),
+      MaxBoundViolation(prog, prog.positive_semidefinite_constraints()),
+      MaxBoundViolation(prog, prog.linear_matrix_inequality_constraints())});
+  for (const auto& binding : prog.linear_complementarity_constraints()) {
+    const Eigen::VectorXd z = prog.GetSolution(binding.variables());
+    const Eigen::VectorXd w = prog.EvalBindingAtSolution(binding);
+    residual = std::max({residual, (-z).maxCoeff(), (-w).maxCoeff(),
+                         z.cwiseProduct(w).cwiseAbs().maxCoeff()});
+  }
+  return residual;
+}
+
+// Formats residuals, which span many orders of magnitude.
+std::string FormatResidual(double residual) {
+  std::ostringstream os;
+  os << std::setprecision(3) << residual;
+  return os.str();
+}
+
+void RunBenchmark(
+    const Benchmark& benchmark,
+    const std::vector<std::unique_ptr<MathematicalProgramSolverInterface>>&
+        backends) {
+  cout << benchmark.name << ":" << endl;
+  cout << std::left << std::setprecision(3) << "  " << std::setw(18)
+       << "solver" << std::setw(12) << "setup (s)" << std::setw(12)
+       << "solve (s)" << std::setw(12) << "iterations" << std::setw(14)
+       << "cost" << std::setw(12) << "residual" << "result" << endl;
+  for (const SolverId& solver_id : benchmark.solver_ids) {
+    const auto it = std::find_if(
+        backends.begin(), backends.end(),
+        [&solver_id](const auto& backend) {
+          return backend->solver_id() == solver_id;
+        });
+    DRAKE_DEMAND(it != backends.end());
+    const MathematicalProgramSolverInterface& solver = **it;
+    cout << "  " << std::setw(18) << solver_id.name();
+    if (!solver.available()) {
+      cout << "(not available)" << endl;
+      continue;
+    }
+    std::unique_ptr<MathematicalProgram> prog;
+    const double setup_time =
+        MeasureExecutionTime([&]() { prog = benchmark.make_program(); });
+    SolutionResult result{SolutionResult::kUnknownError};
+    double solve_time{};
+    try {
+      solve_time =
+          MeasureExecutionTime([&]() { result = solver.Solve(*prog); });
+    } catch (const std::exception& e) {
+      cout << std::setw(12) << setup_time << "(" << e.what() << ")" << endl;
+      continue;
+    }
+    const optional<int>& num_iterations = prog->GetNumIterations();
+    cout << std::setw(12) << setup_time << std::setw(12) << solve_time
+         << std::setw(12)
+         << (num_iterations ? std::to_string(*num_iterations) : "-")
+         << std::setw(14) << prog->GetOptimalCost() << std::setw(12)
+         << (result == SolutionResult::kSolutionFound
+                 ? FormatResidual(MaxResidual(*prog))
+                 : "-")
+         << result << endl;
+  }
+  cout << endl;
+}
+
+void RunBenchmarks(int num_vars) {
+  std::vector<std::unique_ptr<MathematicalProgramSolverInterface>> backends;
+  backends.push_back(std::make_unique<OsqpSolver>());
+  backends.push_back(std::make_unique<ActiveSetQPSolver>());
+  backends.push_back(std::make_unique<ScsSolver>());
+  backends.push_back(std::make_unique<GurobiSolver>());
+  backends.push_back(std::make_unique<MosekSolver>());
+  backends.push_back(std::make_unique<SnoptSolver>());
+  backends.push_back(std::make_unique<IpoptSolver>());
+  backends.push_back(std::make_unique<NloptSolver>());
+  backends.push_back(std::make_unique<MobyLCPSolver<double>>());
+  backends.push_back(std::make_unique<UnrevisedLemkeSolver<double>>());
+
+  const std::vector<SolverId> nonlinear_solvers{
+      SnoptSolver::id(), IpoptSolver::id(), NloptSolver::id()};
+  const examples::pendulum::PendulumPlant<double> pendulum;
+  const examples::acrobot::AcrobotPlant<double> acrobot;
+  const std::unique_ptr<RigidBodyTreed> kuka = MakeKuka();
+  const int num_contacts = std::max(1, num_vars / 10);
+
+  const std::string size = " (" + std::to_string(num_vars) + " variables)";
+  const std::vector<Benchmark> benchmarks{
+      {"Random sparse LP" + size,
+       [num_vars]() { return MakeRandomLp(num_vars); },
+       {OsqpSolver::id(), ScsSolver::id(), GurobiSolver::id(),
+        MosekSolver::id(), SnoptSolver::id(), IpoptSolver::id(),
+        NloptSolver::id()}},
+      {"Random sparse QP" + size,
+       [num_vars]() { return MakeRandomQp(num_vars); },
+       {OsqpSolver::id(), ActiveSetQPSolver::id(), ScsSolver::id(),
+        GurobiSolver::id(), MosekSolver::id(), SnoptSolver::id(),
+        IpoptSolver::id(), NloptSolver::id()}},
+      {"Random sparse SOCP" + size,
+       [num_vars]() { return MakeRandomSocp(num_vars); },
+       {ScsSolver::id(), GurobiSolver::id(), MosekSolver::id(),
+        SnoptSolver::id(), IpoptSolver::id(), NloptSolver::id()}},
+      {"Random SDP" + size,
+       [num_vars]() { return MakeRandomSdp(num_vars); },
+       {ScsSolver::id(), MosekSolver::id()}},
+      {"Pendulum swing-up (DirectCollocation)",
+       [&pendulum]() { return MakePendulumSwingUp(pendulum); },
+       nonlinear_solvers},
+      {"Acrobot swing-up (DirectCollocation)",
+       [&acrobot]() { return MakeAcrobotSwingUp(acrobot); },
+       nonlinear_solvers},
+      {"KUKA iiwa global IK (McCormick relaxation)",
+       [&kuka]() { return MakeGlobalIk(*kuka); },
+       {GurobiSolver::id(), MosekSolver::id()}},
+      {"Impact LCP (" + std::to_string(num_contacts) + " contacts)",
+       [num_contacts]() { return MakeImpactLcp(num_contacts); },
+       {MobyLcpSolverId::id(), UnrevisedLemkeSolverId::id(),
+        SnoptSolver::id()}}};
+  for (const Benchmark& benchmark : benchmarks) {
+    RunBenchmark(benchmark, backends);
+  }
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+  const int num_vars = argc > 1 ? std::atoi(argv[1]) : 100;
+  drake::solvers::RunBenchmarks(num_vars);
+  return 0;
+}
@@ -1275,6 +1275,70 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, NodeCallbackTest) {
   dut.BranchAndUpdate(dut.mutable_root(), x(2));
   EXPECT_EQ(num_visited_nodes, 5);
 }
+
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  // Solve prog 2, 3 and 4 with several threads, for each of the node and
+  // variable selection methods. Each search starts from a new tree, so that
+  // the workers share the nodes from the root on.
+  auto prog2 = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog2->decision_variables();
+  auto prog3 = ConstructMathematicalProgram3();
+  auto prog4 = ConstructMathematicalProgram4();
+  Eigen::Matrix<double, 5, 1> x_expected0;
+  x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+  const double tol{1E-3};
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      MixedIntegerBranchAndBound bnb2(*prog2, GurobiSolver::id());
+      bnb2.SetNodeSelectionMethod(pick_node);
+      bnb2.SetVariableSelectionMethod(pick_variable);
+      bnb2.set_max_num_threads(3);
+      EXPECT_EQ(bnb2.get_max_num_threads(), 3);
+      EXPECT_EQ(bnb2.Solve(), SolutionResult::kSolutionFound);
+      EXPECT_NEAR(bnb2.GetOptimalCost(), -13.0 / 3, tol);
+      EXPECT_TRUE(CompareMatrices(bnb2.GetSolution(x, 0), x_expected0, tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_LE(bnb2.best_upper_bound() - bnb2.best_lower_bound(),
+                bnb2.absolute_gap_tol() + tol);
+
+      MixedIntegerBranchAndBound bnb3(*prog3, GurobiSolver::id());
+      bnb3.SetNodeSelectionMethod(pick_node);
+      bnb3.SetVariableSelectionMethod(pick_variable);
+      bnb3.set_max_num_threads(3);
+      EXPECT_EQ(bnb3.Solve(), SolutionResult::kUnbounded);
+
+      MixedIntegerBranchAndBound bnb4(*prog4, GurobiSolver::id());
+      bnb4.SetNodeSelectionMethod(pick_node);
+      bnb4.SetVariableSelectionMethod(pick_variable);
+      bnb4.set_max_num_threads(3);
+      EXPECT_EQ(bnb4.Solve(), SolutionResult::kInfeasibleConstraints);
+    }
+  }
+
+  // The user-defined functions are never called concurrently, hence the
+  // counter in the node callback needs no synchronization.
+  MixedIntegerBranchAndBound bnb(*prog2, GurobiSolver::id());
+  bnb.SetNodeSelectionMethod(
+      MixedIntegerBranchAndBound::NodeSelectionMethod::kUserDefined);
+  bnb.SetUserDefinedNodeSelectionFunction([](
+      const MixedIntegerBranchAndBound& branch_and_bound) {
+    return LeftMostNodeInSubTree(branch_and_bound, *(branch_and_bound.root()));
+  });
+  int num_visited_nodes = 0;
+  bnb.SetUserDefinedNodeCallbackFunction(
+      [&num_visited_nodes](const MixedIntegerBranchAndBoundNode& node,
+                           MixedIntegerBranchAndBound* branch_and_bound) {
+        ++num_visited_nodes;
+      });
+  bnb.set_max_num_threads(4);
+  EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+  EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+  // The root node and both child nodes of each branch are visited.
+  EXPECT_EQ(num_visited_nodes % 2, 1);
+  EXPECT_GT(num_visited_nodes, 1);
+
+  EXPECT_THROW(bnb.set_max_num_threads(0), std::exception);
+}
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
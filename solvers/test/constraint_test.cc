@@ -1,5 +1,7 @@
 #include "drake/solvers/constraint.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic.h"
@@ -46,6 +48,59 @@ GTEST_TEST(testConstraint, testLinearConstraintUpdate) {
   EXPECT_TRUE(CompareMatrices(constraint.A(), A3));
   EXPECT_EQ(constraint.num_constraints(), 3);
 }
+GTEST_TEST(testConstraint, testLinearConstraintSparse) {
+  // A linear constraint constructed from a sparse matrix evaluates, updates
+  // and converts to dense form like one constructed from a dense matrix.
+  const std::vector<Eigen::Triplet<double>> triplets{
+      {0, 0, 1}, {0, 2, -2}, {1, 1, 3}};
+  Eigen::SparseMatrix<double> A(2, 3);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  const Eigen::Vector2d lb(-1, 0);
+  const Eigen::Vector2d ub(1, 2);
+  LinearConstraint constraint(A, lb, ub);
+  EXPECT_EQ(constraint.num_constraints(), 2);
+  EXPECT_EQ(constraint.get_sparse_A().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), A.toDense()));
+
+  const Eigen::Vector3d x(1, 2, 3);
+  VectorXd y;
+  constraint.Eval(x, y);
+  EXPECT_TRUE(CompareMatrices(y, Vector2d(-5, 6)));
+  const AutoDiffVecXd x_autodiff = math::initializeAutoDiff(x);
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(x_autodiff, y_autodiff);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(y_autodiff),
+                              Vector2d(-5, 6)));
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToGradientMatrix(y_autodiff),
+                              A.toDense()));
+
+  // Updating with a sparse matrix replaces the dense form as well.
+  Eigen::SparseMatrix<double> A2(1, 3);
+  A2.insert(0, 1) = 4;
+  constraint.UpdateCoefficients(A2, Vector1d(0), Vector1d(1));
+  EXPECT_EQ(constraint.num_constraints(), 1);
+  EXPECT_TRUE(CompareMatrices(constraint.A(), A2.toDense()));
+  constraint.Eval(x, y);
+  EXPECT_TRUE(CompareMatrices(y, Vector1d(8)));
+  EXPECT_THROW(constraint.UpdateCoefficients(Eigen::SparseMatrix<double>(1, 2),
+                                             Vector1d(0), Vector1d(1)),
+               std::runtime_error);
+
+  // The same holds for equality constraints.
+  LinearEqualityConstraint equality_constraint(A, ub);
+  EXPECT_TRUE(CompareMatrices(equality_constraint.A(), A.toDense()));
+  equality_constraint.UpdateCoefficients(A2, Vector1d(3));
+  EXPECT_TRUE(CompareMatrices(equality_constraint.lower_bound(), Vector1d(3)));
+  EXPECT_TRUE(CompareMatrices(equality_constraint.get_sparse_A().toDense(),
+                              A2.toDense()));
+
+  // A constraint constructed from a dense matrix has both forms.
+  const LinearConstraint dense_constraint(A.toDense(), lb, ub);
+  EXPECT_EQ(dense_constraint.get_sparse_A().nonZeros(), 3);
+  dense_constraint.Eval(x, y);
+  EXPECT_TRUE(CompareMatrices(y, Vector2d(-5, 6)));
+}
+
 GTEST_TEST(testConstraint, testQuadraticConstraintHessian) {
   // Check if the getters in the QuadraticConstraint are right.
   Eigen::Matrix2d Q;
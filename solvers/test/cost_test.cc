@@ -164,6 +164,45 @@ GTEST_TEST(testCost, testQuadraticCost) {
   EXPECT_NEAR(y(0), obj_expected + c, tol);
 }
 
+GTEST_TEST(testCost, testQuadraticCostSparse) {
+  // A cost constructed from a sparse, asymmetric Q matches the cost
+  // constructed from the dense counterpart of Q.
+  Eigen::SparseMatrix<double> Q(3, 3);
+  Q.insert(0, 0) = 1;
+  Q.insert(0, 2) = 2;
+  Q.insert(2, 1) = 3;
+  const Eigen::Vector3d b(5, 6, 7);
+  const Eigen::Vector3d x0(1, -2, 3);
+  const double c = 4;
+  const QuadraticCost cost(Q, b, c);
+  const QuadraticCost dense_cost(Eigen::MatrixXd(Q.toDense()), b, c);
+  const Eigen::MatrixXd Q_symmetric = dense_cost.Q();
+  EXPECT_EQ(cost.get_sparse_Q().nonZeros(), 5);
+  EXPECT_TRUE(CompareMatrices(cost.get_sparse_Q().toDense(), Q_symmetric));
+  EXPECT_TRUE(CompareMatrices(cost.Q(), Q_symmetric));
+
+  Eigen::VectorXd y, y_expected;
+  cost.Eval(x0, y);
+  dense_cost.Eval(x0, y_expected);
+  EXPECT_NEAR(y(0), 0.5 * x0.dot(Q_symmetric * x0) + b.dot(x0) + c, 1E-12);
+  EXPECT_NEAR(y(0), y_expected(0), 1E-12);
+
+  const AutoDiffVecXd x0_autodiff = math::initializeAutoDiff(x0);
+  AutoDiffVecXd y_autodiff;
+  cost.Eval(x0_autodiff, y_autodiff);
+  EXPECT_NEAR(y_autodiff(0).value(), y(0), 1E-12);
+  EXPECT_TRUE(CompareMatrices(y_autodiff(0).derivatives(),
+                              Q_symmetric * x0 + b, 1E-12));
+
+  // Updating with a sparse matrix replaces the dense form as well.
+  QuadraticCost updated_cost(Eigen::Matrix3d::Identity(), b);
+  updated_cost.UpdateCoefficients(Q, b, c);
+  EXPECT_TRUE(CompareMatrices(updated_cost.Q(), Q_symmetric));
+  EXPECT_THROW(updated_cost.UpdateCoefficients(
+                   Eigen::SparseMatrix<double>(2, 2), Vector2d::Zero()),
+               runtime_error);
+}
+
 // TODO(eric.cousineau): Move QuadraticErrorCost and L2NormCost tests here from
 // MathematicalProgram.
 
@@ -168,6 +168,101 @@ GTEST_TEST(EvaluatorBaseTest, FunctionEvaluatorTest) {
   VerifyFunctionEvaluator(MakeFunctionWrapped(callable, 3, 3), x);
 }
 
+// Evaluates y = (x₀ x₂, x₁², x₂) on four inputs, and records the size of the
+// derivatives of its last AutoDiffXd input.
+class SparseEvaluator : public EvaluatorBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseEvaluator)
+
+  explicit SparseEvaluator(bool declare_pattern) : EvaluatorBase(3, 4) {
+    if (declare_pattern) {
+      SetGradientSparsityPattern({{0, 0}, {2, 2}, {1, 1}, {0, 2}});
+    }
+  }
+
+  using EvaluatorBase::SetGradientSparsityPattern;
+
+  int num_derivatives() const { return num_derivatives_; }
+
+ private:
+  template <typename T>
+  void DoEvalGeneric(const Eigen::Ref<const VectorX<T>>& x,
+                     VectorX<T>& y) const {
+    y.resize(3);
+    y << x(0) * x(2), x(1) * x(1), x(2);
+  }
+
+  void DoEval(const Ref<const VectorXd>& x, VectorXd& y) const override {
+    DoEvalGeneric<double>(x, y);
+  }
+
+  void DoEval(const Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd& y) const override {
+    num_derivatives_ = x(3).derivatives().size();
+    DoEvalGeneric<AutoDiffXd>(x, y);
+  }
+
+  mutable int num_derivatives_{-1};
+};
+
+GTEST_TEST(EvaluatorBaseTest, GradientSparsityPattern) {
+  const Eigen::Vector4d x(2, 3, 5, 7);
+  const Eigen::Vector3d y_expected(10, 9, 5);
+  VectorXd y;
+
+  // Without a pattern, the gradient is dense and in row-major order.
+  SparseEvaluator dense(false);
+  EXPECT_FALSE(dense.gradient_sparsity_pattern());
+  const vector<std::pair<int, int>> dense_entries =
+      internal::GetGradientEntries(dense, 4);
+  ASSERT_EQ(dense_entries.size(), 12);
+  EXPECT_EQ(internal::GetNumGradientEntries(dense, 4), 12);
+  EXPECT_EQ(dense_entries[5], std::make_pair(1, 1));
+  vector<double> dense_gradient(12);
+  EXPECT_EQ(internal::EvalWithGradient(dense, x, &y, dense_gradient.data()),
+            12);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  EXPECT_EQ(dense_gradient,
+            vector<double>({5, 0, 2, 0, 0, 6, 0, 0, 0, 0, 1, 0}));
+  EXPECT_EQ(dense.num_derivatives(), 4);
+
+  // With a pattern, only its entries are reported, in its order. The input
+  // that is not in the pattern is not seeded with derivatives, and x₀ and x₁,
+  // on which no output depends jointly, share a derivative.
+  SparseEvaluator sparse(true);
+  ASSERT_TRUE(sparse.gradient_sparsity_pattern());
+  EXPECT_EQ(internal::GetGradientEntries(sparse, 4),
+            *sparse.gradient_sparsity_pattern());
+  EXPECT_EQ(internal::GetNumGradientEntries(sparse, 4), 4);
+  vector<double> sparse_gradient(4);
+  EXPECT_EQ(internal::EvalWithGradient(sparse, x, &y, sparse_gradient.data()),
+            4);
+  EXPECT_TRUE(CompareMatrices(y, y_expected));
+  EXPECT_EQ(sparse_gradient, vector<double>({5, 1, 6, 2}));
+  EXPECT_EQ(sparse.num_derivatives(), 2);
+
+  // Invalid patterns are rejected.
+  EXPECT_THROW(sparse.SetGradientSparsityPattern({{3, 0}}), runtime_error);
+  EXPECT_THROW(sparse.SetGradientSparsityPattern({{0, 4}}), runtime_error);
+  EXPECT_THROW(sparse.SetGradientSparsityPattern({{-1, 0}}), runtime_error);
+  EXPECT_THROW(sparse.SetGradientSparsityPattern({{0, 1}, {0, 1}}),
+               runtime_error);
+  EXPECT_EQ(sparse.gradient_sparsity_pattern()->size(), 4);
+}
+
+GTEST_TEST(EvaluatorBaseTest, ThreadSafety) {
+  SparseEvaluator evaluator(false);
+  EXPECT_TRUE(evaluator.is_thread_safe());
+  evaluator.set_is_thread_safe(false);
+  EXPECT_FALSE(evaluator.is_thread_safe());
+
+  // PolynomialEvaluator reuses a mutable evaluation point.
+  const Polynomiald x("x");
+  const PolynomialEvaluator polynomial_evaluator(
+      Vector1<Polynomiald>(x * x), {x.GetSimpleVariable()});
+  EXPECT_FALSE(polynomial_evaluator.is_thread_safe());
+}
+
 }  // anonymous namespace
 }  // namespace solvers
 }  // namespace drake
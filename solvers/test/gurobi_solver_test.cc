@@ -1,5 +1,7 @@
 #include "drake/solvers/gurobi_solver.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -105,6 +107,48 @@ GTEST_TEST(GurobiTest, TestInitialGuess) {
   }
 }
 
+GTEST_TEST(GurobiTest, TestWarmStart) {
+  GurobiSolver solver;
+  if (solver.available()) {
+    // max x₀ + x₁ s.t x₀ + 2x₁ ≤ 4, 3x₀ + x₁ ≤ 6, x ≥ 0. Both linear
+    // constraints are active at the optimal solution, for either bound on the
+    // first one below.
+    MathematicalProgram prog;
+    auto x = prog.NewContinuousVariables<2>("x");
+    prog.AddLinearCost(-x(0) - x(1));
+    Eigen::Matrix2d A;
+    A << 1, 2, 3, 1;
+    auto constraint = prog.AddLinearConstraint(
+        A, Eigen::Vector2d::Constant(-std::numeric_limits<double>::infinity()),
+        Eigen::Vector2d(4, 6), x);
+    prog.AddBoundingBoxConstraint(0, std::numeric_limits<double>::infinity(),
+                                  x);
+    // Solve with the primal simplex from the given basis.
+    prog.SetSolverOption(GurobiSolver::id(), "Presolve", 0);
+    prog.SetSolverOption(GurobiSolver::id(), "Method", 0);
+
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1.6, 1.2),
+                                1E-6, MatrixCompareType::absolute));
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_GT(*prog.GetNumIterations(), 0);
+    auto prog_copy = prog.Clone();
+
+    // The basis of the previous solve is still optimal.
+    constraint.evaluator()->UpdateUpperBound(Eigen::Vector2d(5, 6));
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Eigen::Vector2d(1.4, 1.8),
+                                1E-6, MatrixCompareType::absolute));
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_EQ(*prog.GetNumIterations(), 0);
+
+    // A copy of the program does not share the basis.
+    EXPECT_EQ(solver.Solve(*prog_copy), SolutionResult::kSolutionFound);
+    ASSERT_TRUE(prog_copy->GetNumIterations());
+    EXPECT_GT(*prog_copy->GetNumIterations(), 0);
+  }
+}
+
 namespace TestCallbacks {
 
 struct TestCallbackInfo {
@@ -1,7 +1,12 @@
 #include "drake/solvers/ipopt_solver.h"
 
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -64,6 +69,41 @@ GTEST_TEST(QPtest, TestUnitBallExample) {
     TestQPonUnitBallExample(solver);
   }
 }
+
+GTEST_TEST(IpoptTest, TestMaxNumThreads) {
+  // A chain of nonlinear constraints, as in trajectory optimization, with
+  // thread-safe quadratic constraints x(i)² + x(i+1)² <= 1, and symbolic
+  // constraints, which are not thread-safe.
+  MathematicalProgram prog;
+  const int num_vars = 20;
+  const auto x = prog.NewContinuousVariables(num_vars);
+  const auto quadratic_constraint = std::make_shared<QuadraticConstraint>(
+      2 * Eigen::Matrix2d::Identity(), Eigen::Vector2d::Zero(),
+      -std::numeric_limits<double>::infinity(), 1);
+  for (int i = 0; i < num_vars - 1; ++i) {
+    prog.AddConstraint(quadratic_constraint, x.segment<2>(i));
+    prog.AddConstraint(x(i) * x(i + 1) >= -0.3);
+    prog.AddQuadraticCost((x(i) - 1) * (x(i) - 1) + 0.1 * x(i + 1));
+  }
+  prog.SetInitialGuessForAllVariables(Eigen::VectorXd::Zero(num_vars));
+
+  IpoptSolver solver;
+  if (solver.available()) {
+    ASSERT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    const Eigen::VectorXd x_sequential = prog.GetSolution(x);
+    const double cost_sequential = prog.GetOptimalCost();
+
+    // The costs and constraints evaluate to the same values with any number
+    // of threads, hence the solver takes the same iterates.
+    prog.SetSolverOption(IpoptSolver::id(), "max_num_threads", 4);
+    ASSERT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_sequential, 0));
+    EXPECT_EQ(prog.GetOptimalCost(), cost_sequential);
+
+    prog.SetSolverOption(IpoptSolver::id(), "max_num_threads", 0);
+    EXPECT_THROW(solver.Solve(prog), std::runtime_error);
+  }
+}
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -2922,6 +2922,219 @@ GTEST_TEST(testMathematicalProgram, testAddCallback) {
   EXPECT_TRUE(was_called);
 }
 
+namespace {
+// Checks that `binding` evaluates as `e`, with the parameters of `prog` at
+// their current values, at a few values of the decision variables of `prog`.
+template <typename C>
+void CheckParametricBinding(const MathematicalProgram& prog,
+                            const Binding<C>& binding, const Expression& e) {
+  for (int trial = 0; trial < 3; ++trial) {
+    const VectorXd x_val = VectorXd::LinSpaced(prog.num_vars(), -1, trial);
+    symbolic::Environment env;
+    for (int i = 0; i < prog.num_vars(); ++i) {
+      env.insert(prog.decision_variable(i), x_val(i));
+    }
+    for (int i = 0; i < prog.num_parameters(); ++i) {
+      env.insert(prog.parameters()(i), prog.GetParameterValues()(i));
+    }
+    EXPECT_NEAR(prog.EvalBinding(binding, x_val)(0), e.Evaluate(env), 1E-12);
+  }
+}
+}  // namespace
+
+GTEST_TEST(testMathematicalProgram, testParametricCosts) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(2, "p");
+  EXPECT_EQ(prog.num_parameters(), 2);
+  EXPECT_TRUE(CompareMatrices(prog.GetParameterValues(), Vector2d::Zero()));
+
+  const Expression e_linear = p(0) * x(0) + (2 + p(1)) * x(1) + 3 * p(0) + 1;
+  const Binding<LinearCost> linear_cost = prog.AddLinearCost(e_linear);
+  EXPECT_TRUE(CompareMatrices(linear_cost.evaluator()->a(), Vector2d(0, 2)));
+  EXPECT_EQ(linear_cost.evaluator()->b(), 1);
+
+  const Expression e_quadratic =
+      (x(0) - p(0)) * (x(0) - p(0)) + p(1) * x(0) * x(1) + x(1) * x(1);
+  const Binding<QuadraticCost> quadratic_cost =
+      prog.AddQuadraticCost(e_quadratic);
+
+  // AddCost dispatches on the degree in the decision variables.
+  const Binding<Cost> generic_linear_cost = prog.AddCost(p(1) * x(0));
+  EXPECT_TRUE(is_dynamic_castable<LinearCost>(generic_linear_cost.evaluator()));
+  const Binding<Cost> generic_quadratic_cost =
+      prog.AddCost(p(1) * x(0) * x(0));
+  EXPECT_TRUE(
+      is_dynamic_castable<QuadraticCost>(generic_quadratic_cost.evaluator()));
+  EXPECT_EQ(prog.linear_costs().size(), 2);
+  EXPECT_EQ(prog.quadratic_costs().size(), 2);
+
+  for (const Vector2d& p_val : {Vector2d(1, 2), Vector2d(-3, 0.5)}) {
+    prog.SetParameterValues(p, p_val);
+    EXPECT_TRUE(CompareMatrices(prog.GetParameterValues(), p_val));
+    EXPECT_TRUE(CompareMatrices(linear_cost.evaluator()->a(),
+                                Vector2d(p_val(0), 2 + p_val(1))));
+    EXPECT_EQ(linear_cost.evaluator()->b(), 3 * p_val(0) + 1);
+    CheckParametricBinding(prog, linear_cost, e_linear);
+    CheckParametricBinding(prog, quadratic_cost, e_quadratic);
+    CheckParametricBinding(prog, generic_linear_cost, p(1) * x(0));
+    CheckParametricBinding(prog, generic_quadratic_cost, p(1) * x(0) * x(0));
+  }
+
+  // The coefficients must be affine in the parameters, and the costs linear
+  // or quadratic in the decision variables.
+  EXPECT_THROW(prog.AddLinearCost(p(0) * p(1) * x(0)), runtime_error);
+  EXPECT_THROW(prog.AddLinearCost(p(0) * x(0) * x(1)), runtime_error);
+  EXPECT_THROW(prog.AddQuadraticCost(p(0) * pow(x(0), 3)), runtime_error);
+  EXPECT_THROW(prog.AddCost(sin(p(0)) * x(0)), runtime_error);
+
+  // Only the parameters of the program can be set.
+  EXPECT_THROW(prog.SetParameterValues(x, Vector2d::Zero()), runtime_error);
+  EXPECT_THROW(prog.AddDecisionVariables(p), runtime_error);
+}
+
+GTEST_TEST(testMathematicalProgram, testParametricConstraints) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(2, "p");
+
+  // A parameter in the coefficients and in the bounds.
+  const Binding<LinearConstraint> constraint1 =
+      prog.AddLinearConstraint(p(0) * x(0) + x(1) <= p(1) + 1);
+  // Parameters in the constant terms of an array of formulas.
+  Eigen::Matrix2d A;
+  A << 1, 2, 3, 4;
+  const Binding<LinearConstraint> constraint2 =
+      prog.AddLinearConstraint((A * x).array() >= p.array());
+  // An equality constraint.
+  const Binding<LinearEqualityConstraint> constraint3 =
+      prog.AddLinearEqualityConstraint(x(0) + p(0) * x(1), 2);
+  const Binding<Constraint> constraint4 =
+      prog.AddConstraint(x(0) - p(1) * x(1) == p(0));
+  EXPECT_TRUE(
+      is_dynamic_castable<LinearEqualityConstraint>(constraint4.evaluator()));
+  EXPECT_EQ(prog.linear_constraints().size(), 2);
+  EXPECT_EQ(prog.linear_equality_constraints().size(), 2);
+
+  for (const Vector2d& p_val : {Vector2d(1, 2), Vector2d(-3, 0.5)}) {
+    prog.SetParameterValues(p, p_val);
+    EXPECT_TRUE(CompareMatrices(constraint1.evaluator()->A(),
+                                Eigen::RowVector2d(p_val(0), 1)));
+    EXPECT_EQ(constraint1.evaluator()->lower_bound()(0),
+              -numeric_limits<double>::infinity());
+    EXPECT_EQ(constraint1.evaluator()->upper_bound()(0), p_val(1) + 1);
+
+    EXPECT_TRUE(CompareMatrices(constraint2.evaluator()->A(), A));
+    EXPECT_TRUE(CompareMatrices(constraint2.evaluator()->lower_bound(), p_val));
+    EXPECT_TRUE(CompareMatrices(constraint2.evaluator()->upper_bound(),
+                                Vector2d::Constant(
+                                    numeric_limits<double>::infinity())));
+
+    EXPECT_TRUE(CompareMatrices(constraint3.evaluator()->A(),
+                                Eigen::RowVector2d(1, p_val(0))));
+    EXPECT_TRUE(CompareMatrices(constraint3.evaluator()->lower_bound(),
+                                Vector1d(2)));
+
+    const auto constraint4_linear =
+        std::dynamic_pointer_cast<LinearConstraint>(constraint4.evaluator());
+    EXPECT_TRUE(CompareMatrices(constraint4_linear->A(),
+                                Eigen::RowVector2d(1, -p_val(1))));
+    EXPECT_TRUE(CompareMatrices(constraint4_linear->upper_bound(),
+                                Vector1d(p_val(0))));
+  }
+
+  // The constraints must be linear in the decision variables.
+  EXPECT_THROW(prog.AddLinearConstraint(p(0) * x(0) * x(1) <= 1),
+               runtime_error);
+  EXPECT_THROW(prog.AddConstraint(p(0) * x(0) * x(0), 0, 1), runtime_error);
+  EXPECT_THROW(prog.AddLinearEqualityConstraint(p(0) * x(0) <= 1),
+               runtime_error);
+}
+
+GTEST_TEST(testMathematicalProgram, testParametricSolve) {
+  // Projects p onto the line x(0) + x(1) = p(2), i.e. solves
+  //   min |x - p.head<2>()|²  s.t. x(0) + x(1) = p(2)
+  // for several values of p, without building the program again.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(3, "p");
+  const Vector2<Expression> error =
+      x.cast<Expression>() - p.head<2>().cast<Expression>();
+  prog.AddQuadraticCost(error.dot(error));
+  prog.AddLinearEqualityConstraint(x(0) + x(1) == p(2));
+
+  for (const Vector3d& p_val : {Vector3d(1, 2, 0), Vector3d(-1, 4, 2)}) {
+    prog.SetParameterValues(p, p_val);
+    ASSERT_EQ(prog.Solve(), SolutionResult::kSolutionFound);
+    const double shift = (p_val(2) - p_val(0) - p_val(1)) / 2;
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x),
+                                p_val.head<2>() + Vector2d::Constant(shift),
+                                1E-10));
+  }
+
+  // A clone has the same parameters and parameter values.
+  auto clone = prog.Clone();
+  EXPECT_EQ(clone->num_parameters(), 3);
+  EXPECT_TRUE(CompareMatrices(clone->GetParameterValues(),
+                              prog.GetParameterValues()));
+}
+
+GTEST_TEST(testMathematicalProgram, testParametricClone) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  auto p = prog.NewParameters(3, "p");
+  const Expression e_linear = p(0) * x(0) + p(1);
+  const Expression e_quadratic = (x(0) - p(0)) * (x(1) - p(2));
+  const auto linear_cost = prog.AddLinearCost(e_linear);
+  const auto quadratic_cost = prog.AddQuadraticCost(e_quadratic);
+  const auto equality =
+      prog.AddLinearEqualityConstraint(x(0) + p(1) * x(1) == p(2));
+  const auto inequality = prog.AddLinearConstraint(p(2) * x(0) - x(1) <= p(0));
+  const Vector3d p_val(1, 2, 3);
+  prog.SetParameterValues(p, p_val);
+
+  // Setting the parameter values of a clone does not change the original
+  // program.
+  auto clone = prog.Clone();
+  const Vector3d clone_p_val(-4, 5, -6);
+  clone->SetParameterValues(p, clone_p_val);
+  EXPECT_TRUE(CompareMatrices(prog.GetParameterValues(), p_val));
+  EXPECT_TRUE(CompareMatrices(clone->GetParameterValues(), clone_p_val));
+
+  ASSERT_EQ(clone->linear_costs().size(), 1);
+  ASSERT_EQ(clone->quadratic_costs().size(), 1);
+  ASSERT_EQ(clone->linear_equality_constraints().size(), 1);
+  ASSERT_EQ(clone->linear_constraints().size(), 1);
+  const auto& clone_linear_cost = clone->linear_costs()[0];
+  const auto& clone_quadratic_cost = clone->quadratic_costs()[0];
+  const auto& clone_equality = clone->linear_equality_constraints()[0];
+  const auto& clone_inequality = clone->linear_constraints()[0];
+  EXPECT_NE(clone_linear_cost.evaluator(), linear_cost.evaluator());
+  EXPECT_NE(clone_quadratic_cost.evaluator(), quadratic_cost.evaluator());
+  EXPECT_NE(clone_equality.evaluator(), equality.evaluator());
+  EXPECT_NE(clone_inequality.evaluator(), inequality.evaluator());
+
+  CheckParametricBinding(prog, linear_cost, e_linear);
+  CheckParametricBinding(prog, quadratic_cost, e_quadratic);
+  CheckParametricBinding(*clone, clone_linear_cost, e_linear);
+  CheckParametricBinding(*clone, clone_quadratic_cost, e_quadratic);
+
+  for (const auto& pair : {std::make_pair(equality, p_val),
+                           std::make_pair(clone_equality, clone_p_val)}) {
+    EXPECT_TRUE(CompareMatrices(pair.first.evaluator()->A(),
+                                Eigen::RowVector2d(1, pair.second(1))));
+    EXPECT_TRUE(CompareMatrices(pair.first.evaluator()->upper_bound(),
+                                Vector1d(pair.second(2))));
+  }
+  for (const auto& pair : {std::make_pair(inequality, p_val),
+                           std::make_pair(clone_inequality, clone_p_val)}) {
+    EXPECT_TRUE(CompareMatrices(pair.first.evaluator()->A(),
+                                Eigen::RowVector2d(pair.second(2), -1)));
+    EXPECT_TRUE(CompareMatrices(pair.first.evaluator()->upper_bound(),
+                                Vector1d(pair.second(0))));
+  }
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
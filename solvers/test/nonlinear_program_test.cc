@@ -1,3 +1,4 @@
+#include <algorithm>   // std::max
 #include <array>       // std::array
 #include <functional>  // std::function
 #include <limits>      // std::numeric_limits
@@ -395,6 +396,77 @@ GTEST_TEST(testNonlinearProgram, UnitLengthConstraint) {
   RunNonlinearProgram(&prob, [&prob]() {prob.CheckSolution(1E-8);});
 }
 
+// Evaluates y = (x₀², x₀ x₂) on four inputs, with a gradient sparsity pattern,
+// and records the largest size of the derivatives of its AutoDiffXd inputs.
+class SparseGradientConstraint : public Constraint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseGradientConstraint)
+
+  SparseGradientConstraint()
+      : Constraint(2, 4, Vector2d(0, 2),
+                   Vector2d(1, numeric_limits<double>::infinity())) {
+    SetGradientSparsityPattern({{0, 0}, {1, 0}, {1, 2}});
+    // num_derivatives_ is mutable.
+    set_is_thread_safe(false);
+  }
+
+  int num_derivatives() const { return num_derivatives_; }
+
+ protected:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
+              Eigen::VectorXd& y) const override {
+    y.resize(2);
+    y << x(0) * x(0), x(0) * x(2);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              // TODO(#2274) Fix NOLINTNEXTLINE(runtime/references).
+              AutoDiffVecXd& y) const override {
+    for (int i = 0; i < x.size(); ++i) {
+      num_derivatives_ = std::max(
+          num_derivatives_, static_cast<int>(x(i).derivatives().size()));
+    }
+    y.resize(2);
+    y << x(0) * x(0), x(0) * x(2);
+  }
+
+ private:
+  mutable int num_derivatives_{0};
+};
+
+// The solvers that use the gradient sparsity pattern of a constraint only
+// evaluate its nonzero gradient entries, and still find the solution.
+GTEST_TEST(testNonlinearProgram, GradientSparsityPattern) {
+  IpoptSolver ipopt_solver;
+  SnoptSolver snopt_solver;
+  std::pair<const char*, MathematicalProgramSolverInterface*> solvers[] = {
+      std::make_pair("SNOPT", &snopt_solver),
+      std::make_pair("Ipopt", &ipopt_solver)};
+
+  for (const auto& solver : solvers) {
+    if (!solver.second->available()) {
+      continue;
+    }
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables<4>();
+    const auto constraint = std::make_shared<SparseGradientConstraint>();
+    prog.AddConstraint(constraint, x);
+    prog.AddQuadraticCost((x(0) - 2) * (x(0) - 2) + (x(1) - 1) * (x(1) - 1) +
+                          (x(2) - 3) * (x(2) - 3) + x(3) * x(3));
+    prog.SetInitialGuessForAllVariables(Vector4d(0.5, 0, 4.5, 0));
+    ASSERT_EQ(solver.second->Solve(prog), SolutionResult::kSolutionFound)
+        << "Using solver: " << solver.first;
+    // x₀ ≤ 1 is active, and x₀ x₂ ≥ 2 is not.
+    EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), Vector4d(1, 1, 3, 0),
+                                1E-6, MatrixCompareType::absolute))
+        << "Using solver: " << solver.first;
+    // Only x₀ and x₂ appear in the pattern, so that only they are seeded.
+    EXPECT_EQ(constraint->num_derivatives(), 2)
+        << "Using solver: " << solver.first;
+  }
+}
+
 GTEST_TEST(testNonlinearProgram, CallbackTest) {
   MathematicalProgram prog;
   const auto x = prog.NewContinuousVariables<3>();
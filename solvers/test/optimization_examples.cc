@@ -73,6 +73,9 @@ void OptimizationProgram::RunProblem(
 double OptimizationProgram::GetSolverSolutionDefaultCompareTolerance(
     SolverType solver_type) const {
   switch (solver_type) {
+    case SolverType::kActiveSetQP : {
+      return 1E-10;
+    }
     case SolverType::kMosek : {
       return 1E-10;
     }
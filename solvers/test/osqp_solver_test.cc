@@ -21,6 +21,8 @@ GTEST_TEST(QPtest, TestUnconstrainedQP) {
     const double tol = 1E-5;
     EXPECT_NEAR(prog.GetSolution(x(0)), 0, tol);
     EXPECT_NEAR(prog.GetOptimalCost(), 0, tol);
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_GT(*prog.GetNumIterations(), 0);
   }
 
   // Add additional quadratic costs
@@ -106,6 +108,52 @@ GTEST_TEST(QPtest, TestInfeasible) {
   }
 }
 
+// Solves the same program repeatedly, after updating its linear cost, its
+// bounds and its quadratic cost in turn, and compares against the solution of a
+// program constructed from scratch.
+GTEST_TEST(QPtest, TestRepeatedSolves) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto quadratic_cost = prog.AddQuadraticCost(Eigen::Matrix2d::Identity(),
+                                              Eigen::Vector2d::Zero(), x)
+                            .evaluator();
+  auto linear_cost = prog.AddLinearCost(Eigen::Vector2d(-2, -4), x).evaluator();
+  auto constraint =
+      prog.AddLinearConstraint(Eigen::RowVector2d(1, 1), -1, 1, x).evaluator();
+
+  OsqpSolver solver;
+  if (solver.available()) {
+    // OSQP does not polish a solution with no active constraint, whose
+    // accuracy is then set by its default tolerances.
+    const double tol = 1E-4;
+    // While Q is the identity, the minimum of 0.5|x|² + aᵀx s.t.
+    // lb ≤ x₀ + x₁ ≤ ub is the projection of -a onto the constraint.
+    auto check_solution = [&](const Eigen::Vector2d& x_expected) {
+      EXPECT_EQ(solver.Solve(prog), SolutionResult::kSolutionFound);
+      EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_expected, tol));
+    };
+    check_solution(Eigen::Vector2d(-0.5, 1.5));
+
+    linear_cost->UpdateCoefficients(Eigen::Vector2d(2, -2));
+    check_solution(Eigen::Vector2d(-2, 2));
+
+    constraint->UpdateLowerBound(Vector1d(0.5));
+    constraint->UpdateUpperBound(Vector1d(3));
+    check_solution(Eigen::Vector2d(-1.75, 2.25));
+
+    quadratic_cost->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                                       Eigen::Vector2d::Zero());
+    check_solution(Eigen::Vector2d(-0.75, 1.25));
+
+    // An update with lb > ub, followed by a valid one. OSQP rejects bounds
+    // with l > u in its data validation, before solving.
+    constraint->UpdateLowerBound(Vector1d(4));
+    EXPECT_EQ(solver.Solve(prog), SolutionResult::kInvalidInput);
+    constraint->UpdateLowerBound(Vector1d(0.5));
+    check_solution(Eigen::Vector2d(-0.75, 1.25));
+  }
+}
+
 GTEST_TEST(LPtest, TestUnbounded) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<2>();
@@ -0,0 +1,102 @@
+#include "drake/solvers/parallel_evaluation.h"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using std::runtime_error;
+using std::unique_ptr;
+using std::vector;
+
+namespace drake {
+namespace solvers {
+namespace {
+
+GTEST_TEST(ParallelEvaluationTest, EvaluateInParallel) {
+  const int num_evaluations = 50;
+  // Every seventh evaluation is not thread-safe.
+  auto is_thread_safe = [](int i) { return i % 7 != 0; };
+  const std::thread::id calling_thread = std::this_thread::get_id();
+  drake::internal::ThreadPool pool3(3);
+  drake::internal::ThreadPool pool100(100);
+  for (drake::internal::ThreadPool* pool :
+       {static_cast<drake::internal::ThreadPool*>(nullptr), &pool3,
+        &pool100}) {
+    // The pools are reused across calls.
+    for (int repeat = 0; repeat < 3; ++repeat) {
+      vector<int> num_calls(num_evaluations, 0);
+      vector<std::thread::id> threads(num_evaluations);
+      internal::EvaluateInParallel(num_evaluations, pool, is_thread_safe,
+                                   [&](int i) {
+        ++num_calls[i];
+        threads[i] = std::this_thread::get_id();
+      });
+      EXPECT_EQ(num_calls, vector<int>(num_evaluations, 1));
+      for (int i = 0; i < num_evaluations; ++i) {
+        if (pool == nullptr || !is_thread_safe(i)) {
+          EXPECT_EQ(threads[i], calling_thread);
+        }
+      }
+    }
+  }
+
+  // Without a pool, the evaluations are made in order.
+  vector<int> order;
+  internal::EvaluateInParallel(10, nullptr, is_thread_safe,
+                               [&](int i) { order.push_back(i); });
+  EXPECT_EQ(order, vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+  // An exception thrown by an evaluation on any thread is rethrown, and the
+  // pool remains usable afterwards.
+  drake::internal::ThreadPool pool4(4);
+  for (const int throwing_evaluation : {0, 1, 49}) {
+    EXPECT_THROW(internal::EvaluateInParallel(
+                     num_evaluations, &pool4, is_thread_safe,
+                     [&](int i) {
+                       if (i == throwing_evaluation) {
+                         throw runtime_error("evaluation failed");
+                       }
+                     }),
+                 runtime_error);
+  }
+  int num_calls = 0;
+  internal::EvaluateInParallel(num_evaluations, &pool4,
+                               [](int) { return false; },
+                               [&](int) { ++num_calls; });
+  EXPECT_EQ(num_calls, num_evaluations);
+
+  EXPECT_THROW(drake::internal::ThreadPool(0), runtime_error);
+}
+
+GTEST_TEST(ParallelEvaluationTest, TakeMaxNumThreadsOption) {
+  // The option is removed from the map, and the other options are kept.
+  std::map<std::string, int> int_options{{"max_num_threads", 3},
+                                         {"Major iterations limit", 10}};
+  const unique_ptr<drake::internal::ThreadPool> pool =
+      internal::TakeMaxNumThreadsOption("TestSolver", &int_options);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->num_threads(), 3);
+  EXPECT_EQ(int_options,
+            (std::map<std::string, int>{{"Major iterations limit", 10}}));
+
+  // Without the option, or with a single thread, no pool is created.
+  EXPECT_EQ(internal::TakeMaxNumThreadsOption("TestSolver", &int_options),
+            nullptr);
+  int_options["max_num_threads"] = 1;
+  EXPECT_EQ(internal::TakeMaxNumThreadsOption("TestSolver", &int_options),
+            nullptr);
+  EXPECT_EQ(int_options.count("max_num_threads"), 0);
+
+  int_options["max_num_threads"] = 0;
+  EXPECT_THROW(internal::TakeMaxNumThreadsOption("TestSolver", &int_options),
+               runtime_error);
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/solvers/rotation_constraint.h"
 
 #include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +12,7 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/rotation_constraint_internal.h"
 
 using Eigen::Vector3d;
 using Eigen::Matrix3d;
@@ -223,6 +225,140 @@ GTEST_TEST(RotationConstraint, TestAddStaticSizeNumIntervalsPerHalfAxis) {
       "Incorrect type.");
 }
 
+// The McCormick envelope constraints only depend on the number of binary
+// variables per half axis. Adding them for a second rotation matrix should
+// give the same coefficients, bound to the variables of that matrix.
+GTEST_TEST(RotationConstraint, TestMcCormickEnvelopeSameCoefficients) {
+  MathematicalProgram prog;
+  const int num_builds =
+      internal::GetNumMcCormickVectorConstraintTemplateBuilds();
+  auto R1 = NewRotationMatrixVars(&prog);
+  AddRotationMatrixMcCormickEnvelopeMilpConstraints(&prog, R1, 2);
+  const int num_linear_constraints = prog.linear_constraints().size();
+  // The template for 2 binary variables per half axis is built at most once,
+  // in case no earlier test requested it.
+  const int num_builds_after_R1 =
+      internal::GetNumMcCormickVectorConstraintTemplateBuilds();
+  EXPECT_LE(num_builds_after_R1, num_builds + 1);
+  auto R2 = NewRotationMatrixVars(&prog);
+  AddRotationMatrixMcCormickEnvelopeMilpConstraints(&prog, R2, 2);
+  // The template is reused for R2.
+  EXPECT_EQ(internal::GetNumMcCormickVectorConstraintTemplateBuilds(),
+            num_builds_after_R1);
+  ASSERT_EQ(static_cast<int>(prog.linear_constraints().size()),
+            2 * num_linear_constraints);
+  for (int i = 0; i < num_linear_constraints; ++i) {
+    const auto& binding1 = prog.linear_constraints()[i];
+    const auto& binding2 =
+        prog.linear_constraints()[num_linear_constraints + i];
+    EXPECT_TRUE(CompareMatrices(binding1.evaluator()->A(),
+                                binding2.evaluator()->A()));
+    EXPECT_TRUE(CompareMatrices(binding1.evaluator()->lower_bound(),
+                                binding2.evaluator()->lower_bound()));
+    EXPECT_TRUE(CompareMatrices(binding1.evaluator()->upper_bound(),
+                                binding2.evaluator()->upper_bound()));
+    for (int j = 0; j < binding1.variables().rows(); ++j) {
+      EXPECT_FALSE(
+          binding1.variables()(j).equal_to(binding2.variables()(j)));
+    }
+  }
+}
+
+// Returns true if every binding in `bindings` is satisfied by the values
+// `x` of all the decision variables in `prog`.
+template <typename C>
+bool AreBindingsSatisfied(const MathematicalProgram& prog,
+                          const std::vector<Binding<C>>& bindings,
+                          const Eigen::Ref<const Eigen::VectorXd>& x) {
+  for (const auto& binding : bindings) {
+    Eigen::VectorXd binding_x(binding.GetNumElements());
+    for (int i = 0; i < binding_x.rows(); ++i) {
+      binding_x(i) = x(prog.FindDecisionVariableIndex(binding.variables()(i)));
+    }
+    if (!binding.evaluator()->CheckSatisfied(binding_x)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks the McCormick envelope constraints without solving the MILP. For a
+// rotation matrix R with no entry on an interval boundary, the binary
+// variables are fully determined by R, namely BRpos[k](i, j) = 1 iff
+// R(i, j) >= k / N and BRneg[k](i, j) = 1 iff R(i, j) <= -k / N. Every
+// constraint, including those reusing the cached coefficients for a second
+// rotation matrix, must then be satisfied. Flipping a binary variable must
+// violate some constraint.
+GTEST_TEST(RotationConstraint, TestMcCormickEnvelopeSatisfiedByRotation) {
+  std::vector<Matrix3d> R_samples;
+  R_samples.push_back(math::ZRotation(0.3) * math::YRotation(0.5) *
+                      math::ZRotation(0.7));
+  R_samples.push_back(math::ZRotation(-2.1) * math::YRotation(2.0) *
+                      math::ZRotation(1.2));
+  Matrix3d R_sample;
+  R_sample << 0.17082017792981191, 0.65144498431260445, -0.73921573253413542,
+      -0.82327804434149443, -0.31781600529013027, -0.47032568342231595,
+      -0.54132589862048197, 0.68892119955432829, 0.48203096610835455;
+  R_samples.push_back(R_sample);
+
+  for (int N = 1; N <= 3; ++N) {
+    MathematicalProgram prog;
+    const auto R1 = NewRotationMatrixVars(&prog);
+    const auto R2 = NewRotationMatrixVars(&prog);
+    const auto vars1 = AddRotationMatrixMcCormickEnvelopeMilpConstraints(
+        &prog, R1, N);
+    const auto vars2 = AddRotationMatrixMcCormickEnvelopeMilpConstraints(
+        &prog, R2, N);
+    EXPECT_TRUE(prog.generic_constraints().empty());
+    EXPECT_TRUE(prog.lorentz_cone_constraints().empty());
+    EXPECT_TRUE(prog.rotated_lorentz_cone_constraints().empty());
+
+    Eigen::VectorXd x(prog.num_vars());
+    auto set_values = [&prog, &x, N](
+        const MatrixDecisionVariable<3, 3>& R,
+        const AddRotationMatrixMcCormickEnvelopeReturnType& vars,
+        const Matrix3d& R_value) {
+      const std::vector<MatrixDecisionVariable<3, 3>>& BRpos =
+          std::get<2>(vars);
+      const std::vector<MatrixDecisionVariable<3, 3>>& BRneg =
+          std::get<3>(vars);
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          x(prog.FindDecisionVariableIndex(R(i, j))) = R_value(i, j);
+          for (int k = 0; k < N; ++k) {
+            const double phi = static_cast<double>(k) / N;
+            x(prog.FindDecisionVariableIndex(BRpos[k](i, j))) =
+                R_value(i, j) >= phi ? 1 : 0;
+            x(prog.FindDecisionVariableIndex(BRneg[k](i, j))) =
+                R_value(i, j) <= -phi ? 1 : 0;
+          }
+        }
+      }
+    };
+    auto all_satisfied = [&prog, &x]() {
+      return AreBindingsSatisfied(prog, prog.linear_constraints(), x) &&
+             AreBindingsSatisfied(prog, prog.linear_equality_constraints(),
+                                  x) &&
+             AreBindingsSatisfied(prog, prog.bounding_box_constraints(), x);
+    };
+
+    for (int sample = 0; sample < static_cast<int>(R_samples.size());
+         ++sample) {
+      const Matrix3d& R1_value = R_samples[sample];
+      const Matrix3d& R2_value = R_samples[(sample + 1) % R_samples.size()];
+      set_values(R1, vars1, R1_value);
+      set_values(R2, vars2, R2_value);
+      EXPECT_TRUE(all_satisfied()) << "N = " << N << ", sample " << sample;
+
+      // Putting R2(0, 0) on the wrong side of zero violates the constraints.
+      const int index =
+          prog.FindDecisionVariableIndex(std::get<2>(vars2)[0](0, 0));
+      x(index) = 1 - x(index);
+      EXPECT_FALSE(all_satisfied()) << "N = " << N << ", sample " << sample;
+    }
+  }
+}
+
 class TestMcCormick : public ::testing::TestWithParam<std::tuple<bool, int>> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TestMcCormick)
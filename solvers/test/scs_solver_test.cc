@@ -56,6 +56,8 @@ GTEST_TEST(LinearProgramTest, Test0) {
     const Eigen::Vector2d x_expected(5, -3);
     EXPECT_TRUE(CompareMatrices(prog.GetSolution(x), x_expected, tol,
                                 MatrixCompareType::absolute));
+    ASSERT_TRUE(prog.GetNumIterations());
+    EXPECT_GT(*prog.GetNumIterations(), 0);
   }
 
   // Now change the cost to 3x(0) - x(1) + 5, and add the constraint 2 <= x(0)
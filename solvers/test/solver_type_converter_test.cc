@@ -38,6 +38,8 @@ optional<SolverType> successor(optional<SolverType> solver_type) {
     case SolverType::kSnopt:
       return SolverType::kUnrevisedLemke;
     case SolverType::kUnrevisedLemke:
+      return SolverType::kActiveSetQP;
+    case SolverType::kActiveSetQP:
       return nullopt;
   }
   DRAKE_ABORT();
@@ -62,7 +64,7 @@ GTEST_TEST(SolverId, RoundTrip) {
   }
 
   // This should track the number of SolverType values, if we add any.
-  EXPECT_EQ(iterations, 12);
+  EXPECT_EQ(iterations, 13);
 }
 
 }  // namespace
@@ -0,0 +1,79 @@
+#include "drake/solvers/sparse_and_dense_matrix.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+Eigen::MatrixXd MakeDense() {
+  Eigen::MatrixXd dense(2, 3);
+  // clang-format off
+  dense << 1, 0, 2,
+           0, 0, 3;
+  // clang-format on
+  return dense;
+}
+
+GTEST_TEST(SparseAndDenseMatrixTest, FromSparse) {
+  const Eigen::MatrixXd dense = MakeDense();
+  const Eigen::SparseMatrix<double> sparse = dense.sparseView();
+  SparseAndDenseMatrix matrix(sparse);
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 3);
+  EXPECT_TRUE(matrix.is_sparse_computed());
+  EXPECT_FALSE(matrix.is_dense_computed());
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 3);
+  EXPECT_FALSE(matrix.is_dense_computed());
+
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), dense));
+  EXPECT_TRUE(matrix.is_dense_computed());
+  // The dense form is computed once.
+  EXPECT_EQ(&matrix.GetAsDense(), &matrix.GetAsDense());
+}
+
+GTEST_TEST(SparseAndDenseMatrixTest, FromDense) {
+  const Eigen::MatrixXd dense = MakeDense();
+  SparseAndDenseMatrix matrix(dense);
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 3);
+  EXPECT_TRUE(matrix.is_dense_computed());
+  EXPECT_FALSE(matrix.is_sparse_computed());
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), dense));
+  EXPECT_FALSE(matrix.is_sparse_computed());
+
+  // The entries equal to zero are not stored in the sparse form.
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 3);
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsSparse().toDense(), dense));
+  EXPECT_TRUE(matrix.is_sparse_computed());
+}
+
+GTEST_TEST(SparseAndDenseMatrixTest, Assignment) {
+  const Eigen::MatrixXd dense = MakeDense();
+  SparseAndDenseMatrix matrix(dense);
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 3);
+
+  // Assigning a dense matrix discards the sparse form of the previous one.
+  const Eigen::MatrixXd identity = Eigen::MatrixXd::Identity(4, 4);
+  matrix = identity;
+  EXPECT_EQ(matrix.rows(), 4);
+  EXPECT_EQ(matrix.cols(), 4);
+  EXPECT_FALSE(matrix.is_sparse_computed());
+  EXPECT_EQ(matrix.GetAsSparse().nonZeros(), 4);
+
+  // Assigning a sparse matrix discards the dense form of the previous one.
+  const Eigen::SparseMatrix<double> sparse = dense.sparseView();
+  matrix = sparse;
+  EXPECT_EQ(matrix.rows(), 2);
+  EXPECT_EQ(matrix.cols(), 3);
+  EXPECT_FALSE(matrix.is_dense_computed());
+  EXPECT_TRUE(CompareMatrices(matrix.GetAsDense(), dense));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
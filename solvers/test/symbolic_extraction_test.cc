@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <limits>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -198,6 +199,132 @@ GTEST_TEST(SymbolicExtraction, DecomposeLinearExpression) {
   }
 }
 
+GTEST_TEST(SymbolicExtraction, IsAffineOrQuadraticExpression) {
+  const Variable x("x");
+  const Variable y("y");
+  for (const Expression& e : {Expression(2), Expression(x), 2 * x + 3 * y + 1,
+                              x / 4 - 3 * (x + y), (x + 1) * (x - 1) - x * x}) {
+    EXPECT_TRUE(IsAffineExpression(e));
+    EXPECT_TRUE(IsQuadraticExpression(e));
+  }
+  for (const Expression& e : {x * y, 2 * x * x + y, (x + y) * (x - 1),
+                              pow(x + 1, 2)}) {
+    EXPECT_FALSE(IsAffineExpression(e));
+    EXPECT_TRUE(IsQuadraticExpression(e));
+  }
+  for (const Expression& e : {x * x * y, pow(x, 3), sin(x), x / y}) {
+    EXPECT_FALSE(IsAffineExpression(e));
+    EXPECT_FALSE(IsQuadraticExpression(e));
+  }
+}
+
+GTEST_TEST(SymbolicExtraction, DecomposeSparseLinearExpressions) {
+  const Variable x("x");
+  const Variable y("y");
+  const Variable z("z");
+
+  // The entries are decomposed in column-major order, and the variables are
+  // ordered by first appearance.
+  MatrixX<Expression> M(2, 2);
+  M << 2 * z + 1, x / 2 - 3 * (y - z),
+       -y + 4 * y, (x + 1) * (x - 1) - x * x + 2 * z;
+  Eigen::SparseMatrix<double> A;
+  VectorXd b;
+  VectorXDecisionVariable vars;
+  DecomposeSparseLinearExpressions(M, &A, &b, &vars);
+  EXPECT_EQ(VectorDecisionVariable<3>(z, y, x), vars);
+  MatrixXd A_expected(4, 3);
+  A_expected <<
+      2, 0, 0,
+      0, 3, 0,
+      3, -3, 0.5,
+      2, 0, 0;
+  EXPECT_TRUE(CompareMatrices(A_expected, MatrixXd(A), kTol));
+  EXPECT_TRUE(CompareMatrices(Eigen::Vector4d(1, 0, 0, -1), b, kTol));
+
+  // Coefficients that cancel out are not stored, but their variables are
+  // kept. The result agrees with DecomposeLinearExpression().
+  const Vector3<Expression> v(x + y - y, 3 * x + 2 * z, Expression(5));
+  DecomposeSparseLinearExpressions(v, &A, &b, &vars);
+  MatrixXd A_dense;
+  VectorXd b_dense;
+  VectorXDecisionVariable vars_dense;
+  DecomposeLinearExpression(v, &A_dense, &b_dense, &vars_dense);
+  EXPECT_EQ(vars_dense, vars);
+  EXPECT_TRUE(CompareMatrices(A_dense, MatrixXd(A), kTol));
+  EXPECT_TRUE(CompareMatrices(b_dense, b, kTol));
+
+  // Variables whose IDs are far apart are mapped through a hash map instead
+  // of a flat table.
+  std::vector<Variable> unused_variables;
+  for (int i = 0; i < 5000; ++i) {
+    unused_variables.emplace_back("unused");
+  }
+  const Variable w("w");
+  DecomposeSparseLinearExpressions(Vector2<Expression>(w - x, 2 * x), &A, &b,
+                                   &vars);
+  EXPECT_EQ(VectorDecisionVariable<2>(x, w), vars);
+  Eigen::Matrix2d A2_expected;
+  A2_expected <<
+      -1, 1,
+      2, 0;
+  EXPECT_TRUE(CompareMatrices(A2_expected, MatrixXd(A), kTol));
+
+  // An empty input and non-affine entries.
+  DecomposeSparseLinearExpressions(VectorXe(0), &A, &b, &vars);
+  EXPECT_EQ(A.rows(), 0);
+  EXPECT_EQ(vars.size(), 0);
+  EXPECT_THROW(DecomposeSparseLinearExpressions(Vector2<Expression>(x, x * y),
+                                                &A, &b, &vars),
+               std::runtime_error);
+  EXPECT_THROW(DecomposeSparseLinearExpressions(Vector1<Expression>(sin(x)),
+                                                &A, &b, &vars),
+               std::runtime_error);
+}
+
+GTEST_TEST(SymbolicExtraction, DecomposeSparseQuadraticExpression) {
+  const Variable x("x");
+  const Variable y("y");
+  const Variable z("z");
+  const VectorDecisionVariable<3> vars_expected(x, y, z);
+  Matrix3d Q_in;
+  Q_in <<
+      3, 2, 1,
+      4, 6, 5,
+      7, 8, 9;
+  const Vector3d b_expected(10, 11, 12);
+  const double c_expected = 13;
+  const Expression e =
+      vars_expected.dot(0.5 * Q_in * vars_expected + b_expected) + c_expected;
+
+  Eigen::SparseMatrix<double> Q;
+  VectorXd b;
+  double c;
+  VectorXDecisionVariable vars;
+  DecomposeSparseQuadraticExpression(e, &Q, &b, &c, &vars);
+  EXPECT_EQ(vars_expected, vars);
+  Matrix3d Q_expected;
+  AverageOffDiagonalTerms(Q_in, &Q_expected);
+  EXPECT_TRUE(CompareMatrices(Q_expected, MatrixXd(Q), 1E-14));
+  EXPECT_TRUE(CompareMatrices(b_expected, b, 1E-14));
+  EXPECT_NEAR(c_expected, c, 1E-14);
+
+  // Squares of sums are expanded.
+  DecomposeSparseQuadraticExpression(pow(x - 2 * z, 2) + y, &Q, &b, &c, &vars);
+  EXPECT_EQ(vars_expected, vars);
+  Q_expected <<
+      2, 0, -4,
+      0, 0, 0,
+      -4, 0, 8;
+  EXPECT_TRUE(CompareMatrices(Q_expected, MatrixXd(Q), kTol));
+  EXPECT_TRUE(CompareMatrices(Vector3d(0, 1, 0), b, kTol));
+  EXPECT_EQ(c, 0);
+
+  EXPECT_THROW(DecomposeSparseQuadraticExpression(x * y * z, &Q, &b, &c,
+                                                  &vars),
+               std::runtime_error);
+}
+
 }  // anonymous namespace
 }  // namespace internal
 }  // namespace solvers
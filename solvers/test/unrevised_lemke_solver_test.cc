@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/mathematical_program.h"
 
 namespace drake {
 namespace solvers {
@@ -87,6 +88,24 @@ GTEST_TEST(TestUnrevisedLemke, TestSimple) {
   RunLCP(M, q, expected_z);
 }
 
+// Checks that solving through MathematicalProgram reports the solution and
+// the number of pivots.
+GTEST_TEST(TestUnrevisedLemke, TestMathematicalProgram) {
+  const Eigen::Matrix2d M = Eigen::Vector2d(1, 2).asDiagonal();
+  const Eigen::Vector2d q(-1, -1);
+  MathematicalProgram prog;
+  const auto z = prog.NewContinuousVariables<2>();
+  prog.AddLinearComplementarityConstraint(M, q, z);
+
+  UnrevisedLemkeSolver<double> l;
+  EXPECT_EQ(l.Solve(prog), SolutionResult::kSolutionFound);
+  EXPECT_EQ(prog.GetSolverId(), UnrevisedLemkeSolverId::id());
+  EXPECT_TRUE(CompareMatrices(prog.GetSolution(z), Eigen::Vector2d(1, 0.5),
+                              epsilon, MatrixCompareType::absolute));
+  ASSERT_TRUE(prog.GetNumIterations());
+  EXPECT_GT(*prog.GetNumIterations(), 0);
+}
+
 GTEST_TEST(TestUnrevisedLemke, TestProblem1) {
   // Problem from example 10.2.1 in "Handbook of Test Problems in
   // Local and Global Optimization".
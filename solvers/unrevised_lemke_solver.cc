@@ -166,8 +166,9 @@ SolutionResult UnrevisedLemkeSolver<T>::Solve(MathematicalProgram& prog) const {
   // We don't actually indicate different results.
   SolverResult solver_result(UnrevisedLemkeSolverId::id());
 
-  // Create a dummy variable for the number of pivots used.
+  // The number of pivots of one LCP, and their sum over all the LCPs.
   int num_pivots = 0;
+  int total_num_pivots = 0;
 
   Eigen::VectorXd x_sol(prog.num_vars());
   for (const auto& binding : bindings) {
@@ -176,6 +177,8 @@ SolutionResult UnrevisedLemkeSolver<T>::Solve(MathematicalProgram& prog) const {
         binding.evaluator();
     bool solved = SolveLcpLemke(
         constraint->M(), constraint->q(), &constraint_solution, &num_pivots);
+    total_num_pivots += num_pivots;
+    solver_result.set_num_iterations(total_num_pivots);
     if (!solved) {
       prog.SetSolverResult(solver_result);
       return SolutionResult::kUnknownError;
@@ -187,6 +190,8 @@ SolutionResult UnrevisedLemkeSolver<T>::Solve(MathematicalProgram& prog) const {
     }
     solver_result.set_optimal_cost(0.0);
   }
+  solver_result.set_decision_variable_values(x_sol);
+  prog.SetSolverResult(solver_result);
   return SolutionResult::kSolutionFound;
 }
 
@@ -4,7 +4,6 @@
 #include <utility>
 
 #include "drake/common/eigen_types.h"
-#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -62,21 +61,26 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
     throw std::runtime_error("R must be positive definite");
   }
 
-  this->DeclarePeriodicDiscreteUpdate(time_period_);
+  this->DeclarePeriodicUnrestrictedUpdate(time_period_, 0.);
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    SetupQp();
   }
+
+  // Each Context holds its own clone of the QP, and the control it was last
+  // solved for, which is zero until the first update.
+  qp_state_index_ = this->DeclareAbstractState(AbstractValue::Make(ContextQp{
+      copyable_unique_ptr<solvers::MathematicalProgram>(
+          prog_ != nullptr ? prog_->Clone() : nullptr),
+      Eigen::VectorXd::Zero(num_inputs_)}));
 }
 
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
-  const Eigen::VectorBlock<const VectorX<T>> current_state =
-      this->EvalEigenVectorInput(context, state_input_index_);
-
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+  const Eigen::VectorXd& current_input =
+      context.template get_abstract_state<ContextQp>(qp_state_index_).control;
 
   const VectorX<T> input_ref = model_->EvalEigenVectorInput(*base_context_, 0);
 
@@ -86,29 +90,51 @@ void LinearModelPredictiveController<T>::CalcControl(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
+void LinearModelPredictiveController<T>::DoCalcUnrestrictedUpdate(
+    const Context<T>& context,
+    const std::vector<const UnrestrictedUpdateEvent<T>*>&,
+    State<T>* state) const {
+  ContextQp& qp = state->template get_mutable_abstract_state<ContextQp>(
+      qp_state_index_);
+  DRAKE_DEMAND(!qp.prog.empty());
+  solvers::MathematicalProgram& prog = *qp.prog.get_mutable();
+
+  const VectorX<T> state_error =
+      this->EvalEigenVectorInput(context, state_input_index_) -
+      base_context_->get_discrete_state().get_vector().CopyToVector();
+
+  // Only the parameters of the QP change between updates. The solution is
+  // kept as the initial guess of the next update, since the solver data of
+  // the program are not copied with the state.
+  prog.SetParameterValues(initial_state_error_, state_error);
+  const solvers::SolutionResult result =
+      solver_ != nullptr ? solver_->Solve(prog) : prog.Solve();
+  DRAKE_DEMAND(result == solvers::SolutionResult::kSolutionFound);
+  prog.SetInitialGuessForAllVariables(
+      prog.GetSolution(prog.decision_variables()));
+  qp.control = prog.GetSolution(prog_->input(0));
+}
+
+template <typename T>
+void LinearModelPredictiveController<T>::SetupQp() {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
   const int kNumSampleTimes =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
 
-  DirectTranscription prog(linear_model_.get(), *base_context_,
-                           kNumSampleTimes);
-
-  const auto state_error = prog.state();
-  const auto input_error = prog.input();
-
-  prog.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                      input_error.transpose() * R_ * input_error);
+  prog_ = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, kNumSampleTimes);
 
-  const VectorX<T> state_ref =
-      base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(prog.initial_state() == current_state - state_ref);
+  const auto state_error = prog_->state();
+  const auto input_error = prog_->input();
 
-  DRAKE_DEMAND(prog.Solve() == solvers::SolutionResult::kSolutionFound);
+  prog_->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                        input_error.transpose() * R_ * input_error);
 
-  return prog.GetInputSamples().col(0);
+  initial_state_error_ = prog_->NewParameters(num_states_, "x0");
+  prog_->AddLinearConstraint(
+      prog_->initial_state().cast<symbolic::Expression>() ==
+      initial_state_error_.cast<symbolic::Expression>());
 }
 
 template class LinearModelPredictiveController<double>;
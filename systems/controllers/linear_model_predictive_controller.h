@@ -1,10 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/symbolic.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/solvers/mathematical_program_solver_interface.h"
 #include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/trajectory_optimization/direct_transcription.h"
 
 namespace drake {
 namespace systems {
@@ -23,9 +28,12 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.  The QP is built once, with the
+/// initial state x(k) as a parameter of the program.  Each Context holds its
+/// own copy of the QP in its abstract state.  The periodic update of each time
+/// step only sets the parameter, solves that copy again from the solution of
+/// the previous time step as its initial guess, and stores the control, which
+/// the control output holds until the next update.
 ///
 /// Instantiated templates for the following kinds of T's are provided:
 /// - double
@@ -76,12 +84,31 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   }
 
  private:
+  friend class LinearModelPredictiveControllerTester;
+
+  // The abstract state of a Context: its clone of prog_, and the control
+  // input of its last update.
+  struct ContextQp {
+    copyable_unique_ptr<solvers::MathematicalProgram> prog;
+    Eigen::VectorXd control;
+  };
+
   void CalcControl(const Context<T>& context, BasicVector<T>* control) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // Solves the QP of `context` for its current state input.
+  void DoCalcUnrestrictedUpdate(
+      const Context<T>& context,
+      const std::vector<const UnrestrictedUpdateEvent<T>*>& events,
+      State<T>* state) const override;
+
+  // The control output is held between updates.
+  optional<bool> DoHasDirectFeedthrough(int, int) const override {
+    return false;
+  }
+
+  // Sets up the DirectTranscription problem, with the initial state error as
+  // a parameter.
+  void SetupQp();
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -101,6 +128,16 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Descrption of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The QP, which is cloned into the abstract state of each Context, where its
+  // parameters are updated and it is solved again at each time step.
+  std::unique_ptr<trajectory_optimization::DirectTranscription> prog_;
+  // The parameters of prog_ for the initial state error.
+  VectorX<symbolic::Variable> initial_state_error_;
+  int qp_state_index_{-1};
+  // The solver of the QP, or nullptr to let MathematicalProgram::Solve()
+  // choose it.
+  std::unique_ptr<solvers::MathematicalProgramSolverInterface> solver_;
 };
 
 }  // namespace controllers
@@ -1,9 +1,13 @@
 #include "drake/systems/controllers/linear_model_predictive_controller.h"
 
+#include <memory>
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/discrete_algebraic_riccati_equation.h"
+#include "drake/solvers/osqp_solver.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -12,10 +16,44 @@
 namespace drake {
 namespace systems {
 namespace controllers {
+
+class LinearModelPredictiveControllerTester {
+ public:
+  // Returns the QP that `controller` solves at each time step for `context`.
+  static const solvers::MathematicalProgram& context_prog(
+      const LinearModelPredictiveController<double>& controller,
+      const Context<double>& context) {
+    using ContextQp = LinearModelPredictiveController<double>::ContextQp;
+    return *context.get_abstract_state<ContextQp>(controller.qp_state_index_)
+                .prog;
+  }
+
+  // Returns the decision variables of the first control input of the QP.
+  static solvers::VectorXDecisionVariable input(
+      const LinearModelPredictiveController<double>& controller) {
+    return controller.prog_->input(0);
+  }
+
+  // Makes `controller` solve its QP with `solver`.
+  static void set_solver(
+      LinearModelPredictiveController<double>* controller,
+      std::unique_ptr<solvers::MathematicalProgramSolverInterface> solver) {
+    controller->solver_ = std::move(solver);
+  }
+};
+
 namespace {
 
 using math::DiscreteAlgebraicRiccatiEquation;
 
+// Applies the periodic update of `controller` to `context`.
+void Update(const LinearModelPredictiveController<double>& controller,
+            Context<double>* context) {
+  std::unique_ptr<State<double>> state = context->CloneState();
+  controller.CalcUnrestrictedUpdate(*context, state.get());
+  context->get_mutable_state().CopyFrom(*state);
+}
+
 class TestMpcWithDoubleIntegrator : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -75,12 +113,84 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
   context->FixInputPort(0, BasicVector<double>::Make(x0(0), x0(1)));
   std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput(*context);
 
+  Update(*dut_, context.get());
   dut_->CalcOutput(*context, output.get());
 
   EXPECT_TRUE(CompareMatrices(K * x0, output->get_vector_data(0)->get_value(),
                               kTolerance));
 }
 
+// The QP is built once, and only updated as the state changes.
+TEST_F(TestMpcWithDoubleIntegrator, TestRepeatedSolves) {
+  const double kTolerance = 1e-5;
+
+  const Eigen::Matrix2d A = system_->A();
+  const Eigen::Matrix<double, 2, 1> B = system_->B();
+  const Eigen::Matrix2d S = DiscreteAlgebraicRiccatiEquation(A, B, Q_, R_);
+  const Eigen::Matrix<double, 1, 2> K =
+      -(R_ + B.transpose() * S * B).inverse() * (B.transpose() * S * A);
+
+  auto context = dut_->CreateDefaultContext();
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput(*context);
+
+  for (const Eigen::Vector2d& x0 :
+       {Eigen::Vector2d(1, 1), Eigen::Vector2d(-2, 0.5),
+        Eigen::Vector2d(0, 3)}) {
+    context->FixInputPort(0, BasicVector<double>::Make(x0(0), x0(1)));
+    Update(*dut_, context.get());
+    dut_->CalcOutput(*context, output.get());
+    EXPECT_TRUE(CompareMatrices(
+        K * x0, output->get_vector_data(0)->get_value(), kTolerance));
+  }
+}
+
+// Each Context holds its own QP, which its updates solve again for the current
+// state, from the solution of its previous update. The control output is held
+// between updates.
+TEST_F(TestMpcWithDoubleIntegrator, TestContextQp) {
+  // Every Context, including a clone, owns a distinct QP.
+  auto context = dut_->CreateDefaultContext();
+  auto clone = context->Clone();
+  EXPECT_NE(
+      &LinearModelPredictiveControllerTester::context_prog(*dut_, *context),
+      &LinearModelPredictiveControllerTester::context_prog(*dut_, *clone));
+
+  LinearModelPredictiveControllerTester::set_solver(
+      dut_.get(), std::make_unique<solvers::OsqpSolver>());
+  std::unique_ptr<SystemOutput<double>> output = dut_->AllocateOutput(*context);
+  context->FixInputPort(0, BasicVector<double>::Make(1, 1));
+
+  // The control is zero until the first update.
+  dut_->CalcOutput(*context, output.get());
+  EXPECT_TRUE(CompareMatrices(output->get_vector_data(0)->get_value(),
+                              Vector1d::Zero()));
+
+  Update(*dut_, context.get());
+  dut_->CalcOutput(*context, output.get());
+  const Eigen::VectorXd control = output->get_vector_data(0)->get_value();
+  const solvers::MathematicalProgram& prog =
+      LinearModelPredictiveControllerTester::context_prog(*dut_, *context);
+  EXPECT_EQ(prog.GetSolverId(), solvers::OsqpSolver::id());
+  EXPECT_TRUE(CompareMatrices(
+      prog.GetInitialGuess(
+          LinearModelPredictiveControllerTester::input(*dut_)),
+      control));
+
+  // A new state input changes the control only at the next update, and only
+  // in the updated Context.
+  context->FixInputPort(0, BasicVector<double>::Make(-2, 0.5));
+  dut_->CalcOutput(*context, output.get());
+  EXPECT_TRUE(
+      CompareMatrices(output->get_vector_data(0)->get_value(), control));
+  Update(*dut_, context.get());
+  dut_->CalcOutput(*context, output.get());
+  EXPECT_FALSE(
+      CompareMatrices(output->get_vector_data(0)->get_value(), control));
+  dut_->CalcOutput(*clone, output.get());
+  EXPECT_TRUE(CompareMatrices(output->get_vector_data(0)->get_value(),
+                              Vector1d::Zero()));
+}
+
 namespace {
 
 // A discrete-time cubic polynomial system.
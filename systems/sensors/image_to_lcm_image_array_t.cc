@@ -1,5 +1,7 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,6 +10,7 @@
 #include "robotlocomotion/image_array_t.hpp"
 #include "robotlocomotion/image_t.hpp"
 
+#include "drake/common/drake_throw.h"
 #include "drake/systems/sensors/image.h"
 
 using std::string;
@@ -21,25 +24,28 @@ namespace {
 
 const int64_t kSecToMillisec = 1000000;
 
+// The color, depth and label images.
+const int kMaxNumImages = 3;
+
 template <PixelType kPixelType>
-void Compress(const Image<kPixelType>& image, image_t* msg) {
+void Compress(const Image<kPixelType>& image, int compression_level,
+              image_t* msg) {
   msg->compression_method = image_t::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
-  size_t buf_size = source_size * 1.001 + 12;
-  std::unique_ptr<uint8_t[]> buf(new uint8_t[buf_size]);
+  // The image is compressed straight into the message, which is sized with
+  // the upper bound on the compressed size and trimmed afterwards.
+  uLongf buf_size = compressBound(source_size);
+  msg->data.resize(buf_size);
 
   auto compress_status = compress2(
-      buf.get(), &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
-      source_size, Z_BEST_SPEED);
+      &msg->data[0], &buf_size, reinterpret_cast<const Bytef*>(image.at(0, 0)),
+      source_size, compression_level);
 
   DRAKE_DEMAND(compress_status == Z_OK);
 
   msg->data.resize(buf_size);
   msg->size = buf_size;
-  memcpy(&msg->data[0], buf.get(), buf_size);
 }
 
 template <PixelType kPixelType>
@@ -52,11 +58,12 @@ void Pack(const Image<kPixelType>& image, image_t* msg) {
   memcpy(&msg->data[0], image.at(0, 0), size);
 }
 
+// Compression is disabled when `compression_level` is zero.
 template <PixelType kPixelType>
 void PackImageToLcmImageT(const Image<kPixelType>& image, int64_t utime,
                           uint8_t pixel_format, uint8_t channel_type,
                           const string& frame_name, image_t* msg,
-                          bool do_compress) {
+                          int compression_level) {
   // TODO(kunimatsu-tri) Fix seq here that is always set to zero.
   msg->header.seq = 0;
   msg->header.utime = utime;
@@ -68,8 +75,8 @@ void PackImageToLcmImageT(const Image<kPixelType>& image, int64_t utime,
   msg->pixel_format = pixel_format;
   msg->channel_type = channel_type;
 
-  if (do_compress) {
-    Compress(image, msg);
+  if (compression_level > 0) {
+    Compress(image, compression_level, msg);
   } else {
     Pack(image, msg);
   }
@@ -114,6 +121,22 @@ ImageToLcmImageArrayT::label_image_input_port() const {
   return this->get_input_port(label_image_input_port_index_);
 }
 
+void ImageToLcmImageArrayT::set_compression_level(int level) {
+  DRAKE_THROW_UNLESS(Z_BEST_SPEED <= level && level <= Z_BEST_COMPRESSION);
+  compression_level_ = level;
+}
+
+void ImageToLcmImageArrayT::set_max_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  if (num_threads == max_num_threads_) return;
+  max_num_threads_ = num_threads;
+  thread_pool_.reset();
+  if (num_threads > 1) {
+    thread_pool_ = std::make_unique<drake::internal::ThreadPool>(
+        std::min(num_threads, kMaxNumImages));
+  }
+}
+
 const OutputPort<double>&
 ImageToLcmImageArrayT::image_array_t_msg_output_port() const {
   return System<double>::get_output_port(image_array_t_msg_output_port_index_);
@@ -135,46 +158,65 @@ void ImageToLcmImageArrayT::CalcImageArray(
   const AbstractValue* label_image_value =
       this->EvalAbstractInput(context, label_image_input_port_index_);
 
+  const int compression_level = do_compress_ ? compression_level_ : 0;
+
+  // Packing, and in particular compressing, each image is independent of the
+  // others. The packing tasks are collected here and then distributed among
+  // the available threads.
+  std::vector<std::function<void(image_t*)>> pack_tasks;
+
   if (color_image_value) {
     const ImageRgba8U& color_image =
         color_image_value->GetValue<ImageRgba8U>();
-
-    image_t color_image_msg;
-    PackImageToLcmImageT(color_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_RGBA,
-                         image_t::CHANNEL_TYPE_UINT8, color_frame_name_,
-                         &color_image_msg,
-                         do_compress_);
-    msg->images.push_back(color_image_msg);
-    msg->num_images++;
+    pack_tasks.push_back([&](image_t* color_image_msg) {
+      PackImageToLcmImageT(color_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_RGBA,
+                           image_t::CHANNEL_TYPE_UINT8, color_frame_name_,
+                           color_image_msg, compression_level);
+    });
   }
 
   if (depth_image_value) {
     const ImageDepth32F& depth_image =
         depth_image_value->GetValue<ImageDepth32F>();
-    image_t depth_image_msg;
-    PackImageToLcmImageT(depth_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_DEPTH,
-                         image_t::CHANNEL_TYPE_FLOAT32, depth_frame_name_,
-                         &depth_image_msg,
-                         do_compress_);
-    msg->images.push_back(depth_image_msg);
-    msg->num_images++;
+    pack_tasks.push_back([&](image_t* depth_image_msg) {
+      PackImageToLcmImageT(depth_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_DEPTH,
+                           image_t::CHANNEL_TYPE_FLOAT32, depth_frame_name_,
+                           depth_image_msg, compression_level);
+    });
   }
 
   if (label_image_value) {
     const ImageLabel16I& label_image =
         label_image_value->GetValue<ImageLabel16I>();
+    pack_tasks.push_back([&](image_t* label_image_msg) {
+      PackImageToLcmImageT(label_image, msg->header.utime,
+                           image_t::PIXEL_FORMAT_LABEL,
+                           image_t::CHANNEL_TYPE_INT16, label_frame_name_,
+                           label_image_msg, compression_level);
+    });
+  }
 
-    image_t label_image_msg;
-    PackImageToLcmImageT(label_image, msg->header.utime,
-                         image_t::PIXEL_FORMAT_LABEL,
-                         image_t::CHANNEL_TYPE_INT16, label_frame_name_,
-                         &label_image_msg,
-                         do_compress_);
-    msg->images.push_back(label_image_msg);
-    msg->num_images++;
+  msg->images.resize(pack_tasks.size());
+  const int num_tasks = static_cast<int>(pack_tasks.size());
+  const int num_threads =
+      thread_pool_ == nullptr
+          ? 1
+          : std::min(thread_pool_->num_threads(), num_tasks);
+  // Tasks are assigned to threads in a round-robin fashion. The calling
+  // thread takes the first share.
+  auto run_tasks = [&](int first_task) {
+    for (int i = first_task; i < num_tasks; i += num_threads) {
+      pack_tasks[i](&msg->images[i]);
+    }
+  };
+  if (num_threads <= 1) {
+    run_tasks(0);
+  } else {
+    thread_pool_->Run(num_threads, run_tasks);
   }
+  msg->num_images = num_tasks;
 }
 
 }  // namespace sensors
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "robotlocomotion/image_array_t.hpp"
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -38,6 +40,30 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
                         const std::string& label_frame_name,
                         bool do_compress = false);
 
+  /// Sets the zlib compression level used when compression is enabled, from
+  /// 1 (fastest) to 9 (smallest output). The default is 1. Has no effect if
+  /// compression is disabled, in which case the images are sent raw.
+  /// Faster codecs such as LZ4 are not offered, since
+  /// robotlocomotion::image_t has no compression method for them that
+  /// subscribers could decode.
+  /// @throws std::exception if `level` is not within [1, 9].
+  void set_compression_level(int level);
+
+  /// Returns the zlib compression level, see set_compression_level().
+  int get_compression_level() const { return compression_level_; }
+
+  /// Sets the maximum number of threads used to pack the color, depth and
+  /// label images into the output message. Images are packed concurrently,
+  /// each by a single thread, and therefore at most three threads are used.
+  /// These threads are created once, by this method, and reused by every
+  /// computation of the output. The output does not depend on this setting.
+  /// The default is one.
+  /// @throws std::exception if `num_threads` is less than one.
+  void set_max_num_threads(int num_threads);
+
+  /// Returns the maximum number of threads, see set_max_num_threads().
+  int get_max_num_threads() const { return max_num_threads_; }
+
   /// Returns a descriptor of the input port containing a color image.
   const InputPortDescriptor<double>& color_image_input_port() const;
 
@@ -65,6 +91,11 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   const std::string label_frame_name_;
 
   const bool do_compress_;
+  int compression_level_{1};
+  int max_num_threads_{1};
+  // The threads packing the images, or nullptr to pack them on the calling
+  // thread.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
 };
 
 }  // namespace sensors
@@ -1,5 +1,6 @@
 #include "drake/systems/sensors/rgbd_camera.h"
 
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -57,6 +58,50 @@ void RgbdCamera::ConvertDepthImageToPointCloud(const ImageDepth32F& depth_image,
   }
 }
 
+RgbdCameraScene::RgbdCameraScene(const RigidBodyTree<double>& tree,
+                                 double z_near, double z_far, double fov_y,
+                                 bool show_window)
+    : RgbdCameraScene(tree, std::make_unique<RgbdRendererVTK>(
+          RenderingConfig{kImageWidth, kImageHeight, fov_y, z_near, z_far,
+                          show_window})) {}
+
+RgbdCameraScene::RgbdCameraScene(const RigidBodyTree<double>& tree,
+                                 std::unique_ptr<RgbdRenderer> renderer)
+    : tree_(tree), renderer_(std::move(renderer)) {
+  // Creates rendering world.
+  for (const auto& body : tree_.get_bodies()) {
+    if (body->get_name() == std::string(RigidBodyTreeConstants::kWorldName)) {
+      continue;
+    }
+
+    const int body_id = body->get_body_index();
+    for (const auto& visual : body->get_visual_elements()) {
+      renderer_->RegisterVisual(visual, body_id);
+    }
+  }
+
+  renderer_->AddFlatTerrain();
+}
+
+void RgbdCameraScene::UpdateVisualPoses(
+    const Eigen::VectorXd& q, const KinematicsCache<double>& cache) const {
+  for (const auto& body : tree_.get_bodies()) {
+    if (body->get_name() == std::string(RigidBodyTreeConstants::kWorldName)) {
+      continue;
+    }
+
+    const auto X_WBody = tree_.CalcBodyPoseInWorldFrame(cache, *body);
+
+    for (size_t i = 0; i < body->get_visual_elements().size(); ++i) {
+      const auto& visual = body->get_visual_elements()[i];
+      const auto X_WV = X_WBody * visual.getLocalTransform();
+      renderer_->UpdateVisualPose(X_WV, body->get_body_index(),
+                                  RgbdRenderer::VisualIndex(i));
+    }
+  }
+  q_ = q;
+}
+
 RgbdCamera::RgbdCamera(const std::string& name,
                        const RigidBodyTree<double>& tree,
                        const Eigen::Vector3d& position,
@@ -70,11 +115,11 @@ RgbdCamera::RgbdCamera(const std::string& name,
       X_WB_initial_(
           Eigen::Translation3d(position[0], position[1], position[2]) *
           Eigen::Isometry3d(math::rpy2rotmat(orientation))),
-      renderer_(new RgbdRendererVTK(
+      scene_(new RgbdCameraScene(tree, std::make_unique<RgbdRendererVTK>(
           RenderingConfig{kImageWidth, kImageHeight, fov_y, z_near, z_far,
                           show_window},
           Eigen::Translation3d(position[0], position[1], position[2]) *
-              Eigen::Isometry3d(math::rpy2rotmat(orientation)) * X_BC_)) {
+              Eigen::Isometry3d(math::rpy2rotmat(orientation)) * X_BC_))) {
   Init(name);
 }
 
@@ -87,10 +132,40 @@ RgbdCamera::RgbdCamera(const std::string& name,
       camera_fixed_(false),
       color_camera_info_(kImageWidth, kImageHeight, fov_y),
       depth_camera_info_(kImageWidth, kImageHeight, fov_y),
-      renderer_(
-          new RgbdRendererVTK(RenderingConfig{kImageWidth, kImageHeight, fov_y,
-                                              z_near, z_far, show_window},
-                              Eigen::Isometry3d::Identity())) {
+      scene_(std::make_shared<RgbdCameraScene>(tree, z_near, z_far, fov_y,
+                                               show_window)) {
+  Init(name);
+}
+
+RgbdCamera::RgbdCamera(const std::string& name,
+                       std::shared_ptr<const RgbdCameraScene> scene,
+                       const Eigen::Vector3d& position,
+                       const Eigen::Vector3d& orientation)
+    : tree_(scene->tree()),
+      frame_(RigidBodyFrame<double>()),
+      camera_fixed_(true),
+      color_camera_info_(kImageWidth, kImageHeight,
+                         scene->renderer().config().fov_y),
+      depth_camera_info_(kImageWidth, kImageHeight,
+                         scene->renderer().config().fov_y),
+      X_WB_initial_(
+          Eigen::Translation3d(position[0], position[1], position[2]) *
+          Eigen::Isometry3d(math::rpy2rotmat(orientation))),
+      scene_(std::move(scene)) {
+  Init(name);
+}
+
+RgbdCamera::RgbdCamera(const std::string& name,
+                       std::shared_ptr<const RgbdCameraScene> scene,
+                       const RigidBodyFrame<double>& frame)
+    : tree_(scene->tree()),
+      frame_(frame),
+      camera_fixed_(false),
+      color_camera_info_(kImageWidth, kImageHeight,
+                         scene->renderer().config().fov_y),
+      depth_camera_info_(kImageWidth, kImageHeight,
+                         scene->renderer().config().fov_y),
+      scene_(std::move(scene)) {
   Init(name);
 }
 
@@ -116,19 +191,13 @@ void RgbdCamera::Init(const std::string& name) {
   camera_base_pose_port_ = &this->DeclareVectorOutputPort(
       rendering::PoseVector<double>(), &RgbdCamera::OutputPoseVector);
 
-  // Creates rendering world.
-  for (const auto& body : tree_.get_bodies()) {
-    if (body->get_name() == std::string(RigidBodyTreeConstants::kWorldName)) {
-      continue;
-    }
-
-    const int body_id = body->get_body_index();
-    for (const auto& visual : body->get_visual_elements()) {
-      renderer_->RegisterVisual(visual, body_id);
-    }
-  }
-
-  renderer_->AddFlatTerrain();
+  // The images depend only on the state input port (the camera's only input)
+  // and on the parameters, not on time or on any state of the camera.
+  rendered_images_cache_entry_ = &this->DeclareCacheEntry(
+      "rendered images",
+      RenderedImages{Eigen::VectorXd(), color_image, depth_image, label_image},
+      &RgbdCamera::CalcRenderedImages,
+      {this->all_input_ports_ticket(), this->all_parameters_ticket()});
 }
 
 const InputPortDescriptor<double>& RgbdCamera::state_input_port() const {
@@ -186,57 +255,66 @@ void RgbdCamera::UpdateModelPoses(
     const BasicVector<double>& input_vector) const {
   const Eigen::VectorXd q =
       input_vector.CopyToVector().head(tree_.get_num_positions());
-  KinematicsCache<double> cache = tree_.doKinematics(q);
-
-  if (!camera_fixed_) {
-    // Updates camera poses.
-    Eigen::Isometry3d X_WB =
-      tree_.CalcFramePoseInWorldFrame(cache, frame_);
-    renderer_->UpdateViewpoint(X_WB * X_BC_);
+  // Other cameras sharing the scene might have already posed the visuals for
+  // this configuration, in which case only the viewpoint, which is specific to
+  // this camera, is set.
+  const bool update_visuals = !scene_->IsPosedFor(q);
+  if (camera_fixed_ && !update_visuals) {
+    scene_->renderer().UpdateViewpoint(X_WB_initial_ * X_BC_);
+    return;
   }
 
-  // Updates body poses.
-  for (const auto& body : tree_.get_bodies()) {
-    if (body->get_name() == std::string(RigidBodyTreeConstants::kWorldName)) {
-      continue;
-    }
-
-    const auto X_WBody = tree_.CalcBodyPoseInWorldFrame(cache, *body);
-
-    for (size_t i = 0; i < body->get_visual_elements().size(); ++i) {
-      const auto& visual = body->get_visual_elements()[i];
-      const auto X_WV = X_WBody * visual.getLocalTransform();
-      renderer_->UpdateVisualPose(X_WV, body->get_body_index(),
-                                  RgbdRenderer::VisualIndex(i));
-    }
-  }
+  KinematicsCache<double> cache = tree_.doKinematics(q);
+  const Eigen::Isometry3d X_WB =
+      camera_fixed_ ? X_WB_initial_
+                    : tree_.CalcFramePoseInWorldFrame(cache, frame_);
+  scene_->renderer().UpdateViewpoint(X_WB * X_BC_);
+  if (update_visuals) scene_->UpdateVisualPoses(q, cache);
 }
 
-void RgbdCamera::OutputColorImage(const Context<double>& context,
-                                  ImageRgba8U* color_image) const {
+void RgbdCamera::CalcRenderedImages(const Context<double>& context,
+                                    RenderedImages* images) const {
   const BasicVector<double>* input_vector =
       this->EvalVectorInput(context, state_input_port_->get_index());
 
   UpdateModelPoses(*input_vector);
-  renderer_->RenderColorImage(color_image);
+  scene_->renderer().RenderImages(&images->color, &images->depth,
+                                  &images->label);
+  images->q = input_vector->get_value().head(tree_.get_num_positions());
 }
 
-void RgbdCamera::OutputDepthImage(const Context<double>& context,
-                                  ImageDepth32F* depth_image) const {
+const RgbdCamera::RenderedImages& RgbdCamera::EvalRenderedImages(
+    const Context<double>& context) const {
   const BasicVector<double>* input_vector =
       this->EvalVectorInput(context, state_input_port_->get_index());
+  const auto q = input_vector->get_value().head(tree_.get_num_positions());
+
+  // Contexts do not yet send value change notifications to the input port
+  // tracker, so a new q leaves the entry up to date. Until they do, q is
+  // compared here.
+  CacheEntryValue& cache_value =
+      rendered_images_cache_entry_->get_mutable_cache_entry_value(context);
+  if (!cache_value.needs_recomputation()) {
+    const RenderedImages& images = cache_value.get_value<RenderedImages>();
+    if (images.q.size() == q.size() && images.q == q) return images;
+    cache_value.mark_out_of_date();
+  }
+  return rendered_images_cache_entry_->Eval<RenderedImages>(context);
+}
 
-  UpdateModelPoses(*input_vector);
-  renderer_->RenderDepthImage(depth_image);
+void RgbdCamera::OutputColorImage(const Context<double>& context,
+                                  ImageRgba8U* color_image) const {
+  *color_image = EvalRenderedImages(context).color;
+}
+
+void RgbdCamera::OutputDepthImage(const Context<double>& context,
+                                  ImageDepth32F* depth_image) const {
+  *depth_image = EvalRenderedImages(context).depth;
 }
 
 void RgbdCamera::OutputLabelImage(const Context<double>& context,
                                   ImageLabel16I* label_image) const {
-  const BasicVector<double>* input_vector =
-      this->EvalVectorInput(context, state_input_port_->get_index());
-
-  UpdateModelPoses(*input_vector);
-  renderer_->RenderLabelImage(label_image);
+  *label_image = EvalRenderedImages(context).label;
 }
 
 RgbdCameraDiscrete::RgbdCameraDiscrete(
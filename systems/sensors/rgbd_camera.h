@@ -6,6 +6,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_optional.h"
 #include "drake/multibody/rigid_body_frame.h"
 #include "drake/multibody/rigid_body_tree.h"
 #include "drake/systems/framework/diagram.h"
@@ -18,6 +19,94 @@
 namespace drake {
 namespace systems {
 namespace sensors {
+/// The rendering scene built from the visual elements of a RigidBodyTree.
+///
+/// A scene can be shared among several RgbdCamera instances that view the
+/// same RigidBodyTree, e.g., the cameras of a workcell. In that case the
+/// visual geometry is loaded once and the visual poses are updated once per
+/// configuration of the tree, regardless of the number of cameras. Each camera
+/// then renders its own viewpoint of the shared scene. All the cameras sharing
+/// a scene have the image size, field of view and depth range of the scene.
+///
+/// @ingroup sensor_systems
+class RgbdCameraScene final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RgbdCameraScene)
+
+  /// Constructs a scene with the visual elements of `tree` and a flat
+  /// terrain.
+  ///
+  /// @param tree The RigidBodyTree containing the geometric description of the
+  /// world. The life span of this parameter must exceed that of this class's
+  /// instance. The maximum number of bodies in the `tree` must be less than
+  /// 1536 based on the number of the colors used for the label image,
+  /// otherwise an exception will be thrown.
+  ///
+  /// @param z_near The minimum depth distance the cameras can measure.
+  /// The default is 0.5 meters.
+  ///
+  /// @param z_far The maximum depth distance the cameras can measure.
+  /// The default is 5 meters.
+  ///
+  /// @param fov_y The cameras' vertical field of view.
+  /// The default is PI / 4.
+  ///
+  /// @param show_window A flag for showing a visible window.  If this is false,
+  /// offscreen rendering is executed. This is useful for debugging purposes.
+  ///
+  /// @throws std::logic_error When the number of rigid bodies in the scene
+  /// exceeds the maximum limit 1535.
+  explicit RgbdCameraScene(
+      const RigidBodyTree<double>& tree,
+      double z_near = 0.5,
+      double z_far = 5.0,
+      double fov_y = M_PI_4,
+      bool show_window = RenderingConfig::kDefaultShowWindow);
+
+  /// Constructs a scene with the visual elements of `tree` and a flat
+  /// terrain, held by `renderer`. The cameras viewing this scene have the
+  /// field of view and depth range of the configuration of `renderer`.
+  ///
+  /// @param tree The RigidBodyTree containing the geometric description of the
+  /// world. The life span of this parameter must exceed that of this class's
+  /// instance.
+  ///
+  /// @param renderer The renderer that holds the scene.
+  RgbdCameraScene(const RigidBodyTree<double>& tree,
+                  std::unique_ptr<RgbdRenderer> renderer);
+
+  ~RgbdCameraScene() = default;
+
+  /// Returns the RigidBodyTree whose visual elements make up this scene.
+  const RigidBodyTree<double>& tree() const { return tree_; }
+
+  /// Returns the renderer that holds this scene. The visual poses of the
+  /// scene are updated by the cameras viewing it; updating them through the
+  /// renderer directly is not supported.
+  const RgbdRenderer& renderer() const { return *renderer_; }
+
+ private:
+  friend class RgbdCamera;
+
+  // Returns true if the visual poses are up to date with the configuration
+  // `q` of the tree.
+  bool IsPosedFor(const Eigen::VectorXd& q) const {
+    return q_ && q_->size() == q.size() && *q_ == q;
+  }
+
+  // Updates the visual poses to the configuration `q`, for which `cache` was
+  // computed.
+  void UpdateVisualPoses(const Eigen::VectorXd& q,
+                         const KinematicsCache<double>& cache) const;
+
+  const RigidBodyTree<double>& tree_;
+  const std::unique_ptr<RgbdRenderer> renderer_;
+  // The configuration of the tree the visual poses were last updated for,
+  // nullopt if they were never updated. A tree whose bodies are all welded has
+  // an empty configuration, which is therefore distinct from nullopt.
+  mutable optional<Eigen::VectorXd> q_;
+};
+
 /// An RGB-D camera system that provides RGB, depth and label images using
 /// visual elements of RigidBodyTree.
 /// RgbdCamera uses [VTK](https://github.com/Kitware/VTK) as the rendering
@@ -169,6 +258,38 @@ class RgbdCamera final : public LeafSystem<double> {
              double fov_y = M_PI_4,
              bool show_window = RenderingConfig::kDefaultShowWindow);
 
+  /// A constructor for a fixed %RgbdCamera, see the constructor above, that
+  /// renders the shared `scene`. The image size, field of view and depth
+  /// range are those of `scene`.
+  ///
+  /// @param name The name of the RgbdCamera.
+  ///
+  /// @param scene The scene rendered by this camera, which can be shared with
+  /// other cameras.
+  ///
+  /// @param position The x-y-z position of `B` in `W`.
+  ///
+  /// @param orientation The roll-pitch-yaw orientation of `B` in `W`.
+  RgbdCamera(const std::string& name,
+             std::shared_ptr<const RgbdCameraScene> scene,
+             const Eigen::Vector3d& position,
+             const Eigen::Vector3d& orientation);
+
+  /// A constructor for an %RgbdCamera attached to a RigidBodyFrame, see the
+  /// constructor above, that renders the shared `scene`. The image size,
+  /// field of view and depth range are those of `scene`.
+  ///
+  /// @param name The name of the RgbdCamera.
+  ///
+  /// @param scene The scene rendered by this camera, which can be shared with
+  /// other cameras.
+  ///
+  /// @param frame The frame in the scene's tree to which this camera is
+  /// attached.
+  RgbdCamera(const std::string& name,
+             std::shared_ptr<const RgbdCameraScene> scene,
+             const RigidBodyFrame<double>& frame);
+
   ~RgbdCamera() = default;
 
   /// Reterns the color sensor's info.
@@ -198,6 +319,11 @@ class RgbdCamera final : public LeafSystem<double> {
   /// Returns the RigidBodyTree to which this RgbdCamera is attached.
   const RigidBodyTree<double>& tree() const { return tree_; }
 
+  /// Returns the scene rendered by this RgbdCamera.
+  const std::shared_ptr<const RgbdCameraScene>& scene() const {
+    return scene_;
+  }
+
   /// Returns a descriptor of the vector valued input port that takes a vector
   /// of `q, v` corresponding to the positions and velocities associated with
   /// the RigidBodyTree.
@@ -230,9 +356,29 @@ class RgbdCamera final : public LeafSystem<double> {
   void OutputPoseVector(const Context<double>& context,
                         rendering::PoseVector<double>* pose_vector) const;
 
-  // TODO(sherm1) This should be the calculator for a cache entry containing
-  // the VTK update that must be valid before outputting any image info. For
-  // now it has to be repeated before each image output port calculation.
+  // The images rendered for a given configuration of the tree. These are
+  // stored in a cache entry shared by the three image output ports so that
+  // the visual poses are updated and the images are rendered only once per
+  // configuration.
+  struct RenderedImages {
+    // The generalized positions of the tree the images were rendered for.
+    Eigen::VectorXd q;
+    ImageRgba8U color;
+    ImageDepth32F depth;
+    ImageLabel16I label;
+  };
+
+  // The calculator for the rendered images cache entry. It updates the poses
+  // of the camera and of the visuals and then renders all three images in a
+  // single submission to the renderer.
+  void CalcRenderedImages(const Context<double>& context,
+                          RenderedImages* images) const;
+
+  // Returns the rendered images for the configuration in `context`, rendering
+  // them only if they are not already up to date.
+  const RenderedImages& EvalRenderedImages(
+      const Context<double>& context) const;
+
   void UpdateModelPoses(const BasicVector<double>& input_vector) const;
 
   const InputPortDescriptor<double>* state_input_port_{};
@@ -240,6 +386,7 @@ class RgbdCamera final : public LeafSystem<double> {
   const OutputPort<double>* depth_image_port_{};
   const OutputPort<double>* label_image_port_{};
   const OutputPort<double>* camera_base_pose_port_{};
+  const CacheEntry* rendered_images_cache_entry_{};
 
   const RigidBodyTree<double>& tree_;
   const RigidBodyFrame<double> frame_;
@@ -262,7 +409,7 @@ class RgbdCamera final : public LeafSystem<double> {
         (Eigen::AngleAxisd(-M_PI_2, Eigen::Vector3d::UnitX()) *
          Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitY()))};
 
-  std::unique_ptr<RgbdRenderer> renderer_;
+  const std::shared_ptr<const RgbdCameraScene> scene_;
 };
 
 /**
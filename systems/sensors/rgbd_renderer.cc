@@ -44,6 +44,20 @@ void RgbdRenderer::RenderLabelImage(ImageLabel16I* label_image_out) const {
   ImplRenderLabelImage(label_image_out);
 }
 
+void RgbdRenderer::RenderImages(ImageRgba8U* color_image_out,
+                                ImageDepth32F* depth_image_out,
+                                ImageLabel16I* label_image_out) const {
+  ImplRenderImages(color_image_out, depth_image_out, label_image_out);
+}
+
+void RgbdRenderer::ImplRenderImages(ImageRgba8U* color_image_out,
+                                    ImageDepth32F* depth_image_out,
+                                    ImageLabel16I* label_image_out) const {
+  if (color_image_out != nullptr) ImplRenderColorImage(color_image_out);
+  if (depth_image_out != nullptr) ImplRenderDepthImage(depth_image_out);
+  if (label_image_out != nullptr) ImplRenderLabelImage(label_image_out);
+}
+
 const RenderingConfig& RgbdRenderer::config() const { return config_; }
 
 const ColorPalette& RgbdRenderer::color_palette() const {
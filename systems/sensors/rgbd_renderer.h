@@ -146,6 +146,24 @@ class RgbdRenderer {
   /// @param label_image_out The rendered label image.
   void RenderLabelImage(ImageLabel16I* label_image_out) const;
 
+  /// Renders the color, depth and label images for the current viewpoint and
+  /// visual poses in a single submission. This is equivalent to, but
+  /// typically cheaper than, calling RenderColorImage(), RenderDepthImage()
+  /// and RenderLabelImage() in sequence since implementations can issue all
+  /// the render passes before reading any of the images back.
+  ///
+  /// @param color_image_out The rendered color image. It can be nullptr, in
+  /// which case the color image is not rendered.
+  ///
+  /// @param depth_image_out The rendered depth image. It can be nullptr, in
+  /// which case the depth image is not rendered.
+  ///
+  /// @param label_image_out The rendered label image. It can be nullptr, in
+  /// which case the label image is not rendered.
+  void RenderImages(ImageRgba8U* color_image_out,
+                    ImageDepth32F* depth_image_out,
+                    ImageLabel16I* label_image_out) const;
+
   /// Returns the configuration object of this renderer.
   const RenderingConfig& config() const;
 
@@ -169,6 +187,11 @@ class RgbdRenderer {
 
   virtual void ImplRenderLabelImage(ImageLabel16I* label_image_out) const = 0;
 
+  // The default implementation renders each of the requested images in turn.
+  virtual void ImplRenderImages(ImageRgba8U* color_image_out,
+                                ImageDepth32F* depth_image_out,
+                                ImageLabel16I* label_image_out) const;
+
   /// The common configuration needed by all implementations of this interface.
   RenderingConfig config_;
 
@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -14,6 +15,7 @@
 #include <vtkCommand.h>
 #include <vtkCubeSource.h>
 #include <vtkCylinderSource.h>
+#include <vtkImageData.h>
 #include <vtkImageExport.h>
 #include <vtkNew.h>
 #include <vtkOBJReader.h>
@@ -22,6 +24,7 @@
 #include <vtkOpenGLTexture.h>
 #include <vtkPNGReader.h>
 #include <vtkPlaneSource.h>
+#include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkProperty.h>
 #include <vtkRenderWindow.h>
@@ -35,6 +38,7 @@
 #include <vtkWindowToImageFilter.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/systems/sensors/depth_shaders.h"
 #include "drake/systems/sensors/vtk_util.h"
 
@@ -101,6 +105,77 @@ void PerformVTKUpdate(const std::unique_ptr<RenderingPipeline>& p) {
   p->exporter->Update();
 }
 
+// Same as PerformVTKUpdate() but for several pipelines at once. All the render
+// passes are submitted before any image is read back, so that reading back
+// one image does not stall the submission of the passes that follow.
+void PerformVTKUpdate(
+    const std::vector<const RenderingPipeline*>& pipelines) {
+  for (const RenderingPipeline* p : pipelines) p->window->Render();
+  for (const RenderingPipeline* p : pipelines) {
+    p->filter->Modified();
+    p->filter->Update();
+    p->exporter->Update();
+  }
+}
+
+// The mesh and texture data loaded by an RgbdRendererVTK, so that its visuals
+// using the same files share their data instead of reloading it.
+class RenderDataCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderDataCache)
+
+  RenderDataCache() = default;
+
+  // Returns the polygonal data of the OBJ mesh in `filename` scaled by
+  // `scale`, loading it if this is the first request for it.
+  vtkSmartPointer<vtkPolyData> LoadScaledMesh(const std::string& filename,
+                                              const Eigen::Vector3d& scale) {
+    const MeshKey key{filename, scale(0), scale(1), scale(2)};
+    auto it = meshes_.find(key);
+    if (it != meshes_.end()) return it->second;
+
+    // TODO(kunimatsu-tri) Add support for other file formats.
+    vtkNew<vtkOBJReader> mesh_reader;
+    mesh_reader->SetFileName(filename.c_str());
+    mesh_reader->Update();
+
+    // Changing the scale of the loaded mesh.
+    vtkNew<vtkTransform> transform;
+    transform->Scale(scale(0), scale(1), scale(2));
+    vtkNew<vtkTransformPolyDataFilter> transform_filter;
+    transform_filter->SetInputConnection(mesh_reader->GetOutputPort());
+    transform_filter->SetTransform(transform.GetPointer());
+    transform_filter->Update();
+
+    auto mesh = vtkSmartPointer<vtkPolyData>::New();
+    mesh->ShallowCopy(transform_filter->GetOutput());
+    meshes_.emplace(key, mesh);
+    return mesh;
+  }
+
+  // Returns the image in the PNG file `filename`, loading it if this is the
+  // first request for it.
+  vtkSmartPointer<vtkImageData> LoadTexture(const std::string& filename) {
+    auto it = textures_.find(filename);
+    if (it != textures_.end()) return it->second;
+
+    vtkNew<vtkPNGReader> texture_reader;
+    texture_reader->SetFileName(filename.c_str());
+    texture_reader->Update();
+
+    auto texture = vtkSmartPointer<vtkImageData>::New();
+    texture->ShallowCopy(texture_reader->GetOutput());
+    textures_.emplace(filename, texture);
+    return texture;
+  }
+
+ private:
+  using MeshKey = std::tuple<std::string, double, double, double>;
+
+  std::map<MeshKey, vtkSmartPointer<vtkPolyData>> meshes_;
+  std::map<std::string, vtkSmartPointer<vtkImageData>> textures_;
+};
+
 void SetModelTransformMatrixToVtkCamera(
     vtkCamera* camera, const vtkSmartPointer<vtkTransform>& X_WC) {
   // vtkCamera contains a transformation as the internal state and
@@ -183,9 +258,21 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
 
   void ImplRenderLabelImage(ImageLabel16I* label_image_out) const;
 
+  void ImplRenderImages(ImageRgba8U* color_image_out,
+                        ImageDepth32F* depth_image_out,
+                        ImageLabel16I* label_image_out) const;
+
  private:
   float CheckRangeAndConvertToMeters(float shader_output) const;
 
+  // Decodes the output of the depth pipeline into a depth image.
+  void DecodeDepthImage(const ImageRgba8U& image,
+                        ImageDepth32F* depth_image_out) const;
+
+  // Decodes the output of the label pipeline into a label image.
+  void DecodeLabelImage(const ImageRgba8U& image,
+                        ImageLabel16I* label_image_out) const;
+
   RgbdRendererVTK* parent_ = nullptr;
 
   vtkNew<vtkActor> terrain_actor_;
@@ -200,6 +287,10 @@ class RgbdRendererVTK::Impl : private ModuleInitVtkRenderingOpenGL2 {
   // SDF / URDF.
   std::map<int, std::array<ActorCollection, 3>> id_object_maps_;
 
+  // The meshes and textures of the registered visuals; it lives as long as
+  // this renderer.
+  RenderDataCache render_data_;
+
   vtkNew<ShaderCallback> uniform_setting_callback_;
 };
 
@@ -302,7 +393,13 @@ void RgbdRendererVTK::Impl::ImplRenderDepthImage(
   // TODO(sherm1) Should evaluate VTK cache entry.
   PerformVTKUpdate(pipelines_[ImageType::kDepth]);
   pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
+  DecodeDepthImage(image, depth_image_out);
+}
 
+void RgbdRendererVTK::Impl::DecodeDepthImage(
+    const ImageRgba8U& image, ImageDepth32F* depth_image_out) const {
+  const int width = image.width();
+  const int height = image.height();
   for (int v = 0; v < height; ++v) {
     for (int u = 0; u < width; ++u) {
       if (image.at(u, v)[0] == 255u &&
@@ -336,7 +433,13 @@ void RgbdRendererVTK::Impl::ImplRenderLabelImage(
   // TODO(sherm1) Should evaluate VTK cache entry.
   PerformVTKUpdate(pipelines_[ImageType::kLabel]);
   pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+  DecodeLabelImage(image, label_image_out);
+}
 
+void RgbdRendererVTK::Impl::DecodeLabelImage(
+    const ImageRgba8U& image, ImageLabel16I* label_image_out) const {
+  const int width = image.width();
+  const int height = image.height();
   ColorI color;
   for (int v = 0; v < height; ++v) {
     for (int u = 0; u < width; ++u) {
@@ -350,6 +453,37 @@ void RgbdRendererVTK::Impl::ImplRenderLabelImage(
   }
 }
 
+void RgbdRendererVTK::Impl::ImplRenderImages(
+    ImageRgba8U* color_image_out, ImageDepth32F* depth_image_out,
+    ImageLabel16I* label_image_out) const {
+  std::vector<const RenderingPipeline*> pipelines;
+  if (color_image_out != nullptr) {
+    pipelines.push_back(pipelines_[ImageType::kColor].get());
+  }
+  if (depth_image_out != nullptr) {
+    pipelines.push_back(pipelines_[ImageType::kDepth].get());
+  }
+  if (label_image_out != nullptr) {
+    pipelines.push_back(pipelines_[ImageType::kLabel].get());
+  }
+  PerformVTKUpdate(pipelines);
+
+  if (color_image_out != nullptr) {
+    pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
+  }
+  const int width = parent_->config().width;
+  const int height = parent_->config().height;
+  ImageRgba8U image(width, height);
+  if (depth_image_out != nullptr) {
+    pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
+    DecodeDepthImage(image, depth_image_out);
+  }
+  if (label_image_out != nullptr) {
+    pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+    DecodeLabelImage(image, label_image_out);
+  }
+}
+
 RgbdRendererVTK::Impl::Impl(RgbdRendererVTK* parent,
                             const Eigen::Isometry3d& X_WC)
     : parent_(parent),
@@ -482,24 +616,10 @@ optional<RgbdRenderer::VisualIndex> RgbdRendererVTK::Impl::ImplRegisterVisual(
       const auto& mesh = dynamic_cast<const DrakeShapes::Mesh&>(geometry);
       const auto* mesh_filename = mesh.resolved_filename_.c_str();
 
-      // TODO(kunimatsu-tri) Add support for other file formats.
-      vtkNew<vtkOBJReader> mesh_reader;
-      mesh_reader->SetFileName(mesh_filename);
-      mesh_reader->Update();
-
-      // Changing the scale of the loaded mesh.
-      const double scale_x = mesh.scale_[0];
-      const double scale_y = mesh.scale_[1];
-      const double scale_z = mesh.scale_[2];
-      vtkNew<vtkTransform> transform;
-      transform->Scale(scale_x, scale_y, scale_z);
-      vtkNew<vtkTransformPolyDataFilter> transform_filter;
-      transform_filter->SetInputConnection(mesh_reader->GetOutputPort());
-      transform_filter->SetTransform(transform.GetPointer());
-      transform_filter->Update();
-
+      vtkSmartPointer<vtkPolyData> mesh_data =
+          render_data_.LoadScaledMesh(mesh.resolved_filename_, mesh.scale_);
       for (auto& mapper : mappers) {
-        mapper->SetInputConnection(transform_filter->GetOutputPort());
+        mapper->SetInputData(mesh_data);
       }
 
       // TODO(kunimatsu-tri) Guessing the texture file name is bad. Instead,
@@ -511,11 +631,8 @@ optional<RgbdRenderer::VisualIndex> RgbdRendererVTK::Impl::ImplRegisterVisual(
       std::ifstream file_exist(texture_file);
 
       if (file_exist) {
-        vtkNew<vtkPNGReader> texture_reader;
-        texture_reader->SetFileName(texture_file.c_str());
-        texture_reader->Update();
         vtkNew<vtkOpenGLTexture> texture;
-        texture->SetInputConnection(texture_reader->GetOutputPort());
+        texture->SetInputData(render_data_.LoadTexture(texture_file));
         texture->InterpolateOn();
 
         // TODO(kunimatsu-tri) Use proper values from material file for
@@ -608,6 +725,12 @@ void RgbdRendererVTK::ImplRenderLabelImage(
   impl_->ImplRenderLabelImage(label_image_out);
 }
 
+void RgbdRendererVTK::ImplRenderImages(ImageRgba8U* color_image_out,
+                                       ImageDepth32F* depth_image_out,
+                                       ImageLabel16I* label_image_out) const {
+  impl_->ImplRenderImages(color_image_out, depth_image_out, label_image_out);
+}
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
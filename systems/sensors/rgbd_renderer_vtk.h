@@ -36,6 +36,10 @@ class RgbdRendererVTK final : public RgbdRenderer {
 
   void ImplRenderLabelImage(ImageLabel16I* label_image_out) const override;
 
+  void ImplRenderImages(ImageRgba8U* color_image_out,
+                        ImageDepth32F* depth_image_out,
+                        ImageLabel16I* label_image_out) const override;
+
   class Impl;
   std::unique_ptr<Impl> impl_;
 };
@@ -1,6 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
+#include <cstring>
+#include <map>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include <zlib.h>
 #include "robotlocomotion/image_array_t.hpp"
 
 #include "drake/systems/sensors/image.h"
@@ -126,6 +131,82 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          image_t::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// Verifies that the compressed images decompress to the input images for any
+// compression level and number of threads, that the compression level is
+// applied, and that the number of threads does not change the output.
+GTEST_TEST(ImageToLcmImageArrayT, CompressionSettings) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight);
+  ImageLabel16I label_image(kImageWidth, kImageHeight);
+  for (int v = 0; v < kImageHeight; ++v) {
+    for (int u = 0; u < kImageWidth; ++u) {
+      for (int ch = 0; ch < color_image.kNumChannels; ++ch) {
+        color_image.at(u, v)[ch] = static_cast<uint8_t>(u * v + ch);
+      }
+      depth_image.at(u, v)[0] = 0.1f * u + v;
+      label_image.at(u, v)[0] = static_cast<int16_t>(u - v);
+    }
+  }
+
+  const int kNumPixels = kImageWidth * kImageHeight;
+  auto VerifyDecompressed = [](const image_t& msg, const void* expected,
+                               int expected_size) {
+    ASSERT_EQ(msg.compression_method, image_t::COMPRESSION_METHOD_ZLIB);
+    std::vector<uint8_t> data(expected_size);
+    uLongf size = expected_size;
+    ASSERT_EQ(uncompress(data.data(), &size, msg.data.data(), msg.size),
+              Z_OK);
+    ASSERT_EQ(static_cast<int>(size), expected_size);
+    EXPECT_EQ(std::memcmp(data.data(), expected, expected_size), 0);
+  };
+
+  ImageToLcmImageArrayT dut(
+      kColorFrameName, kDepthFrameName, kLabelFrameName, true);
+  EXPECT_EQ(dut.get_compression_level(), 1);
+  EXPECT_EQ(dut.get_max_num_threads(), 1);
+  EXPECT_THROW(dut.set_compression_level(0), std::exception);
+  EXPECT_THROW(dut.set_compression_level(10), std::exception);
+  EXPECT_THROW(dut.set_max_num_threads(0), std::exception);
+
+  // The compressed data of each image, for each compression level.
+  std::map<int, std::map<int64_t, std::vector<uint8_t>>> compressed;
+  for (int level : {1, 9}) {
+    for (int num_threads : {1, 3, 2, 1}) {
+      dut.set_compression_level(level);
+      dut.set_max_num_threads(num_threads);
+      const auto image_array_t = SetUpInputAndOutput(
+          &dut, color_image, depth_image, label_image);
+      ASSERT_EQ(image_array_t.num_images, 3);
+      for (const auto& image : image_array_t.images) {
+        // The level is recorded in the FLEVEL bits of the zlib header: 0 for
+        // the fastest compression and 3 for the smallest output.
+        ASSERT_GE(image.data.size(), 2u);
+        EXPECT_EQ(image.data[1] >> 6, level == 1 ? 0 : 3);
+        std::vector<uint8_t>& data = compressed[level][image.pixel_format];
+        if (data.empty()) {
+          data = image.data;
+        } else {
+          EXPECT_EQ(image.data, data);
+        }
+        if (image.pixel_format == image_t::PIXEL_FORMAT_RGBA) {
+          VerifyDecompressed(image, color_image.at(0, 0),
+                             kNumPixels * color_image.kPixelSize);
+        } else if (image.pixel_format == image_t::PIXEL_FORMAT_DEPTH) {
+          VerifyDecompressed(image, depth_image.at(0, 0),
+                             kNumPixels * depth_image.kPixelSize);
+        } else {
+          ASSERT_EQ(image.pixel_format, image_t::PIXEL_FORMAT_LABEL);
+          VerifyDecompressed(image, label_image.at(0, 0),
+                             kNumPixels * label_image.kPixelSize);
+        }
+      }
+    }
+  }
+  for (const auto& format_and_data : compressed[1]) {
+    EXPECT_NE(compressed[9][format_and_data.first], format_and_data.second);
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -2,8 +2,11 @@
 
 #include <array>
 #include <cmath>
+#include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -146,6 +149,8 @@ class RgbdCameraDiagram : public systems::Diagram<double> {
     Connect();
   }
 
+  const RgbdCamera& camera() const { return *rgbd_camera_; }
+
  private:
   void Connect() {
     builder_.Connect(plant_->state_output_port(),
@@ -217,6 +222,19 @@ class RgbdCameraDiagramTest : public ::testing::Test {
     output_ = diagram_->AllocateOutput(*context_);
   }
 
+  // Returns the number of times the images were rendered for the context in
+  // this fixture, which is tracked by the serial number of the cache entry
+  // that holds them.
+  int64_t num_renders() const {
+    const RgbdCamera& camera = diagram_->camera();
+    const Context<double>& camera_context =
+        diagram_->GetSubsystemContext(camera, *context_);
+    EXPECT_EQ(camera.num_cache_entries(), 1);
+    // The serial number starts at one when the cache entry is allocated.
+    return camera.get_cache_entry(CacheIndex(0))
+        .get_cache_entry_value(camera_context).serial_number() - 1;
+  }
+
   std::unique_ptr<systems::SystemOutput<double>> output_;
 
  private:
@@ -263,6 +281,202 @@ TEST_F(RgbdCameraDiagramTest, MovableCameraOutputTest) {
                               actual.matrix(), kTolerance));
 }
 
+// Verifies that the color, depth and label output ports share a single
+// rendering of the scene.
+TEST_F(RgbdCameraDiagramTest, SharedRendering) {
+  const Eigen::Vector3d position(0., 0., 1.);
+  const Eigen::Vector3d orientation(0., M_PI_2, 0.);
+  Init("nothing.sdf", position, orientation);
+  EXPECT_EQ(num_renders(), 0);
+
+  // Evaluating all three image output ports renders the scene once.
+  Verify();
+  EXPECT_EQ(num_renders(), 1);
+
+  // The configuration did not change and therefore the images are not
+  // rendered again.
+  Verify();
+  EXPECT_EQ(num_renders(), 1);
+}
+
+// Verifies that cameras sharing a scene render their own viewpoints of it.
+GTEST_TEST(RgbdCamera, SharedScene) {
+  RigidBodyTree<double> tree;
+  drake::parsers::sdf::AddModelInstancesFromSdfFileToWorld(
+      FindResourceOrThrow("drake/systems/sensors/test/models/nothing.sdf"),
+      multibody::joints::kQuaternion, &tree);
+  auto scene = std::make_shared<RgbdCameraScene>(
+      tree, kDepthRangeNear, kDepthRangeFar, kFovY, kShowWindow);
+
+  // Both cameras are looking straight down at the ground, from different
+  // heights.
+  const Eigen::Vector3d orientation(0., M_PI_2, 0.);
+  const std::vector<double> heights{1., 2.};
+  std::vector<std::unique_ptr<RgbdCamera>> cameras;
+  for (double height : heights) {
+    cameras.push_back(std::make_unique<RgbdCamera>(
+        "rgbd_camera", scene, Eigen::Vector3d(0., 0., height), orientation));
+    EXPECT_EQ(cameras.back()->scene(), scene);
+    EXPECT_EQ(&cameras.back()->tree(), &tree);
+    VerifyCameraInfo(cameras.back()->depth_camera_info());
+  }
+
+  // The cameras are evaluated in turn, as within a Diagram.
+  for (size_t i = 0; i < cameras.size(); ++i) {
+    auto context = cameras[i]->CreateDefaultContext();
+    context->FixInputPort(
+        cameras[i]->state_input_port().get_index(),
+        Eigen::VectorXd::Zero(
+            tree.get_num_positions() + tree.get_num_velocities()));
+    auto output = cameras[i]->AllocateOutput(*context);
+    cameras[i]->CalcOutput(*context, output.get());
+    const auto& depth =
+        output->get_data(cameras[i]->depth_image_output_port().get_index())
+            ->GetValue<ImageDepth32F>();
+    // The depth image holds the Z value in D, which is the height of the
+    // camera for every pixel.
+    for (int v = 0; v < kHeight; ++v) {
+      for (int u = 0; u < kWidth; ++u) {
+        ASSERT_NEAR(depth.at(u, v)[0], heights[i], 1e-4);
+      }
+    }
+  }
+}
+
+// A renderer that renders nothing and counts the updates of the visual poses
+// and of the viewpoint. It also keeps the last pose set for each visual.
+class CountingRenderer final : public RgbdRenderer {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CountingRenderer)
+
+  CountingRenderer()
+      : RgbdRenderer(RenderingConfig{kWidth, kHeight, kFovY, kDepthRangeNear,
+                                     kDepthRangeFar, kShowWindow}) {}
+
+  int num_visual_pose_updates() const { return num_visual_pose_updates_; }
+
+  int num_viewpoint_updates() const { return num_viewpoint_updates_; }
+
+  const Eigen::Isometry3d& visual_pose(int body_id, int visual_index) const {
+    return visual_poses_.at({body_id, visual_index});
+  }
+
+ private:
+  void ImplAddFlatTerrain() override {}
+
+  optional<VisualIndex> ImplRegisterVisual(const DrakeShapes::VisualElement&,
+                                           int body_id) override {
+    return VisualIndex(num_visuals_[body_id]++);
+  }
+
+  void ImplUpdateVisualPose(const Eigen::Isometry3d& X_WV, int body_id,
+                            VisualIndex visual_id) const override {
+    ++num_visual_pose_updates_;
+    visual_poses_[{body_id, visual_id}] = X_WV;
+  }
+
+  void ImplUpdateViewpoint(const Eigen::Isometry3d&) const override {
+    ++num_viewpoint_updates_;
+  }
+
+  void ImplRenderColorImage(ImageRgba8U*) const override {}
+
+  void ImplRenderDepthImage(ImageDepth32F*) const override {}
+
+  void ImplRenderLabelImage(ImageLabel16I*) const override {}
+
+  std::map<int, int> num_visuals_;
+  mutable std::map<std::pair<int, int>, Eigen::Isometry3d> visual_poses_;
+  mutable int num_visual_pose_updates_{0};
+  mutable int num_viewpoint_updates_{0};
+};
+
+// Verifies that cameras sharing a scene update the visual poses once per
+// configuration, while each of them sets its own viewpoint.
+GTEST_TEST(RgbdCamera, SharedScenePosedOncePerConfiguration) {
+  RigidBodyTree<double> tree;
+  drake::parsers::sdf::AddModelInstancesFromSdfFileToWorld(
+      FindResourceOrThrow("drake/systems/sensors/test/models/sphere.sdf"),
+      multibody::joints::kRollPitchYaw, &tree);
+  auto renderer = std::make_unique<CountingRenderer>();
+  const CountingRenderer* counter = renderer.get();
+  auto scene = std::make_shared<RgbdCameraScene>(tree, std::move(renderer));
+  // The sphere has a single visual.
+  const int kNumVisuals = 1;
+
+  const Eigen::Vector3d orientation(0., M_PI_2, 0.);
+  std::vector<std::unique_ptr<RgbdCamera>> cameras;
+  std::vector<std::unique_ptr<Context<double>>> contexts;
+  std::vector<std::unique_ptr<SystemOutput<double>>> outputs;
+  for (double height : {1., 2.}) {
+    cameras.push_back(std::make_unique<RgbdCamera>(
+        "rgbd_camera", scene, Eigen::Vector3d(0., 0., height), orientation));
+    contexts.push_back(cameras.back()->CreateDefaultContext());
+    outputs.push_back(cameras.back()->AllocateOutput(*contexts.back()));
+  }
+
+  // Renders the images of all the cameras in turn, as within a Diagram, for
+  // the configuration `q` of the tree.
+  auto render_all = [&](const Eigen::VectorXd& q) {
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(tree.get_num_positions() +
+                                              tree.get_num_velocities());
+    x.head(tree.get_num_positions()) = q;
+    for (size_t i = 0; i < cameras.size(); ++i) {
+      contexts[i]->FixInputPort(cameras[i]->state_input_port().get_index(), x);
+      cameras[i]->CalcOutput(*contexts[i], outputs[i].get());
+    }
+  };
+
+  // The first camera poses the visuals, the second one only sets its
+  // viewpoint.
+  Eigen::VectorXd q = Eigen::VectorXd::Zero(tree.get_num_positions());
+  render_all(q);
+  EXPECT_EQ(counter->num_visual_pose_updates(), kNumVisuals);
+  EXPECT_EQ(counter->num_viewpoint_updates(), 2);
+
+  // A new configuration poses the visuals once more.
+  q(2) = 0.5;
+  render_all(q);
+  EXPECT_EQ(counter->num_visual_pose_updates(), 2 * kNumVisuals);
+  EXPECT_EQ(counter->num_viewpoint_updates(), 4);
+}
+
+// Verifies that the visuals of a tree whose bodies are all welded, and which
+// therefore has an empty configuration, are posed by the first rendering.
+GTEST_TEST(RgbdCamera, WeldedOnlyTreePosed) {
+  RigidBodyTree<double> tree;
+  drake::parsers::sdf::AddModelInstancesFromSdfFileToWorld(
+      FindResourceOrThrow("drake/systems/sensors/test/models/sphere.sdf"),
+      multibody::joints::kFixed, &tree);
+  ASSERT_EQ(tree.get_num_positions(), 0);
+  auto renderer = std::make_unique<CountingRenderer>();
+  const CountingRenderer* counter = renderer.get();
+  auto scene = std::make_shared<RgbdCameraScene>(tree, std::move(renderer));
+
+  RgbdCamera camera("rgbd_camera", scene, Eigen::Vector3d(0., 0., 2.),
+                    Eigen::Vector3d(0., M_PI_2, 0.));
+  auto context = camera.CreateDefaultContext();
+  auto output = camera.AllocateOutput(*context);
+  context->FixInputPort(camera.state_input_port().get_index(),
+                        Eigen::VectorXd::Zero(0));
+  camera.CalcOutput(*context, output.get());
+  ASSERT_EQ(counter->num_visual_pose_updates(), 1);
+  // The sphere is welded at its model pose.
+  const RigidBody<double>* sphere = tree.FindBody("sphere");
+  ASSERT_NE(sphere, nullptr);
+  const Eigen::Isometry3d& X_WV =
+      counter->visual_pose(sphere->get_body_index(), 0);
+  EXPECT_TRUE(CompareMatrices(X_WV.translation(),
+                              Eigen::Vector3d(0., 0.02, 0.5), kTolerance));
+  EXPECT_TRUE(CompareMatrices(X_WV.linear(), Eigen::Matrix3d::Identity(),
+                              kTolerance));
+
+  // Rendering again does not pose the visuals again.
+  camera.CalcOutput(*context, output.get());
+  EXPECT_EQ(counter->num_visual_pose_updates(), 1);
+  EXPECT_EQ(counter->num_viewpoint_updates(), 2);
+}
+
 class DepthImageToPointCloudConversionTest : public ::testing::Test {
  public:
   static constexpr float kFocal = 500.f;
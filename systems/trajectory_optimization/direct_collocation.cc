@@ -32,10 +32,7 @@ DirectCollocationConstraint::DirectCollocationConstraint(
                  Eigen::VectorXd::Zero(num_states),
                  Eigen::VectorXd::Zero(num_states)),
       system_(System<double>::ToAutoDiffXd(system)),
-      context_(system_->CreateDefaultContext()),
-      // Don't allocate the input port until we're past the point
-      // where we might throw.
-      derivatives_(system_->AllocateTimeDerivatives()),
+      context_(context.Clone()),
       num_states_(num_states),
       num_inputs_(num_inputs) {
   DRAKE_THROW_UNLESS(system_->get_num_input_ports() <= 1);
@@ -44,24 +41,72 @@ DirectCollocationConstraint::DirectCollocationConstraint(
   // TODO(russt): Add support for time-varying dynamics OR check for
   // time-invariance.
 
-  context_->SetTimeStateAndParametersFrom(context);
+  // Each defect depends on every state and input through the dynamics at the
+  // collocation point, so the gradient is dense and no sparsity pattern is
+  // declared.
 
-  if (context.get_num_input_ports() > 0) {
+  // Don't allocate the input port until we're past the point where we might
+  // throw. One workspace suffices unless the constraint is evaluated
+  // concurrently.
+  ReleaseWorkspace(AcquireWorkspace());
+}
+
+std::unique_ptr<DirectCollocationConstraint::Workspace>
+DirectCollocationConstraint::AcquireWorkspace() const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!workspaces_.empty()) {
+      std::unique_ptr<Workspace> workspace = std::move(workspaces_.back());
+      workspaces_.pop_back();
+      return workspace;
+    }
+  }
+  auto workspace = std::make_unique<Workspace>();
+  workspace->context = system_->CreateDefaultContext();
+  workspace->context->SetTimeStateAndParametersFrom(*context_);
+  if (workspace->context->get_num_input_ports() > 0) {
     // Allocate the input port and keep an alias around.
-    input_port_value_ = &context_->FixInputPort(
+    workspace->input_port_value = &workspace->context->FixInputPort(
         0, system_->AllocateInputVector(system_->get_input_port(0)));
   }
+  workspace->derivatives = system_->AllocateTimeDerivatives();
+  return workspace;
+}
+
+void DirectCollocationConstraint::ReleaseWorkspace(
+    std::unique_ptr<Workspace> workspace) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  workspaces_.push_back(std::move(workspace));
 }
 
+class DirectCollocationConstraint::ScopedWorkspace {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedWorkspace)
+
+  explicit ScopedWorkspace(const DirectCollocationConstraint* owner)
+      : owner_(owner), workspace_(owner->AcquireWorkspace()) {}
+
+  ~ScopedWorkspace() { owner_->ReleaseWorkspace(std::move(workspace_)); }
+
+  Workspace* get() const { return workspace_.get(); }
+
+ private:
+  const DirectCollocationConstraint* const owner_;
+  std::unique_ptr<Workspace> workspace_;
+};
+
 void DirectCollocationConstraint::dynamics(const AutoDiffVecXd& state,
                                            const AutoDiffVecXd& input,
+                                           Workspace* workspace,
                                            AutoDiffVecXd* xdot) const {
-  if (context_->get_num_input_ports() > 0) {
-    input_port_value_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(input);
+  Context<AutoDiffXd>& context = *workspace->context;
+  if (context.get_num_input_ports() > 0) {
+    workspace->input_port_value->GetMutableVectorData<AutoDiffXd>()
+        ->SetFromVector(input);
   }
-  context_->get_mutable_continuous_state().SetFromVector(state);
-  system_->CalcTimeDerivatives(*context_, derivatives_.get());
-  *xdot = derivatives_->CopyToVector();
+  context.get_mutable_continuous_state().SetFromVector(state);
+  system_->CalcTimeDerivatives(context, workspace->derivatives.get());
+  *xdot = workspace->derivatives->CopyToVector();
 }
 
 void DirectCollocationConstraint::DoEval(
@@ -89,15 +134,19 @@ void DirectCollocationConstraint::DoEval(
   const auto u0 = x.segment(1 + (2 * num_states_), num_inputs_);
   const auto u1 = x.segment(1 + (2 * num_states_) + num_inputs_, num_inputs_);
 
+  // The system is evaluated in a workspace of its own, so that the constraint
+  // can be evaluated concurrently for several bindings.
+  const ScopedWorkspace workspace(this);
+
   // TODO(sam.creasey): Use caching (when it arrives) to avoid recomputing
   // the dynamics.  Currently the dynamics evaluated here as {u1,x1} are
   // recomputed in the next constraint as {u0,x0}.
   AutoDiffVecXd xdot0;
-  dynamics(x0, u0, &xdot0);
+  dynamics(x0, u0, workspace.get(), &xdot0);
   const Eigen::MatrixXd dxdot0 = math::autoDiffToGradientMatrix(xdot0);
 
   AutoDiffVecXd xdot1;
-  dynamics(x1, u1, &xdot1);
+  dynamics(x1, u1, workspace.get(), &xdot1);
   const Eigen::MatrixXd dxdot1 = math::autoDiffToGradientMatrix(xdot1);
 
   // Cubic interpolation to get xcol and xdotcol.
@@ -105,7 +154,7 @@ void DirectCollocationConstraint::DoEval(
   const AutoDiffVecXd xdotcol = -1.5 * (x0 - x1) / h - .25 * (xdot0 + xdot1);
 
   AutoDiffVecXd g;
-  dynamics(xcol, 0.5 * (u0 + u1), &g);
+  dynamics(xcol, 0.5 * (u0 + u1), workspace.get(), &g);
   y = xdotcol - g;
 }
 
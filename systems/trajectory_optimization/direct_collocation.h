@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/solvers/constraint.h"
@@ -78,7 +80,9 @@ class DirectCollocation : public MultipleShooting {
 ///
 /// Note that the DirectCollocation implementation allocates only ONE of
 /// these constraints, but binds that constraint multiple times (with
-/// different decision variables, along the trajectory).
+/// different decision variables, along the trajectory). The constraint may
+/// be evaluated concurrently for several bindings; each evaluation then uses
+/// its own context of the system.
 
 class DirectCollocationConstraint : public solvers::Constraint {
  public:
@@ -105,16 +109,39 @@ class DirectCollocationConstraint : public solvers::Constraint {
                               const Context<double>& context, int num_states,
                               int num_inputs);
 
+  // The context, with an alias of its input port, and the derivatives in
+  // which dynamics() evaluates the system.
+  struct Workspace {
+    std::unique_ptr<Context<AutoDiffXd>> context;
+    FreestandingInputPortValue* input_port_value{nullptr};
+    std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives;
+  };
+
+  // Returns a workspace that is not in use by another evaluation, allocating
+  // one if needed.
+  std::unique_ptr<Workspace> AcquireWorkspace() const;
+
+  // Returns the workspace to the pool, for reuse by the next evaluations.
+  void ReleaseWorkspace(std::unique_ptr<Workspace> workspace) const;
+
+  // Holds a workspace acquired from the pool and returns it to the pool when
+  // it goes out of scope, also when the evaluation throws.
+  class ScopedWorkspace;
+
   void dynamics(const AutoDiffVecXd& state, const AutoDiffVecXd& input,
-                AutoDiffVecXd* xdot) const;
+                Workspace* workspace, AutoDiffVecXd* xdot) const;
 
   std::unique_ptr<System<AutoDiffXd>> system_;
-  std::unique_ptr<Context<AutoDiffXd>> context_;
-  FreestandingInputPortValue* input_port_value_{nullptr};
-  std::unique_ptr<ContinuousState<AutoDiffXd>> derivatives_;
+  // The time and parameters of the system, with which the context of every
+  // workspace is initialized.
+  std::unique_ptr<Context<double>> context_;
 
   const int num_states_{0};
   const int num_inputs_{0};
+
+  // The workspaces that are not in use, guarded by mutex_.
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<Workspace>> workspaces_;
 };
 
 /// Helper method to add a DirectCollocationConstraint to the @p prog,
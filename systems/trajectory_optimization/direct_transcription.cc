@@ -52,6 +52,23 @@ class DiscreteTimeSystemConstraint : public solvers::Constraint {
     // Makes sure the autodiff vector is properly initialized.
     evaluation_time_.derivatives().resize(2 * num_states_ + num_inputs_);
     evaluation_time_.derivatives().setZero();
+
+    // Each output depends on the input, the state and only the matching
+    // element of the next state, so that the elements of the next state share
+    // a single derivative when the solver evaluates the gradient.
+    std::vector<std::pair<int, int>> gradient_sparsity_pattern;
+    gradient_sparsity_pattern.reserve(num_states_ *
+                                      (num_inputs_ + num_states_ + 1));
+    for (int i = 0; i < num_states_; ++i) {
+      for (int j = 0; j < num_inputs_ + num_states_; ++j) {
+        gradient_sparsity_pattern.emplace_back(i, j);
+      }
+      gradient_sparsity_pattern.emplace_back(i, num_inputs_ + num_states_ + i);
+    }
+    SetGradientSparsityPattern(gradient_sparsity_pattern);
+
+    // All the constraints of a DirectTranscription share the same context.
+    set_is_thread_safe(false);
   }
 
   ~DiscreteTimeSystemConstraint() override = default;
@@ -14,7 +14,11 @@ PositionConstraintForceEvaluator::PositionConstraintForceEvaluator(
     : GeneralizedConstraintForceEvaluator(
           tree, tree.get_num_positions() + tree.getNumPositionConstraints(),
           tree.getNumPositionConstraints()),
-      kinematics_cache_helper_(kinematics_cache_helper) {}
+      kinematics_cache_helper_(kinematics_cache_helper) {
+  // Evaluating the constraint Jacobian updates the kinematics cache shared
+  // through kinematics_cache_helper.
+  set_is_thread_safe(false);
+}
 
 Eigen::MatrixXd PositionConstraintForceEvaluator::EvalConstraintJacobian(
     const Eigen::Ref<const Eigen::VectorXd>& x) const {
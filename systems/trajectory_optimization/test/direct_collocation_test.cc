@@ -9,6 +9,7 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff.h"
 #include "drake/solvers/ipopt_solver.h"
+#include "drake/solvers/parallel_evaluation.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
@@ -267,6 +268,31 @@ GTEST_TEST(DirectCollocationTest, AddDirectCollocationConstraint) {
   EXPECT_TRUE(val.isZero());
 }
 
+// Evaluates the constraint concurrently, as a solver evaluating the bindings
+// of a program in parallel does, and compares with sequential evaluations.
+GTEST_TEST(DirectCollocationTest, ConcurrentEvaluation) {
+  const std::unique_ptr<LinearSystem<double>> system = MakeSimpleLinearSystem();
+  const auto context = system->CreateDefaultContext();
+  const DirectCollocationConstraint constraint(*system, *context);
+  EXPECT_TRUE(constraint.is_thread_safe());
+
+  const int kNumEvaluations = 40;
+  std::vector<Eigen::VectorXd> x(kNumEvaluations);
+  std::vector<Eigen::VectorXd> y_expected(kNumEvaluations);
+  for (int i = 0; i < kNumEvaluations; ++i) {
+    x[i] = Eigen::VectorXd::LinSpaced(constraint.num_vars(), 0.1, i + 1.0);
+    constraint.Eval(x[i], y_expected[i]);
+  }
+  std::vector<Eigen::VectorXd> y(kNumEvaluations);
+  drake::internal::ThreadPool pool(4);
+  solvers::internal::EvaluateInParallel(
+      kNumEvaluations, &pool, [](int) { return true; },
+      [&](int i) { constraint.Eval(x[i], y[i]); });
+  for (int i = 0; i < kNumEvaluations; ++i) {
+    EXPECT_TRUE(CompareMatrices(y[i], y_expected[i]));
+  }
+}
+
 }  // anonymous namespace
 }  // namespace trajectory_optimization
 }  // namespace systems
@@ -88,9 +88,13 @@
     "//common:symbolic_decompose",
     "//common:temp_directory",
     "//common:text_logging_gflags_h",
+    "//common:thread_pool",
     "//common:type_safe_index",
     "//common:unused",
     "//geometry/query_results:penetration_as_point_pair",
+    "//geometry/query_results:signed_distance_pair",
+    "//geometry/query_results:signed_distance_to_point",
+    "//geometry:collision_filter_groups",
     "//geometry:frame_kinematics",
     "//geometry:geometry_context",
     "//geometry:geometry_frame",
@@ -163,6 +167,7 @@
     "//multibody/multibody_tree/math:spatial_momentum",
     "//multibody/multibody_tree/math:spatial_vector",
     "//multibody/multibody_tree/math:spatial_velocity",
+    "//multibody/multibody_tree/multibody_plant:implicit_stribeck_solver",
     "//multibody/multibody_tree/multibody_plant:multibody_plant",
     "//multibody/multibody_tree:articulated_body_inertia",
     "//multibody/multibody_tree:multibody_tree",
@@ -202,8 +207,11 @@
     "//multibody:rigid_body_tree_alias_groups",
     "//multibody:rigid_body_tree_alias_groups_proto",
     "//multibody:rigid_body_tree_construction",
+    "//perception:depth_image_to_point_cloud",
     "//perception:point_cloud",
     "//perception:point_cloud_flags",
+    "//perception:point_cloud_processing",
+    "//solvers:active_set_qp_solver",
     "//solvers:bilinear_product_util",
     "//solvers:binding",
     "//solvers:branch_and_bound",
@@ -230,12 +238,14 @@
     "//solvers:nlopt_solver",
     "//solvers:non_convex_optimization_util",
     "//solvers:osqp_solver",
+    "//solvers:parametric_coefficients",
     "//solvers:rotation_constraint",
     "//solvers:scs_solver",
     "//solvers:snopt_solver",
     "//solvers:solver_id",
     "//solvers:solver_type",
     "//solvers:solver_type_converter",
+    "//solvers:sparse_and_dense_matrix",
     "//solvers:symbolic_extraction",
     "//solvers:system_identification",
     "//solvers:unrevised_lemke_solver",